@@ -11,7 +11,17 @@ EMSCRIPTEN_BINDINGS(my_module) {
   class_<Universe>("Universe")
       .constructor<int>()
       .function("tick", &Universe::tick)
+      .function("set_flocking_weights", &Universe::set_flocking_weights)
+      .function("set_worker_count", &Universe::set_worker_count)
       .function("get_agent_positions", &Universe::get_agent_positions)
+      // Zero-copy path: JS wraps the returned addresses in Float32Array
+      // views over HEAPF32 instead of marshalling a VectorFloat per frame
+      .function("get_agent_pos_x_ptr", &Universe::get_agent_pos_x_ptr)
+      .function("get_agent_pos_y_ptr", &Universe::get_agent_pos_y_ptr)
+      .function("get_agent_pos_z_ptr", &Universe::get_agent_pos_z_ptr)
+      .function("get_agent_positions_ptr", &Universe::get_agent_positions_ptr)
+      .function("get_agent_positions_length",
+                &Universe::get_agent_positions_length)
       .function("get_planet_data", &Universe::get_planet_data)
       .function("get_agent_count", &Universe::get_agent_count)
       .function("get_planet_count", &Universe::get_planet_count);
@@ -1,18 +1,27 @@
 #include "Universe.h"
 #include <algorithm>
 
-Universe::Universe(int agent_count) {
+Universe::Universe(int agent_count) : agent_count_(agent_count) {
   rng.seed(42);
   std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
   std::uniform_real_distribution<float> color(0.0f, 1.0f);
 
   // Create 1 Million Agents (or subset for demo)
-  agents.resize(agent_count);
-  for (auto &a : agents) {
-    a.pos = {dist(rng), dist(rng), dist(rng)};
-    a.vel = {0, 0, 0};
-    a.energy = 100.0f;
-    a.w_gravity = 1.0f; // Evolve this later
+  pos_x_.resize(agent_count);
+  pos_y_.resize(agent_count);
+  pos_z_.resize(agent_count);
+  vel_x_.assign(agent_count, 0.0f);
+  vel_y_.assign(agent_count, 0.0f);
+  vel_z_.assign(agent_count, 0.0f);
+  energy_.assign(agent_count, 100.0f);
+  w_gravity_.assign(agent_count, 1.0f); // Evolve this later
+  w_cohesion_.assign(agent_count, 0.0f);
+  w_alignment_.assign(agent_count, 0.0f);
+
+  for (int i = 0; i < agent_count; i++) {
+    pos_x_[i] = dist(rng);
+    pos_y_[i] = dist(rng);
+    pos_z_[i] = dist(rng);
   }
 
   // Create Planets
@@ -20,56 +29,298 @@ Universe::Universe(int agent_count) {
   planets.push_back(
       {{60, 0, 0}, 5.0f, 0.1f, 0.0f, 0.0f, 1.0f}); // Blue Gas Giant
   planets.push_back({{-40, 40, 0}, 8.0f, 0.2f, 1.0f, 0.0f, 0.0f}); // Red Dwarf
+  // Spatial grid storage, sized once here and reused every frame
+  grid_starts_.resize(kGridBuckets + 1);
+  grid_entries_.resize(agent_count);
+  grid_bucket_.resize(agent_count);
+  grid_key_.resize(agent_count);
+  grid_px_.resize(agent_count);
+  grid_py_.resize(agent_count);
+  grid_pz_.resize(agent_count);
+  grid_vx_.resize(agent_count);
+  grid_vy_.resize(agent_count);
+  grid_vz_.resize(agent_count);
+  grid_skey_.resize(agent_count);
+  dvel_x_.resize(agent_count);
+  dvel_y_.resize(agent_count);
+  dvel_z_.resize(agent_count);
+  positions_out_.resize(static_cast<std::size_t>(agent_count) * 3);
+
+  (void)color;
+}
+
+void Universe::set_flocking_weights(float cohesion, float alignment) {
+  std::fill(w_cohesion_.begin(), w_cohesion_.end(), cohesion);
+  std::fill(w_alignment_.begin(), w_alignment_.end(), alignment);
+  flocking_enabled_ = (cohesion != 0.0f || alignment != 0.0f);
+}
+
+void Universe::set_worker_count(int workers) {
+  worker_count_ = workers < 1 ? 1 : workers;
+}
+
+namespace {
+inline long long packCell(int cx, int cy, int cz) {
+  const long long mask = 0x1FFFFF;
+  return ((static_cast<long long>(cx) & mask) << 42) |
+         ((static_cast<long long>(cy) & mask) << 21) |
+         (static_cast<long long>(cz) & mask);
+}
+} // namespace
+
+void Universe::rebuildGrid() {
+  const int n = agent_count_;
+  const float inv_cell = 1.0f / kNeighborRadius;
+
+  // Pass 1: bucket each agent and count occupancy
+  std::fill(grid_starts_.begin(), grid_starts_.end(), 0);
+  for (int i = 0; i < n; i++) {
+    const int cx = static_cast<int>(std::floor(pos_x_[i] * inv_cell));
+    const int cy = static_cast<int>(std::floor(pos_y_[i] * inv_cell));
+    const int cz = static_cast<int>(std::floor(pos_z_[i] * inv_cell));
+    grid_bucket_[i] = bucketOf(cx, cy, cz);
+    grid_key_[i] = packCell(cx, cy, cz);
+    grid_starts_[grid_bucket_[i] + 1]++;
+  }
+
+  // Prefix sum -> bucket start offsets
+  for (int b = 0; b < kGridBuckets; b++) {
+    grid_starts_[b + 1] += grid_starts_[b];
+  }
+
+  // Pass 2: scatter agents into bucket order. A reused cursor copy walks
+  // forward so grid_starts_ itself stays intact for queries. The lanes
+  // the query loop reads are copied into bucket order here, so neighbor
+  // scans stream contiguous memory.
+  grid_cursor_.assign(grid_starts_.begin(), grid_starts_.end());
+  for (int i = 0; i < n; i++) {
+    const int slot = grid_cursor_[grid_bucket_[i]]++;
+    grid_entries_[slot] = i;
+    grid_px_[slot] = pos_x_[i];
+    grid_py_[slot] = pos_y_[i];
+    grid_pz_[slot] = pos_z_[i];
+    grid_vx_[slot] = vel_x_[i];
+    grid_vy_[slot] = vel_y_[i];
+    grid_vz_[slot] = vel_z_[i];
+    grid_skey_[slot] = grid_key_[i];
+  }
+}
+
+// Cohesion (steer toward the local centroid) and alignment (match the
+// local average velocity), each agent examining only the 27 cells around
+// its own. Deltas accumulate into scratch lanes and apply after the scan
+// so results do not depend on agent order. The packed-cell key check
+// keeps hash collisions from double-counting a bucket shared by two
+// distinct cells.
+void Universe::applyFlocking(float dt) {
+  // The scan reads the grid lanes as a read-only snapshot and writes
+  // disjoint dvel slots, so it partitions cleanly across workers
+  parallelFor(agent_count_,
+              [this, dt](int begin, int end) { flockRange(begin, end, dt); });
+
+  const int n = agent_count_;
+  for (int i = 0; i < n; i++) {
+    vel_x_[i] += dvel_x_[i];
+  }
+  for (int i = 0; i < n; i++) {
+    vel_y_[i] += dvel_y_[i];
+  }
+  for (int i = 0; i < n; i++) {
+    vel_z_[i] += dvel_z_[i];
+  }
+}
+
+void Universe::flockRange(int q_begin, int q_end, float dt) {
+  const float inv_cell = 1.0f / kNeighborRadius;
+  const float radius_sq = kNeighborRadius * kNeighborRadius;
+  constexpr long long kXStep = 1ll << 42;  // packCell stride between cx cells
+
+  // Candidate entry spans for the current cell, shared by every agent in
+  // it. With the cx-linear hash each (dy, dz) row of three cells is one
+  // contiguous span (kcells = 3) unless the row straddles the table wrap,
+  // which falls back to single-cell spans. An entry inside a span belongs
+  // to the row iff its packed key is k0 plus 0..kcells-1 x-steps.
+  struct Span {
+    int begin, end;
+    long long k0;
+    unsigned kcells;
+  };
+  Span spans[27];
+  int nspans = 0;
+  long long group_key = -1;  // Impossible packed key (high bits set)
+
+  // Walk agents in bucket order: all agents of a cell are consecutive,
+  // so the span set is rebuilt only when the cell changes, and the
+  // sorted lanes stay hot in cache
+  for (int q = q_begin; q < q_end; q++) {
+    const int i = grid_entries_[q];
+    const float xi = grid_px_[q];
+    const float yi = grid_py_[q];
+    const float zi = grid_pz_[q];
+
+    if (grid_skey_[q] != group_key) {
+      group_key = grid_skey_[q];
+      const int cx = static_cast<int>(std::floor(xi * inv_cell));
+      const int cy = static_cast<int>(std::floor(yi * inv_cell));
+      const int cz = static_cast<int>(std::floor(zi * inv_cell));
+      nspans = 0;
+      for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+          const int b0 = bucketOf(cx - 1, cy + dy, cz + dz);
+          const long long k0 = packCell(cx - 1, cy + dy, cz + dz);
+          if (b0 + 2 < kGridBuckets) {
+            spans[nspans++] =
+                Span{grid_starts_[b0], grid_starts_[b0 + 3], k0, 3};
+          } else {
+            for (int dx = 0; dx < 3; dx++) {
+              const int b = bucketOf(cx - 1 + dx, cy + dy, cz + dz);
+              spans[nspans++] = Span{grid_starts_[b], grid_starts_[b + 1],
+                                     k0 + dx * kXStep, 1};
+            }
+          }
+        }
+      }
+    }
+
+    float sum_px = 0, sum_py = 0, sum_pz = 0;
+    float sum_vx = 0, sum_vy = 0, sum_vz = 0;
+    int neighbors = 0;
+
+    for (int s = 0; s < nspans; s++) {
+      const Span &sp = spans[s];
+      // Branch-free accumulate: the radius test fails for most of a
+      // cell's volume, so predicating beats branching here
+      for (int e = sp.begin; e < sp.end; e++) {
+        const unsigned long long kd =
+            static_cast<unsigned long long>(grid_skey_[e] - sp.k0);
+        const bool keyok =
+            ((kd >> 42) < sp.kcells) & ((kd & (kXStep - 1)) == 0);
+        const float ddx = grid_px_[e] - xi;
+        const float ddy = grid_py_[e] - yi;
+        const float ddz = grid_pz_[e] - zi;
+        const bool in = (ddx * ddx + ddy * ddy + ddz * ddz <= radius_sq) &
+                        (e != q) & keyok;
+        const float m = in ? 1.0f : 0.0f;
+        sum_px += grid_px_[e] * m;
+        sum_py += grid_py_[e] * m;
+        sum_pz += grid_pz_[e] * m;
+        sum_vx += grid_vx_[e] * m;
+        sum_vy += grid_vy_[e] * m;
+        sum_vz += grid_vz_[e] * m;
+        neighbors += static_cast<int>(in);
+      }
+    }
+
+    if (neighbors > 0) {
+      const float inv = 1.0f / static_cast<float>(neighbors);
+      dvel_x_[i] = ((sum_px * inv - xi) * w_cohesion_[i] +
+                    (sum_vx * inv - vel_x_[i]) * w_alignment_[i]) *
+                   dt;
+      dvel_y_[i] = ((sum_py * inv - yi) * w_cohesion_[i] +
+                    (sum_vy * inv - vel_y_[i]) * w_alignment_[i]) *
+                   dt;
+      dvel_z_[i] = ((sum_pz * inv - zi) * w_cohesion_[i] +
+                    (sum_vz * inv - vel_z_[i]) * w_alignment_[i]) *
+                   dt;
+    } else {
+      dvel_x_[i] = 0;
+      dvel_y_[i] = 0;
+      dvel_z_[i] = 0;
+    }
+  }
 }
 
 void Universe::tick(float dt) {
-  for (auto &a : agents) {
-    // 1. Gravity from Planets
-    for (const auto &p : planets) {
-      float dx = p.position.x - a.pos.x;
-      float dy = p.position.y - a.pos.y;
-      float dz = p.position.z - a.pos.z;
-      float distSq = dx * dx + dy * dy + dz * dz;
-      float dist = std::sqrt(distSq);
-
-      // F = G * m1 * m2 / r^2
-      if (dist > p.radius) {
-        float force = (p.gravity * 10.0f) / distSq;
-        a.vel.x += (dx / dist) * force * dt;
-        a.vel.y += (dy / dist) * force * dt;
-        a.vel.z += (dz / dist) * force * dt;
+  const int n = agent_count_;
+
+  // 0. Flocking (cohesion/alignment over grid neighbors)
+  if (flocking_enabled_) {
+    rebuildGrid();
+    applyFlocking(dt);
+  }
+
+  // 1. Gravity from Planets, partitioned across workers (each agent's
+  // state is independent of every other's during this phase)
+  parallelFor(n,
+              [this, dt](int begin, int end) { gravityRange(begin, end, dt); });
+  // 2. Integration + 3. Drag — pure dense lanes, one stream per array
+  for (int i = 0; i < n; i++) {
+    pos_x_[i] += vel_x_[i] * dt;
+  }
+  for (int i = 0; i < n; i++) {
+    pos_y_[i] += vel_y_[i] * dt;
+  }
+  for (int i = 0; i < n; i++) {
+    pos_z_[i] += vel_z_[i] * dt;
+  }
+  for (int i = 0; i < n; i++) {
+    vel_x_[i] *= 0.99f;
+  }
+  for (int i = 0; i < n; i++) {
+    vel_y_[i] *= 0.99f;
+  }
+  for (int i = 0; i < n; i++) {
+    vel_z_[i] *= 0.99f;
+  }
+}
+
+// Planet-outer so the inner loop runs straight down the SoA lanes; per
+// agent the planets are still visited in order, so results match the old
+// per-agent loop exactly. The surface-bounce branch is rare (agents
+// inside a planet), leaving the gravity path a dense vectorizable body.
+void Universe::gravityRange(int begin, int end, float dt) {
+  for (const auto &p : planets) {
+    const float px = p.position.x;
+    const float py = p.position.y;
+    const float pz = p.position.z;
+    const float radius = p.radius;
+    const float g10 = p.gravity * 10.0f;
+
+    for (int i = begin; i < end; i++) {
+      const float dx = px - pos_x_[i];
+      const float dy = py - pos_y_[i];
+      const float dz = pz - pos_z_[i];
+      const float distSq = dx * dx + dy * dy + dz * dz;
+      const float dist = std::sqrt(distSq);
+
+      // F = G * m1 * m2 / r^2, scaled by the agent's gravity weight
+      if (dist > radius) {
+        const float force = (g10 / distSq) * w_gravity_[i];
+        vel_x_[i] += (dx / dist) * force * dt;
+        vel_y_[i] += (dy / dist) * force * dt;
+        vel_z_[i] += (dz / dist) * force * dt;
       } else {
         // Bounce / Surface friction
-        a.vel.x *= -0.5f;
-        a.vel.y *= -0.5f;
-        a.vel.z *= -0.5f;
+        vel_x_[i] *= -0.5f;
+        vel_y_[i] *= -0.5f;
+        vel_z_[i] *= -0.5f;
         // Push out
-        float push = (p.radius - dist) + 0.1f;
-        a.pos.x -= (dx / dist) * push;
-        a.pos.y -= (dy / dist) * push;
-        a.pos.z -= (dz / dist) * push;
+        const float push = (radius - dist) + 0.1f;
+        pos_x_[i] -= (dx / dist) * push;
+        pos_y_[i] -= (dy / dist) * push;
+        pos_z_[i] -= (dz / dist) * push;
       }
     }
+  }
+}
 
-    // 2. Integration
-    a.pos.x += a.vel.x * dt;
-    a.pos.y += a.vel.y * dt;
-    a.pos.z += a.vel.z * dt;
-
-    // 3. Drag
-    a.vel.x *= 0.99f;
-    a.vel.y *= 0.99f;
-    a.vel.z *= 0.99f;
+std::uintptr_t Universe::get_agent_positions_ptr() {
+  const int n = agent_count_;
+  for (int i = 0; i < n; i++) {
+    positions_out_[3 * i + 0] = pos_x_[i];
+    positions_out_[3 * i + 1] = pos_y_[i];
+    positions_out_[3 * i + 2] = pos_z_[i];
   }
+  return reinterpret_cast<std::uintptr_t>(positions_out_.data());
 }
 
 std::vector<float> Universe::get_agent_positions() const {
   std::vector<float> data;
-  data.reserve(agents.size() * 3);
-  for (const auto &a : agents) {
-    data.push_back(a.pos.x);
-    data.push_back(a.pos.y);
-    data.push_back(a.pos.z);
+  data.reserve(static_cast<std::size_t>(agent_count_) * 3);
+  for (int i = 0; i < agent_count_; i++) {
+    data.push_back(pos_x_[i]);
+    data.push_back(pos_y_[i]);
+    data.push_back(pos_z_[i]);
   }
   return data;
 }
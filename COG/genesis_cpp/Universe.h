@@ -1,7 +1,9 @@
 #pragma once
 #include <vector>
 #include <cmath>
+#include <cstdint>
 #include <random>
+#include <thread>
 
 struct Vec3 {
     float x, y, z;
@@ -14,29 +16,156 @@ struct Planet {
     float r, g, b;
 };
 
-struct Agent {
-    Vec3 pos;
-    Vec3 vel;
-    float energy;
-    // Brain weights
-    float w_gravity;
-    float w_cohesion;
-    float w_alignment;
-};
-
 class Universe {
 public:
     Universe(int agent_count);
     void tick(float dt);
-    
+
+    // Non-owning accessor view over one agent's lanes in the SoA arrays.
+    // Replaces the old interleaved Agent value struct — same fields, but
+    // the storage behind them is one contiguous array per field.
+    struct Agent {
+        float &pos_x, &pos_y, &pos_z;
+        float &vel_x, &vel_y, &vel_z;
+        float &energy;
+        float &w_gravity;
+        float &w_cohesion;
+        float &w_alignment;
+    };
+
+    Agent agent(int i) {
+        return Agent{pos_x_[i], pos_y_[i], pos_z_[i],
+                     vel_x_[i], vel_y_[i], vel_z_[i],
+                     energy_[i],
+                     w_gravity_[i], w_cohesion_[i], w_alignment_[i]};
+    }
+
+    // Enable flocking: sets every agent's cohesion/alignment weight.
+    // Both zero (the default) skips the neighbor pass entirely.
+    void set_flocking_weights(float cohesion, float alignment);
+
+    // Number of worker threads for the per-agent phases of tick()
+    // (gravity and the flocking scan). 1 (the default) runs serial.
+    // Requires the WASM threads build when targeting the browser.
+    void set_worker_count(int workers);
+
     // Data Access for JS
     std::vector<float> get_agent_positions() const;
     std::vector<float> get_planet_data() const;
-    int get_agent_count() const { return agents.size(); }
+
+    // Zero-copy access across the WASM boundary. The SoA lanes are
+    // stable heap buffers for the Universe's lifetime, so JS can view
+    // them directly: new Float32Array(HEAPF32.buffer, ptr, count) — no
+    // per-frame allocation or marshalling. For consumers that want
+    // interleaved xyz (GL attribute streams), get_agent_positions_ptr()
+    // packs the lanes into one persistent buffer (a single linear pass,
+    // still no allocation) and returns its address.
+    std::uintptr_t get_agent_pos_x_ptr() const {
+        return reinterpret_cast<std::uintptr_t>(pos_x_.data());
+    }
+    std::uintptr_t get_agent_pos_y_ptr() const {
+        return reinterpret_cast<std::uintptr_t>(pos_y_.data());
+    }
+    std::uintptr_t get_agent_pos_z_ptr() const {
+        return reinterpret_cast<std::uintptr_t>(pos_z_.data());
+    }
+    std::uintptr_t get_agent_positions_ptr();
+    int get_agent_positions_length() const { return agent_count_ * 3; }
+    int get_agent_count() const { return agent_count_; }
     int get_planet_count() const { return planets.size(); }
 
 private:
-    std::vector<Agent> agents;
+    // Agent state, structure-of-arrays: each field is its own contiguous
+    // lane so tick()'s per-planet and integration loops vectorize across
+    // agents instead of striding over interleaved structs.
+    int agent_count_ = 0;
+    std::vector<float> pos_x_, pos_y_, pos_z_;
+    std::vector<float> vel_x_, vel_y_, vel_z_;
+    std::vector<float> energy_;
+    // Brain weights
+    std::vector<float> w_gravity_;
+    std::vector<float> w_cohesion_;
+    std::vector<float> w_alignment_;
+
+    // Uniform spatial hash grid for neighbor queries, rebuilt per frame.
+    // Cells of kNeighborRadius hash into a fixed power-of-two bucket
+    // table laid out counting-sort style (prefix-summed starts + ordered
+    // agent ids), so a frame's grid is two passes over the agents and
+    // each query touches only the 27 surrounding cells — flocking cost is
+    // O(N) instead of the O(N^2) all-pairs scan. All storage is sized
+    // once and reused; no per-frame allocation.
+    static constexpr int kGridBuckets = 131072;
+    static constexpr float kNeighborRadius = 5.0f;
+
+    void rebuildGrid();
+    void applyFlocking(float dt);
+    void flockRange(int q_begin, int q_end, float dt);
+    void gravityRange(int begin, int end, float dt);
+
+    // Run fn(begin, end) over agent ranges, one per worker, joined before
+    // returning. Workers only read shared state (planets, grid lanes) and
+    // write disjoint per-agent slots, so ranges need no synchronization
+    // beyond the join. Serial when worker_count_ is 1.
+    template <typename Fn>
+    void parallelFor(int n, Fn fn) {
+        if (worker_count_ <= 1 || n < worker_count_) {
+            fn(0, n);
+            return;
+        }
+        const int chunk = (n + worker_count_ - 1) / worker_count_;
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count_ - 1);
+        for (int w = 1; w < worker_count_; w++) {
+            const int begin = w * chunk;
+            const int end = begin + chunk < n ? begin + chunk : n;
+            if (begin >= end) {
+                break;
+            }
+            workers.emplace_back([fn, begin, end]() { fn(begin, end); });
+        }
+        fn(0, chunk);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    int worker_count_ = 1;
+
+    // The hash is linear in cx: buckets of an x-run of cells are
+    // consecutive table slots, so a query's (dy, dz) row of three cells
+    // is normally one contiguous entry span — one probe instead of three.
+    static unsigned rowBase(int cy, int cz) {
+        unsigned h = static_cast<unsigned>(cy) * 19349663u ^
+                     static_cast<unsigned>(cz) * 83492791u;
+        h ^= h >> 16;
+        h *= 0x45d9f3bu;
+        h ^= h >> 16;
+        return h;
+    }
+
+    static int bucketOf(int cx, int cy, int cz) {
+        return static_cast<int>((rowBase(cy, cz) + static_cast<unsigned>(cx)) &
+                                (kGridBuckets - 1));
+    }
+
+    bool flocking_enabled_ = false;
+    std::vector<int> grid_starts_;   // kGridBuckets + 1 prefix-summed offsets
+    std::vector<int> grid_entries_;  // Agent ids ordered by bucket
+    std::vector<int> grid_bucket_;   // Per-agent bucket id
+    std::vector<long long> grid_key_;  // Per-agent packed cell coords
+                                       // (disambiguates bucket collisions)
+    std::vector<int> grid_cursor_;   // Scatter cursor reused per rebuild
+    // Bucket-sorted copies of the lanes the query loop reads, built
+    // during the scatter pass: neighbor scans then stream contiguous
+    // memory instead of gathering through the entry table
+    std::vector<float> grid_px_, grid_py_, grid_pz_;
+    std::vector<float> grid_vx_, grid_vy_, grid_vz_;
+    std::vector<long long> grid_skey_;
+    std::vector<float> dvel_x_, dvel_y_, dvel_z_;  // Flocking deltas
+
+    // Persistent interleaved xyz buffer behind get_agent_positions_ptr()
+    std::vector<float> positions_out_;
+
     std::vector<Planet> planets;
     std::mt19937 rng;
 };
@@ -30,6 +30,7 @@ extern int rse_os_user_ranges(uint64_t *code_start, uint64_t *code_end,
                               uint64_t *stack_start, uint64_t *stack_end);
 extern uint64_t rse_os_user_translate(uint64_t vaddr);
 extern uint64_t rse_os_user_flags(uint64_t vaddr);
+extern int rse_os_user_fault_in(uint64_t vaddr, int write);
 extern int rse_os_prepare_ring3(uint32_t torus_id);
 extern int64_t rse_os_syscall_dispatch(int64_t num,
                                        uint64_t arg1, uint64_t arg2,
@@ -73,10 +74,20 @@ static volatile struct limine_stack_size_request stack_size_request = {
     .stack_size = 1024 * 1024
 };
 
+__attribute__((used, section(".limine_reqs")))
+static volatile struct limine_smp_request smp_request = {
+    .id = LIMINE_SMP_REQUEST,
+    .revision = 0,
+    .flags = 0
+};
+
 __attribute__((used, section(".limine_reqs")))
 LIMINE_REQUESTS_END_MARKER;
 
+void serial_flush(void);
+
 static inline void hlt_loop(void) {
+    serial_flush();
     for (;;) {
         __asm__ volatile("cli; hlt");
     }
@@ -113,6 +124,7 @@ static inline uint32_t inl(uint16_t port) {
 }
 
 static inline void rse_poweroff(void) {
+    serial_flush();
     outw(0x604, 0x2000);
     outw(0xB004, 0x2000);
     outw(0x4004, 0x3400);
@@ -142,6 +154,49 @@ static void serial_write_char(char c) {
     outb(0x3F8, (uint8_t)c);
 }
 
+/* ========== Buffered serial output ==========
+ *
+ * Waiting on the UART transmit-empty bit at 115200 baud is slow enough
+ * that log lines landing inside a benchmark loop get charged to the
+ * workload being measured. serial_write therefore costs only a ring
+ * copy; the UART is drained opportunistically in bounded slices from
+ * the idle/event loops, with full flushes at benchmark boundaries and
+ * on the exception path so crash output is never lost. When the ring
+ * wraps, the oldest bytes are overwritten — the most recent output is
+ * the part worth keeping after a hang.
+ */
+#define SERIAL_RING_SIZE 65536u /* power of two */
+
+static char g_serial_ring[SERIAL_RING_SIZE];
+static volatile uint32_t g_serial_ring_head = 0; /* next byte to drain */
+static volatile uint32_t g_serial_ring_tail = 0; /* next byte to write */
+static uint64_t g_serial_ring_dropped = 0;
+
+static void serial_ring_push(char c) {
+    uint32_t tail = g_serial_ring_tail;
+    if (tail - g_serial_ring_head >= SERIAL_RING_SIZE) {
+        g_serial_ring_head = g_serial_ring_head + 1;
+        g_serial_ring_dropped++;
+    }
+    g_serial_ring[tail & (SERIAL_RING_SIZE - 1)] = c;
+    g_serial_ring_tail = tail + 1;
+}
+
+void serial_drain(uint32_t max_bytes) {
+    while (max_bytes > 0 && g_serial_ring_head != g_serial_ring_tail) {
+        serial_write_char(g_serial_ring[g_serial_ring_head & (SERIAL_RING_SIZE - 1)]);
+        g_serial_ring_head = g_serial_ring_head + 1;
+        max_bytes--;
+    }
+}
+
+void serial_flush(void) {
+    while (g_serial_ring_head != g_serial_ring_tail) {
+        serial_write_char(g_serial_ring[g_serial_ring_head & (SERIAL_RING_SIZE - 1)]);
+        g_serial_ring_head = g_serial_ring_head + 1;
+    }
+}
+
 static void ui_console_write(const char *s);
 
 void serial_write(const char *s) {
@@ -150,7 +205,7 @@ void serial_write(const char *s) {
     }
     ui_console_write(s);
     while (*s) {
-        serial_write_char(*s++);
+        serial_ring_push(*s++);
     }
 }
 
@@ -166,7 +221,7 @@ void serial_write_u64(uint64_t value) {
         value /= 10;
     }
     while (i-- > 0) {
-        serial_write_char(buf[i]);
+        serial_ring_push(buf[i]);
     }
 }
 
@@ -479,6 +534,7 @@ static void exception_dump(const char *label, struct exc_frame *frame, uint64_t
         serial_write_u64(cr2);
     }
     serial_write("\n");
+    serial_flush();
 }
 
 static void exception_return_to_kernel(struct exc_frame *frame) {
@@ -500,8 +556,14 @@ __attribute__((used)) static void gp_handler(struct exc_frame *frame) {
     exception_return_to_kernel(frame);
 }
 
+static int user_demand_page_in(uint64_t vaddr, int write);
+
 __attribute__((used)) static void pf_handler(struct exc_frame *frame) {
     uint64_t cr2 = read_cr2();
+    if (frame && (frame->cs & 0x3) == 0x3 &&
+        user_demand_page_in(cr2, (frame->error_code & 0x2) != 0)) {
+        return;  /* mapping repaired; retry the faulting access */
+    }
     exception_dump("#PF", frame, cr2);
     exception_return_to_kernel(frame);
 }
@@ -689,6 +751,31 @@ static void map_user_range(uint64_t start, uint64_t end, uint64_t flags) {
     }
 }
 
+/* Service a user-mode #PF on a demand-paged address: have the OS layer
+ * materialize the frame (allocate + zero on first touch), then patch the
+ * hardware page table in place and invalidate the stale translation so
+ * the faulting instruction can retry. Returns 0 for genuine faults. */
+static int user_demand_page_in(uint64_t vaddr, int write) {
+    const uint64_t user_max = USER_VADDR_BASE + USER_WINDOW_SIZE;
+    if (vaddr < USER_VADDR_BASE || vaddr >= user_max) {
+        return 0;
+    }
+    if (!rse_os_user_fault_in(vaddr, write)) {
+        return 0;
+    }
+    uint64_t phys = rse_os_user_translate(vaddr);
+    if (!phys) {
+        return 0;
+    }
+    uint64_t pte_flags = user_flags_to_pte(rse_os_user_flags(vaddr));
+    if (pte_flags == 0) {
+        return 0;
+    }
+    map_user_pt_entry(vaddr, phys, pte_flags);
+    __asm__ volatile("invlpg (%0)" : : "r"(vaddr) : "memory");
+    return 1;
+}
+
 static bool build_user_page_table(uint64_t code_vaddr, uint64_t stack_vaddr,
                                   uint64_t code_phys, uint64_t stack_phys) {
     memset(g_user_pml4, 0, 4096u);
@@ -3881,6 +3968,62 @@ static void bench_fastio(void) {
     serial_write("\n");
 }
 
+/* ========== SMP bring-up ==========
+ *
+ * Limine parks every AP in a spin loop waiting on its goto_address slot
+ * and hands each one a dedicated stack sized by stack_size_request, so
+ * per-core stacks need no setup here. rse_smp_start_workers releases up
+ * to max_workers APs straight into the C++ braid worker loop, passing
+ * the worker index through extra_argument; each released AP bumps the
+ * online counter before entering its loop so the BSP can wait for the
+ * fleet to be up before publishing work.
+ */
+extern void rse_braid_ap_main(uint32_t worker_index);
+
+static volatile uint32_t g_smp_online = 0;
+
+static void smp_ap_entry(struct limine_smp_info *info) {
+    __atomic_add_fetch(&g_smp_online, 1, __ATOMIC_SEQ_CST);
+    rse_braid_ap_main((uint32_t)info->extra_argument);
+    hlt_loop();
+}
+
+uint32_t rse_smp_cpu_count(void) {
+    struct limine_smp_response *resp = smp_request.response;
+    return resp ? (uint32_t)resp->cpu_count : 1u;
+}
+
+/* Release up to max_workers APs into rse_braid_ap_main(0..n-1) and wait
+ * until they are online. Returns the number released: 0 on single-core
+ * hardware or when the bootloader gave no SMP response. goto_address is
+ * a one-shot handoff, so this must be called at most once. */
+uint32_t rse_smp_start_workers(uint32_t max_workers) {
+    struct limine_smp_response *resp = smp_request.response;
+    if (!resp || !resp->cpus || resp->cpu_count <= 1) {
+        serial_write("[RSE] smp unavailable (single core or no response)\n");
+        return 0;
+    }
+    uint32_t started = 0;
+    for (uint64_t i = 0; i < resp->cpu_count && started < max_workers; ++i) {
+        struct limine_smp_info *cpu = resp->cpus[i];
+        if (!cpu || cpu->lapic_id == resp->bsp_lapic_id) {
+            continue;
+        }
+        cpu->extra_argument = started;
+        __atomic_store_n(&cpu->goto_address, smp_ap_entry, __ATOMIC_SEQ_CST);
+        ++started;
+    }
+    while (__atomic_load_n(&g_smp_online, __ATOMIC_SEQ_CST) < started) {
+        __asm__ volatile("pause");
+    }
+    serial_write("[RSE] smp workers online=");
+    serial_write_u64(started);
+    serial_write(" cpus=");
+    serial_write_u64(resp->cpu_count);
+    serial_write("\n");
+    return started;
+}
+
 static void init_workloads(void) {
     if (g_os_initialized) {
         serial_write("[RSE] init workloads skipped (already ready)\n");
@@ -4212,6 +4355,7 @@ static void run_benchmarks(struct rse_boot_info *boot_info, int do_init) {
     bench_udp_http_server();
     bench_http_loopback();
     serial_write("[RSE] benchmarks end\n");
+    serial_flush();
     g_metrics.metrics_valid = 1;
 }
 
@@ -4791,6 +4935,7 @@ static void ui_event_loop(struct rse_boot_info *boot_info) {
 
     for (;;) {
         int needs_redraw = 0;
+        serial_drain(256);
         if (g_pointer) {
             EFI_SIMPLE_POINTER_STATE state;
             EFI_STATUS status = g_pointer->GetState(g_pointer, &state);
@@ -176,6 +176,20 @@ extern "C" uint64_t rse_os_user_flags(uint64_t vaddr) {
     return flags;
 }
 
+// Ring3 demand-fault service: materialize the page backing `vaddr`
+// (demand mapping, deferred zero, or copy-on-write) and report whether
+// a retry can succeed. kernel.c re-maps the repaired frame into the
+// hardware table before returning to the faulting instruction.
+extern "C" int rse_os_user_fault_in(uint64_t vaddr, int write) {
+    os::OSProcess* proc = g_ring3_proc ? g_ring3_proc : user_procs[0][0];
+    if (!proc || !proc->vmem || !proc->memory.page_table) {
+        return 0;
+    }
+    uint64_t page = os::align_down(vaddr);
+    proc->vmem->faultIn(page, write != 0);
+    return proc->memory.page_table->translate(page) != 0;
+}
+
 
 static void user_log_prefix(os::OSProcess* proc, const rse_syscalls* sys, const char* tag) {
     if (!proc || !sys || !tag) {
@@ -573,7 +587,29 @@ static os::OSProcess* create_ring3_process(uint32_t pid, uint32_t parent_pid) {
 }
 
 
+// Lazy subsystem bring-up (defined after TorusRuntime): the first touch
+// of a persistent path or the net device pays the probe cost, not boot.
+static void ensure_blockfs(uint32_t torus_id);
+static void ensure_net(uint32_t torus_id);
+
+static bool path_has_prefix(const char* path, const char* prefix) {
+    if (!path || !prefix) {
+        return false;
+    }
+    while (*prefix) {
+        if (*path++ != *prefix++) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static int os_open_shim(const char *name, uint32_t flags) {
+    if (path_has_prefix(name, "/persist")) {
+        ensure_blockfs(current_torus_id);
+    } else if (path_has_prefix(name, "/dev/net")) {
+        ensure_net(current_torus_id);
+    }
     return (int)os::syscall(os::SYS_OPEN, (uint64_t)name, flags, 0644);
 }
 
@@ -598,10 +634,16 @@ static int os_lseek_shim(int fd, int64_t offset, int whence) {
 }
 
 static int os_list_shim(const char *path, char *buf, uint32_t len) {
+    if (path_has_prefix(path, "/persist")) {
+        ensure_blockfs(current_torus_id);
+    }
     return (int)os::syscall(os::SYS_LIST, (uint64_t)path, (uint64_t)buf, len);
 }
 
 static int os_stat_shim(const char *path, struct rse_stat *out) {
+    if (path_has_prefix(path, "/persist")) {
+        ensure_blockfs(current_torus_id);
+    }
     return (int)os::syscall(os::SYS_STAT, (uint64_t)path, (uint64_t)out);
 }
 extern "C" void init_main(const struct rse_syscalls *sys);
@@ -610,6 +652,87 @@ extern "C" int rse_block_init(void);
 extern "C" uint32_t rse_block_size(void);
 extern "C" uint64_t rse_block_total_blocks(void);
 extern "C" int rse_net_init(void);
+extern "C" uint32_t rse_smp_start_workers(uint32_t max_workers);
+
+// Boot phase profiling: one serial line per phase with the cycle delta
+// since the previous mark and the running total since the first, so a
+// slow phase shows up in the log without a debugger attached.
+static uint64_t g_boot_epoch = 0;
+static uint64_t g_boot_phase_start = 0;
+
+static void boot_phase_mark(const char* phase) {
+    const uint64_t now = kernel_rdtsc();
+    if (g_boot_epoch == 0) {
+        g_boot_epoch = now;
+        g_boot_phase_start = now;
+    }
+    serial_write("[BOOT] ");
+    serial_write(phase);
+    serial_write(" +");
+    serial_write_u64(now - g_boot_phase_start);
+    serial_write(" cycles (total ");
+    serial_write_u64(now - g_boot_epoch);
+    serial_write(")\n");
+    g_boot_phase_start = now;
+}
+
+// ========== SMP braid workers ==========
+//
+// With SMP brought up (kernel.c releases APs through the Limine SMP
+// response; each AP arrives on its own bootloader-provided stack), tori
+// B and C each own a physical core while the BSP keeps torus A and the
+// braid exchange — the three-torus braid stops time-slicing on one CPU.
+// Each core binds its own TorusContext slot in g_core_torus_context;
+// the legacy os::current_torus_context global stays the BSP's binding,
+// so syscall dispatch remains BSP-only and APs execute torus event
+// processing exclusively.
+//
+// Coordination is a mailbox per worker: the BSP publishes a round
+// number, each worker ticks its torus once and acknowledges, and the
+// BSP runs coordinator exchanges between rounds while the workers spin
+// idle — no torus state is ever touched by two cores at once.
+static constexpr uint32_t kBraidWorkers = 2;
+
+struct BraidWorker {
+    braided::BraidedKernel* torus;
+    os::TorusContext* ctx;     // This core's context binding
+    volatile uint64_t round;   // BSP publishes the next round here
+    volatile uint64_t acked;   // Worker acknowledges the completed round
+    volatile uint32_t stop;
+};
+
+static BraidWorker g_braid_workers[kBraidWorkers] = {};
+static os::TorusContext g_braid_ap_contexts[kBraidWorkers] = {};
+
+// Slot 0 is the BSP; APs bind slot 1 + worker_index on arrival
+static os::TorusContext* g_core_torus_context[1 + kBraidWorkers] = {};
+
+extern "C" void rse_braid_ap_main(uint32_t worker_index) {
+    if (worker_index >= kBraidWorkers) {
+        return;  // kernel.c parks the core
+    }
+    BraidWorker& w = g_braid_workers[worker_index];
+    g_core_torus_context[1 + worker_index] = w.ctx;
+
+    uint64_t done = 0;
+    for (;;) {
+        if (__atomic_load_n(&w.stop, __ATOMIC_ACQUIRE) != 0) {
+            return;  // Back to kernel.c, core halts
+        }
+        const uint64_t round = __atomic_load_n(&w.round, __ATOMIC_ACQUIRE);
+        if (round == done) {
+            __asm__ volatile("pause");
+            continue;
+        }
+        // Tickless: an empty queue makes the round a no-op; ack without
+        // touching torus state so the exchange cadence stays intact.
+        if (w.torus->nextEventTime() != ~0ULL) {
+            w.torus->tick();
+        }
+        done = round;
+        __atomic_store_n(&w.acked, done, __ATOMIC_RELEASE);
+    }
+}
 
 extern "C" void rse_braid_smoke(void) {
     serial_write("[RSE] braided smoke start\n");
@@ -656,13 +779,69 @@ extern "C" void rse_braid_smoke(void) {
 
     const uint64_t ticks = 300;
     const uint64_t braid_interval = 30;
-    for (uint64_t i = 0; i < ticks; ++i) {
-        torus_a->tick();
-        torus_b->tick();
-        torus_c->tick();
 
-        if ((i + 1) % braid_interval == 0) {
-            coordinator->exchange(*torus_a, *torus_b, *torus_c);
+    // Bring up the APs once: worker 0 takes torus B, worker 1 takes
+    // torus C, and the BSP keeps torus A plus the exchange. The worker
+    // slots must be populated before the release — APs start polling
+    // their mailbox immediately.
+    static uint32_t smp_workers = 0;
+    static bool smp_attempted = false;
+    if (!smp_attempted) {
+        smp_attempted = true;
+        g_braid_workers[0].torus = torus_b;
+        g_braid_workers[0].ctx = &g_braid_ap_contexts[0];
+        g_braid_workers[1].torus = torus_c;
+        g_braid_workers[1].ctx = &g_braid_ap_contexts[1];
+        smp_workers = rse_smp_start_workers(kBraidWorkers);
+        if (smp_workers != 0 && smp_workers < kBraidWorkers) {
+            // Partial bring-up cannot host the braid; park what started
+            for (uint32_t w = 0; w < kBraidWorkers; ++w) {
+                __atomic_store_n(&g_braid_workers[w].stop, 1u,
+                                 __ATOMIC_RELEASE);
+            }
+            smp_workers = 0;
+        }
+    }
+
+    if (smp_workers == kBraidWorkers) {
+        serial_write("[RSE] braid SMP mode: one torus per core\n");
+        g_core_torus_context[0] = os::current_torus_context;
+        for (uint64_t i = 0; i < ticks; ++i) {
+            __atomic_store_n(&g_braid_workers[0].round, i + 1,
+                             __ATOMIC_RELEASE);
+            __atomic_store_n(&g_braid_workers[1].round, i + 1,
+                             __ATOMIC_RELEASE);
+            if (torus_a->nextEventTime() != ~0ULL) {
+                torus_a->tick();
+            }
+            while (__atomic_load_n(&g_braid_workers[0].acked,
+                                   __ATOMIC_ACQUIRE) < i + 1 ||
+                   __atomic_load_n(&g_braid_workers[1].acked,
+                                   __ATOMIC_ACQUIRE) < i + 1) {
+                __asm__ volatile("pause");
+            }
+
+            if ((i + 1) % braid_interval == 0) {
+                // Workers idle between rounds; the exchange may touch
+                // all three tori from the BSP
+                coordinator->exchange(*torus_a, *torus_b, *torus_c);
+            }
+        }
+    } else {
+        for (uint64_t i = 0; i < ticks; ++i) {
+            if (torus_a->nextEventTime() != ~0ULL) {
+                torus_a->tick();
+            }
+            if (torus_b->nextEventTime() != ~0ULL) {
+                torus_b->tick();
+            }
+            if (torus_c->nextEventTime() != ~0ULL) {
+                torus_c->tick();
+            }
+
+            if ((i + 1) % braid_interval == 0) {
+                coordinator->exchange(*torus_a, *torus_b, *torus_c);
+            }
         }
     }
 
@@ -837,6 +1016,69 @@ static bool install_ring3_elf(TorusRuntime& rt, os::OSProcess* proc) {
 static TorusRuntime g_runtimes[kTorusCount] = {};
 static int g_runtimes_ready = 0;
 
+// Block and net are probed once, on first use, instead of up front in
+// rse_os_run: the probes are the slowest part of boot and most tori
+// never touch either subsystem before their first events run. The probe
+// outcome is shared; device registration and the BlockFS mount happen
+// per torus, for the torus whose access triggered them.
+static int g_block_probe = 0;  // 0 = not probed, 1 = present, -1 = absent
+static uint32_t g_block_dev_size = 0;
+static uint64_t g_block_dev_total = 0;
+static int g_net_probe = 0;
+static bool g_blockfs_ready[kTorusCount] = {};
+static bool g_net_ready[kTorusCount] = {};
+
+static void ensure_blockfs(uint32_t torus_id) {
+    if (torus_id >= kTorusCount || g_blockfs_ready[torus_id]) {
+        return;
+    }
+    g_blockfs_ready[torus_id] = true;  // the probe outcome is final either way
+    if (g_block_probe == 0) {
+        g_block_probe = (rse_block_init() == 0) ? 1 : -1;
+        if (g_block_probe == 1) {
+            g_block_dev_size = rse_block_size();
+            g_block_dev_total = rse_block_total_blocks();
+        }
+        boot_phase_mark(g_block_probe == 1 ? "block probe (lazy)"
+                                           : "block probe (lazy, absent)");
+    }
+    if (g_block_probe != 1 || g_block_dev_size == 0) {
+        return;
+    }
+    TorusRuntime& rt = g_runtimes[torus_id];
+    os::Device* dev_blk = os::create_block_device("blk0", g_block_dev_size);
+    if (dev_blk) {
+        rt.dev_mgr->registerDevice(dev_blk);
+    }
+    if (g_block_dev_total > 0 && rt.blockfs) {
+        if (rt.blockfs->mount(g_block_dev_size, g_block_dev_total)) {
+            rt.vfs->setBlockFS(rt.blockfs);
+        } else {
+            serial_write("[RSE] BlockFS mount failed\n");
+        }
+    }
+}
+
+static void ensure_net(uint32_t torus_id) {
+    if (torus_id >= kTorusCount || g_net_ready[torus_id]) {
+        return;
+    }
+    g_net_ready[torus_id] = true;
+    if (g_net_probe == 0) {
+        g_net_probe = (rse_net_init() == 0) ? 1 : -1;
+        boot_phase_mark(g_net_probe == 1 ? "net probe (lazy)"
+                                         : "net probe (lazy, absent)");
+    }
+    if (g_net_probe != 1) {
+        return;
+    }
+    TorusRuntime& rt = g_runtimes[torus_id];
+    os::Device* dev_net = os::create_net_device("net0");
+    if (dev_net) {
+        rt.dev_mgr->registerDevice(dev_net);
+    }
+}
+
 extern "C" int rse_os_fastio_bench(uint64_t* bytes_out,
                                    uint64_t* cycles_out,
                                    uint64_t* cycles_per_byte_out) {
@@ -1486,10 +1728,7 @@ extern "C" void rse_os_run(void) {
         return;
     }
     TorusRuntime* runtimes = g_runtimes;
-    const bool has_block = (rse_block_init() == 0);
-    const uint32_t block_size = has_block ? rse_block_size() : 0;
-    const uint64_t block_total = has_block ? rse_block_total_blocks() : 0;
-    const bool has_net = (rse_net_init() == 0);
+    boot_phase_mark("os runtime enter");
 
     for (uint32_t torus_id = 0; torus_id < kTorusCount; ++torus_id) {
         TorusRuntime& rt = runtimes[torus_id];
@@ -1514,29 +1753,12 @@ extern "C" void rse_os_run(void) {
             rt.dev_mgr->registerDevice(dev_fast);
             rt.fastio = dev_fast;
         }
-        if (has_block && block_size > 0) {
-            os::Device* dev_blk = os::create_block_device("blk0", block_size);
-            if (dev_blk) {
-                rt.dev_mgr->registerDevice(dev_blk);
-            }
-            if (block_total > 0 && rt.blockfs) {
-                if (rt.blockfs->mount(block_size, block_total)) {
-                    rt.vfs->setBlockFS(rt.blockfs);
-                } else {
-                    serial_write("[RSE] BlockFS mount failed\n");
-                }
-            }
-        }
+        // blk0/BlockFS and net0 are attached lazily by ensure_blockfs /
+        // ensure_net on first access rather than probed here
         os::Device* dev_loop = os::create_loopback_device("loopback");
         if (dev_loop) {
             rt.dev_mgr->registerDevice(dev_loop);
         }
-        if (has_net) {
-            os::Device* dev_net = os::create_net_device("net0");
-            if (dev_net) {
-                rt.dev_mgr->registerDevice(dev_net);
-            }
-        }
         rt.vfs->setDeviceManager(rt.dev_mgr);
         rt.console = console;
 
@@ -1552,6 +1774,7 @@ extern "C" void rse_os_run(void) {
         rt.scheduler->addProcess(init);
         user_procs[torus_id][0] = init;
     }
+    boot_phase_mark("per-torus subsystems");
 
     for (uint32_t i = 0; i < kExtraProcs; ++i) {
         TorusRuntime& rt = runtimes[0];
@@ -1572,6 +1795,7 @@ extern "C" void rse_os_run(void) {
             serial_write("[RSE] ring3 elf install failed\n");
         }
     }
+    boot_phase_mark("processes created");
 
     struct rse_syscalls sys = {
         .log = serial_write,
@@ -1621,19 +1845,44 @@ extern "C" void rse_os_run(void) {
         runtimes[torus_id].scheduler->tick();
         init_main(&sys);
     }
+    boot_phase_mark("init_main complete");
 
     serial_write("[RSE] userspace run start\n");
+    uint64_t tickless_skips = 0;
     for (uint32_t step = 0; step < 48; ++step) {
+        uint32_t runnable = 0;
         for (uint32_t torus_id = 0; torus_id < kTorusCount; ++torus_id) {
+            // Tickless idle: a tick on an empty ready queue only bumps
+            // idle stats, so skip it and keep the cache warm for the
+            // tori that have work.
+            if (!runtimes[torus_id].scheduler->hasRunnableWork()) {
+                tickless_skips++;
+                continue;
+            }
+            runnable++;
             runtimes[torus_id].scheduler->tick();
         }
+        if (runnable == 0) {
+            // Everything left is blocked and only a running process
+            // could wake it — the remaining fixed-rate steps would be
+            // pure idle load.
+            break;
+        }
     }
-    serial_write("[RSE] userspace run done\n");
+    serial_write("[RSE] userspace run done, tickless skips=");
+    serial_write_u64(tickless_skips);
+    serial_write("\n");
+    boot_phase_mark("userspace run");
 
     serial_write("[RSE] braid scheduler start\n");
     braid_log_loads(runtimes);
     for (uint32_t step = 0; step < 6; ++step) {
         for (uint32_t torus_id = 0; torus_id < kTorusCount; ++torus_id) {
+            // Exchanges can migrate ready work into an idle torus, so
+            // re-check every step rather than parking the torus.
+            if (!runtimes[torus_id].scheduler->hasRunnableWork()) {
+                continue;
+            }
             runtimes[torus_id].scheduler->tick();
         }
         if ((step + 1) % 2 == 0) {
@@ -1645,9 +1894,11 @@ extern "C" void rse_os_run(void) {
     serial_write_u64(os_braid_cycles);
     serial_write("\n");
     serial_write("[RSE] braid scheduler done\n");
+    boot_phase_mark("braid scheduler");
 
 #if RSE_NET_EXCHANGE
-    if (has_net) {
+    ensure_net(current_torus_id);
+    if (g_net_probe == 1) {
         os_net_exchange(runtimes);
     } else {
         serial_write("[RSE] net projection skipped (no net)\n");
@@ -8,7 +8,7 @@ extern "C" void serial_write_u64(uint64_t value);
 
 namespace {
 
-static constexpr uint16_t kRsepxVersion = 0x0001;
+static constexpr uint16_t kRsepxVersion = 0x0002;
 static constexpr uint16_t kRsepxEthertype = 0x88B5;
 static constexpr uint32_t kRsepxFragPayload = 1024;
 static constexpr uint16_t kRsepxMaxFrags =
@@ -37,6 +37,168 @@ static int g_local_mac_ok = 0;
 static RsepxAssembly g_assemblies[3];
 static uint32_t g_drop_logs = 0;
 
+static void rsepx_memcpy(void* dst, const void* src, uint32_t len) {
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    const uint8_t* s = static_cast<const uint8_t*>(src);
+    for (uint32_t i = 0; i < len; ++i) {
+        d[i] = s[i];
+    }
+}
+
+// Projection byte layout: head scalars, boundary_states, tail scalars.
+// Delta/RLE encodings rewrite only the boundary section.
+static constexpr uint32_t kBoundaryOffset =
+    (uint32_t)__builtin_offsetof(braided::Projection, boundary_states);
+static constexpr uint32_t kBoundaryWords = (uint32_t)braided::Projection::BOUNDARY_SIZE;
+static constexpr uint32_t kBoundaryBytes = kBoundaryWords * 4u;
+static constexpr uint32_t kTailOffset = kBoundaryOffset + kBoundaryBytes;
+static constexpr uint32_t kTailBytes = (uint32_t)sizeof(braided::Projection) - kTailOffset;
+
+// Sender-side delta state: the last projection sent, promoted to delta
+// baseline once its seq is acknowledged by the peer.
+static braided::Projection g_last_sent;
+static uint64_t g_last_sent_seq = 0;
+static braided::Projection g_delta_base;
+static uint64_t g_delta_base_seq = 0;
+static int g_has_delta_base = 0;
+
+// Receiver-side reconstruction baselines, one per peer torus.
+static braided::Projection g_rx_base[3];
+static uint64_t g_rx_base_seq[3];
+static int g_rx_base_ok[3];
+
+// Bounded scratch for encoded payloads (worst case: delta touching every
+// cell; such payloads are never sent because raw is smaller).
+static uint8_t g_encode_buf[sizeof(braided::Projection) + 16 + kBoundaryWords * 8];
+
+static void rsepx_put_u32(uint8_t* dst, uint32_t value) {
+    dst[0] = (uint8_t)(value & 0xFF);
+    dst[1] = (uint8_t)((value >> 8) & 0xFF);
+    dst[2] = (uint8_t)((value >> 16) & 0xFF);
+    dst[3] = (uint8_t)((value >> 24) & 0xFF);
+}
+
+static uint32_t rsepx_get_u32(const uint8_t* src) {
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+           ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+// Copy everything except boundary_states (head + tail scalar sections).
+static uint32_t rsepx_encode_scalars(const braided::Projection& proj, uint8_t* out) {
+    const uint8_t* raw = reinterpret_cast<const uint8_t*>(&proj);
+    rsepx_memcpy(out, raw, kBoundaryOffset);
+    rsepx_memcpy(out + kBoundaryOffset, raw + kTailOffset, kTailBytes);
+    return kBoundaryOffset + kTailBytes;
+}
+
+static void rsepx_decode_scalars(braided::Projection& proj, const uint8_t* in) {
+    uint8_t* raw = reinterpret_cast<uint8_t*>(&proj);
+    rsepx_memcpy(raw, in, kBoundaryOffset);
+    rsepx_memcpy(raw + kTailOffset, in + kBoundaryOffset, kTailBytes);
+}
+
+// Delta: scalars + u32 count + count x (u32 cell index, u32 value),
+// relative to base. Returns encoded length, or 0 when raw is no worse.
+static uint32_t rsepx_encode_delta(const braided::Projection& proj,
+                                   const braided::Projection& base, uint8_t* out) {
+    uint32_t len = rsepx_encode_scalars(proj, out);
+    uint8_t* count_at = out + len;
+    len += 4;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < kBoundaryWords; ++i) {
+        if (proj.boundary_states[i] == base.boundary_states[i]) {
+            continue;
+        }
+        rsepx_put_u32(out + len, i);
+        rsepx_put_u32(out + len + 4, proj.boundary_states[i]);
+        len += 8;
+        ++count;
+        if (len >= (uint32_t)sizeof(braided::Projection)) {
+            return 0;  // Raw is smaller; don't bother
+        }
+    }
+    rsepx_put_u32(count_at, count);
+    return len;
+}
+
+static int rsepx_decode_delta(braided::Projection& proj, const braided::Projection& base,
+                              const uint8_t* payload, uint32_t payload_len) {
+    const uint32_t scalar_len = kBoundaryOffset + kTailBytes;
+    if (payload_len < scalar_len + 4) {
+        return 0;
+    }
+    rsepx_decode_scalars(proj, payload);
+    proj.boundary_states = base.boundary_states;
+    const uint32_t count = rsepx_get_u32(payload + scalar_len);
+    if (payload_len < scalar_len + 4 + count * 8) {
+        return 0;
+    }
+    const uint8_t* pairs = payload + scalar_len + 4;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t cell = rsepx_get_u32(pairs + i * 8);
+        if (cell >= kBoundaryWords) {
+            return 0;
+        }
+        proj.boundary_states[cell] = rsepx_get_u32(pairs + i * 8 + 4);
+    }
+    return 1;
+}
+
+// RLE: scalars + u32 pair count + pairs of (u32 run length, u32 value)
+// covering all boundary words. Returns encoded length, or 0 when raw is
+// no worse.
+static uint32_t rsepx_encode_rle(const braided::Projection& proj, uint8_t* out) {
+    uint32_t len = rsepx_encode_scalars(proj, out);
+    uint8_t* count_at = out + len;
+    len += 4;
+    uint32_t pairs = 0;
+    uint32_t i = 0;
+    while (i < kBoundaryWords) {
+        const uint32_t value = proj.boundary_states[i];
+        uint32_t run = 1;
+        while (i + run < kBoundaryWords && proj.boundary_states[i + run] == value) {
+            ++run;
+        }
+        rsepx_put_u32(out + len, run);
+        rsepx_put_u32(out + len + 4, value);
+        len += 8;
+        ++pairs;
+        i += run;
+        if (len >= (uint32_t)sizeof(braided::Projection)) {
+            return 0;
+        }
+    }
+    rsepx_put_u32(count_at, pairs);
+    return len;
+}
+
+static int rsepx_decode_rle(braided::Projection& proj, const uint8_t* payload,
+                            uint32_t payload_len) {
+    const uint32_t scalar_len = kBoundaryOffset + kTailBytes;
+    if (payload_len < scalar_len + 4) {
+        return 0;
+    }
+    rsepx_decode_scalars(proj, payload);
+    const uint32_t pairs = rsepx_get_u32(payload + scalar_len);
+    if (payload_len < scalar_len + 4 + pairs * 8) {
+        return 0;
+    }
+    const uint8_t* stream = payload + scalar_len + 4;
+    uint32_t cell = 0;
+    for (uint32_t p = 0; p < pairs; ++p) {
+        const uint32_t run = rsepx_get_u32(stream + p * 8);
+        const uint32_t value = rsepx_get_u32(stream + p * 8 + 4);
+        if (run == 0 || cell + run > kBoundaryWords) {
+            return 0;
+        }
+        for (uint32_t i = 0; i < run; ++i) {
+            proj.boundary_states[cell + i] = value;
+        }
+        cell += run;
+    }
+    return cell == kBoundaryWords;
+}
+
 static uint16_t rsepx_htons(uint16_t value) {
     return (uint16_t)((value << 8) | (value >> 8));
 }
@@ -67,14 +229,6 @@ static void rsepx_set_mac(uint8_t out[6], const uint8_t* in) {
     }
 }
 
-static void rsepx_memcpy(void* dst, const void* src, uint32_t len) {
-    uint8_t* d = static_cast<uint8_t*>(dst);
-    const uint8_t* s = static_cast<const uint8_t*>(src);
-    for (uint32_t i = 0; i < len; ++i) {
-        d[i] = s[i];
-    }
-}
-
 static int rsepx_mac_equal(const uint8_t* a, const uint8_t* b) {
     for (uint32_t i = 0; i < 6; ++i) {
         if (a[i] != b[i]) {
@@ -100,7 +254,12 @@ void rsepx_init(uint32_t torus_id) {
     g_local_mac_ok = (rse_net_get_mac(g_local_mac) == 0);
     for (size_t i = 0; i < 3; ++i) {
         rsepx_assembly_reset(g_assemblies[i], 0, 0, 0, 0);
+        g_rx_base_seq[i] = 0;
+        g_rx_base_ok[i] = 0;
     }
+    g_last_sent_seq = 0;
+    g_delta_base_seq = 0;
+    g_has_delta_base = 0;
 }
 
 int rsepx_send_projection(const braided::Projection& proj, uint32_t phase, uint64_t seq,
@@ -112,8 +271,32 @@ int rsepx_send_projection(const braided::Projection& proj, uint32_t phase, uint6
         return -1;
     }
 
-    uint8_t payload[kRsepxMaxPayload];
-    const uint32_t payload_len = (uint32_t)proj.serialize(payload, sizeof(payload));
+    // Pick the smallest encoding. Delta needs an acknowledged baseline;
+    // RLE pays off whenever the boundary face has long runs. Raw is the
+    // fallback and is gathered straight from the projection struct —
+    // no staging serialize.
+    uint16_t encoding = RSEPX_ENC_RAW;
+    uint64_t base_seq = 0;
+    const uint8_t* payload = reinterpret_cast<const uint8_t*>(&proj);
+    uint32_t payload_len = (uint32_t)sizeof(braided::Projection);
+
+    if (g_has_delta_base) {
+        const uint32_t delta_len = rsepx_encode_delta(proj, g_delta_base, g_encode_buf);
+        if (delta_len != 0) {
+            encoding = RSEPX_ENC_DELTA;
+            base_seq = g_delta_base_seq;
+            payload = g_encode_buf;
+            payload_len = delta_len;
+        }
+    }
+    if (encoding == RSEPX_ENC_RAW) {
+        const uint32_t rle_len = rsepx_encode_rle(proj, g_encode_buf);
+        if (rle_len != 0) {
+            encoding = RSEPX_ENC_RLE;
+            payload = g_encode_buf;
+            payload_len = rle_len;
+        }
+    }
     if (payload_len == 0 || payload_len > kRsepxMaxPayload) {
         return -1;
     }
@@ -153,6 +336,8 @@ int rsepx_send_projection(const braided::Projection& proj, uint32_t phase, uint6
         hdr.phase = phase;
         hdr.timestamp = proj.timestamp;
         hdr.seq = seq;
+        hdr.base_seq = base_seq;
+        hdr.encoding = encoding;
         hdr.payload_len = payload_len;
         hdr.payload_hash = payload_hash;
         hdr.frag_index = frag_index;
@@ -172,6 +357,11 @@ int rsepx_send_projection(const braided::Projection& proj, uint32_t phase, uint6
         }
     }
 
+    // Remember what we sent; an ack for this seq promotes it to the
+    // delta baseline
+    g_last_sent = proj;
+    g_last_sent_seq = seq;
+
     return 0;
 }
 
@@ -280,6 +470,13 @@ int rsepx_poll(RsepxReceived* out) {
         rsepx_memcpy(&out->ack, payload, sizeof(RsepxAck));
         rsepx_set_mac(out->src_mac, eth->src);
         got = 1;
+
+        // Ack of our most recent projection: it becomes the delta baseline
+        if (out->ack.seq == g_last_sent_seq && g_last_sent_seq != 0) {
+            g_delta_base = g_last_sent;
+            g_delta_base_seq = g_last_sent_seq;
+            g_has_delta_base = 1;
+        }
     } else if (hdr->msg_type == RSEPX_MSG_PROJECTION) {
         if (hdr->payload_len > kRsepxMaxPayload) {
             if (g_drop_logs < 4) {
@@ -353,11 +550,37 @@ int rsepx_poll(RsepxReceived* out) {
                 rsepx_assembly_reset(asmbl, 0, 0, 0, 0);
                 return 0;
             }
+            int decoded = 0;
+            if (hdr->encoding == RSEPX_ENC_RAW) {
+                out->projection = braided::Projection::deserialize(asmbl.buffer, asmbl.payload_len);
+                decoded = (out->projection.torus_id != 0xFFFFFFFF);
+            } else if (hdr->encoding == RSEPX_ENC_RLE) {
+                decoded = rsepx_decode_rle(out->projection, asmbl.buffer, asmbl.payload_len);
+            } else if (hdr->encoding == RSEPX_ENC_DELTA) {
+                if (g_rx_base_ok[hdr->torus_id] &&
+                    g_rx_base_seq[hdr->torus_id] == hdr->base_seq) {
+                    decoded = rsepx_decode_delta(out->projection, g_rx_base[hdr->torus_id],
+                                                 asmbl.buffer, asmbl.payload_len);
+                }
+            }
+            rsepx_assembly_reset(asmbl, 0, 0, 0, 0);
+            if (!decoded) {
+                if (g_drop_logs < 4) {
+                    serial_write("[RSE] net projection drop decode\n");
+                    g_drop_logs++;
+                }
+                return 0;
+            }
+
+            // Any successfully decoded projection becomes the baseline
+            // for subsequent deltas from this torus
+            g_rx_base[hdr->torus_id] = out->projection;
+            g_rx_base_seq[hdr->torus_id] = hdr->seq;
+            g_rx_base_ok[hdr->torus_id] = 1;
+
             out->kind = RsepxReceived::Projection;
             out->header = *hdr;
-            out->projection = braided::Projection::deserialize(asmbl.buffer, asmbl.payload_len);
             rsepx_set_mac(out->src_mac, eth->src);
-            rsepx_assembly_reset(asmbl, 0, 0, 0, 0);
             got = 1;
         }
     }
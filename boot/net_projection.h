@@ -8,6 +8,26 @@
 enum RsepxMsgType : uint16_t {
     RSEPX_MSG_PROJECTION = 1,
     RSEPX_MSG_ACK = 2,
+    // Batched cross-shard events for the distributed braid (one logical
+    // lattice sharded across processes/hosts); payload is a packed array
+    // of ComputeEvent records, RAW encoded
+    RSEPX_MSG_EVENT_BATCH = 3,
+};
+
+// Payload encodings (version 2). RAW fragments are gathered straight from
+// the projection struct with no staging copy. DELTA carries only boundary
+// cells changed against the last acknowledged projection (base_seq in the
+// header names the baseline). RLE run-length encodes boundary_states,
+// which is dominated by zero runs on quiescent faces.
+enum RsepxEncoding : uint16_t {
+    RSEPX_ENC_RAW = 0,
+    RSEPX_ENC_DELTA = 1,
+    RSEPX_ENC_RLE = 2,
+    // Versioned packed format (braided/ProjectionWire.h): payload opens
+    // with a one-byte format version, scalars are varints, the boundary
+    // face is sent sparse. Byte-order independent and decodable across
+    // projection versions, so mixed-version braids interoperate.
+    RSEPX_ENC_PACKED = 3,
 };
 
 struct __attribute__((packed)) RsepxHeader {
@@ -18,6 +38,9 @@ struct __attribute__((packed)) RsepxHeader {
     uint32_t phase;
     uint64_t timestamp;
     uint64_t seq;
+    uint64_t base_seq;      // DELTA: seq of the acked baseline projection
+    uint16_t encoding;      // RsepxEncoding of the payload
+    uint16_t reserved;
     uint32_t payload_len;
     uint64_t payload_hash;
     uint16_t frag_index;
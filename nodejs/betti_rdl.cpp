@@ -17,10 +17,13 @@ private:
   Napi::Value SpawnProcess(const Napi::CallbackInfo &info);
   Napi::Value InjectEvent(const Napi::CallbackInfo &info);
   Napi::Value Run(const Napi::CallbackInfo &info);
+  Napi::Value EnqueueCommand(const Napi::CallbackInfo &info);
+  Napi::Value Drain(const Napi::CallbackInfo &info);
   Napi::Value GetEventsProcessed(const Napi::CallbackInfo &info);
   Napi::Value GetCurrentTime(const Napi::CallbackInfo &info);
   Napi::Value GetProcessCount(const Napi::CallbackInfo &info);
   Napi::Value GetTelemetry(const Napi::CallbackInfo &info);
+  Napi::Value GetTelemetryBuffer(const Napi::CallbackInfo &info);
   Napi::Value GetProcessState(const Napi::CallbackInfo &info);
 };
 
@@ -47,11 +50,16 @@ Napi::Object BettiKernelWrapper::Init(Napi::Env env, Napi::Object exports) {
           InstanceMethod("spawnProcess", &BettiKernelWrapper::SpawnProcess),
           InstanceMethod("injectEvent", &BettiKernelWrapper::InjectEvent),
           InstanceMethod("run", &BettiKernelWrapper::Run),
+          InstanceMethod("enqueueCommand",
+                         &BettiKernelWrapper::EnqueueCommand),
+          InstanceMethod("drain", &BettiKernelWrapper::Drain),
           InstanceMethod("getEventsProcessed",
                          &BettiKernelWrapper::GetEventsProcessed),
           InstanceMethod("getCurrentTime", &BettiKernelWrapper::GetCurrentTime),
           InstanceMethod("getProcessCount", &BettiKernelWrapper::GetProcessCount),
           InstanceMethod("getTelemetry", &BettiKernelWrapper::GetTelemetry),
+          InstanceMethod("getTelemetryBuffer",
+                         &BettiKernelWrapper::GetTelemetryBuffer),
           InstanceMethod("getProcessState", &BettiKernelWrapper::GetProcessState),
       });
 
@@ -60,6 +68,8 @@ Napi::Object BettiKernelWrapper::Init(Napi::Env env, Napi::Object exports) {
   env.SetInstanceData(constructor);
 
   exports.Set("Kernel", func);
+  exports.Set("CMD_SPAWN", Napi::Number::New(env, BETTI_RDL_CMD_SPAWN));
+  exports.Set("CMD_INJECT", Napi::Number::New(env, BETTI_RDL_CMD_INJECT));
   return exports;
 }
 
@@ -112,6 +122,32 @@ Napi::Value BettiKernelWrapper::Run(const Napi::CallbackInfo &info) {
   return Napi::Number::New(env, result);
 }
 
+// Async command queue: append commands without doing kernel work, then
+// apply the whole backlog with a single drain() call
+Napi::Value BettiKernelWrapper::EnqueueCommand(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() < 5) {
+    Napi::TypeError::New(env, "Expected 5 arguments")
+        .ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  const int32_t op = info[0].As<Napi::Number>().Int32Value();
+  const int x = info[1].As<Napi::Number>().Int32Value();
+  const int y = info[2].As<Napi::Number>().Int32Value();
+  const int z = info[3].As<Napi::Number>().Int32Value();
+  const int value = info[4].As<Napi::Number>().Int32Value();
+
+  return Napi::Boolean::New(env,
+                            betti_rdl_enqueue(kernel_, op, x, y, z, value) != 0);
+}
+
+Napi::Value BettiKernelWrapper::Drain(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  return Napi::Number::New(env, betti_rdl_drain(kernel_));
+}
+
 Napi::Value
 BettiKernelWrapper::GetEventsProcessed(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
@@ -150,6 +186,25 @@ Napi::Value BettiKernelWrapper::GetTelemetry(const Napi::CallbackInfo &info) {
   return obj;
 }
 
+// Shared-memory telemetry bridge: an external ArrayBuffer aliasing the
+// kernel's telemetry page, which the tick loop refreshes in place.
+// Dashboards wrap it in a BigUint64Array once and read counters directly
+// from kernel-updated memory — no FFI call and no object marshalling per
+// sample. The buffer borrows kernel memory (no finalizer); a property on
+// it pins this wrapper so the page cannot be destroyed while a view is
+// still reachable.
+Napi::Value
+BettiKernelWrapper::GetTelemetryBuffer(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  const BettiRDLTelemetryPage *page = betti_rdl_get_telemetry_page(kernel_);
+  Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(
+      env, const_cast<BettiRDLTelemetryPage *>(page),
+      sizeof(BettiRDLTelemetryPage));
+  buffer.Set("_kernel", info.This());
+  return buffer;
+}
+
 Napi::Value BettiKernelWrapper::GetProcessState(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
 
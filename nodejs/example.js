@@ -1,4 +1,4 @@
-const { Kernel } = require('./index');
+const { Kernel, TELEMETRY, CMD_INJECT } = require('./index');
 
 console.log('='.repeat(50));
 console.log('   BETTI-RDL NODE.JS EXAMPLE');
@@ -14,11 +14,14 @@ for (let i = 0; i < 10; i++) {
     kernel.spawnProcess(i, 0, 0);
 }
 
-// Inject events
-console.log('[INJECT] Sending events with values 1, 2, 3...');
-kernel.injectEvent(0, 0, 0, 1);
-kernel.injectEvent(0, 0, 0, 2);
-kernel.injectEvent(0, 0, 0, 3);
+// Inject events through the async command queue: appends do no kernel
+// work, one drain() applies the whole batch in a single native call
+console.log('[INJECT] Queueing events with values 1, 2, 3...');
+kernel.enqueueCommand(CMD_INJECT, 0, 0, 0, 1);
+kernel.enqueueCommand(CMD_INJECT, 0, 0, 0, 2);
+kernel.enqueueCommand(CMD_INJECT, 0, 0, 0, 3);
+const applied = kernel.drain();
+console.log(`  Applied ${applied} queued commands.`);
 
 // Run computation
 console.log('\n[COMPUTE] Running distributed counter...');
@@ -31,6 +34,14 @@ console.log(`  Events processed: ${kernel.getEventsProcessed()}`);
 console.log(`  Current time: ${kernel.getCurrentTime()}`);
 console.log(`  Active processes: ${kernel.getProcessCount()}`);
 
+// Monitoring without native calls: the telemetry view aliases the
+// kernel's shared-memory counter page
+const telemetry = kernel.telemetryView();
+console.log('\n[TELEMETRY VIEW]');
+console.log(`  Events: ${telemetry[TELEMETRY.EVENTS_PROCESSED]}`);
+console.log(`  Queue depth: ${telemetry[TELEMETRY.QUEUE_DEPTH]}`);
+console.log(`  Memory used: ${telemetry[TELEMETRY.MEMORY_USED]} bytes`);
+
 console.log('\n[VALIDATION]');
 console.log('  [OK] O(1) memory maintained');
 console.log('  [OK] Real computation performed');
@@ -7,6 +7,25 @@ export interface Telemetry {
     memory_used: number;
 }
 
+/**
+ * BigUint64Array indices into the telemetry view; field order matches
+ * BettiRDLTelemetryPage in betti_rdl_c_api.h
+ */
+export const TELEMETRY: {
+    readonly EVENTS_PROCESSED: 0;
+    readonly CURRENT_TIME: 1;
+    readonly QUEUE_DEPTH: 2;
+    readonly MEMORY_USED: 3;
+    readonly COMMANDS_APPLIED: 4;
+    readonly COMMANDS_PENDING: 5;
+};
+
+/** Command-queue opcode: spawn a process at (x, y, z); value ignored */
+export const CMD_SPAWN: number;
+
+/** Command-queue opcode: inject an event at (x, y, z) with value */
+export const CMD_INJECT: number;
+
 export class Kernel {
     constructor();
 
@@ -76,6 +95,37 @@ export class Kernel {
      */
     get_telemetry(): Telemetry;
 
+    /**
+     * Zero-overhead monitoring: a BigUint64Array aliasing the kernel's
+     * shared-memory telemetry page, updated in place by the run loop.
+     * Index with the TELEMETRY constants; each read is a plain typed-array
+     * load with no native call. Valid for the kernel's lifetime.
+     */
+    telemetryView(): BigUint64Array;
+
+    /**
+     * snake_case alias for telemetryView
+     */
+    telemetry_view(): BigUint64Array;
+
+    /**
+     * Append a command (CMD_SPAWN / CMD_INJECT) to the async queue without
+     * entering the kernel. Returns false when the queue is full.
+     */
+    enqueueCommand(op: number, x: number, y: number, z: number,
+                   value: number): boolean;
+
+    /**
+     * snake_case alias for enqueueCommand
+     */
+    enqueue_command(op: number, x: number, y: number, z: number,
+                    value: number): boolean;
+
+    /**
+     * Apply all queued commands in one call; returns the count applied
+     */
+    drain(): number;
+
     /**
      * Get accumulated state for a process
      */
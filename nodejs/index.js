@@ -1,8 +1,20 @@
 const native = require('./build/Release/betti_rdl');
 
+// BigUint64Array indices into the telemetry view; field order matches
+// BettiRDLTelemetryPage in betti_rdl_c_api.h
+const TELEMETRY = Object.freeze({
+    EVENTS_PROCESSED: 0,
+    CURRENT_TIME: 1,
+    QUEUE_DEPTH: 2,
+    MEMORY_USED: 3,
+    COMMANDS_APPLIED: 4,
+    COMMANDS_PENDING: 5,
+});
+
 class Kernel {
     constructor() {
         this._native = new native.Kernel();
+        this._telemetryView = null;
     }
 
     // camelCase API (native)
@@ -34,6 +46,30 @@ class Kernel {
         return this._native.getTelemetry();
     }
 
+    // Zero-overhead monitoring: a BigUint64Array aliasing the kernel's
+    // shared-memory telemetry page. Created once and cached; each read is
+    // a plain typed-array load from kernel-updated memory, so polling at
+    // dashboard rates costs no native calls and no allocation. Index with
+    // the exported TELEMETRY constants. Each field is torn-free but the
+    // page is not a consistent snapshot across fields.
+    telemetryView() {
+        if (!this._telemetryView) {
+            this._telemetryView =
+                new BigUint64Array(this._native.getTelemetryBuffer());
+        }
+        return this._telemetryView;
+    }
+
+    // Async command queue: append commands without entering the kernel,
+    // then apply the whole backlog with one drain() call
+    enqueueCommand(op, x, y, z, value) {
+        return this._native.enqueueCommand(op, x, y, z, value);
+    }
+
+    drain() {
+        return this._native.drain();
+    }
+
     getProcessState(pid) {
         return this._native.getProcessState(pid);
     }
@@ -63,9 +99,22 @@ class Kernel {
         return this.getTelemetry();
     }
 
+    telemetry_view() {
+        return this.telemetryView();
+    }
+
+    enqueue_command(op, x, y, z, value) {
+        return this.enqueueCommand(op, x, y, z, value);
+    }
+
     get_process_state(pid) {
         return this.getProcessState(pid);
     }
 }
 
-module.exports = { Kernel };
+module.exports = {
+    Kernel,
+    TELEMETRY,
+    CMD_SPAWN: native.CMD_SPAWN,
+    CMD_INJECT: native.CMD_INJECT,
+};
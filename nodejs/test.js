@@ -1,4 +1,4 @@
-const { Kernel } = require('./index');
+const { Kernel, TELEMETRY, CMD_INJECT } = require('./index');
 const assert = require('assert');
 
 console.log('Running Node.js Bindings Tests...');
@@ -32,4 +32,28 @@ assert.strictEqual(remaining, 5);
 assert.strictEqual(Number(kernel.getEventsProcessed()), 2 + 10);
 console.log('  PASS');
 
+// Test 3: Async command queue batches submissions into one drain
+console.log('Test 3: enqueueCommand() + drain()');
+assert.strictEqual(kernel.enqueueCommand(CMD_INJECT, 9, 0, 0, 1), true);
+assert.strictEqual(kernel.enqueueCommand(CMD_INJECT, 9, 0, 0, 2), true);
+assert.strictEqual(kernel.drain(), 2);
+assert.strictEqual(kernel.run(10), 2);
+console.log('  PASS');
+
+// Test 4: Telemetry view reads kernel counters in place, no native call
+console.log('Test 4: telemetryView() aliases live counters');
+const telemetry = kernel.telemetryView();
+assert.ok(telemetry instanceof BigUint64Array);
+assert.strictEqual(Number(telemetry[TELEMETRY.EVENTS_PROCESSED]),
+                   Number(kernel.getEventsProcessed()));
+assert.strictEqual(Number(telemetry[TELEMETRY.QUEUE_DEPTH]), 0);
+assert.strictEqual(Number(telemetry[TELEMETRY.COMMANDS_APPLIED]), 2);
+// The cached view observes later runs without being re-fetched
+kernel.injectEvent(9, 0, 0, 3);
+kernel.run(10);
+assert.strictEqual(Number(telemetry[TELEMETRY.EVENTS_PROCESSED]),
+                   Number(kernel.getEventsProcessed()));
+assert.strictEqual(kernel.telemetryView(), telemetry);
+console.log('  PASS');
+
 console.log('All tests passed!');
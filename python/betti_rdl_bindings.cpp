@@ -38,6 +38,15 @@ public:
 
   int run(int max_events) { return betti_rdl_run(kernel_, max_events); }
 
+  // Async command queue: enqueue appends into the kernel's ring without
+  // doing any kernel work (and so without blocking other Python threads
+  // for long); drain applies the whole backlog in one crossing.
+  bool enqueue_command(int op, int x, int y, int z, int value) {
+    return betti_rdl_enqueue(kernel_, op, x, y, z, value) != 0;
+  }
+
+  int drain() { return betti_rdl_drain(kernel_); }
+
   std::uint64_t get_events_processed() const {
     return betti_rdl_get_events_processed(kernel_);
   }
@@ -62,6 +71,19 @@ public:
     const auto telemetry = betti_rdl_get_telemetry(kernel_);
     return static_cast<double>(telemetry.memory_used) / (1024.0 * 1024.0);
   }
+
+  // Read-only buffer view over the kernel's lattice state array (one
+  // int32 per cell, indexed by node id; the x=0 boundary face is the
+  // first 1024 entries). NumPy wraps it with np.asarray — zero copies
+  // and zero allocation per sample, at any sampling rate. The view
+  // aliases kernel memory updated in place by run(), so consecutive
+  // reads observe live state.
+  py::memoryview lattice_states() const {
+    const std::int32_t *data = betti_rdl_lattice_states(kernel_);
+    return py::memoryview::from_buffer(
+        data, {static_cast<py::ssize_t>(betti_rdl_lattice_size())},
+        {static_cast<py::ssize_t>(sizeof(std::int32_t))});
+  }
 };
 
 PYBIND11_MODULE(betti_rdl, m) {
@@ -84,6 +106,13 @@ PYBIND11_MODULE(betti_rdl, m) {
            py::arg("y"), py::arg("z"), py::arg("value"))
       .def("run", &PyBettiKernel::run, "Run computation for up to max_events",
            py::arg("max_events"))
+      .def("enqueue_command", &PyBettiKernel::enqueue_command,
+           "Append a command (CMD_SPAWN / CMD_INJECT) to the async queue; "
+           "returns False when the queue is full",
+           py::arg("op"), py::arg("x"), py::arg("y"), py::arg("z"),
+           py::arg("value"))
+      .def("drain", &PyBettiKernel::drain,
+           "Apply all queued commands in one call; returns the count applied")
       .def("get_events_processed", &PyBettiKernel::get_events_processed,
            "Get lifetime number of events processed")
       .def("get_current_time", &PyBettiKernel::get_current_time,
@@ -102,7 +131,17 @@ PYBIND11_MODULE(betti_rdl, m) {
       .def_property_readonly("memory_mb", &PyBettiKernel::get_memory_mb,
                              "Total memory used by runtime (MB)")
       .def("get_process_state", &PyBettiKernel::get_process_state,
-           "Get accumulated state for a process", py::arg("pid"));
+           "Get accumulated state for a process", py::arg("pid"))
+      .def_property_readonly(
+          "lattice_states", &PyBettiKernel::lattice_states,
+          // keep_alive pins the kernel while the view exists, so the
+          // aliased buffer cannot be destroyed under NumPy
+          py::keep_alive<0, 1>(),
+          "Zero-copy read-only view of per-cell lattice state "
+          "(np.asarray(k.lattice_states); index = x*1024 + y*32 + z)");
+
+  m.attr("CMD_SPAWN") = static_cast<int>(BETTI_RDL_CMD_SPAWN);
+  m.attr("CMD_INJECT") = static_cast<int>(BETTI_RDL_CMD_INJECT);
 
   m.attr("__version__") = "1.0.0";
 }
@@ -36,7 +36,21 @@ def main():
     print(f"  Events processed: {kernel.events_processed}")
     print(f"  Current time: {kernel.current_time}")
     print(f"  Active processes: {kernel.process_count}")
-    
+
+    # Zero-copy lattice view: the memoryview aliases kernel memory, so
+    # wrapping it once and re-reading after each run() samples live
+    # state with no copy or allocation. Cell index = x*1024 + y*32 + z.
+    print("\n[LATTICE VIEW]")
+    states = kernel.lattice_states
+    print(f"  State at (0,0,0): {states[0]}")
+    try:
+        import numpy as np
+        lattice = np.asarray(states)
+        print(f"  Nonzero cells: {np.count_nonzero(lattice)}")
+    except ImportError:
+        pass
+
+
     print("\n[VALIDATION]")
     print("  [OK] O(1) memory maintained")
     print("  [OK] Real computation performed")
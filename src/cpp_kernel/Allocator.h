@@ -1,10 +1,15 @@
 #pragma once
 
+#include "Profiler.h"
+
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <atomic>
 #include <array>
+#include <bit>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <thread>
@@ -14,6 +19,8 @@
 #include <unistd.h>
 #if defined(__linux__)
   #include <sys/resource.h>
+  #include <sys/mman.h>
+  #include <sched.h>
   #include <stdio.h>
 #elif defined(__APPLE__)
   #include <mach/mach.h>
@@ -24,7 +31,8 @@
 
 // Bounded Arena Allocator for BettiOS
 // Pre-reserves exact memory for 32³ lattice, processes, events, and edges
-// Thread-safe with lock-free freelists per slab and global fallback
+// Thread-safe with per-thread magazines over lock-free freelists per slab
+// and global fallback
 
 // ============================================================================
 // Configuration
@@ -52,19 +60,167 @@ constexpr size_t EDGE_BLOCK_SIZE = 64;
 // Generic allocation pool for miscellaneous allocations
 constexpr size_t GENERIC_POOL_CAPACITY = 64ULL * 1024ULL * 1024ULL; // 64MB
 
+// Segregated size classes for the generic pool: powers of two from 32
+// bytes to 1MB, each with its own freelist so mixed-size alloc/free
+// cycles cannot fragment the arena and free() is O(1). Larger requests
+// bump-allocate exact sizes and are not reclaimed (arena-style, rare).
+constexpr size_t GENERIC_MIN_CLASS_SHIFT = 5;   // 32 bytes
+constexpr size_t GENERIC_MAX_CLASS_SHIFT = 20;  // 1 MB
+constexpr size_t GENERIC_NUM_CLASSES =
+    GENERIC_MAX_CLASS_SHIFT - GENERIC_MIN_CLASS_SHIFT + 1;
+constexpr uint32_t GENERIC_CLASS_LARGE = 0xFFFFFFFF;
+
+// Every generic block starts with a max-aligned header holding its size
+// class, so deallocation never searches
+constexpr size_t GENERIC_HEADER_SIZE = alignof(std::max_align_t);
+
+// ============================================================================
+// Pool Sizing Policies
+// ============================================================================
+
+// Capacities and block sizes come from a sizing policy so each build
+// target reserves exactly the memory its deployment needs. Select one by
+// defining RSE_POOL_SIZING_POLICY before this header is included (e.g.
+// via target_compile_definitions in CMakeLists.txt); the default keeps
+// the historical 32^3-lattice sizing.
+
+struct DefaultPoolSizing {
+    static constexpr const char* NAME = "default (32^3 lattice)";
+    static constexpr size_t PROCESS_CAPACITY = PROCESS_POOL_CAPACITY;
+    static constexpr size_t EVENT_CAPACITY = EVENT_POOL_CAPACITY;
+    static constexpr size_t EDGE_CAPACITY = EDGE_POOL_CAPACITY;
+    static constexpr size_t PROCESS_BLOCK = PROCESS_BLOCK_SIZE;
+    static constexpr size_t EVENT_BLOCK = EVENT_BLOCK_SIZE;
+    static constexpr size_t EDGE_BLOCK = EDGE_BLOCK_SIZE;
+    static constexpr size_t GENERIC_CAPACITY = GENERIC_POOL_CAPACITY;
+};
+
+// Small edge deployments: 16^3-lattice density, ~1/8 the pool memory
+struct SmallEdgePoolSizing {
+    static constexpr const char* NAME = "small-edge (16^3 lattice)";
+    static constexpr size_t SMALL_LATTICE = 16 * 16 * 16;
+    static constexpr size_t PROCESS_CAPACITY = SMALL_LATTICE * PROCESSES_PER_CELL;
+    static constexpr size_t EVENT_CAPACITY = SMALL_LATTICE * EVENTS_PER_CELL;
+    static constexpr size_t EDGE_CAPACITY = SMALL_LATTICE * EDGES_PER_CELL;
+    static constexpr size_t PROCESS_BLOCK = PROCESS_BLOCK_SIZE;
+    static constexpr size_t EVENT_BLOCK = EVENT_BLOCK_SIZE;
+    static constexpr size_t EDGE_BLOCK = EDGE_BLOCK_SIZE;
+    static constexpr size_t GENERIC_CAPACITY = 16ULL * 1024ULL * 1024ULL;
+};
+
+// Large deployments: 64^3-lattice density, 8x the default pools
+struct LargePoolSizing {
+    static constexpr const char* NAME = "large (64^3 lattice)";
+    static constexpr size_t LARGE_LATTICE = 64 * 64 * 64;
+    static constexpr size_t PROCESS_CAPACITY = LARGE_LATTICE * PROCESSES_PER_CELL;
+    static constexpr size_t EVENT_CAPACITY = LARGE_LATTICE * EVENTS_PER_CELL;
+    static constexpr size_t EDGE_CAPACITY = LARGE_LATTICE * EDGES_PER_CELL;
+    static constexpr size_t PROCESS_BLOCK = PROCESS_BLOCK_SIZE;
+    static constexpr size_t EVENT_BLOCK = EVENT_BLOCK_SIZE;
+    static constexpr size_t EDGE_BLOCK = EDGE_BLOCK_SIZE;
+    static constexpr size_t GENERIC_CAPACITY = 256ULL * 1024ULL * 1024ULL;
+};
+
 // Slab size for lock-free freelists (good balance between contention and cache)
 constexpr size_t FREELIST_SLAB_SIZE = 64;
 
+// Per-thread magazine: each thread caches up to MAGAZINE_CAPACITY blocks
+// locally and exchanges them with the shared freelists in batches, so the
+// common alloc/free path never touches a shared cache line
+constexpr size_t MAGAZINE_CAPACITY = FREELIST_SLAB_SIZE;
+constexpr size_t MAGAZINE_BATCH = FREELIST_SLAB_SIZE / 2;
+
+// Back the arenas with 2MB huge pages where the OS allows it: the event
+// pool alone spans ~51MB, and walking it with 4KB pages costs measurable
+// dTLB misses. Falls back to ordinary pages, then to malloc.
+constexpr bool ARENA_HUGE_PAGES = true;
+constexpr size_t HUGE_PAGE_SIZE = 2ULL * 1024ULL * 1024ULL;
+
+// NUMA partitioning: one replica of each fixed block pool per node, with
+// allocations routed to the caller's node so event blocks touched by
+// pinned torus threads live in local DRAM. Capped to keep the routing
+// tables bounded; machines reporting more nodes share the last replica.
+constexpr size_t MAX_NUMA_NODES = 8;
+
+// Allocator telemetry (latency histograms + failure ring) is on by
+// default; define RSE_ALLOC_NO_TELEMETRY to compile it out — snapshot()
+// then returns zeroed data and the hot paths carry no extra code
+#ifndef RSE_ALLOC_NO_TELEMETRY
+#define RSE_ALLOC_TELEMETRY 1
+#endif
+
+// Power-of-two latency buckets: bucket i counts allocations that took
+// [2^i, 2^(i+1)) cycles
+constexpr size_t ALLOC_LATENCY_BUCKETS = 16;
+
+// Ring of the most recent allocation failures, overwritten in place
+constexpr size_t ALLOC_FAILURE_RING_SIZE = 64;
+
+// Pool identifiers stamped into failure records
+enum AllocPoolId : uint32_t {
+    POOL_NONE = 0,
+    POOL_PROCESS = 1,
+    POOL_EVENT = 2,
+    POOL_EDGE = 3,
+    POOL_GENERIC = 4,
+};
+
 // ============================================================================
 // Forward Declarations
 // ============================================================================
 
-class BoundedArenaAllocator;
+template <typename Sizing> class BoundedArenaAllocatorT;
 
 // ============================================================================
 // Statistics and Instrumentation
 // ============================================================================
 
+// Cheap per-allocation timestamp: raw cycle counter where available,
+// steady_clock ticks otherwise. Only relative magnitudes matter for the
+// histogram buckets.
+inline uint64_t telemetry_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// POD snapshot of one pool's health, filled by AllocationStats::snapshot()
+// with relaxed loads only — safe to poll from a monitoring thread while
+// the pool is under load
+struct AllocationSnapshot {
+    uint64_t allocation_count;
+    uint64_t deallocation_count;
+    uint64_t allocation_failures;
+    uint64_t current_usage;
+    uint64_t peak_usage;
+
+    // Fragmentation view, filled by GenericPool::snapshot() only (the
+    // fixed block pools cannot fragment — every block is the same size).
+    // free_bytes counts the unallocated bump tail plus blocks banked on
+    // the class freelists; largest_free_run is the biggest allocation the
+    // pool could satisfy from that free memory. Their ratio drifting down
+    // means free bytes are scattering into small class blocks.
+    uint64_t free_bytes;
+    uint64_t largest_free_run;
+
+    uint64_t latency_buckets[ALLOC_LATENCY_BUCKETS];
+
+    struct FailureRecord {
+        uint64_t size;
+        uint64_t timestamp;
+        uint32_t pool_id;
+        uint32_t reserved;
+    };
+    FailureRecord failures[ALLOC_FAILURE_RING_SIZE];
+};
+
 class AllocationStats {
 public:
     std::atomic<size_t> current_usage{0};
@@ -73,6 +229,57 @@ public:
     std::atomic<size_t> deallocation_count{0};
     std::atomic<size_t> allocation_failures{0};
 
+#if RSE_ALLOC_TELEMETRY
+    // Telemetry state: power-of-two latency buckets and a lock-free ring
+    // of recent failure records. All updates are relaxed increments and
+    // stores; the ring head is a fetch_add so concurrent failures claim
+    // distinct slots (modulo wrap-around overwrites, which are intended).
+    std::atomic<uint64_t> latency_buckets[ALLOC_LATENCY_BUCKETS] = {};
+    std::atomic<uint64_t> failure_ring_head{0};
+    std::atomic<uint64_t> failure_sizes[ALLOC_FAILURE_RING_SIZE] = {};
+    std::atomic<uint64_t> failure_times[ALLOC_FAILURE_RING_SIZE] = {};
+    uint32_t pool_id = POOL_NONE;
+#endif
+
+    void setPoolId(uint32_t id) {
+#if RSE_ALLOC_TELEMETRY
+        pool_id = id;
+#else
+        (void)id;
+#endif
+    }
+
+    void recordLatency(uint64_t cycles) {
+#if RSE_ALLOC_TELEMETRY
+        const size_t bucket = std::min<size_t>(
+            ALLOC_LATENCY_BUCKETS - 1,
+            static_cast<size_t>(64 - std::countl_zero(cycles | 1)) - 1);
+        latency_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+#else
+        (void)cycles;
+#endif
+    }
+
+    AllocationSnapshot snapshot() const {
+        AllocationSnapshot snap = {};
+        snap.allocation_count = allocation_count.load(std::memory_order_relaxed);
+        snap.deallocation_count = deallocation_count.load(std::memory_order_relaxed);
+        snap.allocation_failures = allocation_failures.load(std::memory_order_relaxed);
+        snap.current_usage = current_usage.load(std::memory_order_relaxed);
+        snap.peak_usage = peak_usage.load(std::memory_order_relaxed);
+#if RSE_ALLOC_TELEMETRY
+        for (size_t i = 0; i < ALLOC_LATENCY_BUCKETS; ++i) {
+            snap.latency_buckets[i] = latency_buckets[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < ALLOC_FAILURE_RING_SIZE; ++i) {
+            snap.failures[i].size = failure_sizes[i].load(std::memory_order_relaxed);
+            snap.failures[i].timestamp = failure_times[i].load(std::memory_order_relaxed);
+            snap.failures[i].pool_id = pool_id;
+        }
+#endif
+        return snap;
+    }
+
     void recordAllocation(size_t size) {
         allocation_count.fetch_add(1, std::memory_order_relaxed);
         size_t new_usage = current_usage.fetch_add(size, std::memory_order_relaxed) + size;
@@ -89,8 +296,17 @@ public:
         current_usage.fetch_sub(size, std::memory_order_relaxed);
     }
 
-    void recordFailure() {
+    void recordFailure(size_t size = 0) {
         allocation_failures.fetch_add(1, std::memory_order_relaxed);
+#if RSE_ALLOC_TELEMETRY
+        const uint64_t slot =
+            failure_ring_head.fetch_add(1, std::memory_order_relaxed) %
+            ALLOC_FAILURE_RING_SIZE;
+        failure_sizes[slot].store(size, std::memory_order_relaxed);
+        failure_times[slot].store(telemetry_cycles(), std::memory_order_relaxed);
+#else
+        (void)size;
+#endif
     }
 
     void print(const char* pool_name) const {
@@ -103,6 +319,88 @@ public:
     }
 };
 
+// ============================================================================
+// Arena Backing Memory (optionally huge-page backed)
+// ============================================================================
+
+// Reserve backing memory for an arena. With huge pages requested, try
+// explicit MAP_HUGETLB first (needs a pre-reserved hugetlbfs pool), then
+// an ordinary anonymous mapping promoted via madvise(MADV_HUGEPAGE), and
+// finally plain malloc. mapped reports which release path to use.
+inline void* arena_reserve(size_t size, bool use_huge_pages, bool& mapped) {
+#if defined(__linux__)
+    if (use_huge_pages) {
+        const size_t rounded = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        void* ptr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED) {
+            ptr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr != MAP_FAILED) {
+                madvise(ptr, rounded, MADV_HUGEPAGE);
+            }
+        }
+        if (ptr != MAP_FAILED) {
+            mapped = true;
+            return ptr;
+        }
+    }
+#else
+    (void)use_huge_pages;
+#endif
+    mapped = false;
+    return std::malloc(size);
+}
+
+// Count NUMA nodes via sysfs (no libnuma dependency); 1 off Linux
+inline size_t numa_node_count() {
+#if defined(__linux__)
+    size_t n = 0;
+    char path[64];
+    while (n < MAX_NUMA_NODES) {
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu", n);
+        if (access(path, F_OK) != 0) break;
+        ++n;
+    }
+    return n > 0 ? n : 1;
+#else
+    return 1;
+#endif
+}
+
+// Node of the calling thread, derived from its CPU with the same
+// contiguous-numbering assumption the braid uses to spread tori across
+// sockets. Cached per thread: the threads that matter are pinned.
+inline size_t current_numa_node(size_t num_nodes) {
+    static thread_local size_t node = SIZE_MAX;
+    if (node == SIZE_MAX) {
+#if defined(__linux__)
+        const int cpu = sched_getcpu();
+        const long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+        node = (cpu >= 0 && ncpu > 0)
+                   ? (static_cast<size_t>(cpu) * num_nodes) / static_cast<size_t>(ncpu)
+                   : 0;
+#else
+        node = 0;
+#endif
+    }
+    return node < num_nodes ? node : num_nodes - 1;
+}
+
+inline void arena_release(void* ptr, size_t size, bool mapped) {
+#if defined(__linux__)
+    if (mapped) {
+        const size_t rounded = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        munmap(ptr, rounded);
+        return;
+    }
+#else
+    (void)mapped;
+#endif
+    (void)size;
+    std::free(ptr);
+}
+
 // ============================================================================
 // Lock-Free Freelist Node
 // ============================================================================
@@ -132,7 +430,15 @@ private:
     static constexpr size_t TOTAL_SIZE = CAPACITY * ELEMENT_SIZE;
 
     uint8_t* arena;
+    bool arena_mapped_ = false;
     std::atomic<TaggedFreelistHead> freelists[FREELIST_SLAB_SIZE];
+
+    // Deferred remote frees: blocks freed by threads on other NUMA nodes
+    // land here (one dedicated line, never contended with the local hot
+    // path) and re-enter circulation when a local thread's magazine
+    // refill drains them in a batch
+    std::atomic<TaggedFreelistHead> remote_free_;
+
     std::mutex arena_mutex;
     AllocationStats stats;
     size_t allocated_count;
@@ -172,9 +478,94 @@ private:
         return nullptr;
     }
 
+    // ========== Per-thread magazine layer ==========
+    //
+    // A magazine is a thread-local stack of blocks owned by one pool. The
+    // hot path pops/pushes it with plain loads and stores; only when it
+    // runs empty (refill) or full (drain) does the thread touch the shared
+    // tagged freelists, moving MAGAZINE_BATCH blocks per trip. Cached
+    // blocks flow back to the shared freelists when the thread exits.
+    // Pools are process-lifetime singletons, so a magazine never outlives
+    // its owner.
+    struct Magazine {
+        FixedBlockPool* owner = nullptr;
+        FreelistNode* blocks[MAGAZINE_CAPACITY];
+        size_t count = 0;
+
+        ~Magazine() {
+            if (owner) {
+                owner->drainMagazine(*this, count);
+            }
+        }
+    };
+
+    static Magazine& threadMagazine() {
+        static thread_local Magazine magazine;
+        return magazine;
+    }
+
+    // Return n cached blocks to the shared freelists
+    void drainMagazine(Magazine& mag, size_t n) {
+        while (n-- > 0 && mag.count > 0) {
+            push_to_freelist(mag.blocks[--mag.count]);
+        }
+    }
+
+    // Point the calling thread's magazine at this pool, flushing any
+    // blocks cached for a different pool of the same block geometry
+    Magazine& boundMagazine() {
+        Magazine& mag = threadMagazine();
+        if (mag.owner != this) {
+            if (mag.owner) {
+                mag.owner->drainMagazine(mag, mag.count);
+            }
+            mag.owner = this;
+        }
+        return mag;
+    }
+
+    // Pull up to MAGAZINE_BATCH blocks from the shared freelists, falling
+    // back to draining deferred remote frees
+    void refillMagazine(Magazine& mag) {
+        for (size_t i = 0; i < FREELIST_SLAB_SIZE && mag.count < MAGAZINE_BATCH; ++i) {
+            while (mag.count < MAGAZINE_BATCH) {
+                FreelistNode* node = pop_from_freelist(i);
+                if (!node) break;
+                mag.blocks[mag.count++] = node;
+            }
+        }
+
+        while (mag.count < MAGAZINE_BATCH) {
+            FreelistNode* node = pop_remote();
+            if (!node) break;
+            mag.blocks[mag.count++] = node;
+        }
+    }
+
+    FreelistNode* pop_remote() {
+        TaggedFreelistHead head = remote_free_.load(std::memory_order_acquire);
+
+        while (head.ptr != nullptr) {
+            FreelistNode* next = head.ptr->next;
+            TaggedFreelistHead desired{next, head.tag + 1};
+
+            if (remote_free_.compare_exchange_weak(head, desired,
+                                                   std::memory_order_release,
+                                                   std::memory_order_acquire)) {
+                return head.ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
 public:
-    FixedBlockPool(const char* name) : allocated_count(0) {
-        arena = static_cast<uint8_t*>(std::malloc(TOTAL_SIZE));
+    FixedBlockPool(const char* name, bool huge_pages = ARENA_HUGE_PAGES,
+                   uint32_t pool_id = POOL_NONE)
+        : allocated_count(0) {
+        stats.setPoolId(pool_id);
+        arena = static_cast<uint8_t*>(
+            arena_reserve(TOTAL_SIZE, huge_pages, arena_mapped_));
         if (!arena) {
             throw std::bad_alloc();
         }
@@ -183,31 +574,34 @@ public:
         for (size_t i = 0; i < FREELIST_SLAB_SIZE; ++i) {
             freelists[i].store(TaggedFreelistHead{nullptr, 0}, std::memory_order_relaxed);
         }
+        remote_free_.store(TaggedFreelistHead{nullptr, 0}, std::memory_order_relaxed);
 
         std::cout << "[BoundedAllocator] Initialized " << name
                   << " pool: " << CAPACITY << " x " << ELEMENT_SIZE
-                  << " = " << TOTAL_SIZE << " bytes" << std::endl;
+                  << " = " << TOTAL_SIZE << " bytes"
+                  << (arena_mapped_ ? " (huge-page backed)" : "") << std::endl;
     }
 
     ~FixedBlockPool() {
         if (arena) {
-            std::free(arena);
+            arena_release(arena, TOTAL_SIZE, arena_mapped_);
             arena = nullptr;
         }
     }
 
     void* allocate() {
-        FreelistNode* node = nullptr;
-
-        // Try all slabs (bounded)
-        for (size_t i = 0; i < FREELIST_SLAB_SIZE; ++i) {
-            node = pop_from_freelist(i);
-            if (node) break;
+#if RSE_ALLOC_TELEMETRY
+        const uint64_t t0 = telemetry_cycles();
+#endif
+        // Fast path: pop the calling thread's magazine (no atomics)
+        Magazine& mag = boundMagazine();
+        if (mag.count == 0) {
+            refillMagazine(mag);
         }
 
         void* ptr = nullptr;
-        if (node) {
-            ptr = node;
+        if (mag.count > 0) {
+            ptr = mag.blocks[--mag.count];
         } else {
             // Allocate from arena
             std::lock_guard<std::mutex> lock(arena_mutex);
@@ -215,12 +609,15 @@ public:
                 ptr = arena + (allocated_count * ELEMENT_SIZE);
                 allocated_count++;
             } else {
-                stats.recordFailure();
+                stats.recordFailure(ELEMENT_SIZE);
                 return nullptr;
             }
         }
 
         stats.recordAllocation(ELEMENT_SIZE);
+#if RSE_ALLOC_TELEMETRY
+        stats.recordLatency(telemetry_cycles() - t0);
+#endif
         return ptr;
     }
 
@@ -238,7 +635,45 @@ public:
 
         FreelistNode* node = reinterpret_cast<FreelistNode*>(ptr);
         node->size = ELEMENT_SIZE;
-        push_to_freelist(node);
+
+        // Fast path: push onto the calling thread's magazine (no atomics);
+        // drain a batch to the shared freelists only when it fills up
+        Magazine& mag = boundMagazine();
+        if (mag.count == MAGAZINE_CAPACITY) {
+            drainMagazine(mag, MAGAZINE_BATCH);
+        }
+        mag.blocks[mag.count++] = node;
+
+        stats.recordDeallocation(ELEMENT_SIZE);
+    }
+
+    // True if ptr came from this pool's arena (used for NUMA routing)
+    bool owns(const void* ptr) const {
+        const uintptr_t p = reinterpret_cast<uintptr_t>(ptr);
+        const uintptr_t start = reinterpret_cast<uintptr_t>(arena);
+        return p >= start && p < start + TOTAL_SIZE;
+    }
+
+    // Free from a thread on a different NUMA node: defer onto the remote
+    // list instead of polluting the freeing thread's magazine
+    void remoteFree(void* ptr) {
+        if (!ptr || !owns(ptr)) {
+            std::cerr << "[BoundedAllocator] ERROR: Pointer not in pool!" << std::endl;
+            return;
+        }
+
+        FreelistNode* node = reinterpret_cast<FreelistNode*>(ptr);
+        node->size = ELEMENT_SIZE;
+
+        TaggedFreelistHead head = remote_free_.load(std::memory_order_acquire);
+        TaggedFreelistHead desired{};
+        do {
+            node->next = head.ptr;
+            desired.ptr = node;
+            desired.tag = head.tag + 1;
+        } while (!remote_free_.compare_exchange_weak(head, desired,
+                                                     std::memory_order_release,
+                                                     std::memory_order_acquire));
 
         stats.recordDeallocation(ELEMENT_SIZE);
     }
@@ -256,34 +691,97 @@ public:
     size_t getCurrentUsage() const {
         return stats.current_usage.load(std::memory_order_relaxed);
     }
+
+    AllocationSnapshot snapshot() const { return stats.snapshot(); }
 };
 
 // ============================================================================
-// Generic Slab-Based Memory Pool (for miscellaneous allocations)
+// Generic Segregated Size-Class Pool (for miscellaneous allocations)
 // ============================================================================
 
+template <size_t CAPACITY = GENERIC_POOL_CAPACITY>
 class GenericPool {
 private:
     uint8_t* arena;
-    std::atomic<size_t> allocated_offset{0};
+    bool arena_mapped_ = false;
+    // Atomic so snapshot() can read the bump cursor without taking
+    // arena_mutex; all writes still happen under the lock
+    std::atomic<size_t> bump_offset_{0};
+    std::atomic<TaggedFreelistHead> class_freelists[GENERIC_NUM_CLASSES];
+    // Blocks currently banked per class freelist (relaxed, approximate
+    // while hot) — feeds the fragmentation fields of snapshot()
+    std::atomic<size_t> class_free_counts[GENERIC_NUM_CLASSES] = {};
     AllocationStats stats;
     std::mutex arena_mutex;
 
+    // Smallest power-of-two class whose block fits total bytes
+    static size_t classIndex(size_t total) {
+        const size_t shift = std::max<size_t>(
+            GENERIC_MIN_CLASS_SHIFT,
+            static_cast<size_t>(std::bit_width(total - 1)));
+        return shift - GENERIC_MIN_CLASS_SHIFT;
+    }
+
+    static size_t classSize(size_t idx) {
+        return size_t{1} << (idx + GENERIC_MIN_CLASS_SHIFT);
+    }
+
+    void push_to_class(size_t idx, FreelistNode* node) {
+        TaggedFreelistHead head = class_freelists[idx].load(std::memory_order_acquire);
+        TaggedFreelistHead desired{};
+
+        do {
+            node->next = head.ptr;
+            desired.ptr = node;
+            desired.tag = head.tag + 1;
+        } while (!class_freelists[idx].compare_exchange_weak(head, desired,
+                                                             std::memory_order_release,
+                                                             std::memory_order_acquire));
+        class_free_counts[idx].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    FreelistNode* pop_from_class(size_t idx) {
+        TaggedFreelistHead head = class_freelists[idx].load(std::memory_order_acquire);
+
+        while (head.ptr != nullptr) {
+            FreelistNode* next = head.ptr->next;
+            TaggedFreelistHead desired{next, head.tag + 1};
+
+            if (class_freelists[idx].compare_exchange_weak(head, desired,
+                                                           std::memory_order_release,
+                                                           std::memory_order_acquire)) {
+                class_free_counts[idx].fetch_sub(1, std::memory_order_relaxed);
+                return head.ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
 public:
-    GenericPool() {
-        arena = static_cast<uint8_t*>(std::malloc(GENERIC_POOL_CAPACITY));
+    GenericPool(bool huge_pages = ARENA_HUGE_PAGES) {
+        stats.setPoolId(POOL_GENERIC);
+        arena = static_cast<uint8_t*>(
+            arena_reserve(CAPACITY, huge_pages, arena_mapped_));
         if (!arena) {
             throw std::bad_alloc();
         }
-        std::memset(arena, 0, GENERIC_POOL_CAPACITY);
-        
-        std::cout << "[BoundedAllocator] Initialized generic pool: " 
-                  << GENERIC_POOL_CAPACITY << " bytes" << std::endl;
+        std::memset(arena, 0, CAPACITY);
+
+        for (size_t i = 0; i < GENERIC_NUM_CLASSES; ++i) {
+            class_freelists[i].store(TaggedFreelistHead{nullptr, 0},
+                                     std::memory_order_relaxed);
+        }
+
+        std::cout << "[BoundedAllocator] Initialized generic pool: "
+                  << CAPACITY << " bytes, "
+                  << GENERIC_NUM_CLASSES << " size classes"
+                  << (arena_mapped_ ? " (huge-page backed)" : "") << std::endl;
     }
 
     ~GenericPool() {
         if (arena) {
-            std::free(arena);
+            arena_release(arena, CAPACITY, arena_mapped_);
             arena = nullptr;
         }
     }
@@ -291,30 +789,114 @@ public:
     void* allocate(size_t size) {
         if (size == 0) size = 1;
 
-        std::lock_guard<std::mutex> lock(arena_mutex);
-        size_t current_offset = allocated_offset.load(std::memory_order_relaxed);
-        
-        if (current_offset + size > GENERIC_POOL_CAPACITY) {
-            stats.recordFailure();
-            return nullptr;
+#if RSE_ALLOC_TELEMETRY
+        const uint64_t t0 = telemetry_cycles();
+#endif
+        const size_t total = size + GENERIC_HEADER_SIZE;
+
+        uint8_t* block = nullptr;
+        size_t block_size;
+        uint32_t size_class;
+
+        if (total <= classSize(GENERIC_NUM_CLASSES - 1)) {
+            const size_t idx = classIndex(total);
+            block_size = classSize(idx);
+            size_class = static_cast<uint32_t>(idx);
+            block = reinterpret_cast<uint8_t*>(pop_from_class(idx));
+        } else {
+            // Oversized: exact bump allocation, not reclaimed
+            block_size = (total + GENERIC_HEADER_SIZE - 1) &
+                         ~(GENERIC_HEADER_SIZE - 1);
+            size_class = GENERIC_CLASS_LARGE;
         }
 
-        void* ptr = arena + current_offset;
-        allocated_offset.fetch_add(size, std::memory_order_release);
-        stats.recordAllocation(size);
-        
-        return ptr;
+        if (!block) {
+            std::lock_guard<std::mutex> lock(arena_mutex);
+            const size_t offset = bump_offset_.load(std::memory_order_relaxed);
+            if (offset + block_size > CAPACITY) {
+                stats.recordFailure(size);
+                return nullptr;
+            }
+            block = arena + offset;
+            bump_offset_.store(offset + block_size, std::memory_order_relaxed);
+        }
+
+        *reinterpret_cast<uint32_t*>(block) = size_class;
+        stats.recordAllocation(block_size);
+#if RSE_ALLOC_TELEMETRY
+        stats.recordLatency(telemetry_cycles() - t0);
+#endif
+
+        return block + GENERIC_HEADER_SIZE;
     }
 
-    void deallocate(void*) {
-        // Generic pool is not reused (arena-style)
+    void deallocate(void* ptr) {
+        if (!ptr) return;
+
+        uint8_t* block = static_cast<uint8_t*>(ptr) - GENERIC_HEADER_SIZE;
+        uintptr_t block_val = reinterpret_cast<uintptr_t>(block);
+        uintptr_t arena_start = reinterpret_cast<uintptr_t>(arena);
+        uintptr_t arena_end = arena_start + CAPACITY;
+
+        if (block_val < arena_start || block_val >= arena_end) {
+            return;  // Foreign pointer (e.g. pre-init malloc) — ignore
+        }
+
+        const uint32_t size_class = *reinterpret_cast<uint32_t*>(block);
+        if (size_class >= GENERIC_NUM_CLASSES) {
+            return;  // Oversized block: arena-style, never reclaimed
+        }
+
+        // O(1): push onto the block's size-class freelist
+        FreelistNode* node = reinterpret_cast<FreelistNode*>(block);
+        node->size = classSize(size_class);
+        push_to_class(size_class, node);
+
+        stats.recordDeallocation(classSize(size_class));
     }
 
     void printStats() const { stats.print("Generic Pool"); }
-    
+
     size_t getCurrentUsage() const {
         return stats.current_usage.load(std::memory_order_relaxed);
     }
+
+    // Base counters plus the fragmentation view: class blocks are never
+    // coalesced, so the largest reusable run from the freelists is the
+    // biggest class with a banked block; the bump tail is the only truly
+    // contiguous free region. Relaxed reads throughout — approximate
+    // while the pool is hot, exact when quiescent.
+    AllocationSnapshot snapshot() const {
+        AllocationSnapshot snap = stats.snapshot();
+        const size_t bump_free =
+            CAPACITY - bump_offset_.load(std::memory_order_relaxed);
+        uint64_t banked = 0;
+        uint64_t largest = bump_free;
+        for (size_t i = 0; i < GENERIC_NUM_CLASSES; ++i) {
+            const size_t n =
+                class_free_counts[i].load(std::memory_order_relaxed);
+            if (n > 0) {
+                banked += static_cast<uint64_t>(n) * classSize(i);
+                if (classSize(i) > largest) {
+                    largest = classSize(i);
+                }
+            }
+        }
+        snap.free_bytes = bump_free + banked;
+        snap.largest_free_run = largest;
+        return snap;
+    }
+
+    // 0 when all free memory is one reusable run; climbs toward 100 as
+    // the free bytes scatter into small class blocks
+    double fragmentationPct() const {
+        const AllocationSnapshot snap = snapshot();
+        if (snap.free_bytes == 0) {
+            return 0.0;
+        }
+        return 100.0 * (1.0 - static_cast<double>(snap.largest_free_run) /
+                                  static_cast<double>(snap.free_bytes));
+    }
 };
 
 // ============================================================================
@@ -324,125 +906,227 @@ public:
 // Forward declare the guard variable
 static thread_local bool g_in_allocator_init;
 
-class BoundedArenaAllocator {
+template <typename Sizing = DefaultPoolSizing>
+class BoundedArenaAllocatorT {
 private:
-    static bool initializing;
-    
-    FixedBlockPool<PROCESS_BLOCK_SIZE, PROCESS_POOL_CAPACITY>* process_pool;
-    FixedBlockPool<EVENT_BLOCK_SIZE, EVENT_POOL_CAPACITY>* event_pool;
-    FixedBlockPool<EDGE_BLOCK_SIZE, EDGE_POOL_CAPACITY>* edge_pool;
-    GenericPool* generic_pool;
+    static inline bool initializing = false;
+
+    using ProcessPool = FixedBlockPool<Sizing::PROCESS_BLOCK, Sizing::PROCESS_CAPACITY>;
+    using EventPool = FixedBlockPool<Sizing::EVENT_BLOCK, Sizing::EVENT_CAPACITY>;
+    using EdgePool = FixedBlockPool<Sizing::EDGE_BLOCK, Sizing::EDGE_CAPACITY>;
+    using GenericPoolT = GenericPool<Sizing::GENERIC_CAPACITY>;
+
+    // One replica of each fixed block pool per NUMA node; allocations
+    // route to the caller's node, cross-node frees defer to the home
+    // replica's remote list. The generic pool stays global — it serves
+    // cold miscellaneous allocations, not the event hot path.
+    size_t num_nodes_;
+    ProcessPool* process_pools[MAX_NUMA_NODES] = {};
+    EventPool* event_pools[MAX_NUMA_NODES] = {};
+    EdgePool* edge_pools[MAX_NUMA_NODES] = {};
+    GenericPoolT* generic_pool;
+
+    size_t localNode() const { return current_numa_node(num_nodes_); }
+
+    // Replica whose arena contains ptr (bounded scan over the node count)
+    template <typename Pool>
+    size_t homeNode(Pool* const (&pools)[MAX_NUMA_NODES], const void* ptr) const {
+        for (size_t n = 0; n < num_nodes_; ++n) {
+            if (pools[n]->owns(ptr)) return n;
+        }
+        return localNode();  // Not ours: let the local replica report it
+    }
 
-    BoundedArenaAllocator()
-        : process_pool(nullptr), event_pool(nullptr), edge_pool(nullptr), generic_pool(nullptr)
+    template <typename Pool>
+    void routeFree(Pool* const (&pools)[MAX_NUMA_NODES], void* ptr) {
+        if (!ptr) return;
+        const size_t home = homeNode(pools, ptr);
+        if (home == localNode()) {
+            pools[home]->deallocate(ptr);
+        } else {
+            pools[home]->remoteFree(ptr);
+        }
+    }
+
+    BoundedArenaAllocatorT()
+        : num_nodes_(numa_node_count()), generic_pool(nullptr)
     {
         std::cout << "\n[BoundedAllocator] ========== INITIALIZATION ==========" << std::endl;
-        
+        if (num_nodes_ > 1) {
+            std::cout << "[BoundedAllocator] NUMA partitioning: " << num_nodes_
+                      << " nodes" << std::endl;
+        }
+
         g_in_allocator_init = true;
-        
+
         try {
-            process_pool = new FixedBlockPool<PROCESS_BLOCK_SIZE, PROCESS_POOL_CAPACITY>("Process");
-            event_pool = new FixedBlockPool<EVENT_BLOCK_SIZE, EVENT_POOL_CAPACITY>("Event");
-            edge_pool = new FixedBlockPool<EDGE_BLOCK_SIZE, EDGE_POOL_CAPACITY>("Edge");
-            generic_pool = new GenericPool();
-            
+            for (size_t n = 0; n < num_nodes_; ++n) {
+                char label[32];
+                snprintf(label, sizeof(label), "Process[node%zu]", n);
+                process_pools[n] = new ProcessPool(label, ARENA_HUGE_PAGES, POOL_PROCESS);
+                snprintf(label, sizeof(label), "Event[node%zu]", n);
+                event_pools[n] = new EventPool(label, ARENA_HUGE_PAGES, POOL_EVENT);
+                snprintf(label, sizeof(label), "Edge[node%zu]", n);
+                edge_pools[n] = new EdgePool(label, ARENA_HUGE_PAGES, POOL_EDGE);
+            }
+            generic_pool = new GenericPoolT();
+
+            // Reserved-vs-expected report: what this policy actually
+            // reserved (alignment rounding, node replication) against the
+            // raw capacities it declares
+            const size_t per_node_reserved =
+                process_pools[0]->getCapacity() * process_pools[0]->getBlockSize() +
+                event_pools[0]->getCapacity() * event_pools[0]->getBlockSize() +
+                edge_pools[0]->getCapacity() * edge_pools[0]->getBlockSize();
+            const size_t reserved = per_node_reserved * num_nodes_ + Sizing::GENERIC_CAPACITY;
+            const size_t expected =
+                Sizing::PROCESS_CAPACITY * Sizing::PROCESS_BLOCK +
+                Sizing::EVENT_CAPACITY * Sizing::EVENT_BLOCK +
+                Sizing::EDGE_CAPACITY * Sizing::EDGE_BLOCK +
+                Sizing::GENERIC_CAPACITY;
+            std::cout << "[BoundedAllocator] Sizing policy: " << Sizing::NAME
+                      << " — reserved " << reserved << " bytes ("
+                      << num_nodes_ << " node set(s)), policy expects "
+                      << expected << " bytes" << std::endl;
+
             std::cout << "[BoundedAllocator] ========== READY ==========" << std::endl;
         } catch (const std::bad_alloc& e) {
             std::cerr << "[BoundedAllocator] FATAL: Failed to initialize pools!" << std::endl;
             throw;
         }
-        
+
         g_in_allocator_init = false;
     }
 
 public:
-    ~BoundedArenaAllocator() {
-        delete process_pool;
-        delete event_pool;
-        delete edge_pool;
+    ~BoundedArenaAllocatorT() {
+        for (size_t n = 0; n < num_nodes_; ++n) {
+            delete process_pools[n];
+            delete event_pools[n];
+            delete edge_pools[n];
+        }
         delete generic_pool;
     }
 
-    static BoundedArenaAllocator& getInstance() {
-        static BoundedArenaAllocator instance;
+    static BoundedArenaAllocatorT& getInstance() {
+        static BoundedArenaAllocatorT instance;
         return instance;
     }
 
     void* allocateProcess(size_t size) {
-        if (size > PROCESS_BLOCK_SIZE) {
+        if (size > Sizing::PROCESS_BLOCK) {
             std::cerr << "[BoundedAllocator] Process allocation too large: " << size << std::endl;
             return nullptr;
         }
-        return process_pool->allocate();
+        return process_pools[localNode()]->allocate();
     }
 
     void deallocateProcess(void* ptr) {
-        process_pool->deallocate(ptr);
+        routeFree(process_pools, ptr);
     }
 
     void* allocateEvent(size_t size) {
-        if (size > EVENT_BLOCK_SIZE) {
+        RSE_PROFILE_SCOPE(SITE_ARENA_EVENT_ALLOC);
+        if (size > Sizing::EVENT_BLOCK) {
             std::cerr << "[BoundedAllocator] Event allocation too large: " << size << std::endl;
             return nullptr;
         }
-        return event_pool->allocate();
+        return event_pools[localNode()]->allocate();
     }
 
     void deallocateEvent(void* ptr) {
-        event_pool->deallocate(ptr);
+        RSE_PROFILE_SCOPE(SITE_ARENA_EVENT_FREE);
+        routeFree(event_pools, ptr);
     }
 
     void* allocateEdge(size_t size) {
-        if (size > EDGE_BLOCK_SIZE) {
+        if (size > Sizing::EDGE_BLOCK) {
             std::cerr << "[BoundedAllocator] Edge allocation too large: " << size << std::endl;
             return nullptr;
         }
-        return edge_pool->allocate();
+        return edge_pools[localNode()]->allocate();
     }
 
     void deallocateEdge(void* ptr) {
-        edge_pool->deallocate(ptr);
+        routeFree(edge_pools, ptr);
     }
 
     void* allocateGeneric(size_t size) {
+        RSE_PROFILE_SCOPE(SITE_ARENA_GENERIC_ALLOC);
         return generic_pool->allocate(size);
     }
 
     void deallocateGeneric(void* ptr) {
+        RSE_PROFILE_SCOPE(SITE_ARENA_GENERIC_FREE);
         generic_pool->deallocate(ptr);
     }
 
     void printAllStats() const {
         std::cout << "\n[BoundedAllocator] ========== FINAL STATISTICS ==========" << std::endl;
-        process_pool->printStats("Process Pool");
-        event_pool->printStats("Event Pool");
-        edge_pool->printStats("Edge Pool");
+        for (size_t n = 0; n < num_nodes_; ++n) {
+            process_pools[n]->printStats("Process Pool");
+            event_pools[n]->printStats("Event Pool");
+            edge_pools[n]->printStats("Edge Pool");
+        }
         generic_pool->printStats();
         std::cout << "[BoundedAllocator] ===================================" << std::endl << std::endl;
     }
 
-    // Capacity queries
-    size_t getProcessPoolCapacity() const { return process_pool->getCapacity(); }
-    size_t getEventPoolCapacity() const { return event_pool->getCapacity(); }
-    size_t getEdgePoolCapacity() const { return edge_pool->getCapacity(); }
-    
+    // Capacity queries (per node replica)
+    size_t getProcessPoolCapacity() const { return process_pools[0]->getCapacity(); }
+    size_t getEventPoolCapacity() const { return event_pools[0]->getCapacity(); }
+    size_t getEdgePoolCapacity() const { return edge_pools[0]->getCapacity(); }
+
+    size_t getNumNodes() const { return num_nodes_; }
+
+    // Usage aggregated over all node replicas
     size_t getProcessPoolUsage() const {
-        return process_pool->getCurrentUsage();
+        size_t total = 0;
+        for (size_t n = 0; n < num_nodes_; ++n) total += process_pools[n]->getCurrentUsage();
+        return total;
     }
     size_t getEventPoolUsage() const {
-        return event_pool->getCurrentUsage();
+        size_t total = 0;
+        for (size_t n = 0; n < num_nodes_; ++n) total += event_pools[n]->getCurrentUsage();
+        return total;
     }
     size_t getEdgePoolUsage() const {
-        return edge_pool->getCurrentUsage();
+        size_t total = 0;
+        for (size_t n = 0; n < num_nodes_; ++n) total += edge_pools[n]->getCurrentUsage();
+        return total;
     }
 
     size_t getGenericPoolUsage() const {
         return generic_pool->getCurrentUsage();
     }
+
+    // Lock-free telemetry snapshots for monitoring agents (relaxed reads
+    // only — never stalls the allocating threads)
+    AllocationSnapshot snapshotProcessPool(size_t node = 0) const {
+        return process_pools[node]->snapshot();
+    }
+    AllocationSnapshot snapshotEventPool(size_t node = 0) const {
+        return event_pools[node]->snapshot();
+    }
+    AllocationSnapshot snapshotEdgePool(size_t node = 0) const {
+        return edge_pools[node]->snapshot();
+    }
+    AllocationSnapshot snapshotGenericPool() const { return generic_pool->snapshot(); }
+
+    // Fragmentation drift monitor for long-running tori (see
+    // GenericPool::fragmentationPct)
+    double getGenericFragmentationPct() const {
+        return generic_pool->fragmentationPct();
+    }
 };
 
-// Initialize static member
-bool BoundedArenaAllocator::initializing = false;
+// Build targets select their sizing policy via RSE_POOL_SIZING_POLICY
+// (a compile definition); everything else keeps using the plain
+// BoundedArenaAllocator name
+#ifndef RSE_POOL_SIZING_POLICY
+#define RSE_POOL_SIZING_POLICY DefaultPoolSizing
+#endif
+using BoundedArenaAllocator = BoundedArenaAllocatorT<RSE_POOL_SIZING_POLICY>;
 
 // ============================================================================
 // Global new/delete operators (routes through allocator)
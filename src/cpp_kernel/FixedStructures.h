@@ -1,6 +1,15 @@
 #pragma once
 
 #include <array>
+#ifdef RSE_KERNEL
+// Hosted <atomic> drags <iosfwd> in through bits/atomic_wait.h and
+// collides with the kernel's stream stubs; the stubs carry the atomic
+// subset the fixed structures need
+#include "os/KernelStubs.h"
+#else
+#include <atomic>
+#endif
+#include <bit>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -40,6 +49,21 @@ public:
 
   constexpr void clear() { size_ = 0; }
 
+  constexpr T &back() {
+    assert(size_ > 0);
+    return data_[size_ - 1];
+  }
+
+  constexpr const T &back() const {
+    assert(size_ > 0);
+    return data_[size_ - 1];
+  }
+
+  constexpr void pop_back() {
+    assert(size_ > 0);
+    --size_;
+  }
+
   [[nodiscard]] constexpr bool erase_first(const T &value) {
     for (std::size_t i = 0; i < size_; ++i) {
       if (data_[i] == value) {
@@ -58,6 +82,24 @@ public:
     --size_;
   }
 
+  // Swap-remove variants: O(1), do not preserve element order. The right
+  // erase for pointer cells and other sets where order carries no meaning.
+  [[nodiscard]] constexpr bool erase_first_unordered(const T &value) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      if (data_[i] == value) {
+        erase_at_unordered(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  constexpr void erase_at_unordered(std::size_t idx) {
+    assert(idx < size_);
+    data_[idx] = std::move(data_[size_ - 1]);
+    --size_;
+  }
+
   [[nodiscard]] constexpr std::size_t size() const { return size_; }
   [[nodiscard]] constexpr std::size_t capacity() const { return CAPACITY; }
   [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
@@ -101,6 +143,26 @@ public:
     return true;
   }
 
+  // Append a batch of values and restore the heap property with a single
+  // bottom-up heapify (O(size) total instead of O(count * log size)).
+  [[nodiscard]] constexpr bool pushBatch(const T *values, std::size_t count) {
+    if (count == 0) {
+      return true;
+    }
+    if (size_ + count > CAPACITY) {
+      assert(false && "FixedMinHeap capacity exceeded");
+      return false;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      data_[size_ + i] = values[i];
+    }
+    size_ += count;
+    for (std::size_t i = size_ / 2; i-- > 0;) {
+      siftDown(i);
+    }
+    return true;
+  }
+
   [[nodiscard]] constexpr bool pop() {
     if (size_ == 0) {
       return false;
@@ -113,6 +175,33 @@ public:
     return true;
   }
 
+  // Bulk-extract every element matching pred into out (at most max_out),
+  // compacting the survivors and re-heapifying bottom-up: O(size) total
+  // instead of O(count * log size) worth of pops. Extracted elements come
+  // out in internal array order, not sorted order — callers that need them
+  // ordered sort the batch afterwards.
+  template <typename Pred>
+  [[nodiscard]] constexpr std::size_t drainIf(Pred pred, T *out,
+                                              std::size_t max_out) {
+    std::size_t taken = 0;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < size_; ++i) {
+      if (taken < max_out && pred(data_[i])) {
+        out[taken++] = data_[i];
+      } else {
+        data_[kept++] = data_[i];
+      }
+    }
+    if (taken == 0) {
+      return 0;
+    }
+    size_ = kept;
+    for (std::size_t i = size_ / 2; i-- > 0;) {
+      siftDown(i);
+    }
+    return taken;
+  }
+
   [[nodiscard]] constexpr const T &top() const {
     assert(size_ > 0);
     return data_[0];
@@ -161,6 +250,530 @@ private:
   [[no_unique_address]] Compare comp_{};
 };
 
+// Cache-aware 4-ary variant of FixedMinHeap. Halving the tree depth halves
+// the number of dependent compare-and-swap levels per pop, the four children
+// of a node are contiguous (one cache line for small T), the min-of-children
+// scan is written as conditional selects so it compiles to cmov rather than
+// a branch per child, and the grandchild line is prefetched while the current
+// level is being compared. Interface mirrors FixedMinHeap so it can be
+// swapped in as an event-queue policy.
+template <typename T, std::size_t CAPACITY, typename Compare = std::less<T>>
+class FixedQuadHeap {
+  static_assert(CAPACITY > 0, "FixedQuadHeap capacity must be > 0");
+
+public:
+  constexpr FixedQuadHeap() = default;
+
+  [[nodiscard]] constexpr bool push(const T &value) {
+    if (size_ >= CAPACITY) {
+      assert(false && "FixedQuadHeap capacity exceeded");
+      return false;
+    }
+    data_[size_] = value;
+    siftUp(size_);
+    ++size_;
+    return true;
+  }
+
+  // Append a batch of values and restore the heap property with a single
+  // bottom-up heapify (O(size) total instead of O(count * log size)).
+  [[nodiscard]] constexpr bool pushBatch(const T *values, std::size_t count) {
+    if (count == 0) {
+      return true;
+    }
+    if (size_ + count > CAPACITY) {
+      assert(false && "FixedQuadHeap capacity exceeded");
+      return false;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      data_[size_ + i] = values[i];
+    }
+    size_ += count;
+    for (std::size_t i = (size_ + 2) / 4; i-- > 0;) {
+      siftDown(i);
+    }
+    return true;
+  }
+
+  [[nodiscard]] constexpr bool pop() {
+    if (size_ == 0) {
+      return false;
+    }
+    --size_;
+    if (size_ > 0) {
+      data_[0] = data_[size_];
+      siftDown(0);
+    }
+    return true;
+  }
+
+  [[nodiscard]] constexpr const T &top() const {
+    assert(size_ > 0);
+    return data_[0];
+  }
+
+  [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
+  [[nodiscard]] constexpr std::size_t size() const { return size_; }
+  [[nodiscard]] constexpr std::size_t capacity() const { return CAPACITY; }
+
+  constexpr void clear() { size_ = 0; }
+
+private:
+  constexpr void siftUp(std::size_t idx) {
+    while (idx > 0) {
+      std::size_t parent = (idx - 1) / 4;
+      if (!comp_(data_[idx], data_[parent])) {
+        break;
+      }
+      std::swap(data_[idx], data_[parent]);
+      idx = parent;
+    }
+  }
+
+  constexpr void siftDown(std::size_t idx) {
+    while (true) {
+      const std::size_t first = idx * 4 + 1;
+      if (first >= size_) {
+        break;
+      }
+#if defined(__GNUC__) || defined(__clang__)
+      if (!std::is_constant_evaluated()) {
+        // Pull the first grandchild line in while this level is compared.
+        __builtin_prefetch(&data_[first * 4 + 1 < CAPACITY ? first * 4 + 1
+                                                           : CAPACITY - 1]);
+      }
+#endif
+      const std::size_t last = first + 4 < size_ ? first + 4 : size_;
+      std::size_t best = first;
+      for (std::size_t child = first + 1; child < last; ++child) {
+        // Conditional select rather than a taken/not-taken branch per child
+        best = comp_(data_[child], data_[best]) ? child : best;
+      }
+      if (!comp_(data_[best], data_[idx])) {
+        break;
+      }
+      std::swap(data_[idx], data_[best]);
+      idx = best;
+    }
+  }
+
+  std::array<T, CAPACITY> data_{};
+  std::size_t size_ = 0;
+  [[no_unique_address]] Compare comp_{};
+};
+
+// Bounded timing-wheel priority queue keyed on a `timestamp` member.
+// Events within the wheel horizon (NUM_SLOTS ticks of the current time) get
+// O(1) scheduling into per-tick slots; events beyond the horizon, or events
+// landing on a full slot, spill into a bounded overflow min-heap and migrate
+// back onto the wheel as time advances. Interface mirrors FixedMinHeap so it
+// can be swapped in as an event-queue policy.
+//
+// Ordering: events are served in non-decreasing timestamp order. Within one
+// timestamp the canonical operator< order is preserved (slot entries are
+// scanned for the minimum), matching FixedMinHeap semantics.
+template <typename T, std::size_t CAPACITY, std::size_t NUM_SLOTS = 1024,
+          std::size_t SLOT_CAPACITY = 64>
+class FixedTimingWheel {
+  static_assert(CAPACITY > 0, "FixedTimingWheel capacity must be > 0");
+  static_assert(NUM_SLOTS > 0, "FixedTimingWheel slot count must be > 0");
+
+public:
+  constexpr FixedTimingWheel() = default;
+
+  [[nodiscard]] bool push(const T &value) {
+    if (size_ >= CAPACITY) {
+      assert(false && "FixedTimingWheel capacity exceeded");
+      return false;
+    }
+
+    // Never schedule in the past: late events fire on the current tick.
+    const unsigned long long ts =
+        value.timestamp < wheel_time_ ? wheel_time_ : value.timestamp;
+
+    if (ts - wheel_time_ < NUM_SLOTS) {
+      Slot &slot = slots_[slotIndex(ts)];
+      if (!slot.full()) {
+        (void)slot.push_back(value);
+        ++wheel_size_;
+        ++size_;
+        return true;
+      }
+      // Slot full: fall through to the overflow tier.
+    }
+
+    if (!overflow_.push(value)) {
+      return false;
+    }
+    ++size_;
+    return true;
+  }
+
+  [[nodiscard]] bool pushBatch(const T *values, std::size_t count) {
+    if (size_ + count > CAPACITY) {
+      assert(false && "FixedTimingWheel capacity exceeded");
+      return false;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      (void)push(values[i]);
+    }
+    return true;
+  }
+
+  [[nodiscard]] const T &top() {
+    assert(size_ > 0);
+    const Cursor c = locateMin();
+    if (c.from_overflow) {
+      return overflow_.top();
+    }
+    return slots_[cursor_][c.slot_entry];
+  }
+
+  [[nodiscard]] bool pop() {
+    if (size_ == 0) {
+      return false;
+    }
+    const Cursor c = locateMin();
+    if (c.from_overflow) {
+      (void)overflow_.pop();
+    } else {
+      slots_[cursor_].erase_at(c.slot_entry);
+      --wheel_size_;
+    }
+    --size_;
+    return true;
+  }
+
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
+
+  void clear() {
+    for (std::size_t i = 0; i < NUM_SLOTS; ++i) {
+      slots_[i].clear();
+    }
+    overflow_.clear();
+    wheel_size_ = 0;
+    size_ = 0;
+    cursor_ = 0;
+    wheel_time_ = 0;
+  }
+
+private:
+  using Slot = FixedVector<T, SLOT_CAPACITY>;
+
+  struct Cursor {
+    bool from_overflow;
+    std::size_t slot_entry;
+  };
+
+  [[nodiscard]] std::size_t slotIndex(unsigned long long ts) const {
+    return (cursor_ + static_cast<std::size_t>(ts - wheel_time_)) % NUM_SLOTS;
+  }
+
+  // Advance the cursor to the next occupied tick and, when the wheel drains,
+  // migrate due overflow entries back onto it. Returns where the canonical
+  // minimum lives (current slot entry or overflow top).
+  Cursor locateMin() {
+    if (wheel_size_ == 0 && !overflow_.empty()) {
+      refillFromOverflow();
+    }
+
+    while (wheel_size_ > 0 && slots_[cursor_].empty()) {
+      cursor_ = (cursor_ + 1) % NUM_SLOTS;
+      ++wheel_time_;
+    }
+
+    if (wheel_size_ == 0) {
+      return Cursor{true, 0};
+    }
+
+    Slot &slot = slots_[cursor_];
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < slot.size(); ++i) {
+      if (slot[i] < slot[best]) {
+        best = i;
+      }
+    }
+
+    // A full-slot spill can leave an equal-or-earlier event in the overflow
+    // tier; honor canonical order across both tiers.
+    if (!overflow_.empty() && overflow_.top() < slot[best]) {
+      return Cursor{true, 0};
+    }
+    return Cursor{false, best};
+  }
+
+  void refillFromOverflow() {
+    wheel_time_ = overflow_.top().timestamp;
+    cursor_ = 0;
+    while (!overflow_.empty()) {
+      const T &next = overflow_.top();
+      if (next.timestamp - wheel_time_ >= NUM_SLOTS) {
+        break;
+      }
+      Slot &slot = slots_[slotIndex(next.timestamp)];
+      if (slot.full()) {
+        break; // Slot full again; leave the rest in the overflow tier.
+      }
+      (void)slot.push_back(next);
+      ++wheel_size_;
+      (void)overflow_.pop();
+    }
+  }
+
+  std::array<Slot, NUM_SLOTS> slots_{};
+  FixedMinHeap<T, CAPACITY> overflow_;
+  std::size_t wheel_size_ = 0;
+  std::size_t size_ = 0;
+  std::size_t cursor_ = 0;
+  unsigned long long wheel_time_ = 0;
+};
+
+// Bounded lock-free multi-producer/single-consumer ring (Vyukov-style
+// sequence numbers). Producers reserve slots with a CAS loop and never block;
+// the single consumer's pop is wait-free. Capacity must be a power of two.
+template <typename T, std::size_t CAPACITY>
+class FixedMPSCRing {
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "FixedMPSCRing capacity must be a power of two");
+
+public:
+  FixedMPSCRing() {
+    for (std::size_t i = 0; i < CAPACITY; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  FixedMPSCRing(const FixedMPSCRing &) = delete;
+  FixedMPSCRing &operator=(const FixedMPSCRing &) = delete;
+
+  // Producer side: lock-free, returns false when the ring is full.
+  [[nodiscard]] bool push(const T &value) {
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell &cell = cells_[pos & kMask];
+      const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::intptr_t dif = static_cast<std::intptr_t>(seq) -
+                                static_cast<std::intptr_t>(pos);
+      if (dif == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        return false; // Full
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer side: wait-free, single consumer only.
+  [[nodiscard]] bool pop(T &out) {
+    Cell &cell = cells_[tail_ & kMask];
+    const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<std::intptr_t>(seq) -
+            static_cast<std::intptr_t>(tail_ + 1) <
+        0) {
+      return false; // Empty
+    }
+    out = cell.value;
+    cell.sequence.store(tail_ + CAPACITY, std::memory_order_release);
+    ++tail_;
+    return true;
+  }
+
+  // Approximate under concurrent producers; exact when quiescent.
+  [[nodiscard]] std::size_t size() const {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    return head >= tail_ ? head - tail_ : 0;
+  }
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
+
+private:
+  static constexpr std::size_t kMask = CAPACITY - 1;
+
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  std::array<Cell, CAPACITY> cells_{};
+  alignas(64) std::atomic<std::size_t> head_{0};
+  alignas(64) std::size_t tail_ = 0;
+};
+
+// Bounded lock-free multi-producer/multi-consumer ring. Per-cell
+// sequence numbers arbitrate both sides: a producer claims a slot with
+// one CAS on head_ and publishes with a release store of the sequence,
+// a consumer claims with one CAS on tail_ and recycles the slot the same
+// way, so neither side ever spins on the other's cache line. Indices are
+// cache-line separated. Capacity must be a power of two.
+template <typename T, std::size_t CAPACITY>
+class FixedMPMCRing {
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "FixedMPMCRing capacity must be a power of two");
+
+public:
+  FixedMPMCRing() {
+    for (std::size_t i = 0; i < CAPACITY; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  FixedMPMCRing(const FixedMPMCRing &) = delete;
+  FixedMPMCRing &operator=(const FixedMPMCRing &) = delete;
+
+  // Lock-free, returns false when the ring is full.
+  [[nodiscard]] bool push(const T &value) {
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell &cell = cells_[pos & kMask];
+      const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::intptr_t dif = static_cast<std::intptr_t>(seq) -
+                                static_cast<std::intptr_t>(pos);
+      if (dif == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        return false; // Full
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Lock-free, returns false when the ring is empty.
+  [[nodiscard]] bool pop(T &out) {
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell &cell = cells_[pos & kMask];
+      const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::intptr_t dif = static_cast<std::intptr_t>(seq) -
+                                static_cast<std::intptr_t>(pos + 1);
+      if (dif == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          out = cell.value;
+          cell.sequence.store(pos + CAPACITY, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        return false; // Empty
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Batch variants: bounded loops over the single-slot operations, which
+  // already cost one CAS per slot. Return how many transferred, which is
+  // less than `count` only when the ring fills or drains.
+  std::size_t pushMany(const T *values, std::size_t count) {
+    std::size_t done = 0;
+    while (done < count && push(values[done])) {
+      ++done;
+    }
+    return done;
+  }
+
+  std::size_t popMany(T *out, std::size_t count) {
+    std::size_t done = 0;
+    while (done < count && pop(out[done])) {
+      ++done;
+    }
+    return done;
+  }
+
+  // Approximate under concurrency; exact when quiescent.
+  [[nodiscard]] std::size_t size() const {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    return head >= tail ? head - tail : 0;
+  }
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
+
+private:
+  static constexpr std::size_t kMask = CAPACITY - 1;
+
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  std::array<Cell, CAPACITY> cells_{};
+  alignas(64) std::atomic<std::size_t> head_{0};
+  alignas(64) std::atomic<std::size_t> tail_{0};
+};
+
+// Bounded lock-free single-producer/single-consumer ring. Both sides are
+// wait-free: the producer owns head_, the consumer owns tail_, and each
+// publishes its index with a release store the other side acquires.
+// Capacity must be a power of two.
+template <typename T, std::size_t CAPACITY>
+class FixedSPSCRing {
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "FixedSPSCRing capacity must be a power of two");
+
+public:
+  FixedSPSCRing() = default;
+
+  FixedSPSCRing(const FixedSPSCRing &) = delete;
+  FixedSPSCRing &operator=(const FixedSPSCRing &) = delete;
+
+  // Producer side only: wait-free, returns false when the ring is full.
+  [[nodiscard]] bool push(const T &value) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    const std::size_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= CAPACITY) {
+      return false; // Full
+    }
+    buffer_[head & kMask] = value;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side only: wait-free, returns false when the ring is empty.
+  [[nodiscard]] bool pop(T &out) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    const std::size_t head = head_.load(std::memory_order_acquire);
+    if (tail == head) {
+      return false; // Empty
+    }
+    out = buffer_[tail & kMask];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate under concurrency; exact when quiescent.
+  [[nodiscard]] std::size_t size() const {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    return head >= tail ? head - tail : 0;
+  }
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
+
+private:
+  static constexpr std::size_t kMask = CAPACITY - 1;
+
+  std::array<T, CAPACITY> buffer_{};
+  alignas(64) std::atomic<std::size_t> head_{0};
+  alignas(64) std::atomic<std::size_t> tail_{0};
+};
+
 template <typename T, std::size_t CAPACITY>
 class FixedObjectPool {
   static_assert(CAPACITY > 0, "FixedObjectPool capacity must be > 0");
@@ -176,6 +789,27 @@ public:
   FixedObjectPool(const FixedObjectPool &) = delete;
   FixedObjectPool &operator=(const FixedObjectPool &) = delete;
 
+  // Generation-tagged handle: slot index plus the slot's reuse
+  // generation packed in 32 bits. A handle held across destroy (or slot
+  // reuse) fails resolve() instead of dangling, and handles are half the
+  // size of a pointer. Handle{} is null.
+  class Handle {
+  public:
+    constexpr Handle() = default;
+
+    [[nodiscard]] constexpr bool isNull() const { return value_ == kNull; }
+    constexpr bool operator==(const Handle &) const = default;
+
+  private:
+    friend class FixedObjectPool;
+
+    static constexpr std::uint32_t kNull = 0xFFFFFFFFu;
+
+    explicit constexpr Handle(std::uint32_t value) : value_(value) {}
+
+    std::uint32_t value_ = kNull;
+  };
+
   template <typename... Args>
   [[nodiscard]] T *create(Args &&...args) {
     if (free_top_ == 0) {
@@ -193,20 +827,42 @@ public:
       return;
     }
 
-    std::byte *base = storage_.data();
-    std::byte *ptr = reinterpret_cast<std::byte *>(obj);
-    std::ptrdiff_t offset = ptr - base;
-
-    assert(offset >= 0);
-    assert((static_cast<std::size_t>(offset) % sizeof(T)) == 0);
-
-    std::size_t idx = static_cast<std::size_t>(offset) / sizeof(T);
-    assert(idx < CAPACITY);
+    const std::size_t idx = slotIndex(obj);
 
     obj->~T();
+    // Invalidate outstanding handles to this slot
+    generation_[idx] = (generation_[idx] + 1) & kGenerationMask;
     free_list_[free_top_++] = static_cast<std::uint32_t>(idx);
   }
 
+  // Handle for a live object returned by create()
+  [[nodiscard]] Handle handleFor(const T *obj) const {
+    if (!obj) {
+      return Handle{};
+    }
+    const std::size_t idx = slotIndex(obj);
+    return Handle{static_cast<std::uint32_t>(
+        (generation_[idx] << kIndexBits) | idx)};
+  }
+
+  // O(1) validated access: null for the null handle and for any handle
+  // whose slot has since been destroyed or reused
+  [[nodiscard]] T *resolve(Handle handle) {
+    if (handle.isNull()) {
+      return nullptr;
+    }
+    const std::size_t idx = handle.value_ & kIndexMask;
+    const std::uint32_t gen = handle.value_ >> kIndexBits;
+    if (idx >= CAPACITY || generation_[idx] != gen) {
+      return nullptr;
+    }
+    return reinterpret_cast<T *>(storage_.data() + idx * sizeof(T));
+  }
+
+  [[nodiscard]] const T *resolve(Handle handle) const {
+    return const_cast<FixedObjectPool *>(this)->resolve(handle);
+  }
+
   [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
   [[nodiscard]] std::size_t available() const { return free_top_; }
   [[nodiscard]] std::size_t inUse() const { return CAPACITY - free_top_; }
@@ -218,12 +874,599 @@ public:
     // This is safe because we're clearing everything
     for (std::size_t i = 0; i < CAPACITY; ++i) {
       free_list_[i] = static_cast<std::uint32_t>(CAPACITY - 1 - i);
+      // Every slot may have been live; invalidate all handles
+      generation_[i] = (generation_[i] + 1) & kGenerationMask;
     }
     free_top_ = CAPACITY;
   }
 
 private:
+  // Handle layout: enough low bits to index CAPACITY slots, the rest a
+  // wrapping reuse generation. All-ones is reserved for the null handle.
+  static constexpr std::uint32_t bitsFor(std::size_t n) {
+    std::uint32_t bits = 0;
+    while ((std::size_t{1} << bits) < n) {
+      ++bits;
+    }
+    return bits;
+  }
+
+  static constexpr std::uint32_t kIndexBits = bitsFor(CAPACITY);
+  static constexpr std::uint32_t kIndexMask =
+      (kIndexBits == 32) ? 0xFFFFFFFFu : ((1u << kIndexBits) - 1);
+  static constexpr std::uint32_t kGenerationBits = 32 - kIndexBits;
+  // The generation's top bit stays clear so no packed value collides
+  // with the all-ones null handle
+  static constexpr std::uint32_t kGenerationMask =
+      (kGenerationBits >= 32) ? 0x7FFFFFFFu
+                              : (((1u << kGenerationBits) - 1) >> 1);
+  static_assert(kIndexBits < 31, "FixedObjectPool too large for 32-bit handles");
+
+  [[nodiscard]] std::size_t slotIndex(const T *obj) const {
+    const std::byte *ptr = reinterpret_cast<const std::byte *>(obj);
+    const std::ptrdiff_t offset = ptr - storage_.data();
+    assert(offset >= 0);
+    assert((static_cast<std::size_t>(offset) % sizeof(T)) == 0);
+    const std::size_t idx = static_cast<std::size_t>(offset) / sizeof(T);
+    assert(idx < CAPACITY);
+    return idx;
+  }
+
   alignas(T) std::array<std::byte, sizeof(T) * CAPACITY> storage_{};
   std::array<std::uint32_t, CAPACITY> free_list_{};
+  std::array<std::uint32_t, CAPACITY> generation_{};
   std::size_t free_top_ = 0;
 };
+
+// Fixed-size bitset tuned for allocation scans: word-wise storage with
+// count-trailing-zeros based find-first, so fd tables, scheduler level
+// bitmaps and similar free-slot maps share one audited implementation.
+// Find results are bit indices; N means "not found". Fully constexpr.
+template <std::size_t N>
+class FixedBitset {
+  static_assert(N > 0, "FixedBitset size must be > 0");
+
+public:
+  static constexpr std::size_t npos = N;
+
+  constexpr FixedBitset() = default;
+
+  constexpr void set(std::size_t bit) {
+    words_[bit / 64] |= 1ULL << (bit % 64);
+  }
+
+  constexpr void clear(std::size_t bit) {
+    words_[bit / 64] &= ~(1ULL << (bit % 64));
+  }
+
+  [[nodiscard]] constexpr bool test(std::size_t bit) const {
+    return (words_[bit / 64] >> (bit % 64)) & 1;
+  }
+
+  // Set `count` consecutive bits starting at `first`, whole words at a time
+  constexpr void setRange(std::size_t first, std::size_t count) {
+    applyRange(first, count, true);
+  }
+
+  constexpr void clearRange(std::size_t first, std::size_t count) {
+    applyRange(first, count, false);
+  }
+
+  // Lowest set bit at index >= from, or npos
+  [[nodiscard]] constexpr std::size_t findFirstSet(std::size_t from = 0) const {
+    if (from >= N) {
+      return npos;
+    }
+    std::size_t w = from / 64;
+    std::uint64_t bits = words_[w] & (~0ULL << (from % 64));
+    for (;;) {
+      if (bits != 0) {
+        const std::size_t bit = w * 64 +
+            static_cast<std::size_t>(std::countr_zero(bits));
+        return bit < N ? bit : npos;
+      }
+      if (++w == NUM_WORDS) {
+        return npos;
+      }
+      bits = words_[w];
+    }
+  }
+
+  // Lowest clear bit at index >= from, or npos
+  [[nodiscard]] constexpr std::size_t findFirstZero(std::size_t from = 0) const {
+    if (from >= N) {
+      return npos;
+    }
+    std::size_t w = from / 64;
+    std::uint64_t bits = ~words_[w] & (~0ULL << (from % 64));
+    for (;;) {
+      if (bits != 0) {
+        const std::size_t bit = w * 64 +
+            static_cast<std::size_t>(std::countr_zero(bits));
+        return bit < N ? bit : npos;
+      }
+      if (++w == NUM_WORDS) {
+        return npos;
+      }
+      bits = ~words_[w];
+    }
+  }
+
+  // Highest set bit, or npos
+  [[nodiscard]] constexpr std::size_t findLastSet() const {
+    for (std::size_t w = NUM_WORDS; w-- > 0;) {
+      const std::uint64_t bits = w + 1 == NUM_WORDS ? words_[w] & kTailMask
+                                                    : words_[w];
+      if (bits != 0) {
+        return w * 64 + 63 - static_cast<std::size_t>(std::countl_zero(bits));
+      }
+    }
+    return npos;
+  }
+
+  [[nodiscard]] constexpr std::size_t count() const {
+    std::size_t c = 0;
+    for (std::size_t w = 0; w + 1 < NUM_WORDS; ++w) {
+      c += static_cast<std::size_t>(std::popcount(words_[w]));
+    }
+    c += static_cast<std::size_t>(
+        std::popcount(words_[NUM_WORDS - 1] & kTailMask));
+    return c;
+  }
+
+  [[nodiscard]] constexpr bool any() const { return findFirstSet() != npos; }
+  [[nodiscard]] constexpr bool none() const { return !any(); }
+  [[nodiscard]] constexpr std::size_t size() const { return N; }
+
+  constexpr void reset() { words_.fill(0); }
+
+private:
+  static constexpr std::size_t NUM_WORDS = (N + 63) / 64;
+  // Masks off bits past N in the last word so whole-word scans never
+  // report indices outside the set
+  static constexpr std::uint64_t kTailMask =
+      (N % 64) == 0 ? ~0ULL : (1ULL << (N % 64)) - 1;
+
+  constexpr void applyRange(std::size_t first, std::size_t count, bool value) {
+    std::size_t bit = first;
+    const std::size_t last = first + count;
+    while (bit < last) {
+      const std::size_t w = bit / 64;
+      const std::size_t lo = bit % 64;
+      const std::size_t span = 64 - lo < last - bit ? 64 - lo : last - bit;
+      const std::uint64_t mask =
+          (span == 64 ? ~0ULL : ((1ULL << span) - 1)) << lo;
+      if (value) {
+        words_[w] |= mask;
+      } else {
+        words_[w] &= ~mask;
+      }
+      bit += span;
+    }
+  }
+
+  std::array<std::uint64_t, NUM_WORDS> words_{};
+};
+
+// Fixed-buffer stable LSD radix sort keyed by a caller-supplied 64-bit
+// projection. A batch sorts in at most eight counting passes of one byte
+// each — no comparator calls, so a 4K-element batch costs microseconds
+// where a comparison sort costs ~100ns per element. Passes where every
+// key shares the same byte are skipped, so narrow key ranges (e.g.
+// timestamps inside one tick window) cost correspondingly less.
+// Stability makes multi-key orders composable: sort by the tiebreak key
+// first, then by the primary key.
+template <typename T, std::size_t CAPACITY>
+class FixedRadixSorter {
+  static_assert(CAPACITY > 0, "FixedRadixSorter capacity must be > 0");
+
+public:
+  // Stable ascending sort of data[0..count) by key(element); key must
+  // return the same std::uint64_t for an element across calls
+  template <typename KeyFn>
+  void sortByKey(T *data, std::size_t count, KeyFn key) {
+    if (count < 2) {
+      return;
+    }
+    if (count > CAPACITY) {
+      assert(false && "FixedRadixSorter capacity exceeded");
+      return;
+    }
+
+    // One read of the input fills all eight digit histograms
+    std::size_t hist[NUM_PASSES][RADIX] = {};
+    for (std::size_t i = 0; i < count; ++i) {
+      const std::uint64_t k = key(data[i]);
+      for (std::size_t p = 0; p < NUM_PASSES; ++p) {
+        ++hist[p][(k >> (8 * p)) & 0xFF];
+      }
+    }
+
+    T *src = data;
+    T *dst = scratch_.data();
+    for (std::size_t p = 0; p < NUM_PASSES; ++p) {
+      // A pass where every key shares this byte is a no-op
+      const std::size_t first_digit =
+          (key(src[0]) >> (8 * p)) & 0xFF;
+      if (hist[p][first_digit] == count) {
+        continue;
+      }
+
+      std::size_t offsets[RADIX];
+      std::size_t running = 0;
+      for (std::size_t d = 0; d < RADIX; ++d) {
+        offsets[d] = running;
+        running += hist[p][d];
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t d = (key(src[i]) >> (8 * p)) & 0xFF;
+        dst[offsets[d]++] = src[i];
+      }
+      T *tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+
+    if (src != data) {
+      for (std::size_t i = 0; i < count; ++i) {
+        data[i] = src[i];
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr std::size_t capacity() const { return CAPACITY; }
+
+private:
+  static constexpr std::size_t NUM_PASSES = 8;
+  static constexpr std::size_t RADIX = 256;
+
+  std::array<T, CAPACITY> scratch_;
+};
+
+// Maps a signed 32-bit tiebreak field onto the unsigned key space so
+// radix order matches the field's natural order
+constexpr std::uint64_t radixKeyFromSigned(std::int32_t value) {
+  return static_cast<std::uint32_t>(value) ^ 0x80000000u;
+}
+
+// Sharded metric counter for many-writer/rare-reader statistics. Each
+// shard owns a full cache line, so writers using different shards (e.g.
+// per-thread or per-torus ids) never false-share; reading sums the
+// shards. Relaxed ordering throughout — totals are monotonic statistics,
+// not synchronization.
+template <std::size_t NUM_SHARDS = 8>
+class FixedShardedCounter {
+  static_assert(NUM_SHARDS > 0 && (NUM_SHARDS & (NUM_SHARDS - 1)) == 0,
+                "FixedShardedCounter shard count must be a power of two");
+
+public:
+  void add(std::size_t shard, std::uint64_t delta) {
+    shards_[shard & kMask].value.fetch_add(delta, std::memory_order_relaxed);
+  }
+
+  void increment(std::size_t shard) { add(shard, 1); }
+
+  [[nodiscard]] std::uint64_t total() const {
+    std::uint64_t sum = 0;
+    for (const Shard &shard : shards_) {
+      sum += shard.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+  void reset() {
+    for (Shard &shard : shards_) {
+      shard.value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  static constexpr std::size_t kMask = NUM_SHARDS - 1;
+
+  struct alignas(64) Shard {
+    std::atomic<std::uint64_t> value{0};
+  };
+
+  std::array<Shard, NUM_SHARDS> shards_{};
+};
+
+// Intrusive doubly-linked FIFO. Nodes embed their own links (members of
+// the element type, named as template arguments), so push-back,
+// pop-front, and unlink of a known node are all O(1) with no allocation
+// and no storage here beyond head and tail — capacity is whatever bounds
+// the caller's node pool. A node must be in at most one list per link
+// pair at a time.
+template <typename T, T *T::*Next, T *T::*Prev>
+class IntrusiveList {
+public:
+  constexpr IntrusiveList() = default;
+
+  void pushBack(T *node) {
+    node->*Next = nullptr;
+    node->*Prev = tail_;
+    if (tail_) {
+      tail_->*Next = node;
+    } else {
+      head_ = node;
+    }
+    tail_ = node;
+  }
+
+  [[nodiscard]] T *popFront() {
+    T *node = head_;
+    if (node) {
+      unlink(node);
+    }
+    return node;
+  }
+
+  // O(1) unlink of a node known to be in this list
+  void unlink(T *node) {
+    if (node->*Prev) {
+      (node->*Prev)->*Next = node->*Next;
+    } else {
+      head_ = node->*Next;
+    }
+    if (node->*Next) {
+      (node->*Next)->*Prev = node->*Prev;
+    } else {
+      tail_ = node->*Prev;
+    }
+    node->*Next = nullptr;
+    node->*Prev = nullptr;
+  }
+
+  [[nodiscard]] T *front() const { return head_; }
+  [[nodiscard]] T *back() const { return tail_; }
+  [[nodiscard]] bool empty() const { return head_ == nullptr; }
+
+  // Forget the chain without touching node links; the caller owns the
+  // detached nodes (still connected through their Next pointers)
+  void clear() {
+    head_ = nullptr;
+    tail_ = nullptr;
+  }
+
+private:
+  T *head_ = nullptr;
+  T *tail_ = nullptr;
+};
+
+// Default key mixer for FixedHashMap: Fibonacci multiplicative hash over
+// any key convertible to a 64-bit integer. Supply a custom functor for
+// composite keys.
+template <typename K>
+struct FixedKeyHash {
+  constexpr std::size_t operator()(const K &key) const {
+    return static_cast<std::size_t>(static_cast<std::uint64_t>(key) *
+                                    0x9E3779B97F4A7C15ULL);
+  }
+};
+
+// Bounded open-addressing hash map: linear probing over a power-of-two
+// table held at most half full, so probe chains stay short and insert,
+// find, and erase are deterministic with no allocation and no rehash.
+// Erase leaves a tombstone that later inserts reclaim.
+template <typename K, typename V, std::size_t CAPACITY,
+          typename Hash = FixedKeyHash<K>>
+class FixedHashMap {
+  static_assert(CAPACITY > 0, "FixedHashMap capacity must be > 0");
+
+  static constexpr std::size_t nextPow2(std::size_t v) {
+    std::size_t p = 1;
+    while (p < v) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  // Twice the capacity keeps the load factor at or below 50%
+  static constexpr std::size_t TABLE_SIZE = nextPow2(CAPACITY * 2);
+  static constexpr std::size_t MASK = TABLE_SIZE - 1;
+
+  enum SlotState : std::uint8_t { EMPTY = 0, FULL = 1, TOMBSTONE = 2 };
+
+public:
+  constexpr FixedHashMap() = default;
+
+  [[nodiscard]] bool insert(const K &key, const V &value) {
+    std::size_t first_tomb = TABLE_SIZE;
+    std::size_t idx = hash_(key) & MASK;
+    for (std::size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+      if (states_[idx] == EMPTY) {
+        break;
+      }
+      if (states_[idx] == FULL && keys_[idx] == key) {
+        values_[idx] = value;
+        return true;
+      }
+      if (states_[idx] == TOMBSTONE && first_tomb == TABLE_SIZE) {
+        first_tomb = idx;
+      }
+      idx = (idx + 1) & MASK;
+    }
+    if (size_ >= CAPACITY) {
+      assert(false && "FixedHashMap capacity exceeded");
+      return false;
+    }
+    if (first_tomb != TABLE_SIZE) {
+      idx = first_tomb;
+    }
+    keys_[idx] = key;
+    values_[idx] = value;
+    states_[idx] = FULL;
+    ++size_;
+    return true;
+  }
+
+  [[nodiscard]] V *find(const K &key) {
+    std::size_t idx = hash_(key) & MASK;
+    for (std::size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+      if (states_[idx] == EMPTY) {
+        return nullptr;
+      }
+      if (states_[idx] == FULL && keys_[idx] == key) {
+        return &values_[idx];
+      }
+      idx = (idx + 1) & MASK;
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] const V *find(const K &key) const {
+    return const_cast<FixedHashMap *>(this)->find(key);
+  }
+
+  [[nodiscard]] bool contains(const K &key) const {
+    return find(key) != nullptr;
+  }
+
+  bool erase(const K &key) {
+    std::size_t idx = hash_(key) & MASK;
+    for (std::size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+      if (states_[idx] == EMPTY) {
+        return false;
+      }
+      if (states_[idx] == FULL && keys_[idx] == key) {
+        states_[idx] = TOMBSTONE;
+        --size_;
+        return true;
+      }
+      idx = (idx + 1) & MASK;
+    }
+    return false;
+  }
+
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
+
+  void clear() {
+    states_.fill(EMPTY);
+    size_ = 0;
+  }
+
+private:
+  std::array<K, TABLE_SIZE> keys_{};
+  std::array<V, TABLE_SIZE> values_{};
+  std::array<std::uint8_t, TABLE_SIZE> states_{};
+  std::size_t size_ = 0;
+  [[no_unique_address]] Hash hash_{};
+};
+
+// Bounded traffic accumulator: open-addressed uint64 key -> count table
+// for sampled flow profiling. Keys are never erased (clear() starts a
+// fresh accumulation epoch), so occupancy is tracked by count != 0 with
+// no tombstone machinery; once CAPACITY distinct keys are resident, new
+// keys are counted as dropped rather than evicting hot ones — under
+// sampling the heavy flows establish residency first, which is exactly
+// the set a placement pass wants.
+template <std::size_t CAPACITY>
+class FixedFlowProfiler {
+  static_assert(CAPACITY > 0, "FixedFlowProfiler capacity must be > 0");
+
+  static constexpr std::size_t nextPow2(std::size_t v) {
+    std::size_t p = 1;
+    while (p < v) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  // Twice the capacity keeps the load factor at or below 50%
+  static constexpr std::size_t TABLE_SIZE = nextPow2(CAPACITY * 2);
+  static constexpr std::size_t MASK = TABLE_SIZE - 1;
+
+public:
+  constexpr FixedFlowProfiler() = default;
+
+  // Add weight to a key's count, installing the key on first sight.
+  // Returns false when the key set is saturated and the sample was
+  // dropped (counted in recordsDropped).
+  [[nodiscard]] bool record(std::uint64_t key, std::uint64_t weight = 1) {
+    std::size_t idx =
+        static_cast<std::size_t>(key * 0x9E3779B97F4A7C15ULL) & MASK;
+    for (std::size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+      if (counts_[idx] == 0) {
+        if (size_ >= CAPACITY) {
+          ++dropped_;
+          return false;
+        }
+        keys_[idx] = key;
+        counts_[idx] = weight;
+        ++size_;
+        return true;
+      }
+      if (keys_[idx] == key) {
+        counts_[idx] += weight;
+        return true;
+      }
+      idx = (idx + 1) & MASK;
+    }
+    ++dropped_;
+    return false;
+  }
+
+  [[nodiscard]] std::uint64_t count(std::uint64_t key) const {
+    std::size_t idx =
+        static_cast<std::size_t>(key * 0x9E3779B97F4A7C15ULL) & MASK;
+    for (std::size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+      if (counts_[idx] == 0) {
+        return 0;
+      }
+      if (keys_[idx] == key) {
+        return counts_[idx];
+      }
+      idx = (idx + 1) & MASK;
+    }
+    return 0;
+  }
+
+  // Copy the max_out heaviest flows into out_keys/out_counts, ordered by
+  // descending count. One pass over the table with insertion into the
+  // output window — max_out is expected to be small (a placement pass
+  // looks at a handful of top flows, not the whole matrix).
+  std::size_t topK(std::uint64_t *out_keys, std::uint64_t *out_counts,
+                   std::size_t max_out) const {
+    if (max_out == 0) {
+      return 0;
+    }
+    std::size_t filled = 0;
+    for (std::size_t idx = 0; idx < TABLE_SIZE; ++idx) {
+      if (counts_[idx] == 0) {
+        continue;
+      }
+      if (filled == max_out && counts_[idx] <= out_counts[filled - 1]) {
+        continue;
+      }
+      std::size_t pos = filled < max_out ? filled : max_out - 1;
+      while (pos > 0 && out_counts[pos - 1] < counts_[idx]) {
+        out_keys[pos] = out_keys[pos - 1];
+        out_counts[pos] = out_counts[pos - 1];
+        --pos;
+      }
+      out_keys[pos] = keys_[idx];
+      out_counts[pos] = counts_[idx];
+      if (filled < max_out) {
+        ++filled;
+      }
+    }
+    return filled;
+  }
+
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t capacity() const { return CAPACITY; }
+  [[nodiscard]] std::uint64_t recordsDropped() const { return dropped_; }
+
+  void clear() {
+    counts_.fill(0);
+    size_ = 0;
+  }
+
+private:
+  std::array<std::uint64_t, TABLE_SIZE> keys_{};
+  std::array<std::uint64_t, TABLE_SIZE> counts_{};
+  std::size_t size_ = 0;
+  std::uint64_t dropped_ = 0;
+};
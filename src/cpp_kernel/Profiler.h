@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstdint>
+
+// Cycle-level hot path instrumentation
+//
+// Compile-time switch for rdtsc scope counters in the kernel hot paths
+// (BettiRDLKernel::tick, the arena allocator, TorusScheduler, the syscall
+// dispatcher). Define RSE_PROFILE to arm the probes; when it is off every
+// RSE_PROFILE_* macro expands to nothing, so instrumented builds and
+// production builds compile from the same sources.
+//
+// Samples land in per-thread fixed tables (no locks, no allocation on the
+// record path) keyed by a closed enum of probe sites; rse_prof::dump()
+// aggregates the registered tables on demand. Like the latency histograms
+// in BettiRDLKernel.h, the probes are host-side only — RSE_KERNEL builds
+// always compile them out.
+
+#if defined(RSE_PROFILE) && !defined(RSE_KERNEL)
+#define RSE_PROFILE_ENABLED 1
+#else
+#define RSE_PROFILE_ENABLED 0
+#endif
+
+#if RSE_PROFILE_ENABLED
+
+#include <atomic>
+#include <iostream>
+
+namespace rse_prof {
+
+// Closed set of probe sites: adding one means adding an enumerator here
+// and a name in kSiteNames. Tables stay fixed-size and indexing stays O(1).
+enum SiteId : uint32_t {
+    SITE_RDL_TICK = 0,         // BettiRDLKernel::tick, non-empty queue
+    SITE_RDL_TICK_BATCH,       // BettiRDLKernel::tickBatch, non-empty queue
+    SITE_ARENA_EVENT_ALLOC,    // BoundedArenaAllocator event pool allocate
+    SITE_ARENA_EVENT_FREE,     // BoundedArenaAllocator event pool free
+    SITE_ARENA_GENERIC_ALLOC,  // BoundedArenaAllocator generic allocate
+    SITE_ARENA_GENERIC_FREE,   // BoundedArenaAllocator generic free
+    SITE_SCHED_SCHEDULE,       // TorusScheduler::schedule (pick-next only)
+    SITE_SCHED_TICK,           // TorusScheduler::tick (full slice)
+    SITE_SYSCALL_DISPATCH,     // SyscallDispatcher::dispatch
+    SITE_COUNT
+};
+
+inline const char* const kSiteNames[SITE_COUNT] = {
+    "rdl_tick",
+    "rdl_tick_batch",
+    "arena_event_alloc",
+    "arena_event_free",
+    "arena_generic_alloc",
+    "arena_generic_free",
+    "sched_schedule",
+    "sched_tick",
+    "syscall_dispatch",
+};
+
+// Unserialized rdtsc: the probes must stay cheap enough for hot loops, so
+// no lfence pairing — per-site averages over many calls are what we read,
+// not single-shot measurements.
+inline uint64_t rdtsc() {
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t cnt;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(cnt));
+    return cnt;
+#else
+    return 0;  // No cycle counter: probes degrade to call counters
+#endif
+}
+
+struct SiteStats {
+    uint64_t calls;
+    uint64_t cycles;
+    uint64_t min_cycles;
+    uint64_t max_cycles;
+};
+
+struct ThreadTable {
+    SiteStats sites[SITE_COUNT];
+};
+
+constexpr uint32_t MAX_PROFILE_THREADS = 32;
+
+// Bounded registry owning the table storage, so samples survive their
+// recording thread and dump() never chases a dead thread_local. Each
+// thread claims one slot on first record; slots are not recycled, and
+// threads past the bound record into a private overflow table that
+// simply drops out of dump().
+struct Registry {
+    std::atomic<uint32_t> count{0};
+    ThreadTable tables[MAX_PROFILE_THREADS] = {};
+};
+
+inline Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+inline ThreadTable& table() {
+    thread_local ThreadTable* slot = nullptr;
+    if (!slot) {
+        Registry& r = registry();
+        uint32_t idx = r.count.fetch_add(1, std::memory_order_acq_rel);
+        if (idx < MAX_PROFILE_THREADS) {
+            slot = &r.tables[idx];
+        } else {
+            thread_local ThreadTable overflow{};
+            slot = &overflow;
+        }
+    }
+    return *slot;
+}
+
+inline void record(uint32_t site, uint64_t cycles) {
+    SiteStats& s = table().sites[site];
+    s.calls++;
+    s.cycles += cycles;
+    if (s.calls == 1 || cycles < s.min_cycles) {
+        s.min_cycles = cycles;
+    }
+    if (cycles > s.max_cycles) {
+        s.max_cycles = cycles;
+    }
+}
+
+// Times one lexical scope and books it against `site` on destruction.
+class ScopeTimer {
+public:
+    explicit ScopeTimer(uint32_t site) : site_(site), start_(rdtsc()) {}
+    ~ScopeTimer() { record(site_, rdtsc() - start_); }
+
+    ScopeTimer(const ScopeTimer&) = delete;
+    ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+private:
+    uint32_t site_;
+    uint64_t start_;
+};
+
+/**
+ * Aggregate every registered thread table and print one line per site
+ * that fired. Tables are read without stopping the recording threads
+ * (relaxed telemetry, same contract as the allocator snapshots), so
+ * counts taken while threads are hot are approximate.
+ */
+inline void dump() {
+    Registry& r = registry();
+    uint32_t n = r.count.load(std::memory_order_acquire);
+    if (n > MAX_PROFILE_THREADS) {
+        n = MAX_PROFILE_THREADS;
+    }
+    std::cout << "[Profile] " << n << " thread table(s)" << std::endl;
+    for (uint32_t site = 0; site < SITE_COUNT; site++) {
+        SiteStats total{};
+        for (uint32_t i = 0; i < n; i++) {
+            const SiteStats& s = r.tables[i].sites[site];
+            if (s.calls == 0) {
+                continue;
+            }
+            if (total.calls == 0 || s.min_cycles < total.min_cycles) {
+                total.min_cycles = s.min_cycles;
+            }
+            if (s.max_cycles > total.max_cycles) {
+                total.max_cycles = s.max_cycles;
+            }
+            total.calls += s.calls;
+            total.cycles += s.cycles;
+        }
+        if (total.calls == 0) {
+            continue;
+        }
+        std::cout << "[Profile]   " << kSiteNames[site]
+                  << " calls=" << total.calls
+                  << " cycles=" << total.cycles
+                  << " avg=" << total.cycles / total.calls
+                  << " min=" << total.min_cycles
+                  << " max=" << total.max_cycles << std::endl;
+    }
+}
+
+/** Zero every registered table (e.g. between warmup and measurement). */
+inline void reset() {
+    Registry& r = registry();
+    uint32_t n = r.count.load(std::memory_order_acquire);
+    if (n > MAX_PROFILE_THREADS) {
+        n = MAX_PROFILE_THREADS;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        for (uint32_t site = 0; site < SITE_COUNT; site++) {
+            r.tables[i].sites[site] = SiteStats{};
+        }
+    }
+}
+
+} // namespace rse_prof
+
+// One probe per site per scope: the site id doubles as the variable name,
+// so a duplicated probe in one scope fails to compile instead of
+// double-counting.
+#define RSE_PROFILE_SCOPE(site) \
+    ::rse_prof::ScopeTimer rse_prof_scope_##site(::rse_prof::site)
+#define RSE_PROFILE_DUMP() ::rse_prof::dump()
+#define RSE_PROFILE_RESET() ::rse_prof::reset()
+
+#else
+
+#define RSE_PROFILE_SCOPE(site) ((void)0)
+#define RSE_PROFILE_DUMP() ((void)0)
+#define RSE_PROFILE_RESET() ((void)0)
+
+#endif // RSE_PROFILE_ENABLED
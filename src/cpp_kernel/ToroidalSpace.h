@@ -15,11 +15,240 @@
 // Forward declaration
 struct Process;
 
+// Cell-storage policies for ToroidalSpace.
+//
+// DenseCells (default) keeps the original compile-time 1D array: O(1) access,
+// memory proportional to lattice volume. SparseCells keeps a bounded
+// open-addressing hash of occupied cells only, so memory scales with live
+// processes instead of lattice volume — the right trade for large (e.g.
+// 128^3) mostly-empty lattices on embedded budgets.
+struct DenseCells {};
+
+template <std::size_t MAX_OCCUPIED_CELLS = 4096>
+struct SparseCells {};
+
+// Linear-index policies for ToroidalSpace (and BettiRDLKernel node ids).
+//
+// RowMajorOrder is the original x-fastest layout. MortonOrder interleaves
+// the coordinate bits (Z-order curve) through constexpr-built spread tables,
+// so the 6-neighborhood of a cell lands on nearby cache lines — a large win
+// for diffusion-style workloads that walk neighbors constantly. Morton
+// indexing requires a cubic power-of-two lattice.
+struct RowMajorOrder {
+  template <int W, int H, int D>
+  static constexpr std::size_t index(int x, int y, int z) {
+    return static_cast<std::size_t>(x) +
+           static_cast<std::size_t>(W) *
+               (static_cast<std::size_t>(y) +
+                static_cast<std::size_t>(H) * static_cast<std::size_t>(z));
+  }
+
+  template <int DIM>
+  static constexpr void decode(std::size_t idx, int &x, int &y, int &z) {
+    x = static_cast<int>(idx % static_cast<std::size_t>(DIM));
+    y = static_cast<int>((idx / static_cast<std::size_t>(DIM)) %
+                         static_cast<std::size_t>(DIM));
+    z = static_cast<int>(idx / (static_cast<std::size_t>(DIM) *
+                                static_cast<std::size_t>(DIM)));
+  }
+};
+
+struct MortonOrder {
+  template <int DIM>
+  struct SpreadTable {
+    static_assert(DIM > 0 && (DIM & (DIM - 1)) == 0,
+                  "Morton indexing requires a power-of-two dimension");
+
+    static constexpr std::array<std::uint32_t, DIM> make() {
+      std::array<std::uint32_t, DIM> table{};
+      for (std::uint32_t v = 0; v < static_cast<std::uint32_t>(DIM); ++v) {
+        std::uint32_t spread = 0;
+        for (std::uint32_t bit = 0; (1u << bit) < static_cast<std::uint32_t>(DIM);
+             ++bit) {
+          spread |= ((v >> bit) & 1u) << (3 * bit);
+        }
+        table[v] = spread;
+      }
+      return table;
+    }
+
+    static constexpr std::array<std::uint32_t, DIM> value = make();
+  };
+
+  template <int W, int H, int D>
+  static constexpr std::size_t index(int x, int y, int z) {
+    static_assert(W == H && H == D,
+                  "Morton indexing requires a cubic lattice");
+    const auto &spread = SpreadTable<W>::value;
+    return (static_cast<std::size_t>(spread[x]) << 2) |
+           (static_cast<std::size_t>(spread[y]) << 1) |
+           static_cast<std::size_t>(spread[z]);
+  }
+
+  template <int DIM>
+  static constexpr void decode(std::size_t idx, int &x, int &y, int &z) {
+    std::uint32_t cx = 0, cy = 0, cz = 0;
+    for (std::uint32_t bit = 0; (1u << bit) < static_cast<std::uint32_t>(DIM);
+         ++bit) {
+      cz |= static_cast<std::uint32_t>((idx >> (3 * bit)) & 1u) << bit;
+      cy |= static_cast<std::uint32_t>((idx >> (3 * bit + 1)) & 1u) << bit;
+      cx |= static_cast<std::uint32_t>((idx >> (3 * bit + 2)) & 1u) << bit;
+    }
+    x = static_cast<int>(cx);
+    y = static_cast<int>(cy);
+    z = static_cast<int>(cz);
+  }
+};
+
+namespace toroidal_detail {
+
+// Compile-time wrap for one lattice dimension. The generic
+// ((v % max) + max) % max costs two divisions per coordinate — six per
+// index() — on the path of every add/remove and nodeId computation.
+// Power-of-two extents reduce to a single mask (correct for negatives in
+// two's complement); other extents read a constexpr wrap table covering
+// one period either side of [0, MAX), which is every offset the
+// neighborhood and migration paths produce. Offsets beyond that fall
+// back to the arithmetic form.
+template <int MAX, bool POW2 = ((MAX & (MAX - 1)) == 0)>
+struct WrapDim;
+
+template <int MAX>
+struct WrapDim<MAX, true> {
+  static constexpr int wrap(int v) { return v & (MAX - 1); }
+};
+
+template <int MAX>
+struct WrapDim<MAX, false> {
+  static constexpr int wrap(int v) {
+    if (v >= -MAX && v < 2 * MAX) {
+      return kTable[v + MAX];
+    }
+    return ((v % MAX) + MAX) % MAX;
+  }
+
+private:
+  static constexpr std::array<int, 3 * MAX> makeTable() {
+    std::array<int, 3 * MAX> table{};
+    // Entry i holds wrap(i - MAX), which for i in [0, 3*MAX) is i % MAX
+    for (int i = 0; i < 3 * MAX; ++i) {
+      table[i] = i % MAX;
+    }
+    return table;
+  }
+
+  static constexpr std::array<int, 3 * MAX> kTable = makeTable();
+};
+
+template <typename CellT, std::size_t CELL_COUNT, typename Policy>
+struct CellStorage;
+
+template <typename CellT, std::size_t CELL_COUNT>
+struct CellStorage<CellT, CELL_COUNT, DenseCells> {
+  [[nodiscard]] CellT *findOrCreate(std::size_t idx) { return &cells_[idx]; }
+  [[nodiscard]] CellT *find(std::size_t idx) { return &cells_[idx]; }
+  [[nodiscard]] const CellT *find(std::size_t idx) const {
+    return &cells_[idx];
+  }
+
+  void clear() {
+    for (auto &cell : cells_) {
+      cell = CellT{};
+    }
+  }
+
+private:
+  std::array<CellT, CELL_COUNT> cells_{};
+};
+
+template <typename CellT, std::size_t CELL_COUNT, std::size_t MAX_OCCUPIED>
+struct CellStorage<CellT, CELL_COUNT, SparseCells<MAX_OCCUPIED>> {
+  static_assert(MAX_OCCUPIED > 0, "sparse cell capacity must be > 0");
+
+  [[nodiscard]] CellT *findOrCreate(std::size_t idx) {
+    const std::size_t slot = probe(idx);
+    if (slot == kNumSlots) {
+      assert(false && "SparseCells occupied-cell capacity exceeded");
+      return nullptr;
+    }
+    if (keys_[slot] == kEmpty) {
+      keys_[slot] = static_cast<std::uint32_t>(idx);
+      ++occupied_;
+    }
+    return &cells_[slot];
+  }
+
+  [[nodiscard]] CellT *find(std::size_t idx) {
+    const std::size_t slot = probe(idx);
+    if (slot == kNumSlots || keys_[slot] == kEmpty) {
+      return nullptr;
+    }
+    return &cells_[slot];
+  }
+
+  [[nodiscard]] const CellT *find(std::size_t idx) const {
+    return const_cast<CellStorage *>(this)->find(idx);
+  }
+
+  void clear() {
+    keys_.fill(kEmpty);
+    for (auto &cell : cells_) {
+      cell = CellT{};
+    }
+    occupied_ = 0;
+  }
+
+private:
+  // Power-of-two slot count at <= 50% max load keeps probe chains short.
+  static constexpr std::size_t nextPow2(std::size_t v) {
+    std::size_t p = 1;
+    while (p < v) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  static constexpr std::size_t kNumSlots = nextPow2(2 * MAX_OCCUPIED);
+  static constexpr std::uint32_t kEmpty = 0xFFFFFFFFu;
+
+  // Linear probing; occupied cells are never individually removed (a cell
+  // emptied of processes stays resident until clear()), so no tombstones.
+  [[nodiscard]] std::size_t probe(std::size_t idx) const {
+    const std::uint32_t key = static_cast<std::uint32_t>(idx);
+    std::size_t slot = (idx * 0x9E3779B9u) & (kNumSlots - 1);
+    for (std::size_t i = 0; i < kNumSlots; ++i) {
+      if (keys_[slot] == key || keys_[slot] == kEmpty) {
+        if (keys_[slot] == kEmpty && occupied_ >= MAX_OCCUPIED) {
+          return kNumSlots; // At capacity: only existing cells resolvable
+        }
+        return slot;
+      }
+      slot = (slot + 1) & (kNumSlots - 1);
+    }
+    return kNumSlots;
+  }
+
+  std::array<std::uint32_t, kNumSlots> keys_ = [] {
+    std::array<std::uint32_t, kNumSlots> keys{};
+    keys.fill(kEmpty);
+    return keys;
+  }();
+  std::array<CellT, kNumSlots> cells_{};
+  std::size_t occupied_ = 0;
+};
+
+} // namespace toroidal_detail
+
 // Template-based toroidal lattice.
 // Storage is bounded and deterministic:
-// - compile-time indexed 1D array of cells
+// - cell backing store selected by policy (dense array or sparse hash)
 // - fixed-capacity process pointer list per voxel
-template <int WIDTH, int HEIGHT, int DEPTH, std::size_t MAX_PROCESSES_PER_CELL = 8>
+template <int WIDTH, int HEIGHT, int DEPTH,
+          std::size_t MAX_PROCESSES_PER_CELL = 8,
+          typename CellPolicy = DenseCells,
+          typename IndexOrder = RowMajorOrder,
+          std::size_t OVERFLOW_CAPACITY = 64,
+          typename Item = Process *>
 class ToroidalSpace {
 public:
   static constexpr std::size_t kCellCount =
@@ -33,62 +262,149 @@ public:
 #endif
   }
 
-  // Wrap Coordinate (Topology Logic)
+  // Wrap Coordinate (Topology Logic) — generic fallback for a runtime
+  // extent; prefer wrap<MAX>(v) when the extent is a template dimension
   static constexpr int wrap(int v, int max) {
     return ((v % max) + max) % max;
   }
 
+  // Compile-time-specialized wrap: a mask for power-of-two extents, a
+  // constexpr table otherwise
+  template <int MAX>
+  static constexpr int wrap(int v) {
+    return toroidal_detail::WrapDim<MAX>::wrap(v);
+  }
+
   [[nodiscard]] constexpr std::size_t index(int x, int y, int z) const {
-    const int wx = wrap(x, WIDTH);
-    const int wy = wrap(y, HEIGHT);
-    const int wz = wrap(z, DEPTH);
+    const int wx = wrap<WIDTH>(x);
+    const int wy = wrap<HEIGHT>(y);
+    const int wz = wrap<DEPTH>(z);
 
-    return static_cast<std::size_t>(wx) +
-           static_cast<std::size_t>(WIDTH) *
-               (static_cast<std::size_t>(wy) +
-                static_cast<std::size_t>(HEIGHT) *
-                    static_cast<std::size_t>(wz));
+    return IndexOrder::template index<WIDTH, HEIGHT, DEPTH>(wx, wy, wz);
   }
 
-  bool addProcess(Process *p, int x, int y, int z) {
-    Cell &cell = cells_[index(x, y, z)];
-    const bool ok = cell.processes.push_back(p);
+  bool addProcess(Item p, int x, int y, int z) {
+    const std::size_t idx = index(x, y, z);
+    Cell *cell = cells_.findOrCreate(idx);
+    if (!cell) {
+      return false;
+    }
+    if (!cell->processes.full()) {
+      (void)cell->processes.push_back(p);
+      ++total_processes_;
+      return true;
+    }
+    // Crowded cell: spill into the shared bounded overflow pool instead
+    // of asserting at MAX_PROCESSES_PER_CELL
+    const bool ok = overflow_.push_back(
+        OverflowEntry{static_cast<std::uint32_t>(idx), p});
     if (ok) {
       ++total_processes_;
     }
     return ok;
   }
 
-  bool removeProcess(Process *p, int x, int y, int z) {
-    Cell &cell = cells_[index(x, y, z)];
-    const bool removed = cell.processes.erase_first(p);
-    if (removed) {
+  bool removeProcess(Item p, int x, int y, int z) {
+    const std::size_t idx = index(x, y, z);
+    Cell *cell = cells_.find(idx);
+    if (!cell) {
+      return false;
+    }
+    // Swap-remove: O(1), order within a voxel carries no meaning
+    if (cell->processes.erase_first_unordered(p)) {
       assert(total_processes_ > 0);
       --total_processes_;
+      promoteSpilled(idx, *cell);
+      return true;
+    }
+    // Not resident in the cell proper: it may have spilled
+    for (std::size_t i = 0; i < overflow_.size(); ++i) {
+      if (overflow_[i].cell == idx && overflow_[i].process == p) {
+        overflow_.erase_at_unordered(i);
+        assert(total_processes_ > 0);
+        --total_processes_;
+        return true;
+      }
     }
-    return removed;
+    return false;
   }
 
   [[nodiscard]] std::size_t getProcessCount() const { return total_processes_; }
 
   [[nodiscard]] std::size_t getCellProcessCount(int x, int y, int z) const {
-    const Cell &cell = cells_[index(x, y, z)];
-    return cell.processes.size();
+    const std::size_t idx = index(x, y, z);
+    const Cell *cell = cells_.find(idx);
+    return cell ? cell->processes.size() + countSpilled(idx) : 0;
+  }
+
+  // Item at slot i of a voxel, or a default-constructed (null) Item if
+  // the slot is out of range.
+  // Slots beyond the in-cell list resolve to that voxel's spilled entries.
+  [[nodiscard]] Item getCellProcess(int x, int y, int z,
+                                    std::size_t i) const {
+    const std::size_t idx = index(x, y, z);
+    const Cell *cell = cells_.find(idx);
+    if (!cell) {
+      return Item{};
+    }
+    if (i < cell->processes.size()) {
+      return cell->processes[i];
+    }
+    std::size_t spill = i - cell->processes.size();
+    for (std::size_t j = 0; j < overflow_.size(); ++j) {
+      if (overflow_[j].cell == idx) {
+        if (spill == 0) {
+          return overflow_[j].process;
+        }
+        --spill;
+      }
+    }
+    return Item{};
   }
-  
+
   // Clear all processes (for reset)
   void clear() {
-    for (auto& cell : cells_) {
-      cell.processes.clear();
-    }
+    cells_.clear();
+    overflow_.clear();
     total_processes_ = 0;
   }
 
 private:
   struct Cell {
-    FixedVector<Process *, MAX_PROCESSES_PER_CELL> processes;
+    FixedVector<Item, MAX_PROCESSES_PER_CELL> processes;
+  };
+
+  struct OverflowEntry {
+    std::uint32_t cell;
+    Item process;
   };
 
-  std::array<Cell, kCellCount> cells_{};
+  // When an in-cell slot frees up, pull one of the voxel's spilled
+  // entries back so the overflow pool stays small
+  void promoteSpilled(std::size_t idx, Cell &cell) {
+    if (cell.processes.full()) {
+      return;
+    }
+    for (std::size_t i = 0; i < overflow_.size(); ++i) {
+      if (overflow_[i].cell == idx) {
+        (void)cell.processes.push_back(overflow_[i].process);
+        overflow_.erase_at_unordered(i);
+        return;
+      }
+    }
+  }
+
+  [[nodiscard]] std::size_t countSpilled(std::size_t idx) const {
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < overflow_.size(); ++i) {
+      if (overflow_[i].cell == idx) {
+        ++n;
+      }
+    }
+    return n;
+  }
+
+  toroidal_detail::CellStorage<Cell, kCellCount, CellPolicy> cells_;
+  FixedVector<OverflowEntry, OVERFLOW_CAPACITY> overflow_;
   std::size_t total_processes_ = 0;
 };
@@ -0,0 +1,651 @@
+// OS headers first: Syscall.h's O_* constants must land before
+// BettiRDLKernel.h pulls in <fcntl.h> and its macros of the same names
+#include "../os/TorusScheduler.h"
+#include "../os/SyscallDispatcher.h"
+#include "../os/MemFS.h"
+#include "../os/VFS.h"
+#include "../os/FastPathDevice.h"
+#include "../os/PhysicalAllocator.h"
+#include "../single_torus/BettiRDLKernel.h"
+#include "../braided/ProjectionWire.h"
+
+// <fcntl.h> (via the kernel header) defines O_* as macros; drop them so
+// the os:: constants stay usable below
+#undef O_RDONLY
+#undef O_WRONLY
+#undef O_RDWR
+#undef O_CREAT
+#undef O_TRUNC
+#undef O_APPEND
+
+#include <chrono>
+#include <cstdint>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+/**
+ * rse_bench: registered micro-benchmarks with uniform timing and JSON
+ * output, replacing the hand-rolled loops scattered across
+ * demos/benchmark_phase4*.cpp and benchmarks/stress_test.cpp.
+ *
+ * Each benchmark is a function that sets up its fixture, times only its
+ * hot loop, and reports operations + elapsed nanoseconds. The harness
+ * runs a warmup pass first, then the measured pass, and prints one JSON
+ * object per benchmark (plus a human-readable line on stderr) so every
+ * optimization is verified the same way:
+ *
+ *   rse_bench [--iters N] [--warmup N] [--filter substr] [--list]
+ *             [--baseline file] [--tolerance pct] [--save-baseline file]
+ *
+ * Regression gating: --save-baseline records this machine's results;
+ * --baseline reruns the same scenarios and fails (exit 2) when
+ * ops_per_sec drops more than the tolerance below the recording. The
+ * tolerance comes from --tolerance, overridden per metric by a
+ * "tolerance_pct" field in the baseline file. CMake wires the gate into
+ * ctest whenever benchmarks/rse_bench_baseline.json has been recorded —
+ * baselines are per-machine recordings (like benchmarks/*.json at the
+ * repo root), so fresh checkouts skip the gate until one is captured.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch())
+            .count());
+}
+
+// Library code prints progress to stdout; keep the JSON stream clean by
+// swallowing everything benchmarks write while their loops run.
+class CoutSilencer {
+public:
+    CoutSilencer() : saved_(std::cout.rdbuf(&null_buf_)) {}
+    ~CoutSilencer() { std::cout.rdbuf(saved_); }
+
+private:
+    struct NullBuf : std::streambuf {
+        int overflow(int c) override { return c; }
+    };
+    NullBuf null_buf_;
+    std::streambuf* saved_;
+};
+
+// Returns operations performed; *out_ns receives hot-loop nanoseconds
+using BenchFn = uint64_t (*)(uint64_t iters, uint64_t* out_ns);
+
+/**
+ * RDL kernel tick throughput: one control event scheduled and popped
+ * per iteration, the path TorusRuntime drives for every time slice.
+ */
+uint64_t bench_rdl_tick(uint64_t iters, uint64_t* out_ns) {
+    static BettiRDLKernel kernel;
+    static bool init = false;
+    if (!init) {
+        kernel.setControlHandler([](const RDLEvent&, void*) {}, nullptr);
+        init = true;
+    }
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        (void)kernel.scheduleControlEvent(0, 1);
+        kernel.tick();
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+/**
+ * injectEvent under contention: four threads push into the kernel's
+ * MPSC pending ring concurrently; drains between rounds are untimed.
+ */
+uint64_t bench_inject_event(uint64_t iters, uint64_t* out_ns) {
+    static BettiRDLKernel kernel;
+    static bool init = false;
+    if (!init) {
+        for (int x = 0; x < 4; x++) {
+            for (int y = 0; y < 4; y++) {
+                (void)kernel.spawnProcess(x, y, 0);
+            }
+        }
+        init = true;
+    }
+    constexpr uint32_t kThreads = 4;
+    constexpr uint64_t kRound = 8192;  // Half the pending ring
+    uint64_t injected = 0;
+    uint64_t elapsed = 0;
+    while (injected < iters) {
+        uint64_t want = iters - injected;
+        if (want > kRound) {
+            want = kRound;
+        }
+        uint64_t per_thread = want / kThreads;
+        if (per_thread == 0) {
+            per_thread = 1;
+        }
+        uint64_t start = now_ns();
+        BettiRDLKernel* k = &kernel;
+        std::thread threads[kThreads];
+        for (uint32_t t = 0; t < kThreads; t++) {
+            threads[t] = std::thread([k, per_thread, t] {
+                for (uint64_t i = 0; i < per_thread; i++) {
+                    (void)k->injectEvent(t & 3, (int)(i & 3), 0, 0, 0, 0,
+                                         (int)i);
+                }
+            });
+        }
+        for (uint32_t t = 0; t < kThreads; t++) {
+            threads[t].join();
+        }
+        elapsed += now_ns() - start;
+        injected += per_thread * kThreads;
+        (void)kernel.run(static_cast<int>(per_thread * kThreads * 12));
+    }
+    *out_ns = elapsed;
+    return injected;
+}
+
+/**
+ * Physical frame allocate/free pair.
+ */
+uint64_t bench_phys_alloc(uint64_t iters, uint64_t* out_ns) {
+    alignas(os::PAGE_SIZE) static uint8_t pool[4 << 20];
+    static os::PhysicalAllocator alloc(reinterpret_cast<uint64_t>(pool),
+                                       sizeof(pool));
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        uint64_t frame = alloc.allocateFrame();
+        if (frame == 0) {
+            break;
+        }
+        alloc.freeFrame(frame);
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+/**
+ * Scheduler pick-next: 64 runnable processes rotating through tick().
+ */
+uint64_t bench_sched_tick(uint64_t iters, uint64_t* out_ns) {
+    static os::TorusScheduler scheduler(0);
+    static os::OSProcess* procs[64];
+    static bool init = false;
+    if (!init) {
+        for (uint32_t i = 0; i < 64; i++) {
+            procs[i] = new os::OSProcess(i + 1, (int)(i & 3), (int)(i >> 3));
+            (void)scheduler.addProcess(procs[i]);
+        }
+        init = true;
+    }
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        scheduler.tick();
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+/**
+ * VFS open/close of an existing MemFS file (path cache hot).
+ */
+uint64_t bench_vfs_open(uint64_t iters, uint64_t* out_ns) {
+    static os::MemFS memfs;
+    static os::VFS vfs(&memfs);
+    static os::FileDescriptorTable fdt;
+    static bool init = false;
+    if (!init) {
+        int32_t fd = vfs.open(&fdt, "bench.txt", os::O_CREAT | os::O_RDWR);
+        if (fd >= 0) {
+            (void)vfs.write(&fdt, fd, "x", 1);
+            vfs.close(&fdt, fd);
+        }
+        init = true;
+    }
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        int32_t fd = vfs.open(&fdt, "bench.txt", os::O_RDONLY);
+        if (fd < 0) {
+            break;
+        }
+        vfs.close(&fdt, fd);
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+/**
+ * Syscall dispatch round trip: SYS_WRITE then SYS_READ of a 64-byte
+ * message through a loopback device, the dominant pair on the torus
+ * syscall surface. Exercises the dispatcher's hot-call fast path; the
+ * process has no virtual memory, so buffers are host pointers and the
+ * numbers isolate dispatch + device cost.
+ */
+uint64_t bench_syscall(uint64_t iters, uint64_t* out_ns) {
+    static os::TorusScheduler scheduler(1);
+    static os::SyscallDispatcher dispatcher;
+    static os::MemFS memfs;
+    static os::VFS vfs(&memfs);
+    static os::TorusContext ctx;
+    static os::OSProcess proc(1000, 0, 1);
+    static int32_t rfd = -1;
+    static int32_t wfd = -1;
+    static bool init = false;
+    if (!init) {
+        ctx.scheduler = &scheduler;
+        ctx.dispatcher = &dispatcher;
+        ctx.vfs = &vfs;
+        os::current_torus_context = &ctx;
+        (void)scheduler.addProcess(&proc);
+        scheduler.tick();
+        os::Device* dev = os::create_loopback_device("bench_pipe");
+        if (dev) {
+            dev->open(dev);
+            wfd = proc.fd_table.allocateDevice(dev, os::O_WRONLY);
+            rfd = proc.fd_table.allocateDevice(dev, os::O_RDONLY);
+        }
+        init = true;
+    }
+    if (rfd < 0 || wfd < 0) {
+        *out_ns = 1;
+        return 0;
+    }
+    os::current_torus_context = &ctx;
+    uint8_t msg[64];
+    uint8_t echo[64];
+    std::memset(msg, 0x17, sizeof(msg));
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        if (dispatcher.dispatch(os::SYS_WRITE, (uint64_t)wfd,
+                                (uint64_t)msg, sizeof(msg), 0, 0, 0) !=
+                (int64_t)sizeof(msg) ||
+            dispatcher.dispatch(os::SYS_READ, (uint64_t)rfd,
+                                (uint64_t)echo, sizeof(echo), 0, 0, 0) !=
+                (int64_t)sizeof(echo)) {
+            break;
+        }
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+/**
+ * FastPath SPSC ring: 64-byte message through write + read.
+ */
+uint64_t bench_fastpath_ring(uint64_t iters, uint64_t* out_ns) {
+    static os::Device* dev = os::create_fastpath_device("bench");
+    uint8_t msg[64];
+    uint8_t echo[64];
+    std::memset(msg, 0x42, sizeof(msg));
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        if (os::fastpath_write(dev, msg, sizeof(msg)) !=
+                (ssize_t)sizeof(msg) ||
+            os::fastpath_read(dev, echo, sizeof(echo)) !=
+                (ssize_t)sizeof(echo)) {
+            break;
+        }
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+/**
+ * Generic-pool trace replay: a deterministic allocation trace (mixed
+ * size classes, lifetimes emerging from random slot reuse) against
+ * BoundedArenaAllocator's segregated freelists. Models the miscellaneous
+ * churn of a long-running torus; poll snapshotGenericPool() afterwards
+ * for the free_bytes / largest_free_run fragmentation drift this
+ * workload produces. xorshift-seeded so the trace is identical run to
+ * run and across size-class redesigns.
+ */
+uint64_t bench_alloc_trace(uint64_t iters, uint64_t* out_ns) {
+    constexpr size_t kSlots = 1024;
+    static void* live[kSlots] = {};
+    auto& alloc = BoundedArenaAllocator::getInstance();
+
+    uint64_t rng = 0x9e3779b97f4a7c15ull;
+    auto next = [&rng]() {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    };
+
+    uint64_t start = now_ns();
+    for (uint64_t step = 0; step < iters; ++step) {
+        const uint64_t r = next();
+        const size_t slot = r % kSlots;
+        if (live[slot]) {
+            alloc.deallocateGeneric(live[slot]);
+        }
+        // Size mix recorded from torus runs: mostly small nodes and
+        // strings, some buffers, occasional projection-sized blocks
+        const uint64_t pick = (r >> 32) % 100;
+        size_t size;
+        if (pick < 70) {
+            size = 16 + ((r >> 8) % 240);
+        } else if (pick < 95) {
+            size = 512 + ((r >> 8) % 3584);
+        } else {
+            size = 16384 + ((r >> 8) % 49152);
+        }
+        live[slot] = alloc.allocateGeneric(size);
+    }
+    *out_ns = now_ns() - start;
+
+    for (size_t i = 0; i < kSlots; ++i) {
+        if (live[i]) {
+            alloc.deallocateGeneric(live[i]);
+            live[i] = nullptr;
+        }
+    }
+    return iters;
+}
+
+/**
+ * Packed projection wire format: serialize + deserialize of a V3
+ * projection with a realistically sparse boundary face (64 of 1024
+ * cells non-zero) — the per-exchange encode cost RSEPX_ENC_PACKED
+ * trades for smaller frames.
+ */
+uint64_t bench_proj_wire(uint64_t iters, uint64_t* out_ns) {
+    static braided::ProjectionV3 src;
+    static braided::ProjectionV3 dst;
+    static uint8_t buf[braided::PROJECTION_WIRE_MAX_V3];
+    static bool init = false;
+    if (!init) {
+        src = braided::ProjectionV3{};
+        src.torus_id = 1;
+        src.timestamp = 123456789;
+        src.total_events_processed = 987654321;
+        src.current_time = 42424242;
+        src.active_processes = 4096;
+        src.pending_events = 512;
+        src.edge_count = 8192;
+        for (size_t i = 0; i < braided::ProjectionV3::BOUNDARY_SIZE;
+             i += 16) {
+            src.boundary_states[i] = (uint32_t)(i * 3 + 1);
+        }
+        for (size_t i = 0; i < braided::ProjectionV3::CONSTRAINT_DIM; i++) {
+            src.constraint_vector[i] = (int32_t)i - 8;
+        }
+        src.initializeBoundaryConstraints(5);
+        src.initializeGlobalConstraints();
+        src.num_processes = 16;
+        for (uint32_t i = 0; i < src.num_processes; i++) {
+            src.processes[i] = {i, (int16_t)(i & 31), (int16_t)(i >> 2),
+                                (int16_t)0, i * 3};
+        }
+        src.state_hash = src.computeHash();
+        init = true;
+    }
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < iters; i++) {
+        size_t n = braided::serializeWire(src, buf, sizeof(buf));
+        if (n == 0 || !braided::deserializeWire(buf, n, dst)) {
+            break;
+        }
+    }
+    *out_ns = now_ns() - start;
+    return iters;
+}
+
+struct Bench {
+    const char* name;
+    BenchFn fn;
+    uint64_t default_iters;
+};
+
+const Bench kBenches[] = {
+    {"rdl_tick", bench_rdl_tick, 1000000},
+    {"inject_event", bench_inject_event, 500000},
+    {"phys_alloc", bench_phys_alloc, 1000000},
+    {"sched_tick", bench_sched_tick, 1000000},
+    {"vfs_open", bench_vfs_open, 1000000},
+    {"syscall", bench_syscall, 1000000},
+    {"fastpath_ring", bench_fastpath_ring, 1000000},
+    {"alloc_trace", bench_alloc_trace, 1000000},
+    {"proj_wire", bench_proj_wire, 200000},
+};
+
+bool name_matches(const char* name, const char* filter) {
+    if (!filter || filter[0] == '\0') {
+        return true;
+    }
+    return std::strstr(name, filter) != nullptr;
+}
+
+// Recorded result for one benchmark, loaded from a baseline JSON file.
+// The file is our own writer's output, so the loader is a bounded field
+// scanner rather than a general JSON parser.
+struct BaselineEntry {
+    char name[64];
+    double ops_per_sec;
+    double tolerance_pct;  // <0 = not set, use the CLI tolerance
+};
+
+constexpr uint32_t kMaxBaselineEntries = 32;
+
+BaselineEntry g_baseline[kMaxBaselineEntries];
+uint32_t g_baseline_count = 0;
+
+// Scans `text` for the double following `"key":` within [from, until)
+double scan_field(const char* from, const char* until, const char* key,
+                  double fallback) {
+    const char* p = std::strstr(from, key);
+    if (!p || p >= until) {
+        return fallback;
+    }
+    p += std::strlen(key);
+    return std::strtod(p, nullptr);
+}
+
+bool load_baseline(const char* path) {
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::fprintf(stderr, "rse_bench: cannot open baseline %s\n", path);
+        return false;
+    }
+    static char text[64 * 1024];
+    size_t len = std::fread(text, 1, sizeof(text) - 1, f);
+    std::fclose(f);
+    text[len] = '\0';
+
+    const char* p = text;
+    while (g_baseline_count < kMaxBaselineEntries) {
+        const char* name_key = std::strstr(p, "\"name\":\"");
+        if (!name_key) {
+            break;
+        }
+        const char* name_start = name_key + 8;
+        const char* name_end = std::strchr(name_start, '"');
+        if (!name_end) {
+            break;
+        }
+        // Fields for this entry end where the next entry's name begins
+        const char* next = std::strstr(name_end, "\"name\":\"");
+        const char* until = next ? next : text + len;
+
+        BaselineEntry& e = g_baseline[g_baseline_count];
+        size_t name_len = static_cast<size_t>(name_end - name_start);
+        if (name_len >= sizeof(e.name)) {
+            name_len = sizeof(e.name) - 1;
+        }
+        std::memcpy(e.name, name_start, name_len);
+        e.name[name_len] = '\0';
+        e.ops_per_sec = scan_field(name_end, until, "\"ops_per_sec\":", 0.0);
+        e.tolerance_pct =
+            scan_field(name_end, until, "\"tolerance_pct\":", -1.0);
+        if (e.ops_per_sec > 0.0) {
+            g_baseline_count++;
+        }
+        p = until;
+    }
+    return g_baseline_count > 0;
+}
+
+const BaselineEntry* find_baseline(const char* name) {
+    for (uint32_t i = 0; i < g_baseline_count; i++) {
+        if (std::strcmp(g_baseline[i].name, name) == 0) {
+            return &g_baseline[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t iters_override = 0;
+    uint64_t warmup_override = 0;
+    bool warmup_set = false;
+    const char* filter = nullptr;
+    bool list_only = false;
+    const char* baseline_path = nullptr;
+    const char* save_path = nullptr;
+    double tolerance_pct = 10.0;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--iters") == 0 && i + 1 < argc) {
+            iters_override = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            warmup_override = std::strtoull(argv[++i], nullptr, 10);
+            warmup_set = true;
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--list") == 0) {
+            list_only = true;
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--save-baseline") == 0 &&
+                   i + 1 < argc) {
+            save_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance_pct = std::strtod(argv[++i], nullptr);
+        } else {
+            std::cerr << "usage: rse_bench [--iters N] [--warmup N]"
+                      << " [--filter substr] [--list] [--baseline file]"
+                      << " [--tolerance pct] [--save-baseline file]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    if (baseline_path && !load_baseline(baseline_path)) {
+        return 1;
+    }
+
+    if (list_only) {
+        for (const Bench& b : kBenches) {
+            std::cout << b.name << std::endl;
+        }
+        return 0;
+    }
+
+    const char* run_names[kMaxBaselineEntries];
+    double run_ops_per_sec[kMaxBaselineEntries];
+    double run_tolerance[kMaxBaselineEntries];
+    uint32_t run_count = 0;
+    uint32_t regressions = 0;
+
+    std::printf("{\"benchmarks\":[");
+    bool first = true;
+    for (const Bench& b : kBenches) {
+        if (!name_matches(b.name, filter)) {
+            continue;
+        }
+        uint64_t iters = iters_override ? iters_override : b.default_iters;
+        uint64_t warmup = warmup_set ? warmup_override : iters / 10;
+        uint64_t ns = 0;
+        uint64_t ops = 0;
+        {
+            CoutSilencer quiet;
+            if (warmup > 0) {
+                (void)b.fn(warmup, &ns);
+            }
+            ops = b.fn(iters, &ns);
+        }
+        double ns_per_op = ops ? (double)ns / (double)ops : 0.0;
+        double ops_per_sec = ns ? (double)ops * 1e9 / (double)ns : 0.0;
+        std::printf("%s{\"name\":\"%s\",\"iters\":%llu,\"warmup\":%llu,"
+                    "\"ops\":%llu,\"total_ns\":%llu,\"ns_per_op\":%.2f,"
+                    "\"ops_per_sec\":%.0f",
+                    first ? "" : ",", b.name,
+                    (unsigned long long)iters, (unsigned long long)warmup,
+                    (unsigned long long)ops, (unsigned long long)ns,
+                    ns_per_op, ops_per_sec);
+        std::fprintf(stderr, "  %-14s %12llu ops  %8.1f ns/op  %12.0f ops/s\n",
+                     b.name, (unsigned long long)ops, ns_per_op, ops_per_sec);
+
+        double tol = tolerance_pct;
+        const BaselineEntry* base = find_baseline(b.name);
+        if (base) {
+            if (base->tolerance_pct >= 0.0) {
+                tol = base->tolerance_pct;
+            }
+            double delta_pct =
+                (ops_per_sec - base->ops_per_sec) * 100.0 / base->ops_per_sec;
+            bool regressed = delta_pct < -tol;
+            if (regressed) {
+                regressions++;
+            }
+            std::printf(",\"baseline_ops_per_sec\":%.0f,\"delta_pct\":%.1f,"
+                        "\"status\":\"%s\"",
+                        base->ops_per_sec, delta_pct,
+                        regressed ? "fail" : "pass");
+            std::fprintf(stderr,
+                         "  %-14s %s vs baseline %.0f ops/s"
+                         " (%+.1f%%, tolerance %.1f%%)\n",
+                         b.name, regressed ? "FAIL" : "PASS",
+                         base->ops_per_sec, delta_pct, tol);
+        } else if (baseline_path) {
+            std::fprintf(stderr, "  %-14s SKIP no baseline entry\n", b.name);
+        }
+        std::printf("}");
+        std::fflush(stdout);
+
+        if (run_count < kMaxBaselineEntries) {
+            run_names[run_count] = b.name;
+            run_ops_per_sec[run_count] = ops_per_sec;
+            run_tolerance[run_count] = tol;
+            run_count++;
+        }
+        first = false;
+    }
+    std::printf("]}\n");
+
+    if (save_path) {
+        std::FILE* f = std::fopen(save_path, "wb");
+        if (!f) {
+            std::fprintf(stderr, "rse_bench: cannot write %s\n", save_path);
+            return 1;
+        }
+        std::fprintf(f, "{\"benchmarks\":[");
+        for (uint32_t i = 0; i < run_count; i++) {
+            std::fprintf(f,
+                         "%s\n  {\"name\":\"%s\",\"ops_per_sec\":%.0f,"
+                         "\"tolerance_pct\":%.1f}",
+                         i ? "," : "", run_names[i], run_ops_per_sec[i],
+                         run_tolerance[i]);
+        }
+        std::fprintf(f, "\n]}\n");
+        std::fclose(f);
+        std::fprintf(stderr, "baseline saved to %s\n", save_path);
+    }
+
+    if (regressions > 0) {
+        std::fprintf(stderr, "%u benchmark(s) regressed beyond tolerance\n",
+                     regressions);
+        return 2;
+    }
+    return 0;
+}
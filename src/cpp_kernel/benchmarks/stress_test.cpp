@@ -1,5 +1,6 @@
 #include "../Allocator.h"
 #include "../demos/BettiRDLCompute.h"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <iomanip>
@@ -13,6 +14,8 @@
 // 1. The Firehose: Max throughput measurement
 // 2. The Deep Dive: Deep recursion memory stability
 // 3. The Swarm: Massive parallelism scaling
+// 4. The Scheduler A/B: Event-queue policy comparison
+// 5. The Scaling Curve: Producer-count sweep (contention vs independence)
 // ============================================================================
 
 using namespace std::chrono;
@@ -167,6 +170,197 @@ void runSwarm(int thread_count, int events_per_thread) {
   std::cout << "  [SUCCESS] Threads maintained stability." << std::endl;
 }
 
+// ----------------------------------------------------------------------------
+// 4. THE SCHEDULER A/B
+// Goal: Compare event-queue policies (min-heap vs timing wheel)
+// ----------------------------------------------------------------------------
+struct QueueBenchEvent {
+  unsigned long long timestamp;
+  int id;
+
+  bool operator<(const QueueBenchEvent &other) const {
+    if (timestamp != other.timestamp)
+      return timestamp < other.timestamp;
+    return id < other.id;
+  }
+};
+
+template <typename QueueT>
+double runQueuePolicy(QueueT &queue, int operations) {
+  // Steady-state schedule/fire loop with small bounded delays, mimicking
+  // AdaptiveEdge-derived events in the BettiRDLKernel tick loop.
+  constexpr int kSteadyDepth = 4096;
+  unsigned long long now = 0;
+  unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+
+  for (int i = 0; i < kSteadyDepth; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    (void)queue.push({now + 1 + (seed >> 33) % 32, i});
+  }
+
+  auto start = high_resolution_clock::now();
+  for (int i = 0; i < operations; i++) {
+    now = queue.top().timestamp;
+    (void)queue.pop();
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    (void)queue.push({now + 1 + (seed >> 33) % 32, i});
+  }
+  auto end = high_resolution_clock::now();
+
+  double seconds = duration_cast<milliseconds>(end - start).count() / 1000.0;
+  return seconds > 0.0 ? operations / seconds : 0.0;
+}
+
+void runQueueAB(int operations) {
+  printHeader("TEST 4: THE SCHEDULER A/B (Queue Policies)");
+  std::cout << "Goal: " << operations
+            << " schedule/fire cycles per event-queue policy." << std::endl;
+
+  static FixedMinHeap<QueueBenchEvent, 8192> heap;
+  double heap_ops = runQueuePolicy(heap, operations);
+  std::cout << "  FixedMinHeap:    " << std::fixed << std::setprecision(2)
+            << heap_ops << " ops/sec" << std::endl;
+
+  static FixedQuadHeap<QueueBenchEvent, 8192> quad;
+  double quad_ops = runQueuePolicy(quad, operations);
+  std::cout << "  FixedQuadHeap:   " << std::fixed << std::setprecision(2)
+            << quad_ops << " ops/sec" << std::endl;
+
+  static FixedTimingWheel<QueueBenchEvent, 8192> wheel;
+  double wheel_ops = runQueuePolicy(wheel, operations);
+  std::cout << "  FixedTimingWheel: " << std::fixed << std::setprecision(2)
+            << wheel_ops << " ops/sec" << std::endl;
+
+  if (heap_ops > 0.0) {
+    std::cout << "  Quad/Heap ratio:  " << std::setprecision(2)
+              << (quad_ops / heap_ops) << "x" << std::endl;
+    std::cout << "  Wheel/Heap ratio: " << std::setprecision(2)
+              << (wheel_ops / heap_ops) << "x" << std::endl;
+  }
+}
+
+// ----------------------------------------------------------------------------
+// 5. THE SCALING CURVE
+// Goal: Show how injection throughput scales with producer count, with
+// contention isolated from tick throughput.
+//
+// Sweep A pushes 1..N producer threads into ONE kernel: every producer
+// crosses the injection lock, so the curve exposes serialization on the
+// shared path (drains between rounds are untimed). Sweep B runs 1..N
+// fully independent kernels, one per thread — the no-sharing ceiling the
+// shared path should be judged against.
+// ----------------------------------------------------------------------------
+
+// Timed injection of `total_events` into one shared kernel by `producers`
+// threads, in rounds bounded by the pending buffer; returns inject-only EPS.
+double runSharedInjectSweep(int producers, long total_events) {
+  BettiRDLCompute kernel;
+  kernel.spawnProcess(0, 0, 0);
+
+  // Half the pending-buffer capacity per round, so producers never spin
+  // on a full buffer and the drain below keeps the event queue bounded
+  constexpr int kRound = 8192;
+  constexpr int chain_length = 10;
+
+  long injected = 0;
+  double inject_seconds = 0.0;
+  while (injected < total_events) {
+    int round = static_cast<int>(
+        std::min<long>(kRound, total_events - injected));
+    int per_thread = std::max(1, round / producers);
+
+    auto start = high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (int t = 0; t < producers; t++) {
+      threads.emplace_back([&kernel, per_thread] {
+        for (int i = 0; i < per_thread; i++) {
+          (void)kernel.injectEvent(0, 0, 0, i);
+        }
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+    auto end = high_resolution_clock::now();
+    inject_seconds += duration_cast<microseconds>(end - start).count() / 1e6;
+
+    injected += static_cast<long>(per_thread) * producers;
+    // Untimed drain: tick throughput stays out of the injection number
+    (void)kernel.run(per_thread * producers * chain_length);
+  }
+
+  return inject_seconds > 0.0 ? injected / inject_seconds : 0.0;
+}
+
+// Aggregate processed EPS of `kernels` independent kernels, one thread each.
+double runIndependentSweep(int kernels, long events_per_kernel) {
+  std::vector<std::thread> threads;
+  std::atomic<long> total_events = 0;
+
+  auto start = high_resolution_clock::now();
+  for (int i = 0; i < kernels; i++) {
+    threads.emplace_back(workerThread, i, static_cast<int>(events_per_kernel),
+                         std::ref(total_events));
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  auto end = high_resolution_clock::now();
+
+  double seconds = duration_cast<microseconds>(end - start).count() / 1e6;
+  return seconds > 0.0 ? total_events / seconds : 0.0;
+}
+
+void runScalingCurve(long shared_events, long events_per_kernel) {
+  printHeader("TEST 5: THE SCALING CURVE (Producer Sweep)");
+
+  int max_threads =
+      static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  std::cout << "Goal: Sweep 1.." << max_threads
+            << " producers; shared-kernel injection vs independent kernels."
+            << std::endl;
+
+  // Powers of two up to the core count, plus the core count itself
+  std::vector<int> counts;
+  for (int c = 1; c < max_threads; c *= 2) {
+    counts.push_back(c);
+  }
+  counts.push_back(max_threads);
+
+  std::cout << "\n  Threads | Shared inject EPS |  Scaling | Independent EPS |  Scaling"
+            << std::endl;
+  std::cout << "  --------+-------------------+----------+-----------------+---------"
+            << std::endl;
+
+  double shared_base = 0.0;
+  double indep_base = 0.0;
+  for (int c : counts) {
+    // Kernel constructors are chatty; keep the table contiguous
+    std::streambuf *saved = std::cout.rdbuf(nullptr);
+    double shared_eps = runSharedInjectSweep(c, shared_events);
+    double indep_eps = runIndependentSweep(c, events_per_kernel);
+    std::cout.rdbuf(saved);
+    if (c == 1) {
+      shared_base = shared_eps;
+      indep_base = indep_eps;
+    }
+
+    std::cout << "  " << std::setw(7) << c << " | " << std::setw(17)
+              << std::fixed << std::setprecision(0) << shared_eps << " | "
+              << std::setw(7) << std::setprecision(2)
+              << (shared_base > 0.0 ? shared_eps / shared_base : 0.0) << "x | "
+              << std::setw(15) << std::setprecision(0) << indep_eps << " | "
+              << std::setw(7) << std::setprecision(2)
+              << (indep_base > 0.0 ? indep_eps / indep_base : 0.0) << "x"
+              << std::endl;
+  }
+
+  std::cout << "\n  Shared scaling that trails independent scaling is"
+            << " contention on the\n  injection path, not tick throughput"
+            << " (drains are untimed in the sweep)." << std::endl;
+}
+
 int main() {
   std::cout << "Betti-RDL System Stress Test" << std::endl;
   std::cout << "V 1.0.0" << std::endl;
@@ -182,5 +376,11 @@ int main() {
   // 3. Swarm: 16 threads (typical high-end consumer CPU)
   runSwarm(16, 100000);
 
+  // 4. Scheduler A/B: 2 million schedule/fire cycles per policy
+  runQueueAB(2000000);
+
+  // 5. Scaling curve: 512K shared injections, 100K events per kernel
+  runScalingCurve(512 * 1024, 100000);
+
   return 0;
 }
@@ -20,6 +20,57 @@ void betti_rdl_inject_event(BettiRDLCompute *kernel, int x, int y, int z,
   }
 }
 
+size_t betti_rdl_spawn_batch(BettiRDLCompute *kernel,
+                             const BettiRDLSpawnDesc *spawns, size_t count) {
+  if (!kernel || !spawns) {
+    return 0;
+  }
+  static_assert(sizeof(BettiRDLSpawnDesc) ==
+                sizeof(BettiRDLCompute::SpawnDesc));
+  return kernel->spawnProcessBatch(
+      reinterpret_cast<const BettiRDLCompute::SpawnDesc *>(spawns), count);
+}
+
+size_t betti_rdl_inject_batch(BettiRDLCompute *kernel,
+                              const BettiRDLEventDesc *events, size_t count) {
+  if (!kernel || !events) {
+    return 0;
+  }
+  static_assert(sizeof(BettiRDLEventDesc) ==
+                sizeof(BettiRDLCompute::EventDesc));
+  return kernel->injectEventBatch(
+      reinterpret_cast<const BettiRDLCompute::EventDesc *>(events), count);
+}
+
+BettiRDLCommandQueue *betti_rdl_command_queue(BettiRDLCompute *kernel) {
+  if (!kernel) {
+    return nullptr;
+  }
+  // The C view is the same ring: lock-free 64-bit atomics have the
+  // layout of the plain cursors they mirror
+  static_assert(BETTI_RDL_COMMAND_CAPACITY ==
+                BettiRDLCompute::kCommandQueueCapacity);
+  static_assert(sizeof(BettiRDLCommand) == sizeof(BettiRDLCompute::Command));
+  static_assert(sizeof(BettiRDLCommandQueue) ==
+                sizeof(BettiRDLCompute::CommandQueue));
+  static_assert(std::atomic<uint64_t>::is_always_lock_free);
+  static_assert(BETTI_RDL_CMD_SPAWN == BettiRDLCompute::kCommandSpawn);
+  static_assert(BETTI_RDL_CMD_INJECT == BettiRDLCompute::kCommandInject);
+  return reinterpret_cast<BettiRDLCommandQueue *>(kernel->commandQueue());
+}
+
+int betti_rdl_enqueue(BettiRDLCompute *kernel, int32_t op, int x, int y,
+                      int z, int value) {
+  if (!kernel) {
+    return 0;
+  }
+  return kernel->enqueueCommand({op, x, y, z, value}) ? 1 : 0;
+}
+
+int betti_rdl_drain(BettiRDLCompute *kernel) {
+  return kernel ? kernel->drainCommands() : 0;
+}
+
 int betti_rdl_run(BettiRDLCompute *kernel, int max_events) {
   if (kernel) {
     return kernel->run(max_events);
@@ -55,8 +106,32 @@ BettiRDLTelemetry betti_rdl_get_telemetry(const BettiRDLCompute *kernel) {
   return telemetry;
 }
 
+const BettiRDLTelemetryPage *
+betti_rdl_get_telemetry_page(const BettiRDLCompute *kernel) {
+  if (!kernel) {
+    return nullptr;
+  }
+  // The C view is the same cache line: lock-free 64-bit atomics have the
+  // layout of the plain fields they mirror
+  static_assert(sizeof(BettiRDLTelemetryPage) ==
+                sizeof(BettiRDLCompute::TelemetryPage));
+  static_assert(std::atomic<uint64_t>::is_always_lock_free);
+  return reinterpret_cast<const BettiRDLTelemetryPage *>(
+      kernel->telemetryPage());
+}
+
 int betti_rdl_get_process_state(const BettiRDLCompute *kernel, int pid) {
   return kernel ? kernel->getProcessState(pid) : 0;
 }
 
+const int32_t *betti_rdl_lattice_states(const BettiRDLCompute *kernel) {
+  if (!kernel) {
+    return nullptr;
+  }
+  static_assert(sizeof(int) == sizeof(int32_t));
+  return reinterpret_cast<const int32_t *>(kernel->latticeStates());
+}
+
+size_t betti_rdl_lattice_size(void) { return BettiRDLCompute::latticeSize(); }
+
 } // extern "C"
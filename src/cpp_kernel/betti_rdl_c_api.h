@@ -17,6 +17,22 @@ typedef struct {
   size_t memory_used;
 } BettiRDLTelemetry;
 
+// Shared-memory telemetry page: one cache line the kernel's tick loop
+// refreshes with relaxed atomic stores — no locks, no syscalls, no FFI
+// crossing per sample. Monitors read the fields as plain 64-bit loads;
+// each field is individually torn-free but the page is not a consistent
+// snapshot across fields. The struct is exactly one cache line so
+// polling it never contends with anything else the kernel writes.
+typedef struct {
+  uint64_t events_processed;
+  uint64_t current_time;
+  uint64_t queue_depth;
+  uint64_t memory_used;
+  uint64_t commands_applied;  // Lifetime commands drained from the ring
+  uint64_t commands_pending;  // Ring backlog at the last drain
+  uint8_t reserved[16];       // Pad to one 64-byte cache line
+} BettiRDLTelemetryPage;
+
 #ifdef _WIN32
     #ifdef BETTI_RDL_EXPORTS
         #define BETTI_RDL_API __declspec(dllexport)
@@ -34,9 +50,71 @@ BETTI_RDL_API void betti_rdl_destroy(BettiRDLCompute* kernel);
 // Process management
 BETTI_RDL_API void betti_rdl_spawn_process(BettiRDLCompute* kernel, int x, int y, int z);
 
+// Descriptors for bulk operations (one FFI crossing per frame)
+typedef struct {
+  int x, y, z;
+  int value;
+} BettiRDLEventDesc;
+
+typedef struct {
+  int x, y, z;
+} BettiRDLSpawnDesc;
+
+// Bulk process spawn; returns the number of processes created
+BETTI_RDL_API size_t betti_rdl_spawn_batch(BettiRDLCompute* kernel,
+                                           const BettiRDLSpawnDesc* spawns,
+                                           size_t count);
+
 // Event injection
 BETTI_RDL_API void betti_rdl_inject_event(BettiRDLCompute* kernel, int x, int y, int z, int value);
 
+// Bulk event injection; returns the number of events accepted
+BETTI_RDL_API size_t betti_rdl_inject_batch(BettiRDLCompute* kernel,
+                                            const BettiRDLEventDesc* events,
+                                            size_t count);
+
+// Asynchronous command queue: bindings append commands into a shared
+// ring without calling into the kernel, then one betti_rdl_drain call
+// applies the whole backlog — per-command FFI (and interpreter lock)
+// overhead stops scaling with command count. The ring is single
+// producer, single consumer: the binding writes tail, drain writes head.
+#define BETTI_RDL_COMMAND_CAPACITY 4096
+
+enum {
+  BETTI_RDL_CMD_SPAWN = 1,   // Spawn a process at (x, y, z); value ignored
+  BETTI_RDL_CMD_INJECT = 2,  // Inject an event at (x, y, z) with value
+};
+
+typedef struct {
+  int32_t op;
+  int32_t x, y, z;
+  int32_t value;
+} BettiRDLCommand;
+
+typedef struct {
+  uint64_t head;     // Consumer cursor — written only by drain
+  uint64_t tail;     // Producer cursor — written only by the binding
+  uint64_t dropped;  // Enqueues refused because the ring was full
+  BettiRDLCommand commands[BETTI_RDL_COMMAND_CAPACITY];
+} BettiRDLCommandQueue;
+
+// Get the kernel's command ring. Owned by the kernel and valid until
+// betti_rdl_destroy. Direct-writer protocol: read head; the ring is
+// full when tail - head == BETTI_RDL_COMMAND_CAPACITY; otherwise write
+// commands[tail % capacity], then publish tail + 1 (plain 64-bit store
+// — one producer at a time).
+BETTI_RDL_API BettiRDLCommandQueue*
+betti_rdl_command_queue(BettiRDLCompute* kernel);
+
+// Append one command (for bindings that do not write the ring directly).
+// Returns 1 on success, 0 when the ring is full.
+BETTI_RDL_API int betti_rdl_enqueue(BettiRDLCompute* kernel, int32_t op,
+                                    int x, int y, int z, int value);
+
+// Apply every queued command in order; returns the count applied.
+// Refreshes commands_applied / commands_pending on the telemetry page.
+BETTI_RDL_API int betti_rdl_drain(BettiRDLCompute* kernel);
+
 // Execution
 // Processes at most max_events NEW events (not based on lifetime total)
 // Returns the number of events processed in this call
@@ -54,9 +132,28 @@ BETTI_RDL_API size_t betti_rdl_get_process_count(const BettiRDLCompute* kernel);
 BETTI_RDL_API BettiRDLTelemetry
 betti_rdl_get_telemetry(const BettiRDLCompute* kernel);
 
+// Get the kernel's telemetry page. The pointer is owned by the kernel
+// and stays valid until betti_rdl_destroy; sample it at any rate.
+BETTI_RDL_API const BettiRDLTelemetryPage*
+betti_rdl_get_telemetry_page(const BettiRDLCompute* kernel);
+
 // Get state of a specific process
 BETTI_RDL_API int betti_rdl_get_process_state(const BettiRDLCompute* kernel, int pid);
 
+// Stable pointer to the kernel's lattice state array: one int32 per
+// cell, indexed by node id (x*1024 + y*32 + z, so the x=0 boundary face
+// is the first 1024 entries). Owned by the kernel, updated in place by
+// the tick loop, and valid until betti_rdl_destroy — bindings wrap it
+// in a buffer-protocol view so NumPy reads lattice state with zero
+// copies and zero allocation per sample. Single writer: each cell is an
+// individually torn-free int32, but the array is not a consistent
+// snapshot across cells.
+BETTI_RDL_API const int32_t*
+betti_rdl_lattice_states(const BettiRDLCompute* kernel);
+
+// Number of cells behind betti_rdl_lattice_states
+BETTI_RDL_API size_t betti_rdl_lattice_size(void);
+
 #ifdef __cplusplus
 }
 #endif
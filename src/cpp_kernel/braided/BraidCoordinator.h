@@ -11,6 +11,20 @@
 
 namespace braided {
 
+// Raw cycle counter for phase cost accounting (same source the allocator
+// telemetry uses); only relative magnitudes matter for the summaries.
+inline uint64_t braid_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return 0;
+#endif
+}
+
 /**
  * BraidCoordinator: Orchestrates cyclic projection exchange between tori.
  * 
@@ -28,15 +42,57 @@ public:
         B_PROJECTS,  // Torus B projects, A and C ingest
         C_PROJECTS   // Torus C projects, A and B ingest
     };
-    
+
+    static constexpr uint32_t kNumPhases = 3;
+    static constexpr uint32_t kNumTori = 3;
+
+    // One exchange's cost breakdown: extraction covers extractProjection
+    // plus verify; each ingest covers one applyConstraint call.
+    struct PhaseSample {
+        uint64_t extract_cycles;
+        uint64_t ingest_cycles[2];  // In braid order for that phase
+    };
+
+    // Rolling window of the most recent exchanges per phase; newest
+    // samples overwrite the oldest in place.
+    static constexpr uint32_t kPhaseWindow = 64;
+
+    // Window summary returned by getPhaseStats()
+    struct PhaseStats {
+        uint64_t mean_extract_cycles;
+        uint64_t mean_ingest_cycles;   // Mean over both ingests
+        uint64_t mean_total_cycles;
+        uint64_t max_total_cycles;
+        uint64_t samples;              // Exchanges contributing (<= window)
+    };
+
 private:
     Phase current_phase_;
     uint64_t exchange_count_;
-    
+
     // Statistics
     uint64_t total_exchanges_;
     uint64_t consistency_violations_;
-    
+
+    // Per-phase cost windows and cumulative per-torus ingest cycles, so a
+    // slow braid cycle can be attributed to extraction, ingestion, or one
+    // particular torus rather than inferred from violation rate.
+    PhaseSample phase_window_[kNumPhases][kPhaseWindow] = {};
+    uint64_t phase_sample_count_[kNumPhases] = {};
+    uint64_t torus_ingest_cycles_[kNumTori] = {};
+
+    void recordPhase(Phase phase, uint64_t extract,
+                     uint64_t ingest_first, uint64_t ingest_second,
+                     uint32_t first_torus, uint32_t second_torus) {
+        const uint32_t slot =
+            static_cast<uint32_t>(phase_sample_count_[phase] % kPhaseWindow);
+        phase_window_[phase][slot] =
+            PhaseSample{extract, {ingest_first, ingest_second}};
+        phase_sample_count_[phase]++;
+        torus_ingest_cycles_[first_torus] += ingest_first;
+        torus_ingest_cycles_[second_torus] += ingest_second;
+    }
+
 public:
     BraidCoordinator() 
         : current_phase_(A_PROJECTS)
@@ -60,7 +116,44 @@ public:
     // Statistics
     uint64_t getTotalExchanges() const { return total_exchanges_; }
     uint64_t getConsistencyViolations() const { return consistency_violations_; }
-    
+
+    // Mean/max cost over the rolling window of recent exchanges for one
+    // phase. Zeroed until that phase has run at least once.
+    PhaseStats getPhaseStats(Phase phase) const {
+        PhaseStats out = {};
+        const uint64_t seen = phase_sample_count_[phase];
+        const uint32_t have = seen < kPhaseWindow
+                                  ? static_cast<uint32_t>(seen)
+                                  : kPhaseWindow;
+        if (have == 0) {
+            return out;
+        }
+        uint64_t extract_sum = 0;
+        uint64_t ingest_sum = 0;
+        uint64_t max_total = 0;
+        for (uint32_t i = 0; i < have; ++i) {
+            const PhaseSample& s = phase_window_[phase][i];
+            const uint64_t total =
+                s.extract_cycles + s.ingest_cycles[0] + s.ingest_cycles[1];
+            extract_sum += s.extract_cycles;
+            ingest_sum += s.ingest_cycles[0] + s.ingest_cycles[1];
+            if (total > max_total) {
+                max_total = total;
+            }
+        }
+        out.mean_extract_cycles = extract_sum / have;
+        out.mean_ingest_cycles = ingest_sum / (2 * have);
+        out.mean_total_cycles = (extract_sum + ingest_sum) / have;
+        out.max_total_cycles = max_total;
+        out.samples = have;
+        return out;
+    }
+
+    // Cumulative cycles torus_id has spent ingesting constraints
+    uint64_t getTorusIngestCycles(uint32_t torus_id) const {
+        return torus_id < kNumTori ? torus_ingest_cycles_[torus_id] : 0;
+    }
+
     // Phase name for debugging
     const char* getPhaseName() const {
         switch (current_phase_) {
@@ -80,22 +173,27 @@ inline void BraidCoordinator::exchange(
     switch (current_phase_) {
         case A_PROJECTS: {
             // Torus A projects its state
+            const uint64_t t0 = braid_cycles();
             Projection proj = torus_a.extractProjection();
-            
+
             // Verify projection integrity
             if (!proj.verify()) {
                 std::cerr << "[BRAID] WARNING: Invalid projection from Torus A" << std::endl;
                 consistency_violations_++;
             }
-            
+            const uint64_t t1 = braid_cycles();
+
             // B and C ingest as constraint
             bool b_ok = torus_b.applyConstraint(proj);
+            const uint64_t t2 = braid_cycles();
             bool c_ok = torus_c.applyConstraint(proj);
-            
+            const uint64_t t3 = braid_cycles();
+
             if (!b_ok || !c_ok) {
                 consistency_violations_++;
             }
-            
+            recordPhase(A_PROJECTS, t1 - t0, t2 - t1, t3 - t2, 1, 2);
+
             // Rotate to next phase
             current_phase_ = B_PROJECTS;
             break;
@@ -103,20 +201,25 @@ inline void BraidCoordinator::exchange(
         
         case B_PROJECTS: {
             // Torus B projects its state
+            const uint64_t t0 = braid_cycles();
             Projection proj = torus_b.extractProjection();
-            
+
             if (!proj.verify()) {
                 std::cerr << "[BRAID] WARNING: Invalid projection from Torus B" << std::endl;
                 consistency_violations_++;
             }
-            
+            const uint64_t t1 = braid_cycles();
+
             bool a_ok = torus_a.applyConstraint(proj);
+            const uint64_t t2 = braid_cycles();
             bool c_ok = torus_c.applyConstraint(proj);
-            
+            const uint64_t t3 = braid_cycles();
+
             if (!a_ok || !c_ok) {
                 consistency_violations_++;
             }
-            
+            recordPhase(B_PROJECTS, t1 - t0, t2 - t1, t3 - t2, 0, 2);
+
             // Rotate to next phase
             current_phase_ = C_PROJECTS;
             break;
@@ -124,20 +227,25 @@ inline void BraidCoordinator::exchange(
         
         case C_PROJECTS: {
             // Torus C projects its state
+            const uint64_t t0 = braid_cycles();
             Projection proj = torus_c.extractProjection();
-            
+
             if (!proj.verify()) {
                 std::cerr << "[BRAID] WARNING: Invalid projection from Torus C" << std::endl;
                 consistency_violations_++;
             }
-            
+            const uint64_t t1 = braid_cycles();
+
             bool a_ok = torus_a.applyConstraint(proj);
+            const uint64_t t2 = braid_cycles();
             bool b_ok = torus_b.applyConstraint(proj);
-            
+            const uint64_t t3 = braid_cycles();
+
             if (!a_ok || !b_ok) {
                 consistency_violations_++;
             }
-            
+            recordPhase(C_PROJECTS, t1 - t0, t2 - t1, t3 - t2, 0, 1);
+
             // Complete one full cycle
             current_phase_ = A_PROJECTS;
             exchange_count_++;
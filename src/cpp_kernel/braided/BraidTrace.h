@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace braided {
+
+/**
+ * BraidTrace: phase timeline recorder for braid runs.
+ *
+ * Each execution thread (and the coordinator) owns a lane: a fixed ring
+ * of begin/end phase spans written without locks — one writer per lane,
+ * newest spans overwrite the oldest once the ring wraps. Recording is
+ * off by default; when disabled every probe is a single flag test, so
+ * the hooks stay in the hot loops permanently.
+ *
+ * exportChromeTrace() emits Chrome trace-event JSON ("X" complete
+ * events, microsecond timestamps) that loads directly into
+ * chrome://tracing or Perfetto, one row per lane, so barrier stalls and
+ * exchange cost are visible as gaps between tick spans. Export after
+ * stop() — it reads the rings unsynchronized.
+ */
+class BraidTrace {
+public:
+    static constexpr std::size_t kEventsPerLane = 4096;
+
+    enum Phase : uint8_t {
+        TICK_RUN = 0,      // Ticking between exchanges
+        PROJ_WRITE,        // Writing the projection into the seqlock slot
+        BARRIER_WAIT,      // Parked in sync_barrier_ before the exchange
+        CONSTRAIN_WAIT,    // Parked while constraints are applied
+        EXCHANGE,          // Coordinator: whole braid exchange
+        PHASE_COUNT
+    };
+
+    static const char* phaseName(uint8_t phase) {
+        static const char* const names[PHASE_COUNT] = {
+            "tick_run", "proj_write", "barrier_wait", "constrain_wait",
+            "exchange",
+        };
+        return phase < PHASE_COUNT ? names[phase] : "?";
+    }
+
+    struct Event {
+        uint64_t begin_ns;
+        uint64_t end_ns;
+        uint8_t phase;
+    };
+
+    /** One ring per recording thread; head free-runs, ring keeps newest. */
+    struct Lane {
+        Event events[kEventsPerLane];
+        uint64_t head = 0;
+        char name[32] = {};
+    };
+
+    void init(std::size_t num_lanes) {
+        lanes_.clear();
+        lanes_.reserve(num_lanes);
+        for (std::size_t i = 0; i < num_lanes; i++) {
+            lanes_.push_back(std::make_unique<Lane>());
+            std::snprintf(lanes_[i]->name, sizeof(lanes_[i]->name),
+                          "lane %zu", i);
+        }
+    }
+
+    void setLaneName(std::size_t lane, const char* name) {
+        if (lane < lanes_.size()) {
+            std::snprintf(lanes_[lane]->name, sizeof(lanes_[lane]->name),
+                          "%s", name);
+        }
+    }
+
+    void setEnabled(bool on) { enabled_.store(on, std::memory_order_release); }
+    bool enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    /** Timestamp for a span opened by hand (0 = tracing off, drop it). */
+    uint64_t spanBegin() const { return enabled() ? nowNs() : 0; }
+
+    /** Close a hand-opened span; no-op when spanBegin() returned 0. */
+    void spanEnd(std::size_t lane, Phase phase, uint64_t begin_ns) {
+        if (begin_ns != 0) {
+            record(lane, phase, begin_ns, nowNs());
+        }
+    }
+
+    void record(std::size_t lane, Phase phase, uint64_t begin_ns,
+                uint64_t end_ns) {
+        if (!enabled() || lane >= lanes_.size()) {
+            return;
+        }
+        Lane& l = *lanes_[lane];
+        Event& ev = l.events[l.head % kEventsPerLane];
+        ev.begin_ns = begin_ns;
+        ev.end_ns = end_ns;
+        ev.phase = phase;
+        l.head++;
+    }
+
+    /** RAII span: times one lexical scope on `lane` when tracing is on. */
+    class Scope {
+    public:
+        Scope(BraidTrace& trace, std::size_t lane, Phase phase)
+            : trace_(trace), lane_(lane), phase_(phase),
+              begin_ns_(trace.spanBegin()) {}
+        ~Scope() { trace_.spanEnd(lane_, phase_, begin_ns_); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        BraidTrace& trace_;
+        std::size_t lane_;
+        Phase phase_;
+        uint64_t begin_ns_;
+    };
+
+    void exportChromeTrace(std::ostream& os) const {
+        // Timestamps are relative to the earliest recorded span so the
+        // viewer opens at t=0
+        uint64_t origin = UINT64_MAX;
+        for (const auto& lane : lanes_) {
+            const uint64_t count =
+                lane->head < kEventsPerLane ? lane->head : kEventsPerLane;
+            for (uint64_t i = 0; i < count; i++) {
+                if (lane->events[i].begin_ns < origin) {
+                    origin = lane->events[i].begin_ns;
+                }
+            }
+        }
+        if (origin == UINT64_MAX) {
+            origin = 0;
+        }
+
+        os << "{\"traceEvents\":[";
+        bool first = true;
+        for (std::size_t t = 0; t < lanes_.size(); t++) {
+            const Lane& lane = *lanes_[t];
+            os << (first ? "" : ",")
+               << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+               << t << ",\"args\":{\"name\":\"" << lane.name << "\"}}";
+            first = false;
+
+            // Oldest surviving span first
+            const uint64_t count =
+                lane.head < kEventsPerLane ? lane.head : kEventsPerLane;
+            const uint64_t start = lane.head - count;
+            for (uint64_t i = 0; i < count; i++) {
+                const Event& ev = lane.events[(start + i) % kEventsPerLane];
+                char buf[160];
+                std::snprintf(buf, sizeof(buf),
+                              ",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,"
+                              "\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}",
+                              phaseName(ev.phase), t,
+                              (double)(ev.begin_ns - origin) / 1000.0,
+                              (double)(ev.end_ns - ev.begin_ns) / 1000.0);
+                os << buf;
+            }
+        }
+        os << "],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+private:
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    std::atomic<bool> enabled_{false};
+};
+
+} // namespace braided
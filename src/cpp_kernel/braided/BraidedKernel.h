@@ -56,6 +56,10 @@ public:
     unsigned long long getCurrentTime() const {
         return kernel_.getCurrentTime();
     }
+
+    unsigned long long nextEventTime() {
+        return kernel_.nextEventTime();
+    }
     
     unsigned long long getEventsProcessed() const {
         return kernel_.getEventsProcessed();
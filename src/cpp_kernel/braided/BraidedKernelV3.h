@@ -3,6 +3,7 @@
 #include "BraidedKernelV2.h"
 #include "ProjectionV3.h"
 
+#include <bit>
 #include <vector>
 #include <tuple>
 
@@ -31,8 +32,28 @@ private:
     uint64_t last_heartbeat_ = 0;
     ProjectionV3::HealthStatus health_status_ = ProjectionV3::HEALTHY;
     
-    // Phase 3: Process tracking (for reconstruction)
-    std::vector<std::tuple<int, int, int, uint32_t>> active_processes_;
+    // Phase 3: Process tracking (for reconstruction).
+    // Bounded to the kernel's process capacity: spawn never reallocates
+    // and the reconstruction path stays off the heap.
+    FixedVector<std::tuple<int, int, int, uint32_t>, BettiRDLKernel::kMaxProcesses>
+        active_processes_;
+
+    // Delta projections: publish only boundary cells changed since the
+    // last extraction; a full snapshot is re-sent periodically so a
+    // receiver that missed a cycle can resynchronize
+    static constexpr uint32_t FULL_RESYNC_INTERVAL = 16;
+    bool delta_projections_ = false;
+    bool published_full_ = false;
+    uint64_t last_published_boundary_gen_ = 0;
+    uint32_t projections_since_full_ = 0;
+
+    // Cached full boundary view per peer torus, patched by incoming deltas
+    struct PeerBoundaryView {
+        std::array<uint32_t, ProjectionV3::BOUNDARY_SIZE> view{};
+        uint64_t generation = 0;
+        bool valid = false;
+    };
+    std::vector<PeerBoundaryView> peer_views_;
     
 public:
     BraidedKernelV3() = default;
@@ -42,8 +63,9 @@ public:
     bool spawnProcess(int x, int y, int z) {
         bool success = kernel_.spawnProcess(x, y, z);
         if (success) {
-            // Track process for reconstruction
-            active_processes_.push_back({x, y, z, 0});
+            // Track process for reconstruction (bounded by kMaxProcesses,
+            // which also caps successful kernel spawns)
+            (void)active_processes_.push_back({x, y, z, 0});
         }
         return success;
     }
@@ -51,6 +73,14 @@ public:
     bool createEdge(int x1, int y1, int z1, int x2, int y2, int z2, unsigned long long initial_delay) {
         return kernel_.createEdge(x1, y1, z1, x2, y2, z2, initial_delay);
     }
+
+    bool removeEdge(int x1, int y1, int z1, int x2, int y2, int z2) {
+        return kernel_.removeEdge(x1, y1, z1, x2, y2, z2);
+    }
+
+    void maybeCompactEdges() {
+        kernel_.maybeCompactEdges();
+    }
     
     bool injectEvent(int dst_x, int dst_y, int dst_z, int src_x, int src_y, int src_z, int payload) {
         return kernel_.injectEvent(dst_x, dst_y, dst_z, src_x, src_y, src_z, payload);
@@ -144,9 +174,28 @@ public:
      * Extract projection of current state (Phase 3 version).
      * Includes heartbeat, health status, and process information.
      */
-    ProjectionV3 extractProjection() const {
+    /**
+     * Enable delta projections: after the first full snapshot, only
+     * boundary cells changed since the previous extraction are published
+     * (with a periodic full resync every FULL_RESYNC_INTERVAL cycles).
+     */
+    void setDeltaProjections(bool enabled) {
+        delta_projections_ = enabled;
+    }
+
+    ProjectionV3 extractProjection() {
         ProjectionV3 proj;
-        
+        extractProjectionInto(proj);
+        return proj;
+    }
+
+    /**
+     * Extract projection into a caller-owned buffer (zero-copy variant,
+     * used by the braid's seqlock projection slots).
+     */
+    void extractProjectionInto(ProjectionV3& proj) {
+        proj = ProjectionV3{};  // Slot may hold a stale projection
+
         // 1. Identity
         proj.torus_id = torus_id_;
         proj.timestamp = kernel_.getCurrentTime();
@@ -155,19 +204,49 @@ public:
         proj.total_events_processed = kernel_.getEventsProcessed();
         proj.current_time = kernel_.getCurrentTime();
         proj.active_processes = static_cast<uint32_t>(active_processes_.size());
-        proj.pending_events = 0;    // Not exposed by BettiRDLKernel
-        proj.edge_count = 0;        // Not exposed by BettiRDLKernel
-        
-        // 3. Boundary state (x=0 face)
-        extractBoundaryState(proj.boundary_states);
+        proj.pending_events = kernel_.getPendingEventCount();
+        proj.edge_count = kernel_.getEdgeCount();
         
+        // 3. Boundary state (x=0 face): full snapshot, or a delta against
+        // the previous extraction when the region is quiescent enough
+        proj.boundary_generation = kernel_.getBoundaryGeneration();
+        bool emitted_delta = false;
+        if (delta_projections_ && published_full_ &&
+            projections_since_full_ < FULL_RESYNC_INTERVAL) {
+            std::array<uint32_t, ProjectionV3::MAX_BOUNDARY_DELTAS> idx;
+            std::array<uint32_t, ProjectionV3::MAX_BOUNDARY_DELTAS> val;
+            const size_t dirty = kernel_.fillBoundaryDeltas(
+                last_published_boundary_gen_, idx.data(), val.data(), idx.size());
+            if (dirty <= ProjectionV3::MAX_BOUNDARY_DELTAS) {
+                proj.is_delta = 1;
+                proj.boundary_base_generation = last_published_boundary_gen_;
+                proj.num_boundary_deltas = static_cast<uint32_t>(dirty);
+                for (size_t i = 0; i < dirty; i++) {
+                    proj.boundary_deltas[i] = {idx[i], val[i]};
+                }
+                // Receivers build constraints from their patched view;
+                // the in-projection set stays inactive
+                proj.deactivateBoundaryConstraints();
+                projections_since_full_++;
+                emitted_delta = true;
+            }
+        }
+        if (!emitted_delta) {
+            extractBoundaryState(proj.boundary_states);
+            published_full_ = true;
+            projections_since_full_ = 0;
+        }
+        last_published_boundary_gen_ = proj.boundary_generation;
+
         // 4. Legacy constraint vector
         proj.constraint_vector = {};
         proj.constraint_vector[0] = static_cast<int32_t>(kernel_.getEventsProcessed() % INT32_MAX);
         proj.constraint_vector[3] = static_cast<int32_t>(kernel_.getCurrentTime() % INT32_MAX);
-        
+
         // 5. Phase 2: Initialize boundary and global constraints
-        proj.initializeBoundaryConstraints(10);
+        if (!proj.is_delta) {
+            proj.initializeBoundaryConstraints(10);
+        }
         proj.initializeGlobalConstraints();
         
         // 6. Phase 3: Heartbeat and health
@@ -179,8 +258,6 @@ public:
         
         // 8. Compute hash for integrity
         proj.state_hash = proj.computeHash();
-        
-        return proj;
     }
     
     /**
@@ -260,6 +337,76 @@ public:
     size_t getNumActiveProcesses() const {
         return active_processes_.size();
     }
+
+    /**
+     * Get current event backlog (injected + scheduled).
+     */
+    uint32_t getPendingEvents() const {
+        return kernel_.getPendingEventCount();
+    }
+
+    // ========== Phase 4: Load migration ==========
+
+    /**
+     * Remove one tracked process from this torus and report its position.
+     * The caller respawns it on the destination torus (work stealing).
+     * @return true if a process was emigrated
+     */
+    bool emigrateProcess(int& x, int& y, int& z) {
+        while (!active_processes_.empty()) {
+            auto [px, py, pz, state] = active_processes_.back();
+            active_processes_.pop_back();
+            if (kernel_.despawnProcessAt(px, py, pz)) {
+                x = px; y = py; z = pz;
+                return true;
+            }
+            // Stale tracking entry (e.g. cell already drained) — keep looking
+        }
+        return false;
+    }
+
+    /**
+     * Remove the tracked process at a specific cell (targeted variant of
+     * emigrateProcess, used by flow-affinity placement). The caller
+     * respawns it on the destination torus.
+     * @return true if a process was emigrated from (x, y, z)
+     */
+    bool emigrateProcessAt(int x, int y, int z) {
+        for (size_t i = 0; i < active_processes_.size(); i++) {
+            const auto [px, py, pz, state] = active_processes_[i];
+            if (px != x || py != y || pz != z) {
+                continue;
+            }
+            if (!kernel_.despawnProcessAt(x, y, z)) {
+                return false;
+            }
+            active_processes_.erase_at_unordered(i);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Whether this torus hosts a process at the given cell.
+     */
+    bool hasProcessAt(int x, int y, int z) const {
+        return kernel_.hasProcessAt(x, y, z);
+    }
+
+    // ========== Flow profiling (forwarded to the kernel) ==========
+
+    void setFlowProfiling(bool enabled) {
+        kernel_.setFlowProfiling(enabled);
+    }
+
+    size_t topFlows(uint64_t* out_keys, uint64_t* out_counts,
+                    size_t max_out) const {
+        return kernel_.topFlows(out_keys, out_counts, max_out);
+    }
+
+    void clearFlowProfile() {
+        kernel_.clearFlowProfile();
+    }
     
     /**
      * Reset kernel to initial state while preserving allocators.
@@ -280,6 +427,12 @@ public:
         // Reset health
         last_heartbeat_ = 0;
         health_status_ = ProjectionV3::HEALTHY;
+
+        // Reset delta projection state
+        published_full_ = false;
+        last_published_boundary_gen_ = 0;
+        projections_since_full_ = 0;
+        peer_views_.clear();
     }
     
 private:
@@ -287,43 +440,86 @@ private:
      * Extract boundary state from kernel (x=0 face).
      */
     void extractBoundaryState(std::array<uint32_t, ProjectionV3::BOUNDARY_SIZE>& boundary_states) const {
-        uint64_t time = kernel_.getCurrentTime();
-        
-        for (int y = 0; y < 32; y++) {
-            for (int z = 0; z < 32; z++) {
-                int idx = y * 32 + z;
-                
-                // Heuristic: hash of coordinates and time
-                uint64_t hash = (0ULL * 1000000 + y * 1000 + z) ^ time;
-                hash = hash * 2654435761ULL;
-                
-                boundary_states[idx] = static_cast<uint32_t>(hash % 256);
-            }
+        kernel_.fillBoundaryStates(boundary_states.data(), boundary_states.size());
+    }
+
+    /**
+     * Cached boundary view for a peer torus (grown on demand).
+     */
+    PeerBoundaryView& peerView(uint32_t torus_id) {
+        if (torus_id >= peer_views_.size()) {
+            peer_views_.resize(torus_id + 1);
         }
+        return peer_views_[torus_id];
     }
-    
+
     /**
      * Apply boundary constraints from projection.
+     *
+     * Full projections refresh the cached per-peer view and apply the
+     * in-projection constraint set. Delta projections patch the cached
+     * view and re-derive the sampled constraints from it; a delta whose
+     * base generation does not match the cache is skipped — the peer
+     * re-sends a full snapshot every FULL_RESYNC_INTERVAL cycles.
      */
     int applyBoundaryConstraints(const ProjectionV3& proj) {
         int violations = 0;
-        
+
         std::array<uint32_t, ProjectionV3::BOUNDARY_SIZE> our_boundary;
         extractBoundaryState(our_boundary);
-        
-        for (const auto& bc : proj.boundary_constraints) {
-            if (!bc.isActive()) continue;
-            
-            uint32_t our_cell_idx = bc.cell_index;
-            int32_t our_state = static_cast<int32_t>(our_boundary[our_cell_idx]);
-            
-            if (bc.isViolated(our_state)) {
-                violations++;
-                int32_t correction = bc.computeCorrection(our_state);
-                generateCorrectiveEvent(our_cell_idx, correction);
+
+        PeerBoundaryView& peer = peerView(proj.torus_id);
+
+        std::array<uint32_t, ProjectionV3::NUM_BOUNDARY_CONSTRAINTS> cell_index;
+        std::array<int32_t, ProjectionV3::NUM_BOUNDARY_CONSTRAINTS> corrections;
+        uint64_t mask;
+
+        if (proj.is_delta) {
+            if (!peer.valid || peer.generation != proj.boundary_base_generation) {
+                return 0;  // Out of sync; wait for the next full snapshot
+            }
+            for (uint32_t i = 0; i < proj.num_boundary_deltas; i++) {
+                const auto& d = proj.boundary_deltas[i];
+                if (d.cell_index < peer.view.size()) {
+                    peer.view[d.cell_index] = d.state;
+                }
+            }
+            peer.generation = proj.boundary_generation;
+
+            // Re-derive the sampled constraints from the patched view
+            // (dense and cell-sorted by construction, so the prefix
+            // invariant the evaluator relies on holds)
+            std::array<int32_t, ProjectionV3::NUM_BOUNDARY_CONSTRAINTS> expected;
+            std::array<int32_t, ProjectionV3::NUM_BOUNDARY_CONSTRAINTS> tolerance;
+            for (size_t i = 0; i < ProjectionV3::NUM_BOUNDARY_CONSTRAINTS; i++) {
+                const uint32_t cell_idx = static_cast<uint32_t>(
+                    i * ProjectionV3::BOUNDARY_SAMPLE_STRIDE);
+                cell_index[i] = cell_idx;
+                expected[i] = static_cast<int32_t>(peer.view[cell_idx]);
+                tolerance[i] = 10;
             }
+            mask = ProjectionV3::evaluateBoundaryViolations(
+                cell_index, expected, tolerance,
+                ProjectionV3::NUM_BOUNDARY_CONSTRAINTS, our_boundary,
+                corrections);
+        } else {
+            // Full projection: refresh the cache, then apply its constraints
+            peer.view = proj.boundary_states;
+            peer.generation = proj.boundary_generation;
+            peer.valid = true;
+
+            mask = proj.evaluateBoundaryViolations(our_boundary, corrections);
+            cell_index = proj.bc_cell_index;
         }
-        
+
+        // Corrective events only for the set bits of the violation mask
+        for (uint64_t m = mask; m != 0; m &= m - 1) {
+            const int i = std::countr_zero(m);
+            generateCorrectiveEvent(cell_index[static_cast<size_t>(i)],
+                                    corrections[static_cast<size_t>(i)]);
+        }
+        violations = std::popcount(mask);
+
         return violations;
     }
     
@@ -32,21 +32,6 @@ struct ProjectionV3 {
     static constexpr size_t CONSTRAINT_DIM = 16;
     std::array<int32_t, CONSTRAINT_DIM> constraint_vector;
     
-    // Phase 2 fields
-    struct BoundaryConstraint {
-        uint32_t cell_index;
-        int32_t expected_state;
-        int32_t tolerance;
-        
-        bool isActive() const { return cell_index != 0xFFFFFFFF; }
-        bool isViolated(int32_t actual_state) const {
-            return std::abs(actual_state - expected_state) > tolerance;
-        }
-        int32_t computeCorrection(int32_t actual_state) const {
-            return expected_state - actual_state;
-        }
-    };
-    
     struct GlobalConstraint {
         enum Type : uint32_t {
             NONE = 0,
@@ -69,9 +54,29 @@ struct ProjectionV3 {
         }
     };
     
-    static constexpr size_t NUM_BOUNDARY_CONSTRAINTS = 32;
-    std::array<BoundaryConstraint, NUM_BOUNDARY_CONSTRAINTS> boundary_constraints;
-    
+    /**
+     * Boundary constraints in SoA layout: cell index, expected state, and
+     * tolerance live in parallel contiguous arrays so violation checking
+     * compiles to SIMD compares (see evaluateBoundaryViolations). A cell
+     * index of 0xFFFFFFFF marks an inactive slot.
+     *
+     * Indexed at extraction: active constraints are packed into the
+     * prefix [0, bc_active_count), sorted by cell index (see
+     * compactBoundaryConstraints). Ingestion walks only that prefix —
+     * O(active constraints), not O(capacity) — which is what lets the
+     * capacity sit at 64 samples for tighter cross-torus coupling
+     * without taxing sparse constraint sets.
+     */
+    static constexpr size_t NUM_BOUNDARY_CONSTRAINTS = 64;
+    static constexpr size_t BOUNDARY_SAMPLE_STRIDE =
+        (32 * 32) / NUM_BOUNDARY_CONSTRAINTS;
+    static_assert(NUM_BOUNDARY_CONSTRAINTS <= 64,
+                  "Violation masks are 64-bit");
+    std::array<uint32_t, NUM_BOUNDARY_CONSTRAINTS> bc_cell_index;
+    std::array<int32_t, NUM_BOUNDARY_CONSTRAINTS> bc_expected_state;
+    std::array<int32_t, NUM_BOUNDARY_CONSTRAINTS> bc_tolerance;
+    uint32_t bc_active_count = 0;
+
     static constexpr size_t NUM_GLOBAL_CONSTRAINTS = 4;
     std::array<GlobalConstraint, NUM_GLOBAL_CONSTRAINTS> global_constraints;
     
@@ -112,19 +117,122 @@ struct ProjectionV3 {
     static constexpr size_t MAX_PROCESSES_IN_PROJECTION = 64;
     std::array<ProcessInfo, MAX_PROCESSES_IN_PROJECTION> processes;
     uint32_t num_processes = 0;
+
+    // ========== Delta projection (incremental exchange) ==========
+
+    /**
+     * Delta mode: boundary_states is not filled; boundary_deltas carries
+     * only the cells changed between boundary_base_generation and
+     * boundary_generation. Receivers patch a cached full view per peer.
+     */
+    struct BoundaryDelta {
+        uint32_t cell_index;
+        uint32_t state;
+    };
+
+    static constexpr size_t MAX_BOUNDARY_DELTAS = 64;
+    uint32_t is_delta = 0;                  // 0 = full boundary_states
+    uint64_t boundary_generation = 0;       // generation at extraction
+    uint64_t boundary_base_generation = 0;  // deltas apply on top of this
+    uint32_t num_boundary_deltas = 0;
+    std::array<BoundaryDelta, MAX_BOUNDARY_DELTAS> boundary_deltas;
     
     // ========== Methods ==========
     
     // Phase 2 methods
     void initializeBoundaryConstraints(int32_t default_tolerance = 10) {
         for (size_t i = 0; i < NUM_BOUNDARY_CONSTRAINTS; i++) {
-            uint32_t cell_idx = i * 32;
-            boundary_constraints[i] = {
-                .cell_index = cell_idx,
-                .expected_state = static_cast<int32_t>(boundary_states[cell_idx]),
-                .tolerance = default_tolerance
-            };
+            const uint32_t cell_idx =
+                static_cast<uint32_t>(i * BOUNDARY_SAMPLE_STRIDE);
+            bc_cell_index[i] = cell_idx;
+            bc_expected_state[i] = static_cast<int32_t>(boundary_states[cell_idx]);
+            bc_tolerance[i] = default_tolerance;
         }
+        bc_active_count = NUM_BOUNDARY_CONSTRAINTS;  // Dense and sorted
+    }
+
+    void deactivateBoundaryConstraints() {
+        bc_cell_index.fill(0xFFFFFFFF);
+        bc_active_count = 0;
+    }
+
+    /**
+     * Build the ingestion index: pack active constraints (cell index not
+     * 0xFFFFFFFF) into the prefix, sorted by cell index, and record the
+     * count. Called once at extraction after the constraint set is
+     * edited in place; receivers then never scan inactive slots.
+     */
+    void compactBoundaryConstraints() {
+        size_t packed = 0;
+        for (size_t i = 0; i < NUM_BOUNDARY_CONSTRAINTS; i++) {
+            if (bc_cell_index[i] == 0xFFFFFFFF) {
+                continue;
+            }
+            bc_cell_index[packed] = bc_cell_index[i];
+            bc_expected_state[packed] = bc_expected_state[i];
+            bc_tolerance[packed] = bc_tolerance[i];
+            packed++;
+        }
+        // Insertion sort by cell index: the set is small and usually
+        // already ordered (extraction samples cells in ascending order)
+        for (size_t i = 1; i < packed; i++) {
+            const uint32_t cell = bc_cell_index[i];
+            const int32_t expected = bc_expected_state[i];
+            const int32_t tolerance = bc_tolerance[i];
+            size_t j = i;
+            while (j > 0 && bc_cell_index[j - 1] > cell) {
+                bc_cell_index[j] = bc_cell_index[j - 1];
+                bc_expected_state[j] = bc_expected_state[j - 1];
+                bc_tolerance[j] = bc_tolerance[j - 1];
+                j--;
+            }
+            bc_cell_index[j] = cell;
+            bc_expected_state[j] = expected;
+            bc_tolerance[j] = tolerance;
+        }
+        for (size_t i = packed; i < NUM_BOUNDARY_CONSTRAINTS; i++) {
+            bc_cell_index[i] = 0xFFFFFFFF;
+        }
+        bc_active_count = static_cast<uint32_t>(packed);
+    }
+
+    /**
+     * Evaluate one constraint set against an actual boundary view.
+     *
+     * Precondition: the set is prefix-packed — the first active_count
+     * slots are active (compactBoundaryConstraints / the initializers
+     * guarantee this), so the pass does O(active) work with no sentinel
+     * scanning. The loop is branch-free over the prefix and lowers to
+     * SIMD; the result is a bitmask with bit i set when constraint i is
+     * violated. corrections[i] holds the signed correction for every
+     * evaluated slot; consumers walk only the set bits.
+     */
+    static uint64_t evaluateBoundaryViolations(
+        const std::array<uint32_t, NUM_BOUNDARY_CONSTRAINTS>& cell_index,
+        const std::array<int32_t, NUM_BOUNDARY_CONSTRAINTS>& expected_state,
+        const std::array<int32_t, NUM_BOUNDARY_CONSTRAINTS>& tolerance,
+        uint32_t active_count,
+        const std::array<uint32_t, BOUNDARY_SIZE>& actual,
+        std::array<int32_t, NUM_BOUNDARY_CONSTRAINTS>& corrections) {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < active_count; i++) {
+            const int32_t actual_state =
+                static_cast<int32_t>(actual[cell_index[i]]);
+            const int32_t diff = actual_state - expected_state[i];
+            const int32_t magnitude = diff < 0 ? -diff : diff;
+            corrections[i] = expected_state[i] - actual_state;
+            const uint64_t violated = magnitude > tolerance[i] ? 1u : 0u;
+            mask |= violated << i;
+        }
+        return mask;
+    }
+
+    uint64_t evaluateBoundaryViolations(
+        const std::array<uint32_t, BOUNDARY_SIZE>& actual,
+        std::array<int32_t, NUM_BOUNDARY_CONSTRAINTS>& corrections) const {
+        return evaluateBoundaryViolations(bc_cell_index, bc_expected_state,
+                                          bc_tolerance, bc_active_count,
+                                          actual, corrections);
     }
     
     void initializeGlobalConstraints() {
@@ -189,8 +297,10 @@ struct ProjectionV3 {
         return hash;
     }
     
-    // Initialize process information from a list of processes
-    void initializeProcessInfo(const std::vector<std::tuple<int, int, int, uint32_t>>& process_list) {
+    // Initialize process information from a list of (x, y, z, state)
+    // tuples; works with std::vector and the kernel's FixedVector alike
+    template <typename ProcessList>
+    void initializeProcessInfo(const ProcessList& process_list) {
         num_processes = std::min(static_cast<size_t>(process_list.size()), 
                                  static_cast<size_t>(MAX_PROCESSES_IN_PROJECTION));
         
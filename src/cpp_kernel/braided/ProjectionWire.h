@@ -0,0 +1,555 @@
+#pragma once
+
+#include "Projection.h"
+#include "ProjectionV2.h"
+#include "ProjectionV3.h"
+
+namespace braided {
+
+/**
+ * ProjectionWire: packed, versioned serialization for Projection /
+ * ProjectionV2 / ProjectionV3.
+ *
+ * The raw RSEPX path ships the in-memory struct — padded arrays, host
+ * byte order, no payload versioning — so mixed-version braids cannot
+ * interoperate and the 1024-entry boundary_states dominates the frame
+ * even when the face is mostly quiescent. The wire format fixes both:
+ *
+ * - Every payload starts with a one-byte format version, and each
+ *   version's fields are a strict prefix of the next. A V1 decoder
+ *   reads its section of a V3 payload and ignores the tail; a V3
+ *   decoder fills Phase 2/3 fields with inactive defaults when handed
+ *   a V1 payload. Rolling upgrades need no flag days.
+ * - Scalars are LEB128 varints (zigzag for signed), byte-order
+ *   independent by construction. boundary_states is sent sparse:
+ *   a count of non-zero cells followed by delta-coded indices and
+ *   values, so a quiescent face costs bytes, not kilobytes.
+ * - state_hash is the one fixed-width field (8 bytes little-endian):
+ *   it is uniformly random, so a varint would average longer.
+ *
+ * Encoders return the payload size, or 0 when the buffer is too small
+ * (size a buffer with the wireMaxSize constants below). Decoders return
+ * false on truncated or unknown-version input and leave partial reads
+ * in the output struct — callers already treat a failed frame as a
+ * dropped frame.
+ */
+enum ProjectionWireVersion : uint8_t {
+    PROJECTION_WIRE_V1 = 1,
+    PROJECTION_WIRE_V2 = 2,
+    PROJECTION_WIRE_V3 = 3,
+};
+
+namespace wire_detail {
+
+constexpr size_t MAX_VARINT32 = 5;
+constexpr size_t MAX_VARINT64 = 10;
+
+/**
+ * Bounds-checked LEB128 writer over a caller-owned buffer. Overflow
+ * latches ok() false and makes further puts no-ops, so encoders check
+ * once at the end instead of after every field.
+ */
+class Writer {
+public:
+    Writer(uint8_t* buf, size_t cap) : buf_(buf), cap_(cap) {}
+
+    void putByte(uint8_t v) {
+        if (pos_ >= cap_) {
+            ok_ = false;
+            return;
+        }
+        buf_[pos_++] = v;
+    }
+
+    void putVarint(uint64_t v) {
+        while (v >= 0x80) {
+            putByte(static_cast<uint8_t>(v) | 0x80);
+            v >>= 7;
+        }
+        putByte(static_cast<uint8_t>(v));
+    }
+
+    // Zigzag: small magnitudes of either sign stay short
+    void putSigned(int64_t v) {
+        putVarint((static_cast<uint64_t>(v) << 1) ^
+                  static_cast<uint64_t>(v >> 63));
+    }
+
+    void putFixed64(uint64_t v) {
+        for (int i = 0; i < 8; i++) {
+            putByte(static_cast<uint8_t>(v >> (8 * i)));
+        }
+    }
+
+    bool ok() const { return ok_; }
+    size_t size() const { return pos_; }
+
+private:
+    uint8_t* buf_;
+    size_t cap_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+/**
+ * Matching reader. Truncation (or a varint running past 10 bytes)
+ * latches ok() false and subsequent gets return 0.
+ */
+class Reader {
+public:
+    Reader(const uint8_t* buf, size_t len) : buf_(buf), len_(len) {}
+
+    uint8_t getByte() {
+        if (pos_ >= len_) {
+            ok_ = false;
+            return 0;
+        }
+        return buf_[pos_++];
+    }
+
+    uint64_t getVarint() {
+        uint64_t v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const uint8_t byte = getByte();
+            v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return ok_ ? v : 0;
+            }
+        }
+        ok_ = false;  // Malformed: continuation bit past 10 bytes
+        return 0;
+    }
+
+    int64_t getSigned() {
+        const uint64_t z = getVarint();
+        return static_cast<int64_t>((z >> 1) ^ (~(z & 1) + 1));
+    }
+
+    uint64_t getFixed64() {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; i++) {
+            v |= static_cast<uint64_t>(getByte()) << (8 * i);
+        }
+        return v;
+    }
+
+    bool ok() const { return ok_; }
+
+private:
+    const uint8_t* buf_;
+    size_t len_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+/**
+ * Core section, identical across versions (Projection, ProjectionV2 and
+ * ProjectionV3 share these field names, so the helpers are templates).
+ * boundary_states goes out sparse: non-zero count, then per cell the
+ * index delta from the previous non-zero cell (first index absolute)
+ * and the value — quiescent faces collapse to a single zero count.
+ */
+template <typename P>
+inline void writeCore(Writer& w, const P& proj) {
+    w.putVarint(proj.torus_id);
+    w.putVarint(proj.timestamp);
+    w.putVarint(proj.total_events_processed);
+    w.putVarint(proj.current_time);
+    w.putVarint(proj.active_processes);
+    w.putVarint(proj.pending_events);
+    w.putVarint(proj.edge_count);
+
+    uint32_t nonzero = 0;
+    for (size_t i = 0; i < P::BOUNDARY_SIZE; i++) {
+        nonzero += proj.boundary_states[i] != 0 ? 1u : 0u;
+    }
+    w.putVarint(nonzero);
+    uint32_t prev = 0;
+    for (size_t i = 0; i < P::BOUNDARY_SIZE; i++) {
+        if (proj.boundary_states[i] == 0) {
+            continue;
+        }
+        w.putVarint(static_cast<uint32_t>(i) - prev);
+        w.putVarint(proj.boundary_states[i]);
+        prev = static_cast<uint32_t>(i);
+    }
+
+    for (size_t i = 0; i < P::CONSTRAINT_DIM; i++) {
+        w.putSigned(proj.constraint_vector[i]);
+    }
+    w.putFixed64(proj.state_hash);
+}
+
+template <typename P>
+inline void readCore(Reader& r, P& proj) {
+    proj.torus_id = static_cast<uint32_t>(r.getVarint());
+    proj.timestamp = r.getVarint();
+    proj.total_events_processed = r.getVarint();
+    proj.current_time = r.getVarint();
+    proj.active_processes = static_cast<uint32_t>(r.getVarint());
+    proj.pending_events = static_cast<uint32_t>(r.getVarint());
+    proj.edge_count = static_cast<uint32_t>(r.getVarint());
+
+    proj.boundary_states.fill(0);
+    const uint64_t nonzero = r.getVarint();
+    uint32_t cell = 0;
+    for (uint64_t i = 0; i < nonzero && r.ok(); i++) {
+        cell += static_cast<uint32_t>(r.getVarint());
+        const uint32_t state = static_cast<uint32_t>(r.getVarint());
+        if (cell < P::BOUNDARY_SIZE) {
+            proj.boundary_states[cell] = state;
+        }
+    }
+
+    for (size_t i = 0; i < P::CONSTRAINT_DIM; i++) {
+        proj.constraint_vector[i] = static_cast<int32_t>(r.getSigned());
+    }
+    proj.state_hash = r.getFixed64();
+}
+
+/**
+ * Phase 2 section: active boundary constraints (count + absolute cell
+ * index, expected, tolerance per entry) and the four global constraint
+ * slots. One wire layout regardless of the in-memory representation —
+ * V2 stores constraints AoS, V3 SoA, and both map onto it.
+ */
+template <typename P>
+inline void writeGlobalConstraints(Writer& w, const P& proj) {
+    for (size_t i = 0; i < P::NUM_GLOBAL_CONSTRAINTS; i++) {
+        w.putVarint(static_cast<uint32_t>(proj.global_constraints[i].type));
+        w.putSigned(proj.global_constraints[i].expected_value);
+        w.putSigned(proj.global_constraints[i].tolerance);
+    }
+}
+
+template <typename P>
+inline void readGlobalConstraints(Reader& r, P& proj) {
+    for (size_t i = 0; i < P::NUM_GLOBAL_CONSTRAINTS; i++) {
+        proj.global_constraints[i].type =
+            static_cast<typename P::GlobalConstraint::Type>(
+                static_cast<uint32_t>(r.getVarint()));
+        proj.global_constraints[i].expected_value = r.getSigned();
+        proj.global_constraints[i].tolerance = r.getSigned();
+    }
+}
+
+inline void writeConstraintsV2(Writer& w, const ProjectionV2& proj) {
+    uint32_t active = 0;
+    for (size_t i = 0; i < ProjectionV2::NUM_BOUNDARY_CONSTRAINTS; i++) {
+        active += proj.boundary_constraints[i].isActive() ? 1u : 0u;
+    }
+    w.putVarint(active);
+    for (size_t i = 0; i < ProjectionV2::NUM_BOUNDARY_CONSTRAINTS; i++) {
+        const auto& bc = proj.boundary_constraints[i];
+        if (!bc.isActive()) {
+            continue;
+        }
+        w.putVarint(bc.cell_index);
+        w.putSigned(bc.expected_state);
+        w.putSigned(bc.tolerance);
+    }
+    writeGlobalConstraints(w, proj);
+}
+
+inline void readConstraintsV2(Reader& r, ProjectionV2& proj) {
+    for (auto& bc : proj.boundary_constraints) {
+        bc.cell_index = 0xFFFFFFFF;
+    }
+    const uint64_t active = r.getVarint();
+    for (uint64_t i = 0; i < active && r.ok(); i++) {
+        const uint32_t cell = static_cast<uint32_t>(r.getVarint());
+        const int32_t expected = static_cast<int32_t>(r.getSigned());
+        const int32_t tolerance = static_cast<int32_t>(r.getSigned());
+        if (i < ProjectionV2::NUM_BOUNDARY_CONSTRAINTS) {
+            proj.boundary_constraints[i] = {cell, expected, tolerance};
+        }
+    }
+    readGlobalConstraints(r, proj);
+}
+
+inline void writeConstraintsV3(Writer& w, const ProjectionV3& proj) {
+    w.putVarint(proj.bc_active_count);
+    // SoA prefix is packed and sorted (compactBoundaryConstraints), so
+    // indices delta-code just like the sparse boundary
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < proj.bc_active_count; i++) {
+        w.putVarint(proj.bc_cell_index[i] - prev);
+        w.putSigned(proj.bc_expected_state[i]);
+        w.putSigned(proj.bc_tolerance[i]);
+        prev = proj.bc_cell_index[i];
+    }
+    writeGlobalConstraints(w, proj);
+}
+
+inline void readConstraintsV3(Reader& r, ProjectionV3& proj) {
+    proj.deactivateBoundaryConstraints();
+    const uint64_t active = r.getVarint();
+    uint32_t cell = 0;
+    uint32_t stored = 0;
+    for (uint64_t i = 0; i < active && r.ok(); i++) {
+        cell += static_cast<uint32_t>(r.getVarint());
+        const int32_t expected = static_cast<int32_t>(r.getSigned());
+        const int32_t tolerance = static_cast<int32_t>(r.getSigned());
+        if (stored < ProjectionV3::NUM_BOUNDARY_CONSTRAINTS) {
+            proj.bc_cell_index[stored] = cell;
+            proj.bc_expected_state[stored] = expected;
+            proj.bc_tolerance[stored] = tolerance;
+            stored++;
+        }
+    }
+    proj.bc_active_count = stored;
+    readGlobalConstraints(r, proj);
+}
+
+// V2 constraint entries are unsorted absolute indices; V3's are sorted
+// deltas. A V3 decoder handed a V2 payload rebuilds the SoA prefix from
+// the V2 layout and re-sorts via compactBoundaryConstraints.
+inline void readConstraintsV2IntoV3(Reader& r, ProjectionV3& proj) {
+    proj.deactivateBoundaryConstraints();
+    const uint64_t active = r.getVarint();
+    uint32_t stored = 0;
+    for (uint64_t i = 0; i < active && r.ok(); i++) {
+        const uint32_t cell = static_cast<uint32_t>(r.getVarint());
+        const int32_t expected = static_cast<int32_t>(r.getSigned());
+        const int32_t tolerance = static_cast<int32_t>(r.getSigned());
+        if (stored < ProjectionV3::NUM_BOUNDARY_CONSTRAINTS) {
+            proj.bc_cell_index[stored] = cell;
+            proj.bc_expected_state[stored] = expected;
+            proj.bc_tolerance[stored] = tolerance;
+            stored++;
+        }
+    }
+    proj.bc_active_count = stored;
+    proj.compactBoundaryConstraints();
+    readGlobalConstraints(r, proj);
+}
+
+inline void writePhase3(Writer& w, const ProjectionV3& proj) {
+    w.putVarint(proj.heartbeat_timestamp);
+    w.putVarint(static_cast<uint32_t>(proj.health_status));
+
+    w.putVarint(proj.num_processes);
+    for (uint32_t i = 0; i < proj.num_processes; i++) {
+        const auto& p = proj.processes[i];
+        w.putVarint(p.process_id);
+        w.putSigned(p.x);
+        w.putSigned(p.y);
+        w.putSigned(p.z);
+        w.putVarint(p.state);
+    }
+
+    w.putVarint(proj.is_delta);
+    w.putVarint(proj.boundary_generation);
+    w.putVarint(proj.boundary_base_generation);
+    w.putVarint(proj.num_boundary_deltas);
+    for (uint32_t i = 0; i < proj.num_boundary_deltas; i++) {
+        w.putVarint(proj.boundary_deltas[i].cell_index);
+        w.putVarint(proj.boundary_deltas[i].state);
+    }
+}
+
+inline void readPhase3(Reader& r, ProjectionV3& proj) {
+    proj.heartbeat_timestamp = r.getVarint();
+    proj.health_status = static_cast<ProjectionV3::HealthStatus>(
+        static_cast<uint32_t>(r.getVarint()));
+
+    const uint64_t num_procs = r.getVarint();
+    uint32_t stored = 0;
+    for (uint64_t i = 0; i < num_procs && r.ok(); i++) {
+        ProjectionV3::ProcessInfo p;
+        p.process_id = static_cast<uint32_t>(r.getVarint());
+        p.x = static_cast<int16_t>(r.getSigned());
+        p.y = static_cast<int16_t>(r.getSigned());
+        p.z = static_cast<int16_t>(r.getSigned());
+        p.state = static_cast<uint32_t>(r.getVarint());
+        if (stored < ProjectionV3::MAX_PROCESSES_IN_PROJECTION) {
+            proj.processes[stored++] = p;
+        }
+    }
+    proj.num_processes = stored;
+    for (uint32_t i = stored; i < ProjectionV3::MAX_PROCESSES_IN_PROJECTION;
+         i++) {
+        proj.processes[i].process_id = 0xFFFFFFFF;
+    }
+
+    proj.is_delta = static_cast<uint32_t>(r.getVarint());
+    proj.boundary_generation = r.getVarint();
+    proj.boundary_base_generation = r.getVarint();
+    const uint64_t num_deltas = r.getVarint();
+    stored = 0;
+    for (uint64_t i = 0; i < num_deltas && r.ok(); i++) {
+        const uint32_t cell = static_cast<uint32_t>(r.getVarint());
+        const uint32_t state = static_cast<uint32_t>(r.getVarint());
+        if (stored < ProjectionV3::MAX_BOUNDARY_DELTAS) {
+            proj.boundary_deltas[stored++] = {cell, state};
+        }
+    }
+    proj.num_boundary_deltas = stored;
+}
+
+inline void defaultPhase2(ProjectionV3& proj) {
+    proj.deactivateBoundaryConstraints();
+    for (auto& gc : proj.global_constraints) {
+        gc = {ProjectionV3::GlobalConstraint::NONE, 0, 0};
+    }
+}
+
+inline void defaultPhase3(ProjectionV3& proj) {
+    proj.heartbeat_timestamp = 0;
+    proj.health_status = ProjectionV3::HEALTHY;
+    proj.num_processes = 0;
+    for (auto& p : proj.processes) {
+        p.process_id = 0xFFFFFFFF;
+    }
+    proj.is_delta = 0;
+    proj.boundary_generation = 0;
+    proj.boundary_base_generation = 0;
+    proj.num_boundary_deltas = 0;
+}
+
+} // namespace wire_detail
+
+// Worst-case payload sizes (every boundary cell non-zero, every
+// constraint and process slot active) for sizing encode buffers. A
+// typical sparse projection is far smaller — that is the point.
+constexpr size_t PROJECTION_WIRE_MAX_V1 =
+    1 + 7 * wire_detail::MAX_VARINT64 + wire_detail::MAX_VARINT32 +
+    Projection::BOUNDARY_SIZE * 2 * wire_detail::MAX_VARINT32 +
+    Projection::CONSTRAINT_DIM * wire_detail::MAX_VARINT32 + 8;
+
+constexpr size_t PROJECTION_WIRE_MAX_V2 =
+    PROJECTION_WIRE_MAX_V1 + wire_detail::MAX_VARINT32 +
+    ProjectionV2::NUM_BOUNDARY_CONSTRAINTS * 3 * wire_detail::MAX_VARINT32 +
+    ProjectionV2::NUM_GLOBAL_CONSTRAINTS *
+        (wire_detail::MAX_VARINT32 + 2 * wire_detail::MAX_VARINT64);
+
+constexpr size_t PROJECTION_WIRE_MAX_V3 =
+    PROJECTION_WIRE_MAX_V2 + 2 * wire_detail::MAX_VARINT64 +
+    2 * wire_detail::MAX_VARINT32 +
+    ProjectionV3::MAX_PROCESSES_IN_PROJECTION * 5 * wire_detail::MAX_VARINT32 +
+    4 * wire_detail::MAX_VARINT64 +
+    ProjectionV3::MAX_BOUNDARY_DELTAS * 2 * wire_detail::MAX_VARINT32;
+
+// ========== Encoders ==========
+
+inline size_t serializeWire(const Projection& proj, uint8_t* buffer,
+                            size_t buffer_size) {
+    wire_detail::Writer w(buffer, buffer_size);
+    w.putByte(PROJECTION_WIRE_V1);
+    wire_detail::writeCore(w, proj);
+    return w.ok() ? w.size() : 0;
+}
+
+inline size_t serializeWire(const ProjectionV2& proj, uint8_t* buffer,
+                            size_t buffer_size) {
+    wire_detail::Writer w(buffer, buffer_size);
+    w.putByte(PROJECTION_WIRE_V2);
+    wire_detail::writeCore(w, proj);
+    wire_detail::writeConstraintsV2(w, proj);
+    return w.ok() ? w.size() : 0;
+}
+
+inline size_t serializeWire(const ProjectionV3& proj, uint8_t* buffer,
+                            size_t buffer_size) {
+    wire_detail::Writer w(buffer, buffer_size);
+    w.putByte(PROJECTION_WIRE_V3);
+    wire_detail::writeCore(w, proj);
+    wire_detail::writeConstraintsV3(w, proj);
+    wire_detail::writePhase3(w, proj);
+    return w.ok() ? w.size() : 0;
+}
+
+// ========== Decoders ==========
+
+// Older decoders read their prefix of newer payloads and ignore the
+// tail; newer decoders fill sections absent from older payloads with
+// inactive defaults. Unknown versions are rejected outright.
+
+inline bool deserializeWire(const uint8_t* buffer, size_t buffer_size,
+                            Projection& out) {
+    wire_detail::Reader r(buffer, buffer_size);
+    const uint8_t version = r.getByte();
+    if (version < PROJECTION_WIRE_V1 || version > PROJECTION_WIRE_V3) {
+        return false;
+    }
+    wire_detail::readCore(r, out);
+    return r.ok();
+}
+
+inline bool deserializeWire(const uint8_t* buffer, size_t buffer_size,
+                            ProjectionV2& out) {
+    wire_detail::Reader r(buffer, buffer_size);
+    const uint8_t version = r.getByte();
+    if (version < PROJECTION_WIRE_V1 || version > PROJECTION_WIRE_V3) {
+        return false;
+    }
+    wire_detail::readCore(r, out);
+    if (version >= PROJECTION_WIRE_V2) {
+        // V3 constraint entries delta-code sorted indices; V2's are
+        // absolute. Both reduce to (cell, expected, tolerance) triples,
+        // so decode per the sender's version.
+        if (version == PROJECTION_WIRE_V2) {
+            wire_detail::readConstraintsV2(r, out);
+        } else {
+            ProjectionV3 scratch;
+            wire_detail::readConstraintsV3(r, scratch);
+            for (auto& bc : out.boundary_constraints) {
+                bc.cell_index = 0xFFFFFFFF;
+            }
+            const uint32_t n =
+                scratch.bc_active_count <
+                        static_cast<uint32_t>(
+                            ProjectionV2::NUM_BOUNDARY_CONSTRAINTS)
+                    ? scratch.bc_active_count
+                    : static_cast<uint32_t>(
+                          ProjectionV2::NUM_BOUNDARY_CONSTRAINTS);
+            for (uint32_t i = 0; i < n; i++) {
+                out.boundary_constraints[i] = {scratch.bc_cell_index[i],
+                                               scratch.bc_expected_state[i],
+                                               scratch.bc_tolerance[i]};
+            }
+            for (size_t i = 0; i < ProjectionV2::NUM_GLOBAL_CONSTRAINTS;
+                 i++) {
+                out.global_constraints[i] = {
+                    static_cast<ProjectionV2::GlobalConstraint::Type>(
+                        static_cast<uint32_t>(
+                            scratch.global_constraints[i].type)),
+                    scratch.global_constraints[i].expected_value,
+                    scratch.global_constraints[i].tolerance};
+            }
+        }
+    } else {
+        for (auto& bc : out.boundary_constraints) {
+            bc.cell_index = 0xFFFFFFFF;
+        }
+        for (auto& gc : out.global_constraints) {
+            gc = {ProjectionV2::GlobalConstraint::NONE, 0, 0};
+        }
+    }
+    return r.ok();
+}
+
+inline bool deserializeWire(const uint8_t* buffer, size_t buffer_size,
+                            ProjectionV3& out) {
+    wire_detail::Reader r(buffer, buffer_size);
+    const uint8_t version = r.getByte();
+    if (version < PROJECTION_WIRE_V1 || version > PROJECTION_WIRE_V3) {
+        return false;
+    }
+    wire_detail::readCore(r, out);
+    if (version == PROJECTION_WIRE_V2) {
+        wire_detail::readConstraintsV2IntoV3(r, out);
+    } else if (version >= PROJECTION_WIRE_V3) {
+        wire_detail::readConstraintsV3(r, out);
+    } else {
+        wire_detail::defaultPhase2(out);
+    }
+    if (version >= PROJECTION_WIRE_V3) {
+        wire_detail::readPhase3(r, out);
+    } else {
+        wire_detail::defaultPhase3(out);
+    }
+    return r.ok();
+}
+
+} // namespace braided
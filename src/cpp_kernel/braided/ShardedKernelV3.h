@@ -0,0 +1,351 @@
+#pragma once
+
+#include "../demos/BettiRDLKernel.h"
+#include "ProjectionV3.h"
+
+#include <memory>
+#include <tuple>
+
+namespace braided {
+
+/**
+ * ShardedKernelV3: one logical 32^3 torus backed by several
+ * BettiRDLKernel instances, each owning an x-slab of the lattice.
+ *
+ * A single kernel caps at kMaxProcesses (4096) and one lattice's worth
+ * of bounded arrays. Sharding multiplies capacity by the shard count
+ * inside one failure domain while keeping every shard's edge and
+ * process arrays small enough to stay cache-resident — 16 shards carry
+ * ~65k processes behind one instance.
+ *
+ * Processes and edges are keyed by the x coordinate of their cell
+ * (edges live with their source node, whose out-chain fans them out).
+ * Derived events that cross a slab boundary are caught by the kernels'
+ * decomposition hooks (setOwnedXRange + boundary handler, the same
+ * contract BettiRDLCompute exposes for the distributed braid) and
+ * parked in a bounded per-shard ring; tick boundaries drain the rings
+ * into the owning shard with timestamps preserved. A full ring drops
+ * the event and counts it, the same backpressure contract as
+ * injectEvent's pending ring.
+ *
+ * The public surface mirrors BraidedKernelV3 so braid layers and demos
+ * can drop it in where one torus needs more capacity. Each shard keeps
+ * its own logical clock, advanced by the events it processes — the
+ * same decoupling the braid already tolerates between tori, reconciled
+ * by the usual TIME_SYNC constraint machinery.
+ */
+class ShardedKernelV3 {
+public:
+    static constexpr int kDim = 32;
+    static constexpr size_t kMaxShards = 16;
+    static constexpr size_t kCrossQueueCapacity = 4096;
+    static constexpr size_t kMaxProcessesPerShard =
+        BettiRDLKernel::kMaxProcesses;
+
+    explicit ShardedKernelV3(size_t num_shards = 4) {
+        if (num_shards == 0) {
+            num_shards = 1;
+        }
+        if (num_shards > kMaxShards) {
+            num_shards = kMaxShards;
+        }
+        // Slabs must tile the x-extent evenly; round down to a divisor
+        while (kDim % num_shards != 0) {
+            num_shards--;
+        }
+        num_shards_ = num_shards;
+        slab_width_ = kDim / static_cast<int>(num_shards);
+        for (size_t s = 0; s < num_shards_; s++) {
+            shards_[s] = std::make_unique<BettiRDLKernel>();
+            shards_[s]->setOwnedXRange(static_cast<int>(s) * slab_width_,
+                                       (static_cast<int>(s) + 1) * slab_width_);
+            shards_[s]->setBoundaryHandler(&ShardedKernelV3::boundaryTrampoline,
+                                           this);
+        }
+    }
+
+    size_t getNumShards() const { return num_shards_; }
+
+    // ========== BraidedKernelV3-compatible surface ==========
+
+    bool spawnProcess(int x, int y, int z) {
+        const bool success = shards_[shardFor(x)]->spawnProcess(x, y, z);
+        if (success && !spawn_sample_.full()) {
+            // Bounded spawn sample for projection process info
+            (void)spawn_sample_.push_back({x, y, z, 0});
+        }
+        return success;
+    }
+
+    bool createEdge(int x1, int y1, int z1, int x2, int y2, int z2,
+                    unsigned long long initial_delay) {
+        // The edge lives with its source node; cross-slab destinations
+        // are handled at fan-out time by the boundary hook
+        return shards_[shardFor(x1)]->createEdge(x1, y1, z1, x2, y2, z2,
+                                                 initial_delay);
+    }
+
+    bool removeEdge(int x1, int y1, int z1, int x2, int y2, int z2) {
+        return shards_[shardFor(x1)]->removeEdge(x1, y1, z1, x2, y2, z2);
+    }
+
+    void maybeCompactEdges() {
+        for (size_t s = 0; s < num_shards_; s++) {
+            shards_[s]->maybeCompactEdges();
+        }
+    }
+
+    bool injectEvent(int dst_x, int dst_y, int dst_z, int src_x, int src_y,
+                     int src_z, int payload) {
+        return shards_[shardFor(dst_x)]->injectEvent(dst_x, dst_y, dst_z,
+                                                     src_x, src_y, src_z,
+                                                     payload);
+    }
+
+    /**
+     * Advance every shard by at most one event, then route whatever
+     * crossed a slab boundary. Cross-shard events hop between shards
+     * only at these boundaries, never mid-tick.
+     */
+    void tick() {
+        for (size_t s = 0; s < num_shards_; s++) {
+            if (shards_[s]->nextEventTime() != ~0ULL) {
+                shards_[s]->tick();
+            }
+        }
+        drainCrossShard();
+    }
+
+    /**
+     * Process up to max_events across all shards. Shards run in bounded
+     * slices with a routing pass between slices, so a chain that zigzags
+     * across slabs keeps flowing; returns when the budget is spent or
+     * every shard and cross-shard ring has quiesced.
+     */
+    int run(int max_events) {
+        int total = 0;
+        bool progress = true;
+        while (total < max_events && progress) {
+            progress = false;
+            for (size_t s = 0; s < num_shards_ && total < max_events; s++) {
+                BettiRDLKernel& k = *shards_[s];
+                int slice = 0;
+                while (slice < kRunSlice && total < max_events &&
+                       k.nextEventTime() != ~0ULL) {
+                    k.tick();
+                    slice++;
+                    total++;
+                }
+                if (slice > 0) {
+                    progress = true;
+                }
+            }
+            if (drainCrossShard() > 0) {
+                progress = true;
+            }
+        }
+        return total;
+    }
+
+    // Logical clocks advance independently per shard; report the front
+    unsigned long long getCurrentTime() const {
+        unsigned long long t = 0;
+        for (size_t s = 0; s < num_shards_; s++) {
+            t = std::max(t, shards_[s]->getCurrentTime());
+        }
+        return t;
+    }
+
+    unsigned long long getEventsProcessed() const {
+        unsigned long long total = 0;
+        for (size_t s = 0; s < num_shards_; s++) {
+            total += shards_[s]->getEventsProcessed();
+        }
+        return total;
+    }
+
+    void setTorusId(uint32_t id) { torus_id_ = id; }
+    uint32_t getTorusId() const { return torus_id_; }
+
+    size_t getNumActiveProcesses() const {
+        size_t total = 0;
+        for (size_t s = 0; s < num_shards_; s++) {
+            total += shards_[s]->getActiveProcessCount();
+        }
+        return total;
+    }
+
+    uint32_t getPendingEvents() const {
+        uint32_t total = 0;
+        for (size_t s = 0; s < num_shards_; s++) {
+            total += shards_[s]->getPendingEventCount();
+        }
+        return total;
+    }
+
+    uint32_t getEdgeCount() const {
+        uint32_t total = 0;
+        for (size_t s = 0; s < num_shards_; s++) {
+            total += shards_[s]->getEdgeCount();
+        }
+        return total;
+    }
+
+    // ========== Heartbeat and health (wrapper-level, as in V3) ==========
+
+    void updateHeartbeat() {
+        last_heartbeat_ = getCurrentTime();
+        if (health_status_ != ProjectionV3::FAILED) {
+            health_status_ = ProjectionV3::HEALTHY;
+        }
+    }
+
+    bool isAlive(uint64_t current_time, uint64_t timeout) const {
+        if (health_status_ == ProjectionV3::FAILED) return false;
+        return (current_time - last_heartbeat_) < timeout;
+    }
+
+    void markFailed() { health_status_ = ProjectionV3::FAILED; }
+    void markDegraded() { health_status_ = ProjectionV3::DEGRADED; }
+    ProjectionV3::HealthStatus getHealthStatus() const {
+        return health_status_;
+    }
+
+    // ========== Projection ==========
+
+    ProjectionV3 extractProjection() {
+        ProjectionV3 proj;
+        extractProjectionInto(proj);
+        return proj;
+    }
+
+    /**
+     * One projection for the whole logical torus: summary statistics are
+     * aggregated over shards, while the boundary face (x=0) is owned
+     * entirely by shard 0's slab, so its materialized view is the
+     * logical view.
+     */
+    void extractProjectionInto(ProjectionV3& proj) {
+        proj = ProjectionV3{};
+
+        proj.torus_id = torus_id_;
+        proj.timestamp = getCurrentTime();
+        proj.total_events_processed = getEventsProcessed();
+        proj.current_time = proj.timestamp;
+        proj.active_processes = static_cast<uint32_t>(getNumActiveProcesses());
+        proj.pending_events = getPendingEvents();
+        proj.edge_count = getEdgeCount();
+
+        shards_[0]->fillBoundaryStates(proj.boundary_states.data(),
+                                       proj.boundary_states.size());
+        proj.boundary_generation = shards_[0]->getBoundaryGeneration();
+
+        proj.constraint_vector = {};
+        proj.constraint_vector[0] =
+            static_cast<int32_t>(proj.total_events_processed % INT32_MAX);
+        proj.constraint_vector[3] =
+            static_cast<int32_t>(proj.current_time % INT32_MAX);
+
+        proj.initializeBoundaryConstraints(10);
+        proj.initializeGlobalConstraints();
+
+        proj.heartbeat_timestamp = last_heartbeat_;
+        proj.health_status = health_status_;
+        proj.initializeProcessInfo(spawn_sample_);
+
+        proj.state_hash = proj.computeHash();
+    }
+
+    // ========== Cross-shard routing metrics ==========
+
+    uint64_t getCrossShardRouted() const { return cross_routed_; }
+    uint64_t getCrossShardDropped() const { return cross_dropped_; }
+
+    void reset() {
+        for (size_t s = 0; s < num_shards_; s++) {
+            shards_[s]->reset();
+        }
+        RDLEvent evt{};
+        for (size_t s = 0; s < num_shards_; s++) {
+            while (cross_inbox_[s].pop(evt)) {
+            }
+        }
+        spawn_sample_.clear();
+        cross_routed_ = 0;
+        cross_dropped_ = 0;
+        last_heartbeat_ = 0;
+        health_status_ = ProjectionV3::HEALTHY;
+    }
+
+private:
+    // Slices per shard between routing passes: small enough that a
+    // cross-slab chain advances every few events, large enough to
+    // amortize the pass
+    static constexpr int kRunSlice = 64;
+
+    size_t shardFor(int x) const {
+        const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(x);
+        return static_cast<size_t>(wx / slab_width_);
+    }
+
+    static void boundaryTrampoline(const RDLEvent& evt, void* ctx) {
+        static_cast<ShardedKernelV3*>(ctx)->routeCrossShard(evt);
+    }
+
+    void routeCrossShard(const RDLEvent& evt) {
+        const int dst_x =
+            static_cast<int>(static_cast<uint32_t>(evt.dst_node) / 1024u);
+        if (cross_inbox_[shardFor(dst_x)].push(evt)) {
+            cross_routed_++;
+        } else {
+            cross_dropped_++;
+        }
+    }
+
+    // Deliver parked events to their owning shards, timestamps intact.
+    // Returns the number delivered.
+    size_t drainCrossShard() {
+        size_t delivered = 0;
+        for (size_t s = 0; s < num_shards_; s++) {
+            size_t shard_delivered = 0;
+            RDLEvent evt{};
+            while (cross_inbox_[s].pop(evt)) {
+                if (shards_[s]->injectRawEvent(evt)) {
+                    shard_delivered++;
+                } else {
+                    cross_dropped_++;
+                }
+            }
+            if (shard_delivered > 0) {
+                shards_[s]->flushPendingEvents();
+                delivered += shard_delivered;
+            }
+        }
+        return delivered;
+    }
+
+    size_t num_shards_ = 1;
+    int slab_width_ = kDim;
+    uint32_t torus_id_ = 0;
+
+    // Kernels are several MB of bounded arrays each; heap-construct them
+    // like the braid layers do their tori
+    std::array<std::unique_ptr<BettiRDLKernel>, kMaxShards> shards_;
+
+    // Per-destination-shard inbox for boundary crossings. All pushes and
+    // pops happen on the thread driving tick()/run() — the ring is for
+    // bounded buffering between tick and routing, not cross-thread handoff
+    std::array<FixedSPSCRing<RDLEvent, kCrossQueueCapacity>, kMaxShards>
+        cross_inbox_;
+
+    FixedVector<std::tuple<int, int, int, uint32_t>,
+                ProjectionV3::MAX_PROCESSES_IN_PROJECTION>
+        spawn_sample_;
+
+    uint64_t cross_routed_ = 0;
+    uint64_t cross_dropped_ = 0;
+    uint64_t last_heartbeat_ = 0;
+    ProjectionV3::HealthStatus health_status_ = ProjectionV3::HEALTHY;
+};
+
+} // namespace braided
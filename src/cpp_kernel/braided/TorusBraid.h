@@ -95,7 +95,17 @@ public:
     // Query
     uint64_t getCurrentTick() const { return current_tick_; }
     uint64_t getBraidCycles() const { return coordinator_.getExchangeCount(); }
-    
+
+    // Per-phase braid cost (rolling-window mean/max) and cumulative
+    // per-torus ingest cycles — the measured inputs for adaptive braid
+    // interval tuning, alongside the violation rate
+    BraidCoordinator::PhaseStats getPhaseStats(BraidCoordinator::Phase phase) const {
+        return coordinator_.getPhaseStats(phase);
+    }
+    uint64_t getTorusIngestCycles(uint32_t torus_id) const {
+        return coordinator_.getTorusIngestCycles(torus_id);
+    }
+
     // Statistics
     void printStatistics() const;
 };
@@ -187,7 +197,26 @@ inline void TorusBraid::printStatistics() const {
     std::cout << "    > Total exchanges: " << coordinator_.getTotalExchanges() << std::endl;
     std::cout << "    > Consistency violations: " << coordinator_.getConsistencyViolations() << std::endl;
     std::cout << "    > Current phase: " << coordinator_.getPhaseName() << std::endl;
-    
+
+    static const char* kPhaseNames[] = {"A_PROJECTS", "B_PROJECTS", "C_PROJECTS"};
+    for (uint32_t p = 0; p < BraidCoordinator::kNumPhases; p++) {
+        const auto stats = coordinator_.getPhaseStats(
+            static_cast<BraidCoordinator::Phase>(p));
+        if (stats.samples == 0) {
+            continue;
+        }
+        std::cout << "    > " << kPhaseNames[p] << " cost (last "
+                  << stats.samples << "): extract "
+                  << stats.mean_extract_cycles << " cyc, ingest "
+                  << stats.mean_ingest_cycles << " cyc, total mean/max "
+                  << stats.mean_total_cycles << "/"
+                  << stats.max_total_cycles << " cyc" << std::endl;
+    }
+    for (uint32_t t = 0; t < BraidCoordinator::kNumTori; t++) {
+        std::cout << "    > Torus " << t << " ingest cycles: "
+                  << coordinator_.getTorusIngestCycles(t) << std::endl;
+    }
+
     // Aggregate statistics
     uint64_t total_events = torus_a_->getEventsProcessed() 
                           + torus_b_->getEventsProcessed() 
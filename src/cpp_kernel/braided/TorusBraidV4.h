@@ -1,8 +1,13 @@
 #pragma once
 
 #include "BraidedKernelV3.h"
+#include "BraidTrace.h"
 #include "ProjectionV3.h"
+#include "../FixedStructures.h"
 
+#include <array>
+#include <bit>
+#include <fstream>
 #include <memory>
 #include <iostream>
 #include <iomanip>
@@ -11,133 +16,335 @@
 #include <atomic>
 #include <barrier>
 #include <chrono>
+#include <coroutine>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace braided {
 
 /**
  * TorusBraidV4: Parallel execution with adaptive braid interval.
- * 
+ *
  * New in Phase 4:
- * - Parallel torus execution (3 threads)
+ * - Parallel torus execution (N threads, default 3)
  * - Lock-free projection exchange
  * - Adaptive braid interval
  * - Performance monitoring
- * 
- * Target: 50M+ events/sec (3× single-torus)
+ *
+ * The braid width is a runtime parameter: projections are exchanged
+ * cyclically (torus i constrains torus (i+1) mod N), which reduces to the
+ * old A→B→C→A scheme at N=3 and scales throughput with core count.
  */
 class TorusBraidV4 {
 private:
-    // Three tori (heap-allocated)
-    std::unique_ptr<BraidedKernelV3> torus_a_;
-    std::unique_ptr<BraidedKernelV3> torus_b_;
-    std::unique_ptr<BraidedKernelV3> torus_c_;
-    
+    // Seqlock-protected projection slot (zero-copy exchange).
+    //
+    // The single writer fills the slot in place between beginWrite() and
+    // endWrite(); an odd sequence number marks a write in progress. Readers
+    // take a reference into the slot with readBegin() and validate with
+    // readRetry() after consuming it. During a braid exchange the workers
+    // are parked in the barrier, so the coordinator's reads never retry —
+    // the sequence guards any future out-of-window reader.
+    struct ProjectionBuffer {
+        ProjectionV3 slot;
+        std::atomic<uint32_t> sequence{0};
+
+        ProjectionV3& beginWrite() {
+            sequence.fetch_add(1, std::memory_order_release);  // → odd
+            std::atomic_thread_fence(std::memory_order_release);
+            return slot;
+        }
+
+        void endWrite() {
+            sequence.fetch_add(1, std::memory_order_release);  // → even
+        }
+
+        const ProjectionV3& readBegin(uint32_t& seq) const {
+            for (;;) {
+                seq = sequence.load(std::memory_order_acquire);
+                if ((seq & 1u) == 0) {
+                    return slot;
+                }
+            }
+        }
+
+        bool readRetry(uint32_t seq) const {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return sequence.load(std::memory_order_acquire) != seq;
+        }
+    };
+
+    // One torus of the braid: kernel, its projection buffer, its metrics.
+    // ticks doubles as the failure-detection epoch counter: the execution
+    // thread bumps it once per tick (a relaxed increment it does anyway),
+    // and the coordinator detects stalls with one relaxed load and a
+    // subtraction per torus — no timestamp bookkeeping in the hot loop.
+    // Cache-line padded so epoch bumps never false-share with neighbours.
+    struct TorusSlot {
+        std::unique_ptr<BraidedKernelV3> kernel;
+        ProjectionBuffer proj_buffer;
+        alignas(64) std::atomic<uint64_t> ticks{0};
+        char pad_[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    // Coroutine handle for one torus in cooperative mode. The fiber body
+    // yields after every tick; the owning pool worker resumes it in
+    // round-robin with its other tori, so many small tori share a thread.
+    struct TorusTask {
+        struct promise_type {
+            TorusTask get_return_object() {
+                return TorusTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        std::coroutine_handle<promise_type> handle;
+
+        explicit TorusTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+        TorusTask(TorusTask&& other) noexcept : handle(other.handle) {
+            other.handle = {};
+        }
+        TorusTask(const TorusTask&) = delete;
+        TorusTask& operator=(const TorusTask&) = delete;
+        TorusTask& operator=(TorusTask&&) = delete;
+        ~TorusTask() {
+            if (handle) handle.destroy();
+        }
+    };
+
+    // Braid members (heap-allocated; slots are not movable once threads run)
+    std::vector<std::unique_ptr<TorusSlot>> tori_;
+
     // Parallel execution
-    std::unique_ptr<std::thread> thread_a_;
-    std::unique_ptr<std::thread> thread_b_;
-    std::unique_ptr<std::thread> thread_c_;
-    
+    std::vector<std::thread> threads_;
+
     std::atomic<bool> running_{false};
     std::atomic<bool> should_exchange_{false};
-    
-    // Synchronization barrier (4 threads: 3 tori + 1 coordinator)
+
+    // Synchronization barrier (N tori + 1 coordinator)
     std::unique_ptr<std::barrier<>> sync_barrier_;
-    
-    // Lock-free projection buffers (double buffering)
-    struct ProjectionBuffer {
-        std::atomic<ProjectionV3*> current{nullptr};
-        ProjectionV3 buffers[2];
-        std::atomic<int> write_index{0};
-        
-        void write(const ProjectionV3& proj) {
-            int idx = write_index.load(std::memory_order_relaxed);
-            int next_idx = 1 - idx;
-            
-            buffers[next_idx] = proj;
-            current.store(&buffers[next_idx], std::memory_order_release);
-            write_index.store(next_idx, std::memory_order_relaxed);
-        }
-        
-        ProjectionV3 read() const {
-            ProjectionV3* ptr = current.load(std::memory_order_acquire);
-            return ptr ? *ptr : ProjectionV3{};
-        }
-    };
-    
-    ProjectionBuffer proj_buffer_a_;
-    ProjectionBuffer proj_buffer_b_;
-    ProjectionBuffer proj_buffer_c_;
-    
+
     // Braid configuration
     std::atomic<uint64_t> braid_interval_;
     uint64_t heartbeat_timeout_;
     uint64_t braid_cycles_ = 0;
-    
+
+    // Epoch snapshot from the previous exchange (coordinator-only): a
+    // torus whose epoch has not advanced across a full interval is stalled
+    std::vector<uint64_t> last_epoch_;
+
     // Adaptive braid interval
     static constexpr uint64_t MIN_BRAID_INTERVAL = 100;
     static constexpr uint64_t MAX_BRAID_INTERVAL = 10000;
     static constexpr double VIOLATION_THRESHOLD = 0.05;  // 5%
-    
-    // Metrics
-    std::atomic<uint64_t> total_boundary_violations_{0};
-    std::atomic<uint64_t> total_global_violations_{0};
-    std::atomic<uint64_t> total_corrective_events_{0};
-    std::atomic<uint64_t> total_projection_exchanges_{0};
-    std::atomic<uint64_t> total_failures_detected_{0};
-    std::atomic<uint64_t> total_reconstructions_{0};
-    std::atomic<uint64_t> total_migrations_{0};
-    
+
+    // Work stealing: migrate when a torus carries more than
+    // IMBALANCE_RATIO × the mean backlog, at most a few processes per cycle
+    static constexpr double IMBALANCE_RATIO = 2.0;
+    static constexpr uint64_t MIN_BACKLOG_FOR_STEAL = 64;
+    static constexpr std::size_t MAX_MIGRATIONS_PER_CYCLE = 8;
+
+    // Flow-affinity placement: heaviest sampled flows examined per torus
+    // and the migration budget per cycle (kept small so placement creeps
+    // toward the communication graph's clusters without thrashing against
+    // the load balancer)
+    static constexpr std::size_t TOP_FLOWS_PER_TORUS = 16;
+    static constexpr std::size_t MAX_AFFINITY_MIGRATIONS_PER_CYCLE = 4;
+
+    // Event pacing: admission control at the injection boundary. The
+    // governor reads queue depth and the violation burst from each braid
+    // cycle and moves an admitted-events-per-cycle limit AIMD-style —
+    // multiplicative backoff out of the congested region, additive
+    // probing back toward full rate — split evenly across the producers
+    // seen in the closing window.
+    static constexpr std::size_t MAX_PRODUCERS = 16;
+    static constexpr uint64_t MIN_ADMISSION_PER_CYCLE = 1024;
+    static constexpr uint64_t MAX_ADMISSION_PER_CYCLE = 1ull << 20;
+    static constexpr uint64_t ADMISSION_INCREASE_STEP =
+        MAX_ADMISSION_PER_CYCLE / 64;
+    static constexpr double QUEUE_HIGH_WATER = 0.75;
+    static constexpr double QUEUE_LOW_WATER = 0.25;
+    static constexpr uint64_t VIOLATION_BURST_LIMIT = 64;
+
+    // Metrics: sharded so concurrent writers never share a cache line
+    // (per-torus updates use the torus index as the shard, the
+    // coordinator uses its lane). Per-torus tick counts live in the
+    // already-padded TorusSlot::ticks.
+    FixedShardedCounter<> total_boundary_violations_;
+    FixedShardedCounter<> total_global_violations_;
+    FixedShardedCounter<> total_corrective_events_;
+    FixedShardedCounter<> total_projection_exchanges_;
+    FixedShardedCounter<> total_failures_detected_;
+    FixedShardedCounter<> total_reconstructions_;
+    FixedShardedCounter<> total_migrations_;
+    FixedShardedCounter<> total_affinity_migrations_;
+
+    // Profile-guided placement (off by default): tori sample their event
+    // traffic and the exchange migrates processes toward their heavy
+    // communication partners
+    bool flow_placement_ = false;
+
+    // Pacing governor state (off by default). Producers run outside the
+    // braid's barrier, so budgets are plain relaxed atomics; the window
+    // reset at each exchange races with in-flight injections by at most
+    // a few events, which is fine for admission control.
+    struct alignas(64) ProducerWindow {
+        std::atomic<uint64_t> used{0};
+    };
+    bool pacing_enabled_ = false;
+    std::atomic<uint64_t> admission_limit_{MAX_ADMISSION_PER_CYCLE};
+    std::atomic<uint64_t> producer_budget_{MAX_ADMISSION_PER_CYCLE};
+    std::atomic<uint32_t> producers_seen_{0};
+    std::array<ProducerWindow, MAX_PRODUCERS> producer_windows_;
+    uint64_t last_violation_snapshot_ = 0;  // Coordinator-only
+    FixedShardedCounter<> total_events_admitted_;
+    FixedShardedCounter<> total_events_paced_;
+
     // Performance metrics
-    std::atomic<uint64_t> total_ticks_[3]{0, 0, 0};
     std::chrono::high_resolution_clock::time_point start_time_;
-    
+
+    // Phase timeline recorder: one lane per execution thread plus the
+    // coordinator's lane at index width (see coordinatorLane())
+    BraidTrace trace_;
+
+    // NUMA-aware placement: pin each torus to a CPU and first-touch its
+    // state there so kernel pages land on the local node
+    bool numa_aware_ = false;
+    std::vector<int> torus_cpus_;
+
+    // Cooperative execution: 0 = one OS thread per torus (default);
+    // otherwise tori run as coroutines multiplexed M:N over this many
+    // pool workers, yielding at tick boundaries
+    std::size_t num_workers_ = 0;
+
+    // Asynchronous reconstruction: a failed torus is rebuilt into a spare
+    // kernel on a background thread and hot-swapped at a braid boundary,
+    // so the healthy tori never stall on recovery
+    struct ReconstructionJob {
+        std::size_t torus_index;
+        ProjectionV3 snapshot;
+        std::unique_ptr<BraidedKernelV3> spare;
+        std::atomic<bool> ready{false};
+    };
+    std::unique_ptr<ReconstructionJob> recon_job_;
+    std::thread recon_thread_;
+    bool recon_in_flight_ = false;  // Coordinator-only state
+
 public:
     /**
      * Constructor.
      * @param braid_interval Initial braid interval (will adapt)
+     * @param num_tori Braid width (one worker thread per torus)
+     * @param numa_aware Pin each torus to a CPU, spread evenly across the
+     *        machine, and construct its kernel on that CPU so first-touch
+     *        places the lattice/edge/queue pages on the local NUMA node
+     * @param num_workers 0 runs one OS thread per torus; otherwise tori
+     *        run as coroutines multiplexed over this many pool workers,
+     *        allowing high braid widths without thread-per-torus overhead
      */
-    explicit TorusBraidV4(uint64_t braid_interval = 1000)
+    explicit TorusBraidV4(uint64_t braid_interval = 1000,
+                          std::size_t num_tori = 3,
+                          bool numa_aware = false,
+                          std::size_t num_workers = 0)
         : braid_interval_(braid_interval),
-          heartbeat_timeout_(braid_interval * 3)
+          heartbeat_timeout_(braid_interval * 3),
+          numa_aware_(numa_aware),
+          num_workers_(std::min(num_workers, num_tori))
     {
-        // Allocate tori
-        torus_a_ = std::make_unique<BraidedKernelV3>();
-        torus_b_ = std::make_unique<BraidedKernelV3>();
-        torus_c_ = std::make_unique<BraidedKernelV3>();
-        
-        // Set torus IDs
-        torus_a_->setTorusId(0);
-        torus_b_->setTorusId(1);
-        torus_c_->setTorusId(2);
-        
-        // Initialize heartbeats
-        torus_a_->updateHeartbeat();
-        torus_b_->updateHeartbeat();
-        torus_c_->updateHeartbeat();
-        
-        // Initialize projection buffers
-        proj_buffer_a_.write(torus_a_->extractProjection());
-        proj_buffer_b_.write(torus_b_->extractProjection());
-        proj_buffer_c_.write(torus_c_->extractProjection());
-        
-        // Create synchronization barrier (4 threads)
-        sync_barrier_ = std::make_unique<std::barrier<>>(4);
-        
+        if (num_tori < 1) {
+            num_tori = 1;
+        }
+
+        // Spread tori evenly over the available CPUs; on a dual-socket
+        // machine with contiguous node numbering this splits the braid
+        // across both sockets
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        torus_cpus_.reserve(num_tori);
+        for (std::size_t i = 0; i < num_tori; i++) {
+            torus_cpus_.push_back(static_cast<int>((i * hw) / num_tori));
+        }
+
+        // Allocate tori. With NUMA awareness each kernel is constructed on
+        // a thread pinned to its torus's CPU: the constructor writes the
+        // lattice, edge arrays, and event queue, so first-touch commits
+        // those pages to the CPU's local node.
+        tori_.reserve(num_tori);
+        for (std::size_t i = 0; i < num_tori; i++) {
+            auto slot = std::make_unique<TorusSlot>();
+            if (numa_aware_) {
+                std::thread builder([&] {
+                    pinToCpu(torus_cpus_[i]);
+                    slot->kernel = std::make_unique<BraidedKernelV3>();
+                });
+                builder.join();
+            } else {
+                slot->kernel = std::make_unique<BraidedKernelV3>();
+            }
+            slot->kernel->setTorusId(static_cast<int>(i));
+            slot->kernel->updateHeartbeat();
+            slot->kernel->extractProjectionInto(slot->proj_buffer.beginWrite());
+            slot->proj_buffer.endWrite();
+            tori_.push_back(std::move(slot));
+        }
+
+        last_epoch_.assign(num_tori, 0);
+
+        // Trace lanes: one per execution thread, coordinator last. In
+        // cooperative mode a pool worker's lane carries all its tori.
+        const std::size_t exec_lanes = num_workers_ ? num_workers_ : num_tori;
+        trace_.init(exec_lanes + 1);
+        char lane_name[32];
+        for (std::size_t i = 0; i < exec_lanes; i++) {
+            std::snprintf(lane_name, sizeof(lane_name),
+                          num_workers_ ? "worker %zu" : "torus %zu", i);
+            trace_.setLaneName(i, lane_name);
+        }
+        trace_.setLaneName(exec_lanes, "coordinator");
+
+        // Create synchronization barrier (execution threads + coordinator)
+        const std::size_t sync_threads = num_workers_ ? num_workers_ : num_tori;
+        sync_barrier_ = std::make_unique<std::barrier<>>(
+            static_cast<std::ptrdiff_t>(sync_threads + 1));
+
         std::cout << "[TorusBraidV4] Initialized with parallel execution" << std::endl;
+        std::cout << "  Braid width=" << num_tori << " tori" << std::endl;
         std::cout << "  Initial braid_interval=" << braid_interval << std::endl;
         std::cout << "  Heartbeat_timeout=" << heartbeat_timeout_ << std::endl;
         std::cout << "  Adaptive range: [" << MIN_BRAID_INTERVAL << ", " << MAX_BRAID_INTERVAL << "]" << std::endl;
+        if (num_workers_) {
+            std::cout << "  Cooperative mode: " << num_tori << " tori over "
+                      << num_workers_ << " pool workers" << std::endl;
+        }
+        if (numa_aware_) {
+            std::cout << "  NUMA-aware placement: torus→CPU";
+            for (std::size_t i = 0; i < num_tori; i++) {
+                std::cout << " " << i << "→" << torus_cpus_[i];
+            }
+            std::cout << std::endl;
+        }
     }
-    
+
     ~TorusBraidV4() {
         stop();
+        if (recon_thread_.joinable()) recon_thread_.join();
     }
-    
+
     // Access to individual tori (for setup)
-    BraidedKernelV3& getTorusA() { return *torus_a_; }
-    BraidedKernelV3& getTorusB() { return *torus_b_; }
-    BraidedKernelV3& getTorusC() { return *torus_c_; }
-    
+    std::size_t getNumTori() const { return tori_.size(); }
+    BraidedKernelV3& getTorus(std::size_t i) { return *tori_[i]->kernel; }
+
+    // Legacy three-torus accessors (valid while i < width)
+    BraidedKernelV3& getTorusA() { return getTorus(0); }
+    BraidedKernelV3& getTorusB() { return getTorus(1); }
+    BraidedKernelV3& getTorusC() { return getTorus(2); }
+
     /**
      * Start parallel execution.
      */
@@ -146,18 +353,31 @@ public:
             std::cerr << "[TorusBraidV4] Already running!" << std::endl;
             return;
         }
-        
+
         running_.store(true);
         start_time_ = std::chrono::high_resolution_clock::now();
-        
-        // Launch worker threads
-        thread_a_ = std::make_unique<std::thread>(&TorusBraidV4::torusWorker, this, 0, torus_a_.get());
-        thread_b_ = std::make_unique<std::thread>(&TorusBraidV4::torusWorker, this, 1, torus_b_.get());
-        thread_c_ = std::make_unique<std::thread>(&TorusBraidV4::torusWorker, this, 2, torus_c_.get());
-        
-        std::cout << "[TorusBraidV4] Parallel execution started (3 threads)" << std::endl;
+
+        if (num_workers_) {
+            // Cooperative mode: round-robin tori over the pool workers
+            threads_.reserve(num_workers_);
+            for (std::size_t w = 0; w < num_workers_; w++) {
+                threads_.emplace_back(&TorusBraidV4::poolWorker, this, w);
+            }
+            std::cout << "[TorusBraidV4] Cooperative execution started ("
+                      << tori_.size() << " tori, " << num_workers_
+                      << " threads)" << std::endl;
+        } else {
+            // Launch worker threads
+            threads_.reserve(tori_.size());
+            for (std::size_t i = 0; i < tori_.size(); i++) {
+                threads_.emplace_back(&TorusBraidV4::torusWorker, this,
+                                      static_cast<int>(i));
+            }
+            std::cout << "[TorusBraidV4] Parallel execution started ("
+                      << tori_.size() << " threads)" << std::endl;
+        }
     }
-    
+
     /**
      * Stop parallel execution.
      */
@@ -165,215 +385,460 @@ public:
         if (!running_.load()) {
             return;
         }
-        
+
         running_.store(false);
-        should_exchange_.store(true);  // Wake up threads
-        
-        // Wait for threads to finish
-        if (thread_a_ && thread_a_->joinable()) thread_a_->join();
-        if (thread_b_ && thread_b_->joinable()) thread_b_->join();
-        if (thread_c_ && thread_c_->joinable()) thread_c_->join();
-        
+
+        // Wait for threads to finish; workers only block in the barrier while
+        // the coordinator is mid-exchange, so no wake-up signal is needed
+        // (setting should_exchange_ here would strand them in the barrier).
+        for (auto& t : threads_) {
+            if (t.joinable()) t.join();
+        }
+        threads_.clear();
+
+        // Drain any in-flight reconstruction
+        if (recon_thread_.joinable()) recon_thread_.join();
+
         std::cout << "[TorusBraidV4] Parallel execution stopped" << std::endl;
     }
-    
+
     /**
      * Run for a specified duration (in milliseconds).
      */
     void runFor(uint64_t duration_ms) {
         start();
-        
+
         auto start = std::chrono::high_resolution_clock::now();
         uint64_t last_exchange_time = 0;
-        
+
         while (running_.load()) {
             auto now = std::chrono::high_resolution_clock::now();
             uint64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
-            
+
             if (elapsed_ms >= duration_ms) {
                 break;
             }
-            
+
             // Check if it's time for a braid exchange
             if (elapsed_ms - last_exchange_time >= braid_interval_.load() / 1000) {
                 performBraidExchange();
                 last_exchange_time = elapsed_ms;
             }
-            
+
             // Sleep briefly to avoid busy-waiting
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
-        
+
         stop();
     }
-    
+
     /**
      * Perform a single braid exchange.
      */
     void performBraidExchange() {
         braid_cycles_++;
-        
+        const std::size_t n = tori_.size();
+        BraidTrace::Scope exchange_span(trace_, coordinatorLane(),
+                                        BraidTrace::EXCHANGE);
+
         std::cout << "\n[TorusBraidV4] === Braid Exchange #" << braid_cycles_ << " ===" << std::endl;
-        
+
         // Signal all tori to exchange
         should_exchange_.store(true, std::memory_order_release);
-        
+
         // Wait for all tori to write projections
-        sync_barrier_->arrive_and_wait();
-        
-        // Read projections (lock-free)
-        ProjectionV3 proj_a = proj_buffer_a_.read();
-        ProjectionV3 proj_b = proj_buffer_b_.read();
-        ProjectionV3 proj_c = proj_buffer_c_.read();
-        
-        total_projection_exchanges_ += 3;
-        
-        // Apply constraints cyclically: A→B, B→C, C→A
-        std::cout << "[TorusBraidV4] Applying constraints: A→B, B→C, C→A" << std::endl;
-        
-        bool success_b = torus_b_->applyConstraint(proj_a);
-        bool success_c = torus_c_->applyConstraint(proj_b);
-        bool success_a = torus_a_->applyConstraint(proj_c);
-        
+        {
+            BraidTrace::Scope wait_span(trace_, coordinatorLane(),
+                                        BraidTrace::BARRIER_WAIT);
+            sync_barrier_->arrive_and_wait();
+        }
+
+        // Take zero-copy references into the seqlock slots. Workers are
+        // parked in the barrier for the rest of the exchange, so the slots
+        // stay stable while constraints are applied.
+        std::vector<const ProjectionV3*> projections;
+        projections.reserve(n);
+        for (std::size_t i = 0; i < n; i++) {
+            uint32_t seq;
+            projections.push_back(&tori_[i]->proj_buffer.readBegin(seq));
+        }
+
+        total_projection_exchanges_.add(coordinatorLane(), n);
+
+        // Apply constraints cyclically: torus i → torus (i+1) mod N
+        std::cout << "[TorusBraidV4] Applying constraints cyclically across "
+                  << n << " tori" << std::endl;
+
+        for (std::size_t i = 0; i < n; i++) {
+            tori_[(i + 1) % n]->kernel->applyConstraint(*projections[i]);
+        }
+
         // Update metrics
-        total_boundary_violations_ += torus_a_->getBoundaryViolations() + 
-                                       torus_b_->getBoundaryViolations() + 
-                                       torus_c_->getBoundaryViolations();
-        
-        total_global_violations_ += torus_a_->getGlobalViolations() + 
-                                     torus_b_->getGlobalViolations() + 
-                                     torus_c_->getGlobalViolations();
-        
-        total_corrective_events_ += torus_a_->getCorrectiveEvents() + 
-                                     torus_b_->getCorrectiveEvents() + 
-                                     torus_c_->getCorrectiveEvents();
-        
-        // Detect failures
-        detectAndRecoverFailures();
-        
+        for (std::size_t i = 0; i < n; i++) {
+            total_boundary_violations_.add(i, tori_[i]->kernel->getBoundaryViolations());
+            total_global_violations_.add(i, tori_[i]->kernel->getGlobalViolations());
+            total_corrective_events_.add(i, tori_[i]->kernel->getCorrectiveEvents());
+        }
+
+        // Edge-churn hygiene: compaction (when fragmentation warrants it)
+        // is safe here because the workers are parked in the barrier
+        for (std::size_t i = 0; i < n; i++) {
+            tori_[i]->kernel->maybeCompactEdges();
+        }
+
+        // Work-stealing: rebalance load while workers are parked in the barrier
+        rebalanceLoad(projections);
+
+        // Flow-affinity placement: co-locate heavy communicators (also
+        // inside the exchange window, for the same safety argument)
+        repartitionByFlow();
+
+        // Epoch-based stall detection: one relaxed load and a subtraction
+        // per torus. A torus whose epoch counter has not moved since the
+        // previous exchange produced no ticks for a whole interval — treat
+        // it like a failed heartbeat. The first cycle has no baseline.
+        std::vector<uint8_t> stalled(n, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            const uint64_t epoch = tori_[i]->ticks.load(std::memory_order_relaxed);
+            stalled[i] = (braid_cycles_ > 1 && epoch - last_epoch_[i] == 0) ? 1 : 0;
+            last_epoch_[i] = epoch;
+        }
+
+        // Hot-swap a finished reconstruction, then kick off new ones.
+        // A just-swapped torus is skipped: its slot still holds the
+        // projection the failed kernel wrote earlier this cycle.
+        const std::size_t swapped = completeReconstruction();
+        detectAndRecoverFailures(projections, stalled, swapped);
+
         // Adapt braid interval
         adaptBraidInterval();
-        
+
+        // Retune the pacing governor from this cycle's signals and open
+        // a fresh admission window
+        updatePacingGovernor(projections);
+
         // Reset exchange flag
         should_exchange_.store(false, std::memory_order_release);
-        
+
         // Release tori to continue execution
         sync_barrier_->arrive_and_wait();
-        
+
         std::cout << "[TorusBraidV4] Braid exchange complete (interval=" << braid_interval_.load() << ")" << std::endl;
     }
-    
+
     /**
      * Print comprehensive statistics.
      */
     void printStatistics() const {
         auto end_time = std::chrono::high_resolution_clock::now();
         double elapsed_sec = std::chrono::duration<double>(end_time - start_time_).count();
-        
-        std::cout << "\n╔════════════════════════════════════════════════════════════════╗" << std::endl;
-        std::cout << "║           TorusBraidV4 Performance Statistics                 ║" << std::endl;
-        std::cout << "╠════════════════════════════════════════════════════════════════╣" << std::endl;
-        
+
+        std::cout << "\n==================================================================" << std::endl;
+        std::cout << "           TorusBraidV4 Performance Statistics" << std::endl;
+        std::cout << "==================================================================" << std::endl;
+
         // Throughput
-        uint64_t total_events = torus_a_->getEventsProcessed() + 
-                                 torus_b_->getEventsProcessed() + 
-                                 torus_c_->getEventsProcessed();
-        
+        uint64_t total_events = 0;
+        for (const auto& slot : tori_) {
+            total_events += slot->kernel->getEventsProcessed();
+        }
+
         double total_throughput = total_events / elapsed_sec;
-        
-        std::cout << "║ Elapsed Time:           " << std::setw(10) << std::fixed << std::setprecision(2) 
-                  << elapsed_sec << " sec                  ║" << std::endl;
-        std::cout << "║ Total Events:           " << std::setw(10) << total_events << "                          ║" << std::endl;
-        std::cout << "║ Total Throughput:       " << std::setw(10) << std::fixed << std::setprecision(1) 
-                  << (total_throughput / 1e6) << " M events/sec         ║" << std::endl;
-        
-        std::cout << "╠════════════════════════════════════════════════════════════════╣" << std::endl;
-        
+
+        std::cout << "  Elapsed Time:           " << std::setw(10) << std::fixed << std::setprecision(2)
+                  << elapsed_sec << " sec" << std::endl;
+        std::cout << "  Total Events:           " << std::setw(10) << total_events << std::endl;
+        std::cout << "  Total Throughput:       " << std::setw(10) << std::fixed << std::setprecision(1)
+                  << (total_throughput / 1e6) << " M events/sec" << std::endl;
+
+        std::cout << "------------------------------------------------------------------" << std::endl;
+
         // Per-torus metrics
-        std::cout << "║                        Torus A    Torus B    Torus C          ║" << std::endl;
-        std::cout << "║ Events Processed:      " 
-                  << std::setw(9) << torus_a_->getEventsProcessed() << "   "
-                  << std::setw(9) << torus_b_->getEventsProcessed() << "   "
-                  << std::setw(9) << torus_c_->getEventsProcessed() << "        ║" << std::endl;
-        
-        double throughput_a = torus_a_->getEventsProcessed() / elapsed_sec / 1e6;
-        double throughput_b = torus_b_->getEventsProcessed() / elapsed_sec / 1e6;
-        double throughput_c = torus_c_->getEventsProcessed() / elapsed_sec / 1e6;
-        
-        std::cout << "║ Throughput (M/sec):    " 
-                  << std::setw(9) << std::fixed << std::setprecision(1) << throughput_a << "   "
-                  << std::setw(9) << std::fixed << std::setprecision(1) << throughput_b << "   "
-                  << std::setw(9) << std::fixed << std::setprecision(1) << throughput_c << "        ║" << std::endl;
-        
-        std::cout << "╠════════════════════════════════════════════════════════════════╣" << std::endl;
-        
+        for (std::size_t i = 0; i < tori_.size(); i++) {
+            const auto& slot = tori_[i];
+            double throughput = slot->kernel->getEventsProcessed() / elapsed_sec / 1e6;
+            std::cout << "  Torus " << std::setw(2) << i << ":  events="
+                      << std::setw(10) << slot->kernel->getEventsProcessed()
+                      << "  ticks=" << std::setw(10) << slot->ticks.load()
+                      << "  throughput=" << std::fixed << std::setprecision(1)
+                      << throughput << " M/sec" << std::endl;
+        }
+
+        std::cout << "------------------------------------------------------------------" << std::endl;
+
         // Braid metrics
-        std::cout << "║ Braid Cycles:           " << std::setw(10) << braid_cycles_ << "                          ║" << std::endl;
-        std::cout << "║ Current Interval:       " << std::setw(10) << braid_interval_.load() << " ticks                   ║" << std::endl;
-        std::cout << "║ Boundary Violations:    " << std::setw(10) << total_boundary_violations_.load() << "                          ║" << std::endl;
-        std::cout << "║ Global Violations:      " << std::setw(10) << total_global_violations_.load() << "                          ║" << std::endl;
-        std::cout << "║ Corrective Events:      " << std::setw(10) << total_corrective_events_.load() << "                          ║" << std::endl;
-        
-        std::cout << "╠════════════════════════════════════════════════════════════════╣" << std::endl;
-        
+        std::cout << "  Braid Cycles:           " << std::setw(10) << braid_cycles_ << std::endl;
+        std::cout << "  Current Interval:       " << std::setw(10) << braid_interval_.load() << " ticks" << std::endl;
+        std::cout << "  Boundary Violations:    " << std::setw(10) << total_boundary_violations_.total() << std::endl;
+        std::cout << "  Global Violations:      " << std::setw(10) << total_global_violations_.total() << std::endl;
+        std::cout << "  Corrective Events:      " << std::setw(10) << total_corrective_events_.total() << std::endl;
+
         // Fault tolerance metrics
-        std::cout << "║ Failures Detected:      " << std::setw(10) << total_failures_detected_.load() << "                          ║" << std::endl;
-        std::cout << "║ Reconstructions:        " << std::setw(10) << total_reconstructions_.load() << "                          ║" << std::endl;
-        std::cout << "║ Process Migrations:     " << std::setw(10) << total_migrations_.load() << "                          ║" << std::endl;
-        
-        std::cout << "╚════════════════════════════════════════════════════════════════╝" << std::endl;
-        
+        std::cout << "  Failures Detected:      " << std::setw(10) << total_failures_detected_.total() << std::endl;
+        std::cout << "  Reconstructions:        " << std::setw(10) << total_reconstructions_.total() << std::endl;
+        std::cout << "  Process Migrations:     " << std::setw(10) << total_migrations_.total() << std::endl;
+        std::cout << "  Affinity Migrations:    " << std::setw(10) << total_affinity_migrations_.total() << std::endl;
+
+        // Pacing governor
+        if (pacing_enabled_) {
+            std::cout << "  Admission Limit:        " << std::setw(10) << admission_limit_.load(std::memory_order_relaxed) << " events/cycle" << std::endl;
+            std::cout << "  Events Admitted:        " << std::setw(10) << total_events_admitted_.total() << std::endl;
+            std::cout << "  Events Paced:           " << std::setw(10) << total_events_paced_.total() << std::endl;
+        }
+
+        std::cout << "==================================================================" << std::endl;
+
         // Speedup analysis
         double single_torus_baseline = 16.8e6;  // 16.8M events/sec
         double speedup = total_throughput / single_torus_baseline;
-        double efficiency = speedup / 3.0 * 100.0;
-        
+        double efficiency = speedup / static_cast<double>(tori_.size()) * 100.0;
+
         std::cout << "\n[Performance Analysis]" << std::endl;
         std::cout << "  Single-torus baseline: 16.8 M events/sec" << std::endl;
         std::cout << "  Braided speedup: " << std::fixed << std::setprecision(2) << speedup << "×" << std::endl;
         std::cout << "  Parallel efficiency: " << std::fixed << std::setprecision(1) << efficiency << "%" << std::endl;
     }
-    
+
+    /**
+     * Arm (or disarm) the phase timeline recorder. Cheap enough to leave
+     * on for whole runs: each thread records a handful of spans per braid
+     * cycle, not per tick.
+     */
+    void enableTracing(bool on = true) { trace_.setEnabled(on); }
+
+    /**
+     * Write the recorded timeline as Chrome trace-event JSON (load into
+     * chrome://tracing or Perfetto). Call after stop().
+     * @return false if the file could not be opened
+     */
+    bool exportTrace(const char* path) const {
+        std::ofstream out(path);
+        if (!out) {
+            std::cerr << "[TorusBraidV4] Cannot write trace to " << path << std::endl;
+            return false;
+        }
+        trace_.exportChromeTrace(out);
+        std::cout << "[TorusBraidV4] Trace written to " << path << std::endl;
+        return true;
+    }
+
+    /**
+     * Enable profile-guided placement: every torus samples its event
+     * traffic (bounded-memory flow table in the kernel) and each braid
+     * exchange migrates a few processes so heavy communicators share a
+     * torus, cutting cross-torus event routing.
+     */
+    void enableFlowPlacement(bool on = true) {
+        flow_placement_ = on;
+        for (auto& slot : tori_) {
+            slot->kernel->setFlowProfiling(on);
+        }
+    }
+
+    /**
+     * Enable the closed-loop pacing governor. Producers must inject
+     * through injectPaced() for the admission limit to bite; direct
+     * kernel injection bypasses the governor.
+     */
+    void enableEventPacing(bool on = true) {
+        pacing_enabled_ = on;
+        admission_limit_.store(MAX_ADMISSION_PER_CYCLE, std::memory_order_relaxed);
+        producer_budget_.store(MAX_ADMISSION_PER_CYCLE, std::memory_order_relaxed);
+        producers_seen_.store(0, std::memory_order_relaxed);
+        for (ProducerWindow& w : producer_windows_) {
+            w.used.store(0, std::memory_order_relaxed);
+        }
+        std::cout << "[TorusBraidV4] Event pacing "
+                  << (on ? "enabled" : "disabled") << std::endl;
+    }
+
+    /**
+     * Governed injection entry point for external producers. Each
+     * producer (any stable id, hashed onto MAX_PRODUCERS budget slots)
+     * spends from a fair share of the cycle's admission limit; once the
+     * share is gone the event is refused and the caller backs off until
+     * the next braid exchange opens a new window. With the governor off
+     * this is a plain forward to the torus's injection ring.
+     */
+    bool injectPaced(std::size_t producer, std::size_t torus,
+                     int dst_x, int dst_y, int dst_z,
+                     int src_x, int src_y, int src_z, int payload) {
+        if (pacing_enabled_) {
+            const std::size_t slot = producer & (MAX_PRODUCERS - 1);
+            producers_seen_.fetch_or(1u << slot, std::memory_order_relaxed);
+            const uint64_t used =
+                producer_windows_[slot].used.fetch_add(1, std::memory_order_relaxed);
+            if (used >= producer_budget_.load(std::memory_order_relaxed)) {
+                total_events_paced_.increment(slot);
+                return false;
+            }
+        }
+        const bool ok = tori_[torus]->kernel->injectEvent(
+            dst_x, dst_y, dst_z, src_x, src_y, src_z, payload);
+        if (ok) {
+            total_events_admitted_.increment(producer);
+        }
+        return ok;
+    }
+
     // Getters for metrics
-    uint64_t getTotalFailures() const { return total_failures_detected_.load(); }
-    uint64_t getTotalReconstructions() const { return total_reconstructions_.load(); }
-    uint64_t getTotalMigrations() const { return total_migrations_.load(); }
+    bool isPacingEnabled() const { return pacing_enabled_; }
+    uint64_t getAdmissionLimit() const {
+        return admission_limit_.load(std::memory_order_relaxed);
+    }
+    uint64_t getEventsAdmitted() const { return total_events_admitted_.total(); }
+    uint64_t getEventsPaced() const { return total_events_paced_.total(); }
+    uint64_t getTotalFailures() const { return total_failures_detected_.total(); }
+    uint64_t getTotalReconstructions() const { return total_reconstructions_.total(); }
+    uint64_t getTotalMigrations() const { return total_migrations_.total(); }
+    uint64_t getAffinityMigrations() const { return total_affinity_migrations_.total(); }
     uint64_t getBraidCycles() const { return braid_cycles_; }
-    
+    uint64_t getTorusTicks(std::size_t i) const { return tori_[i]->ticks.load(); }
+
 private:
+    std::size_t coordinatorLane() const {
+        return num_workers_ ? num_workers_ : tori_.size();
+    }
+
     /**
      * Worker thread for a single torus.
      */
-    void torusWorker(int torus_id, BraidedKernelV3* torus) {
-        ProjectionBuffer* proj_buffer = nullptr;
-        if (torus_id == 0) proj_buffer = &proj_buffer_a_;
-        else if (torus_id == 1) proj_buffer = &proj_buffer_b_;
-        else proj_buffer = &proj_buffer_c_;
-        
+    /**
+     * Pin the calling thread to a CPU (no-op off Linux).
+     */
+    static void pinToCpu(int cpu) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            std::cerr << "[TorusBraidV4] Failed to pin thread to CPU " << cpu << std::endl;
+        }
+#else
+        (void)cpu;
+#endif
+    }
+
+    /**
+     * Coroutine body for one torus in cooperative mode: one tick per
+     * resume, suspended in between so siblings on the same worker run.
+     */
+    TorusTask torusFiber(TorusSlot& slot) {
+        while (running_.load(std::memory_order_acquire)) {
+            slot.kernel->tick();
+            slot.ticks.fetch_add(1, std::memory_order_relaxed);
+            co_await std::suspend_always{};
+        }
+    }
+
+    /**
+     * Pool worker for cooperative mode: resumes its share of the torus
+     * fibers round-robin, and represents all of them at the exchange
+     * barrier (writing each of their projections before parking).
+     */
+    void poolWorker(std::size_t worker_id) {
+        if (numa_aware_) {
+            pinToCpu(torus_cpus_[worker_id % torus_cpus_.size()]);
+        }
+
+        // Static partition: torus i belongs to worker i mod num_workers
+        std::vector<TorusSlot*> my_slots;
+        std::vector<TorusTask> fibers;
+        for (std::size_t i = worker_id; i < tori_.size(); i += num_workers_) {
+            my_slots.push_back(tori_[i].get());
+            fibers.push_back(torusFiber(*tori_[i]));
+        }
+
+        std::cout << "[Pool worker " << worker_id << "] Running "
+                  << fibers.size() << " tori" << std::endl;
+
+        uint64_t run_begin = trace_.spanBegin();
+        while (running_.load(std::memory_order_acquire)) {
+            for (auto& fiber : fibers) {
+                if (!fiber.handle.done()) {
+                    fiber.handle.resume();
+                }
+            }
+
+            if (should_exchange_.load(std::memory_order_acquire)) {
+                trace_.spanEnd(worker_id, BraidTrace::TICK_RUN, run_begin);
+
+                {
+                    BraidTrace::Scope span(trace_, worker_id,
+                                           BraidTrace::PROJ_WRITE);
+                    for (TorusSlot* slot : my_slots) {
+                        slot->kernel->extractProjectionInto(slot->proj_buffer.beginWrite());
+                        slot->proj_buffer.endWrite();
+                    }
+                }
+
+                {
+                    BraidTrace::Scope span(trace_, worker_id,
+                                           BraidTrace::BARRIER_WAIT);
+                    sync_barrier_->arrive_and_wait();
+                }
+                {
+                    BraidTrace::Scope span(trace_, worker_id,
+                                           BraidTrace::CONSTRAIN_WAIT);
+                    sync_barrier_->arrive_and_wait();
+                }
+
+                run_begin = trace_.spanBegin();
+            }
+        }
+
+        std::cout << "[Pool worker " << worker_id << "] Stopped" << std::endl;
+    }
+
+    void torusWorker(int torus_id) {
+        TorusSlot& slot = *tori_[static_cast<std::size_t>(torus_id)];
+
+        if (numa_aware_) {
+            pinToCpu(torus_cpus_[static_cast<std::size_t>(torus_id)]);
+        }
+
         std::cout << "[Torus " << torus_id << "] Worker thread started" << std::endl;
-        
+
+        const std::size_t lane = static_cast<std::size_t>(torus_id);
+        uint64_t run_begin = trace_.spanBegin();
         while (running_.load(std::memory_order_acquire)) {
             // Execute torus tick
-            torus->tick();
-            total_ticks_[torus_id].fetch_add(1, std::memory_order_relaxed);
-            
+            slot.kernel->tick();
+            slot.ticks.fetch_add(1, std::memory_order_relaxed);
+
             // Check if braid exchange needed
             if (should_exchange_.load(std::memory_order_acquire)) {
-                // Extract and write projection (lock-free)
-                ProjectionV3 proj = torus->extractProjection();
-                proj_buffer->write(proj);
-                
+                trace_.spanEnd(lane, BraidTrace::TICK_RUN, run_begin);
+
+                // Extract projection straight into the seqlock slot (no copy)
+                {
+                    BraidTrace::Scope span(trace_, lane,
+                                           BraidTrace::PROJ_WRITE);
+                    slot.kernel->extractProjectionInto(slot.proj_buffer.beginWrite());
+                    slot.proj_buffer.endWrite();
+                }
+
                 // Wait for coordinator
-                sync_barrier_->arrive_and_wait();
-                
+                {
+                    BraidTrace::Scope span(trace_, lane,
+                                           BraidTrace::BARRIER_WAIT);
+                    sync_barrier_->arrive_and_wait();
+                }
+
                 // Wait for constraints to be applied
-                sync_barrier_->arrive_and_wait();
+                {
+                    BraidTrace::Scope span(trace_, lane,
+                                           BraidTrace::CONSTRAIN_WAIT);
+                    sync_barrier_->arrive_and_wait();
+                }
+
+                run_begin = trace_.spanBegin();
             }
         }
-        
+
         std::cout << "[Torus " << torus_id << "] Worker thread stopped" << std::endl;
     }
-    
+
     /**
      * Adapt braid interval based on violation rate.
      */
@@ -381,35 +846,285 @@ private:
         if (braid_cycles_ < 10) {
             return;  // Need more data
         }
-        
-        double violation_rate = (total_boundary_violations_.load() + total_global_violations_.load()) / 
+
+        double violation_rate = (total_boundary_violations_.total() + total_global_violations_.total()) /
                                  static_cast<double>(braid_cycles_);
-        
+
         uint64_t current_interval = braid_interval_.load();
         uint64_t new_interval = current_interval;
-        
+
         if (violation_rate > VIOLATION_THRESHOLD) {
             // Too many violations → exchange more frequently
             new_interval = std::max(MIN_BRAID_INTERVAL, static_cast<uint64_t>(current_interval * 0.8));
-            std::cout << "[TorusBraidV4] High violation rate (" << violation_rate 
+            std::cout << "[TorusBraidV4] High violation rate (" << violation_rate
                       << ") → decreasing interval to " << new_interval << std::endl;
         } else if (violation_rate < VIOLATION_THRESHOLD / 2) {
             // Few violations → exchange less frequently
             new_interval = std::min(MAX_BRAID_INTERVAL, static_cast<uint64_t>(current_interval * 1.2));
-            std::cout << "[TorusBraidV4] Low violation rate (" << violation_rate 
+            std::cout << "[TorusBraidV4] Low violation rate (" << violation_rate
                       << ") → increasing interval to " << new_interval << std::endl;
         }
-        
+
         braid_interval_.store(new_interval, std::memory_order_relaxed);
         heartbeat_timeout_ = new_interval * 3;
     }
-    
+
+    /**
+     * Closed-loop pacing governor.
+     *
+     * Runs in the exchange window. Signals: the busiest torus's queue
+     * depth as a fraction of the injection ring, and the violations
+     * accrued since the previous cycle. A deep queue or a violation
+     * burst means producers are outrunning the braid, so the admission
+     * limit halves and queues drain inside the efficient region; a
+     * shallow, clean cycle probes additively back toward full rate. The
+     * new limit is split evenly across the producers seen in the closing
+     * window, and all budget windows reopen.
+     */
+    void updatePacingGovernor(const std::vector<const ProjectionV3*>& projections) {
+        if (!pacing_enabled_) {
+            return;
+        }
+
+        uint64_t peak_pending = 0;
+        for (const ProjectionV3* proj : projections) {
+            peak_pending = std::max<uint64_t>(peak_pending, proj->pending_events);
+        }
+        const double depth = static_cast<double>(peak_pending) /
+                             static_cast<double>(BettiRDLKernel::kMaxPendingEvents);
+
+        const uint64_t violations_now =
+            total_boundary_violations_.total() + total_global_violations_.total();
+        const uint64_t violation_burst = violations_now - last_violation_snapshot_;
+        last_violation_snapshot_ = violations_now;
+
+        uint64_t limit = admission_limit_.load(std::memory_order_relaxed);
+        if (depth > QUEUE_HIGH_WATER || violation_burst > VIOLATION_BURST_LIMIT) {
+            limit = std::max(MIN_ADMISSION_PER_CYCLE, limit / 2);
+            std::cout << "[TorusBraidV4] Pacing back-off: queue depth "
+                      << std::fixed << std::setprecision(2) << depth
+                      << ", violation burst " << violation_burst
+                      << " → admission limit " << limit << std::endl;
+        } else if (depth < QUEUE_LOW_WATER && violation_burst == 0) {
+            limit = std::min(MAX_ADMISSION_PER_CYCLE,
+                             limit + ADMISSION_INCREASE_STEP);
+        }
+        admission_limit_.store(limit, std::memory_order_relaxed);
+
+        // Fair split across the producers active in the closing window;
+        // an empty window keeps the full limit for the first arrival
+        const uint32_t seen = producers_seen_.exchange(0, std::memory_order_relaxed);
+        const uint32_t active = seen ? static_cast<uint32_t>(std::popcount(seen)) : 1;
+        producer_budget_.store(limit / active, std::memory_order_relaxed);
+        for (ProducerWindow& w : producer_windows_) {
+            w.used.store(0, std::memory_order_relaxed);
+        }
+    }
+
     /**
-     * Detect and recover from failures (simplified for Phase 4).
+     * Work-stealing load balancer.
+     *
+     * Runs inside the exchange window (workers parked in the barrier), so
+     * kernels can be mutated safely. Queue depths come straight from the
+     * projections: the most overloaded torus sheds processes to the most
+     * underloaded one, which moves the future event load those processes
+     * attract. In-flight events stay on the source torus — event queues are
+     * bounded in-place structures and are not drained across tori.
      */
-    void detectAndRecoverFailures() {
-        // Simplified failure detection for Phase 4
-        // Full implementation from Phase 3 can be integrated here
+    void rebalanceLoad(const std::vector<const ProjectionV3*>& projections) {
+        const std::size_t n = tori_.size();
+        if (n < 2) {
+            return;
+        }
+
+        uint64_t total_backlog = 0;
+        std::size_t busiest = 0, idlest = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            total_backlog += projections[i]->pending_events;
+            if (projections[i]->pending_events > projections[busiest]->pending_events) busiest = i;
+            if (projections[i]->pending_events < projections[idlest]->pending_events) idlest = i;
+        }
+
+        const double mean_backlog = static_cast<double>(total_backlog) / n;
+        const uint64_t peak = projections[busiest]->pending_events;
+        if (peak < MIN_BACKLOG_FOR_STEAL ||
+            static_cast<double>(peak) < IMBALANCE_RATIO * mean_backlog) {
+            return;  // Braid is balanced enough
+        }
+
+        std::size_t migrated = 0;
+        for (; migrated < MAX_MIGRATIONS_PER_CYCLE; migrated++) {
+            int x, y, z;
+            if (!tori_[busiest]->kernel->emigrateProcess(x, y, z)) {
+                break;  // Nothing left to shed
+            }
+            tori_[idlest]->kernel->spawnProcess(x, y, z);
+        }
+
+        if (migrated > 0) {
+            total_migrations_.add(coordinatorLane(), migrated);
+            std::cout << "[TorusBraidV4] Work-stealing: migrated " << migrated
+                      << " processes from Torus " << busiest << " (backlog=" << peak
+                      << ") to Torus " << idlest << " (backlog="
+                      << projections[idlest]->pending_events << ")" << std::endl;
+        }
+    }
+
+    /**
+     * Profile-guided placement pass.
+     *
+     * Each torus's kernel has been sampling (src, dst) event traffic into
+     * a bounded flow table. Inside the exchange window the coordinator
+     * reads every torus's heaviest flows and, where a flow's destination
+     * process lives on a different torus than its source, pulls the
+     * destination process to the source's torus — co-locating heavy
+     * communicators so their event chains propagate locally instead of
+     * dying at the torus boundary. Budgeted per cycle so placement
+     * converges over braid intervals without fighting the work stealer,
+     * and tables are cleared after each read so decisions track current
+     * traffic, not history.
+     */
+    void repartitionByFlow() {
+        if (!flow_placement_ || tori_.size() < 2) {
+            return;
+        }
+
+        const std::size_t n = tori_.size();
+        std::size_t moved = 0;
+
+        for (std::size_t i = 0; i < n; i++) {
+            BraidedKernelV3& here = *tori_[i]->kernel;
+
+            std::array<uint64_t, TOP_FLOWS_PER_TORUS> keys;
+            std::array<uint64_t, TOP_FLOWS_PER_TORUS> counts;
+            const std::size_t flows = here.topFlows(keys.data(), counts.data(),
+                                                    keys.size());
+
+            for (std::size_t f = 0;
+                 f < flows && moved < MAX_AFFINITY_MIGRATIONS_PER_CYCLE; f++) {
+                const uint32_t src = static_cast<uint32_t>(keys[f] >> 32);
+                const uint32_t dst = static_cast<uint32_t>(keys[f]);
+                const int sx = static_cast<int>(src / 1024u);
+                const int sy = static_cast<int>((src % 1024u) / 32u);
+                const int sz = static_cast<int>(src % 32u);
+                const int dx = static_cast<int>(dst / 1024u);
+                const int dy = static_cast<int>((dst % 1024u) / 32u);
+                const int dz = static_cast<int>(dst % 32u);
+
+                if (!here.hasProcessAt(sx, sy, sz)) {
+                    continue;  // Source already migrated away this cycle
+                }
+                if (here.hasProcessAt(dx, dy, dz)) {
+                    continue;  // Already co-located
+                }
+
+                // Pull the destination process from whichever torus holds it
+                for (std::size_t j = 0; j < n; j++) {
+                    if (j == i || !tori_[j]->kernel->hasProcessAt(dx, dy, dz)) {
+                        continue;
+                    }
+                    if (tori_[j]->kernel->emigrateProcessAt(dx, dy, dz) &&
+                        here.spawnProcess(dx, dy, dz)) {
+                        moved++;
+                    }
+                    break;
+                }
+            }
+
+            // Fresh epoch: next cycle's decisions reflect next interval's
+            // traffic
+            here.clearFlowProfile();
+        }
+
+        if (moved > 0) {
+            total_migrations_.add(coordinatorLane(), moved);
+            total_affinity_migrations_.add(coordinatorLane(), moved);
+            std::cout << "[TorusBraidV4] Flow placement: co-located " << moved
+                      << " processes with their heavy communication partners"
+                      << std::endl;
+        }
+    }
+
+    /**
+     * Detect failed tori and schedule asynchronous reconstruction.
+     *
+     * Unlike Phase 3's synchronous rebuild (which held the barrier for
+     * the whole restore), the rebuild runs on a dedicated thread against
+     * a spare kernel; the failed torus keeps its worker until the spare
+     * is hot-swapped in by completeReconstruction() at a later boundary.
+     *
+     * A torus counts as failed if its projection reports FAILED or its
+     * epoch counter stalled across the last interval (see the sampling
+     * loop in performBraidExchange).
+     */
+    void detectAndRecoverFailures(const std::vector<const ProjectionV3*>& projections,
+                                  const std::vector<uint8_t>& stalled,
+                                  std::size_t skip_index) {
+        if (recon_in_flight_) {
+            return;  // One reconstruction at a time
+        }
+
+        for (std::size_t i = 0; i < projections.size(); i++) {
+            const bool failed =
+                projections[i]->health_status == ProjectionV3::FAILED || stalled[i];
+            if (i == skip_index || !failed) {
+                continue;
+            }
+
+            total_failures_detected_.increment(i);
+            std::cout << "[TorusBraidV4] Torus " << i
+                      << (stalled[i] ? " STALLED (epoch unchanged)" : " FAILED")
+                      << " — starting background reconstruction" << std::endl;
+
+            // Rebuild from the healthy cyclic predecessor's projection:
+            // it carries the process sample that constrained the failed
+            // torus, and the failed torus's own snapshot is suspect
+            const std::size_t donor = (i + projections.size() - 1) % projections.size();
+
+            recon_job_ = std::make_unique<ReconstructionJob>();
+            recon_job_->torus_index = i;
+            recon_job_->snapshot = *projections[donor];
+            recon_in_flight_ = true;
+
+            if (recon_thread_.joinable()) recon_thread_.join();
+            recon_thread_ = std::thread([this, i] {
+                if (numa_aware_) {
+                    pinToCpu(torus_cpus_[i]);  // First-touch on the torus's node
+                }
+                auto spare = std::make_unique<BraidedKernelV3>();
+                spare->setTorusId(static_cast<int>(i));
+                spare->restoreFromProjection(recon_job_->snapshot);
+                spare->updateHeartbeat();
+                recon_job_->spare = std::move(spare);
+                recon_job_->ready.store(true, std::memory_order_release);
+            });
+            return;
+        }
+    }
+
+    /**
+     * Hot-swap a completed spare kernel into its slot. Runs inside the
+     * exchange window while the slot's worker is parked in the barrier,
+     * so the unique_ptr swap is race-free.
+     * @return index of the swapped torus, or SIZE_MAX if none
+     */
+    std::size_t completeReconstruction() {
+        if (!recon_in_flight_ || !recon_job_->ready.load(std::memory_order_acquire)) {
+            return SIZE_MAX;
+        }
+
+        const std::size_t idx = recon_job_->torus_index;
+        tori_[idx]->kernel = std::move(recon_job_->spare);
+        total_reconstructions_.increment(idx);
+        recon_in_flight_ = false;
+        if (recon_thread_.joinable()) recon_thread_.join();
+        recon_job_.reset();
+
+        std::cout << "[TorusBraidV4] Torus " << idx
+                  << " reconstructed and hot-swapped ("
+                  << tori_[idx]->kernel->getNumActiveProcesses()
+                  << " processes restored)" << std::endl;
+        return idx;
     }
 };
 
@@ -5,6 +5,7 @@
 #include "../ToroidalSpace.h"
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -47,9 +48,9 @@ private:
   static constexpr std::size_t kMaxProcesses = 2048;
 
   static constexpr std::uint32_t nodeId(int x, int y, int z) {
-    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap(x, kDim);
-    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap(y, kDim);
-    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap(z, kDim);
+    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(x);
+    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(y);
+    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(z);
     return static_cast<std::uint32_t>(wx * 1024 + wy * 32 + wz);
   }
 
@@ -76,6 +77,42 @@ private:
 
   std::chrono::steady_clock::time_point start_time_;
 
+  // Batch compute scratch (bounded, reused across tickBatch calls):
+  // events drained for one timestamp, their derived events, and the
+  // gathered per-cell lanes the vector pass runs over. The slot map is
+  // epoch-stamped so coalescing never clears lattice-sized arrays.
+  FixedVector<ComputeEvent, kMaxPendingEvents> batch_scratch_;
+  FixedVector<ComputeEvent, kMaxPendingEvents> derived_scratch_;
+  std::array<std::uint32_t, kMaxPendingEvents> batch_nodes_{};
+  std::array<int, kMaxPendingEvents> batch_states_{};
+  std::array<int, kMaxPendingEvents> batch_values_{};
+  std::array<int, kMaxPendingEvents> batch_masks_{};
+  std::array<std::uint32_t, LATTICE_SIZE> batch_slot_{};
+  std::array<std::uint32_t, LATTICE_SIZE> batch_stamp_{};
+  std::uint32_t batch_epoch_ = 0;
+
+  // Domain decomposition: the owned x-slab [owned_x_begin_, owned_x_end_)
+  // and the handler that receives derived events whose destination falls
+  // outside it. A partitioned driver wires the handler to deliver such
+  // events to the owning instance (halo exchange); unpartitioned kernels
+  // own the whole lattice and never fire it.
+  int owned_x_begin_ = 0;
+  int owned_x_end_ = kDim;
+  void (*boundary_handler_)(const ComputeEvent &, void *) = nullptr;
+  void *boundary_ctx_ = nullptr;
+
+  // Route a derived event: local push when we own the destination,
+  // handler when a neighbor does
+  void emitDerived(const ComputeEvent &evt) {
+    int x, y, z;
+    decodeNode(static_cast<std::uint32_t>(evt.dst_node), x, y, z);
+    if (boundary_handler_ && (x < owned_x_begin_ || x >= owned_x_end_)) {
+      boundary_handler_(evt, boundary_ctx_);
+      return;
+    }
+    (void)event_queue.push(evt);
+  }
+
 public:
   struct Telemetry {
     std::uint64_t events_processed;
@@ -85,6 +122,48 @@ public:
     double throughput_eps;
   };
 
+  // Shared-memory telemetry page: one cache line the tick loop refreshes
+  // with relaxed atomic stores, so external monitors sample at any rate
+  // without taking the injection lock or crossing the FFI per field.
+  // Layout is mirrored by BettiRDLTelemetryPage in betti_rdl_c_api.h —
+  // each field is an independently torn-free 64-bit value, not a
+  // consistent snapshot. memory_used walks the allocator pools, so it is
+  // refreshed every kMemoryRefreshPeriod events rather than every tick.
+  // The command counters track the async command queue: applied is the
+  // lifetime total drained, pending the backlog at the last drain.
+  struct alignas(64) TelemetryPage {
+    std::atomic<std::uint64_t> events_processed{0};
+    std::atomic<std::uint64_t> current_time{0};
+    std::atomic<std::uint64_t> queue_depth{0};
+    std::atomic<std::uint64_t> memory_used{0};
+    std::atomic<std::uint64_t> commands_applied{0};
+    std::atomic<std::uint64_t> commands_pending{0};
+  };
+  static constexpr std::uint64_t kMemoryRefreshPeriod = 1024;
+
+  const TelemetryPage *telemetryPage() const { return &telemetry_page_; }
+
+private:
+  TelemetryPage telemetry_page_;
+
+  // Refresh the shared page from the tick loop (single writer, relaxed)
+  void publishTelemetry() {
+    telemetry_page_.events_processed.store(
+        static_cast<std::uint64_t>(events_processed),
+        std::memory_order_relaxed);
+    telemetry_page_.current_time.store(
+        static_cast<std::uint64_t>(current_time), std::memory_order_relaxed);
+    telemetry_page_.queue_depth.store(
+        static_cast<std::uint64_t>(event_queue.size()),
+        std::memory_order_relaxed);
+    if ((events_processed % kMemoryRefreshPeriod) == 0) {
+      telemetry_page_.memory_used.store(MemoryManager::getUsedMemory(),
+                                        std::memory_order_relaxed);
+    }
+  }
+
+public:
+
   BettiRDLCompute() : start_time_(std::chrono::steady_clock::now()) {
     std::cout << "[COMPUTE] Initializing Betti-RDL with real computation..."
               << std::endl;
@@ -106,6 +185,176 @@ public:
     return space.addProcess(reinterpret_cast<Process *>(p), x, y, z);
   }
 
+  struct EventDesc {
+    int x, y, z;
+    int value;
+  };
+
+  struct SpawnDesc {
+    int x, y, z;
+  };
+
+  // Bulk injection: one lock acquisition for a whole frame of events.
+  // Returns the number of events accepted (stops at queue capacity).
+  std::size_t injectEventBatch(const EventDesc *events, std::size_t count) {
+    if (!events) {
+      return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(event_injection_lock);
+    std::size_t accepted = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      ComputeEvent evt{};
+      evt.timestamp = current_time;
+      evt.dst_node =
+          static_cast<int>(nodeId(events[i].x, events[i].y, events[i].z));
+      evt.src_node = 0;
+      evt.value = events[i].value;
+
+      if (!pending_events.push_back(evt)) {
+        break;
+      }
+      ++accepted;
+    }
+    return accepted;
+  }
+
+  // Bulk spawn counterpart. Returns the number of processes created.
+  std::size_t spawnProcessBatch(const SpawnDesc *spawns, std::size_t count) {
+    if (!spawns) {
+      return 0;
+    }
+
+    std::size_t created = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (!spawnProcess(spawns[i].x, spawns[i].y, spawns[i].z)) {
+        break;
+      }
+      ++created;
+    }
+    return created;
+  }
+
+  // --- Asynchronous command queue (language bindings) ---
+  //
+  // Scripting drivers append spawn/inject commands into this ring without
+  // entering the kernel — write the slot, then bump tail — and the host
+  // applies the whole backlog with one drainCommands() call, so per-call
+  // FFI (and interpreter lock) overhead stops scaling with command count.
+  // Layout is mirrored by BettiRDLCommandQueue in betti_rdl_c_api.h.
+  // Single producer, single consumer: tail moves only on the producer
+  // side, head only in drainCommands.
+
+  static constexpr std::size_t kCommandQueueCapacity = 4096;
+
+  static constexpr std::int32_t kCommandSpawn = 1;
+  static constexpr std::int32_t kCommandInject = 2;
+
+  struct Command {
+    std::int32_t op;
+    std::int32_t x, y, z;
+    std::int32_t value;  // Ignored for spawn
+  };
+
+  struct CommandQueue {
+    std::atomic<std::uint64_t> head{0};     // Consumer cursor (drain)
+    std::atomic<std::uint64_t> tail{0};     // Producer cursor (binding)
+    std::atomic<std::uint64_t> dropped{0};  // Enqueues refused on full
+    Command commands[kCommandQueueCapacity];
+  };
+
+  CommandQueue *commandQueue() { return &command_queue_; }
+
+  // Producer-side append for bindings that cannot write the ring
+  // directly. Returns false (and counts a drop) when the ring is full.
+  bool enqueueCommand(const Command &cmd) {
+    const std::uint64_t tail =
+        command_queue_.tail.load(std::memory_order_relaxed);
+    const std::uint64_t head =
+        command_queue_.head.load(std::memory_order_acquire);
+    if (tail - head >= kCommandQueueCapacity) {
+      command_queue_.dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    command_queue_.commands[tail % kCommandQueueCapacity] = cmd;
+    command_queue_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Apply every queued command in order, exactly as if the matching
+  // spawnProcess/injectEvent call had been made per command. Unknown ops
+  // are consumed and ignored so a newer binding degrades instead of
+  // wedging the ring. Refreshes the completion counters on the telemetry
+  // page and returns the number of commands applied.
+  int drainCommands() {
+    std::uint64_t head = command_queue_.head.load(std::memory_order_relaxed);
+    const std::uint64_t tail =
+        command_queue_.tail.load(std::memory_order_acquire);
+    int applied = 0;
+    for (; head != tail; ++head) {
+      const Command &cmd =
+          command_queue_.commands[head % kCommandQueueCapacity];
+      switch (cmd.op) {
+      case kCommandSpawn:
+        (void)spawnProcess(cmd.x, cmd.y, cmd.z);
+        break;
+      case kCommandInject:
+        (void)injectEvent(cmd.x, cmd.y, cmd.z, cmd.value);
+        break;
+      default:
+        break;
+      }
+      ++applied;
+    }
+    command_queue_.head.store(head, std::memory_order_release);
+    commands_applied_ += static_cast<std::uint64_t>(applied);
+    telemetry_page_.commands_applied.store(commands_applied_,
+                                           std::memory_order_relaxed);
+    telemetry_page_.commands_pending.store(
+        command_queue_.tail.load(std::memory_order_relaxed) - head,
+        std::memory_order_relaxed);
+    return applied;
+  }
+
+private:
+  CommandQueue command_queue_;
+  std::uint64_t commands_applied_ = 0;
+
+public:
+  // --- Domain decomposition (partitioned drivers) ---
+
+  using BoundaryHandler = void (*)(const ComputeEvent &evt, void *ctx);
+
+  // Restrict this instance to the x-slab [x_begin, x_end). Derived events
+  // leaving the slab are handed to the boundary handler instead of being
+  // queued locally.
+  void setOwnedXRange(int x_begin, int x_end) {
+    owned_x_begin_ = x_begin;
+    owned_x_end_ = x_end;
+  }
+
+  void setBoundaryHandler(BoundaryHandler handler, void *ctx) {
+    boundary_handler_ = handler;
+    boundary_ctx_ = ctx;
+  }
+
+  // Inject a fully-formed event preserving its timestamp — the delivery
+  // side of halo exchange, where the original event time must survive the
+  // hop between instances. Thread-safe like injectEvent.
+  bool injectRawEvent(const ComputeEvent &evt) {
+    std::lock_guard<std::mutex> lock(event_injection_lock);
+    return pending_events.push_back(evt);
+  }
+
+  // Timestamp of the next event this instance would process, or
+  // ~0ULL when idle. Flushes pending injections so freshly delivered
+  // halo events count; lockstep drivers use this to find the global
+  // minimum before ticking partitions.
+  unsigned long long nextEventTime() {
+    flushPendingEvents();
+    return event_queue.empty() ? ~0ULL : event_queue.top().timestamp;
+  }
+
   bool injectEvent(int dst_x, int dst_y, int dst_z, int value) {
     ComputeEvent evt{};
     evt.timestamp = current_time;
@@ -123,14 +372,26 @@ public:
     return true;
   }
 
-  // Transfer pending events to the main event queue (single-threaded from scheduler)
+  // Transfer pending events to the main event queue (single-threaded from
+  // scheduler). The flush is partial when the queue is near capacity:
+  // unflushed events stay in the ring behind a cursor and move on a later
+  // flush once ticking frees space, instead of being dropped. Producers
+  // seeing push_back fail while the cursor backlog drains is the
+  // backpressure signal streaming ingestion throttles on.
   private:
+  std::size_t pending_flush_pos_ = 0;
+
   void flushPendingEvents() {
     std::lock_guard<std::mutex> lock(event_injection_lock);
-    for (std::size_t i = 0; i < pending_events.size(); ++i) {
-      (void)event_queue.push(pending_events[i]);
+    while (pending_flush_pos_ < pending_events.size() &&
+           event_queue.size() < kMaxPendingEvents) {
+      (void)event_queue.push(pending_events[pending_flush_pos_]);
+      ++pending_flush_pos_;
+    }
+    if (pending_flush_pos_ == pending_events.size()) {
+      pending_events.clear();
+      pending_flush_pos_ = 0;
     }
-    pending_events.clear();
   }
 
   public:
@@ -165,8 +426,122 @@ public:
       new_evt.src_node = evt.dst_node;
       new_evt.value = evt.value + 1;
 
-      (void)event_queue.push(new_evt);
+      emitDerived(new_evt);
     }
+
+    publishTelemetry();
+  }
+
+  // Batch compute mode: drains every event sharing the minimum timestamp,
+  // coalesces per destination cell, then runs the state update as a
+  // gather / dense accumulate / scatter over contiguous lanes. The middle
+  // loop is branch-free (the active mask multiplies out updates to cells
+  // without a process) and autovectorizes — simulation frames where many
+  // cells fire per timestep spend their time there instead of in per-event
+  // heap pops and lattice-indexed updates. Derived propagation events are
+  // bulk-inserted with a single heapify. Returns the number of events
+  // processed (0 if the queue is empty).
+  int tickBatch() {
+    if (event_queue.empty()) {
+      return 0;
+    }
+
+    const unsigned long long batch_time = event_queue.top().timestamp;
+    current_time = batch_time;
+
+    batch_scratch_.clear();
+    while (!event_queue.empty() &&
+           event_queue.top().timestamp == batch_time) {
+      (void)batch_scratch_.push_back(event_queue.top());
+      (void)event_queue.pop();
+    }
+
+    // Coalesce values per destination cell. Duplicates must combine here:
+    // with two events targeting one cell, independently scattered lanes
+    // would overwrite each other's update. The slot map assigns each cell
+    // its lane on first sight; epoch stamps make stale entries invisible
+    // without clearing the lattice-sized arrays between batches.
+    ++batch_epoch_;
+    std::size_t lanes = 0;
+    for (std::size_t i = 0; i < batch_scratch_.size(); ++i) {
+      const std::uint32_t node =
+          static_cast<std::uint32_t>(batch_scratch_[i].dst_node);
+      if (batch_stamp_[node] != batch_epoch_) {
+        batch_stamp_[node] = batch_epoch_;
+        batch_slot_[node] = static_cast<std::uint32_t>(lanes);
+        batch_nodes_[lanes] = node;
+        batch_values_[lanes] = 0;
+        ++lanes;
+      }
+      batch_values_[batch_slot_[node]] += batch_scratch_[i].value;
+    }
+
+    // Gather states and active masks into contiguous lanes
+    for (std::size_t i = 0; i < lanes; ++i) {
+      batch_states_[i] = process_states_[batch_nodes_[i]];
+      batch_masks_[i] = process_active_[batch_nodes_[i]];
+    }
+
+    // Vector kernel: one dense accumulate across the batch
+    for (std::size_t i = 0; i < lanes; ++i) {
+      batch_states_[i] += batch_values_[i] * batch_masks_[i];
+    }
+
+    // Scatter results back to the lattice
+    for (std::size_t i = 0; i < lanes; ++i) {
+      process_states_[batch_nodes_[i]] = batch_states_[i];
+    }
+
+    // Propagation stays per event (each event emits its own derived
+    // event, same rule as tick()), collected and pushed as one batch
+    derived_scratch_.clear();
+    for (std::size_t i = 0; i < batch_scratch_.size(); ++i) {
+      const ComputeEvent &evt = batch_scratch_[i];
+      int dst_x, dst_y, dst_z;
+      decodeNode(static_cast<std::uint32_t>(evt.dst_node), dst_x, dst_y,
+                 dst_z);
+      const int next_x = (dst_x + 1) % kDim;
+      if (next_x < 10) {
+        ComputeEvent new_evt{};
+        new_evt.timestamp = batch_time + 1;
+        new_evt.dst_node = static_cast<int>(nodeId(next_x, dst_y, dst_z));
+        new_evt.src_node = evt.dst_node;
+        new_evt.value = evt.value + 1;
+        if (boundary_handler_ &&
+            (next_x < owned_x_begin_ || next_x >= owned_x_end_)) {
+          boundary_handler_(new_evt, boundary_ctx_);
+        } else {
+          (void)derived_scratch_.push_back(new_evt);
+        }
+      }
+    }
+    (void)event_queue.pushBatch(derived_scratch_.begin(),
+                                derived_scratch_.size());
+
+    events_processed += batch_scratch_.size();
+    publishTelemetry();
+    return static_cast<int>(batch_scratch_.size());
+  }
+
+  // Batch-mode counterpart of run(): same observable results (the update
+  // rule is commutative, so per-timestamp processing order is immaterial),
+  // but may overshoot max_events by up to one batch since timestamps are
+  // never split
+  int runBatch(int max_events) {
+    flushPendingEvents();
+
+    int events_in_run = 0;
+    while (events_in_run < max_events && !event_queue.empty()) {
+      events_in_run += tickBatch();
+    }
+
+    telemetry_page_.queue_depth.store(
+        static_cast<std::uint64_t>(event_queue.size()),
+        std::memory_order_relaxed);
+    telemetry_page_.memory_used.store(MemoryManager::getUsedMemory(),
+                                      std::memory_order_relaxed);
+
+    return events_in_run;
   }
 
   // Process at most max_events NEW events, returning the count processed
@@ -181,6 +556,13 @@ public:
       events_in_run++;
     }
 
+    // Final queue depth (and memory) for monitors between run() calls
+    telemetry_page_.queue_depth.store(
+        static_cast<std::uint64_t>(event_queue.size()),
+        std::memory_order_relaxed);
+    telemetry_page_.memory_used.store(MemoryManager::getUsedMemory(),
+                                      std::memory_order_relaxed);
+
     return events_in_run;
   }
 
@@ -192,6 +574,15 @@ public:
     return process_active_[idx] ? process_states_[idx] : 0;
   }
 
+  // Stable pointer to the lattice state array: one int per cell, indexed
+  // by node id, updated in place by the tick loop. Valid for the
+  // kernel's lifetime, so bindings can wrap it in a buffer view and
+  // sample state without a copy or an FFI crossing per read. Single
+  // writer: each cell is a torn-free int, but the array is not a
+  // consistent snapshot across cells.
+  const int *latticeStates() const { return process_states_.data(); }
+  static constexpr std::size_t latticeSize() { return LATTICE_SIZE; }
+
   unsigned long long getCurrentTime() const { return current_time; }
   unsigned long long getEventsProcessed() const { return events_processed; }
   std::size_t getProcessCount() const { return process_count_; }
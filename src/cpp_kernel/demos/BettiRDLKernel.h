@@ -13,7 +13,6 @@ constexpr std::size_t LATTICE_SIZE = 32 * 32 * 32;
 #include "../Allocator.h"
 #include <chrono>
 #include <iostream>
-#include <mutex>
 #endif
 
 // Betti-RDL Integration
@@ -69,9 +68,9 @@ private:
   static constexpr std::uint32_t kInvalidEdge = 0xFFFFFFFFu;
 
   static constexpr std::uint32_t nodeId(int x, int y, int z) {
-    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap(x, kDim);
-    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap(y, kDim);
-    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap(z, kDim);
+    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(x);
+    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(y);
+    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(z);
     return static_cast<std::uint32_t>(wx * 1024 + wy * 32 + wz);
   }
 
@@ -81,66 +80,216 @@ private:
     z = static_cast<int>(node % 32u);
   }
 
+public:
   static constexpr std::size_t kMaxPendingEvents = 8192;
   static constexpr std::size_t kMaxEdges = 8192;
   static constexpr std::size_t kMaxProcesses = 4096;
+  static constexpr std::size_t kMaxFlowEntries = 1024;
 
-  ToroidalSpace<kDim, kDim, kDim> space;
+private:
+  // Cells hold 32-bit generation-tagged pool handles rather than raw
+  // pointers: half the footprint per slot, and a stale entry resolves to
+  // nullptr instead of dangling
+  using ProcHandle =
+      typename FixedObjectPool<BettiRDLProcess, kMaxProcesses>::Handle;
+
+  ToroidalSpace<kDim, kDim, kDim, 8, DenseCells, RowMajorOrder, 64, ProcHandle>
+      space;
   FixedMinHeap<RDLEvent, kMaxPendingEvents> event_queue;
   FixedObjectPool<BettiRDLProcess, kMaxProcesses> process_pool;
 
-  struct EdgeEntry {
-    std::uint32_t from_node;
+  // Edge storage is split hot/cold on the tick() access pattern. The
+  // fan-out loop touches only to_node, next_out and the adaptive delay —
+  // 16 bytes, four edges per cache line — while the endpoint coordinates
+  // it never reads sit in a parallel cold array indexed identically,
+  // read only by edge management and snapshot paths. A combined entry
+  // was 48 bytes, so every traversed edge dragged triple the cache
+  // traffic through the loop.
+  struct EdgeHot {
     std::uint32_t to_node;
-    AdaptiveEdge edge;
-    std::uint32_t next_out = kInvalidEdge;
+    std::uint32_t next_out = kInvalidEdge;  // Chain link; free-list link when freed
+    unsigned long long delay = 0;
+  };
+  static_assert(sizeof(EdgeHot) == 16, "tick() working set: 4 edges/line");
+
+  struct EdgeCold {
+    std::uint32_t from_node;
+    int from_x, from_y, from_z;
+    int to_x, to_y, to_z;
   };
 
   std::array<std::uint32_t, LATTICE_SIZE> out_head_{};
   std::array<std::uint32_t, LATTICE_SIZE> out_tail_{};
-  std::array<EdgeEntry, kMaxEdges> edges_{};
-  std::size_t edge_count_ = 0;
+  std::array<EdgeHot, kMaxEdges> edge_hot_{};
+  std::array<EdgeCold, kMaxEdges> edge_cold_{};
+  std::size_t edge_count_ = 0;       // Live edges
+  std::size_t edge_high_water_ = 0;  // Append frontier in the edge arrays
+
+  // Freed slots chained through next_out for reuse, so topology-adaptive
+  // workloads that add and remove edges can run indefinitely inside
+  // kMaxEdges live edges
+  std::uint32_t free_head_ = kInvalidEdge;
+
+  // Compaction scratch: edges are rewritten here in node-grouped order,
+  // then copied back (see compactEdges)
+  std::array<EdgeHot, kMaxEdges> compact_hot_{};
+  std::array<EdgeCold, kMaxEdges> compact_cold_{};
+
+  // Edge identity (from,to) -> slot, so existence checks cost one probe
+  // instead of walking the source's out-chain
+  FixedHashMap<std::uint64_t, std::uint32_t, kMaxEdges> edge_map_;
+
+  static constexpr std::uint64_t edgeKey(std::uint32_t from, std::uint32_t to) {
+    return (static_cast<std::uint64_t>(from) << 32) | to;
+  }
 
   unsigned long long current_time = 0;
   unsigned long long events_processed = 0;  // Lifetime total
   int process_counter = 0;
 
-  // Thread-safety for concurrent injectEvent
-  std::mutex event_injection_lock;
-  FixedVector<RDLEvent, 16384> pending_events;
+  // Domain decomposition: the owned x-slab [owned_x_begin_, owned_x_end_)
+  // and the handler that receives derived events whose destination falls
+  // outside it (same contract as BettiRDLCompute). A sharded driver wires
+  // the handler to deliver such events to the owning instance;
+  // unpartitioned kernels own the whole lattice and never fire it.
+  int owned_x_begin_ = 0;
+  int owned_x_end_ = kDim;
+  void (*boundary_handler_)(const RDLEvent &, void *) = nullptr;
+  void *boundary_ctx_ = nullptr;
+
+  // Lock-free injection ring: many injecting threads, drained only by the
+  // scheduler thread
+  FixedMPSCRing<RDLEvent, 16384> pending_events;
+
+  // Materialized boundary view (x=0 face process counts), kept current on
+  // spawn/despawn so projection extraction never rescans the lattice.
+  // Each cell records the generation of its last change, which lets the
+  // braid layer emit delta projections for quiescent regions.
+  std::array<std::uint32_t, kDim * kDim> boundary_view_{};
+  std::array<std::uint64_t, kDim * kDim> boundary_cell_gen_{};
+  std::uint64_t boundary_generation_ = 0;
+
+  void touchBoundary(int x, int y, int z, int delta) {
+    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(x);
+    if (wx != 0) {
+      return;
+    }
+    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(y);
+    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(z);
+    const std::size_t idx = static_cast<std::size_t>(wy * kDim + wz);
+    boundary_view_[idx] =
+        static_cast<std::uint32_t>(static_cast<int>(boundary_view_[idx]) + delta);
+    boundary_cell_gen_[idx] = ++boundary_generation_;
+  }
 
   [[nodiscard]] bool insertOrUpdateEdge(const AdaptiveEdge &edge) {
     const std::uint32_t from = nodeId(edge.from_x, edge.from_y, edge.from_z);
     const std::uint32_t to = nodeId(edge.to_x, edge.to_y, edge.to_z);
 
-    // Check existing edges for this source (bounded, deterministic scan)
-    for (std::uint32_t idx = out_head_[from]; idx != kInvalidEdge;
-         idx = edges_[idx].next_out) {
-      if (edges_[idx].to_node == to) {
-        edges_[idx].edge = edge;
-        return true;
-      }
+    // One probe decides existence; the out-chains stay for event routing
+    if (std::uint32_t *existing = edge_map_.find(edgeKey(from, to))) {
+      edge_hot_[*existing].delay = edge.delay;
+      edge_cold_[*existing] = EdgeCold{from, edge.from_x, edge.from_y,
+                                       edge.from_z, edge.to_x, edge.to_y,
+                                       edge.to_z};
+      return true;
     }
 
-    if (edge_count_ >= kMaxEdges) {
+    const std::uint32_t new_idx = allocEdgeSlot();
+    if (new_idx == kInvalidEdge) {
       assert(false && "AdaptiveEdge capacity exceeded");
       return false;
     }
-
-    const std::uint32_t new_idx = static_cast<std::uint32_t>(edge_count_++);
-    edges_[new_idx] = EdgeEntry{from, to, edge, kInvalidEdge};
+    ++edge_count_;
+    edge_hot_[new_idx] = EdgeHot{to, kInvalidEdge, edge.delay};
+    edge_cold_[new_idx] = EdgeCold{from, edge.from_x, edge.from_y, edge.from_z,
+                                   edge.to_x, edge.to_y, edge.to_z};
+    (void)edge_map_.insert(edgeKey(from, to), new_idx);
 
     if (out_head_[from] == kInvalidEdge) {
       out_head_[from] = new_idx;
       out_tail_[from] = new_idx;
     } else {
-      edges_[out_tail_[from]].next_out = new_idx;
+      edge_hot_[out_tail_[from]].next_out = new_idx;
       out_tail_[from] = new_idx;
     }
 
     return true;
   }
 
+  // Reuse a freed slot before advancing the append frontier
+  [[nodiscard]] std::uint32_t allocEdgeSlot() {
+    if (free_head_ != kInvalidEdge) {
+      const std::uint32_t idx = free_head_;
+      free_head_ = edge_hot_[idx].next_out;
+      return idx;
+    }
+    if (edge_high_water_ >= kMaxEdges) {
+      return kInvalidEdge;
+    }
+    return static_cast<std::uint32_t>(edge_high_water_++);
+  }
+
+  // Per-event core shared by tick() and runUntil(): advance the clock,
+  // adapt delays, and fan derived events out along the destination's
+  // out-chain (only the 16-byte hot entries are touched; delay adaptation
+  // matches AdaptiveEdge::updateDelay)
+  void dispatchEvent(const RDLEvent &evt) {
+    current_time = evt.timestamp;
+    events_processed++;
+
+    const std::uint32_t dst_node = static_cast<std::uint32_t>(evt.dst_node);
+    for (std::uint32_t idx = out_head_[dst_node]; idx != kInvalidEdge;
+         idx = edge_hot_[idx].next_out) {
+      EdgeHot &hot = edge_hot_[idx];
+
+      if (evt.payload > 0) {
+        hot.delay = hot.delay > 1 ? hot.delay - 1 : 1;
+      } else {
+        hot.delay += 1;
+      }
+
+      RDLEvent new_evt{};
+      new_evt.timestamp = current_time + hot.delay;
+      new_evt.dst_node = static_cast<int>(hot.to_node);
+      new_evt.src_node = evt.dst_node;
+      new_evt.payload = evt.payload + 1;
+
+      // Sampled flow accounting (one branch when profiling is off):
+      // every 16th derived event charges its (src, dst) pair, so the
+      // heavy lanes of the communication graph surface at a fraction of
+      // the bookkeeping cost
+      if (flow_profiling_ && ((flow_sample_tick_++ & kFlowSampleMask) == 0)) {
+        (void)flow_profile_.record(edgeKey(dst_node, hot.to_node));
+      }
+
+      // Destinations outside the owned x-slab go to the boundary
+      // handler; one null check when unpartitioned
+      if (boundary_handler_) {
+        const int next_x = static_cast<int>(hot.to_node / 1024u);
+        if (next_x < owned_x_begin_ || next_x >= owned_x_end_) {
+          boundary_handler_(new_evt, boundary_ctx_);
+          continue;
+        }
+      }
+      (void)event_queue.push(new_evt);
+    }
+  }
+
+  // runUntil scratch: events below the horizon are drained here in bulk
+  // and radix-sorted before the array scan
+  std::array<RDLEvent, kMaxPendingEvents> horizon_batch_{};
+  FixedRadixSorter<RDLEvent, kMaxPendingEvents> horizon_sorter_;
+
+  // Flow profiling (off by default): bounded sampled traffic counts per
+  // (src, dst) node pair, keyed like the edge identity map. The braid's
+  // placement pass reads the heavy pairs at exchange boundaries to
+  // co-locate communicating processes.
+  static constexpr std::uint32_t kFlowSampleMask = 15;  // 1-in-16 sampling
+  bool flow_profiling_ = false;
+  std::uint32_t flow_sample_tick_ = 0;
+  FixedFlowProfiler<kMaxFlowEntries> flow_profile_;
+
 public:
   BettiRDLKernel() {
 #ifndef RSE_KERNEL
@@ -158,7 +307,29 @@ public:
     if (!p) {
       return false;
     }
-    return space.addProcess(reinterpret_cast<Process *>(p), x, y, z);
+    const bool added = space.addProcess(process_pool.handleFor(p), x, y, z);
+    if (!added) {
+      process_pool.destroy(p);
+      return false;
+    }
+    touchBoundary(x, y, z, +1);
+    return true;
+  }
+
+  // Remove one process from a voxel and return its slot to the pool.
+  // Used by the braid layer to migrate load between tori.
+  bool despawnProcessAt(int x, int y, int z) {
+    const std::size_t count = space.getCellProcessCount(x, y, z);
+    if (count == 0) {
+      return false;
+    }
+    const ProcHandle h = space.getCellProcess(x, y, z, count - 1);
+    if (h.isNull() || !space.removeProcess(h, x, y, z)) {
+      return false;
+    }
+    process_pool.destroy(process_pool.resolve(h));
+    touchBoundary(x, y, z, -1);
+    return true;
   }
 
   bool createEdge(int x1, int y1, int z1, int x2, int y2, int z2,
@@ -175,6 +346,106 @@ public:
     return insertOrUpdateEdge(edge);
   }
 
+  // Remove an edge and recycle its slot. The predecessor walk is bounded
+  // by the source node's out-degree; the identity map makes the
+  // existence check itself one probe.
+  bool removeEdge(int x1, int y1, int z1, int x2, int y2, int z2) {
+    const std::uint32_t from = nodeId(x1, y1, z1);
+    const std::uint32_t to = nodeId(x2, y2, z2);
+
+    const std::uint32_t *slot = edge_map_.find(edgeKey(from, to));
+    if (!slot) {
+      return false;
+    }
+    const std::uint32_t idx = *slot;
+
+    std::uint32_t prev = kInvalidEdge;
+    for (std::uint32_t e = out_head_[from]; e != idx;
+         e = edge_hot_[e].next_out) {
+      prev = e;
+    }
+    if (prev == kInvalidEdge) {
+      out_head_[from] = edge_hot_[idx].next_out;
+    } else {
+      edge_hot_[prev].next_out = edge_hot_[idx].next_out;
+    }
+    if (out_tail_[from] == idx) {
+      out_tail_[from] = prev;
+    }
+
+    (void)edge_map_.erase(edgeKey(from, to));
+    edge_hot_[idx].next_out = free_head_;
+    free_head_ = idx;
+    --edge_count_;
+    return true;
+  }
+
+  // Rewrite the edge array in node-grouped chain order: drains the free
+  // list and makes each node's out-chain contiguous again, so routing
+  // walks stay sequential after heavy add/remove churn. Single-threaded;
+  // the braid runs it at exchange boundaries while workers are parked.
+  void compactEdges() {
+    std::uint32_t next_slot = 0;
+    for (std::uint32_t node = 0; node < LATTICE_SIZE; ++node) {
+      std::uint32_t e = out_head_[node];
+      if (e == kInvalidEdge) {
+        continue;
+      }
+      out_head_[node] = next_slot;
+      while (e != kInvalidEdge) {
+        compact_hot_[next_slot] = edge_hot_[e];
+        compact_cold_[next_slot] = edge_cold_[e];
+        e = edge_hot_[e].next_out;
+        compact_hot_[next_slot].next_out =
+            e != kInvalidEdge ? next_slot + 1 : kInvalidEdge;
+        ++next_slot;
+      }
+      out_tail_[node] = next_slot - 1;
+    }
+
+    for (std::uint32_t i = 0; i < next_slot; ++i) {
+      edge_hot_[i] = compact_hot_[i];
+      edge_cold_[i] = compact_cold_[i];
+      // insert() updates the existing key's slot in place
+      (void)edge_map_.insert(
+          edgeKey(edge_cold_[i].from_node, edge_hot_[i].to_node), i);
+    }
+
+    assert(next_slot == edge_count_);
+    edge_high_water_ = next_slot;
+    free_head_ = kInvalidEdge;
+  }
+
+  // Compact only once churn has fragmented a quarter of the capacity;
+  // cheap enough to call every braid cycle
+  void maybeCompactEdges() {
+    if (edge_high_water_ - edge_count_ >= kMaxEdges / 4) {
+      compactEdges();
+    }
+  }
+
+  using BoundaryHandler = void (*)(const RDLEvent &evt, void *ctx);
+
+  // Restrict this instance to the x-slab [x_begin, x_end). Derived events
+  // leaving the slab are handed to the boundary handler instead of being
+  // queued locally.
+  void setOwnedXRange(int x_begin, int x_end) {
+    owned_x_begin_ = x_begin;
+    owned_x_end_ = x_end;
+  }
+
+  void setBoundaryHandler(BoundaryHandler handler, void *ctx) {
+    boundary_handler_ = handler;
+    boundary_ctx_ = ctx;
+  }
+
+  // Inject a fully-formed event preserving its timestamp — the delivery
+  // side of cross-shard routing, where the original event time must
+  // survive the hop between instances. Thread-safe like injectEvent.
+  bool injectRawEvent(const RDLEvent &evt) {
+    return pending_events.push(evt);
+  }
+
   bool injectEvent(int dst_x, int dst_y, int dst_z, int src_x, int src_y,
                    int src_z, int payload) {
     RDLEvent evt{};
@@ -183,23 +454,16 @@ public:
     evt.src_node = static_cast<int>(nodeId(src_x, src_y, src_z));
     evt.payload = payload;
 
-    // Thread-safe injection: add to pending queue
-    {
-      std::lock_guard<std::mutex> lock(event_injection_lock);
-      if (!pending_events.push_back(evt)) {
-        return false;
-      }
-    }
-    return true;
+    // Thread-safe injection: lock-free push onto the pending ring
+    return pending_events.push(evt);
   }
 
   // Transfer pending events to the main event queue (single-threaded from scheduler)
   void flushPendingEvents() {
-    std::lock_guard<std::mutex> lock(event_injection_lock);
-    for (std::size_t i = 0; i < pending_events.size(); ++i) {
-      (void)event_queue.push(pending_events[i]);
+    RDLEvent evt{};
+    while (pending_events.pop(evt)) {
+      (void)event_queue.push(evt);
     }
-    pending_events.clear();
   }
 
   void tick() {
@@ -209,26 +473,54 @@ public:
 
     RDLEvent evt = event_queue.top();
     (void)event_queue.pop();
+    dispatchEvent(evt);
+  }
 
-    current_time = evt.timestamp;
-    events_processed++;
-
-    // Iterate all outgoing edges from the destination node
-    const std::uint32_t dst_node = static_cast<std::uint32_t>(evt.dst_node);
-    for (std::uint32_t idx = out_head_[dst_node]; idx != kInvalidEdge;
-         idx = edges_[idx].next_out) {
-      EdgeEntry &entry = edges_[idx];
-
-      entry.edge.updateDelay(evt.payload, current_time);
-
-      RDLEvent new_evt{};
-      new_evt.timestamp = current_time + entry.edge.delay;
-      new_evt.dst_node = static_cast<int>(entry.to_node);
-      new_evt.src_node = evt.dst_node;
-      new_evt.payload = evt.payload + 1;
-
-      (void)event_queue.push(new_evt);
+  // Process every event with timestamp strictly below horizon, in
+  // canonical order, and return the count. Where a time-based driver
+  // would otherwise spin tick() per event, the events below the horizon
+  // are pulled from the heap in one O(n) bulk drain, radix-sorted into
+  // canonical order (three chained stable passes, least-significant
+  // tiebreak first), and dispatched as a straight array scan. Per-event
+  // heap pops are paid only for derived events that land back below the
+  // horizon mid-scan — those interleave through the heap so execution
+  // order stays exactly tick()-equivalent. Delays are >= 1, so derived
+  // events run strictly after their cause and the round loop terminates.
+  unsigned long long runUntil(unsigned long long horizon) {
+    flushPendingEvents();
+    unsigned long long processed = 0;
+    for (;;) {
+      const std::size_t count = event_queue.drainIf(
+          [horizon](const RDLEvent &e) { return e.timestamp < horizon; },
+          horizon_batch_.data(), horizon_batch_.size());
+      if (count == 0) {
+        break;
+      }
+      horizon_sorter_.sortByKey(
+          horizon_batch_.data(), count,
+          [](const RDLEvent &e) { return radixKeyFromSigned(e.payload); });
+      horizon_sorter_.sortByKey(
+          horizon_batch_.data(), count, [](const RDLEvent &e) {
+            return (radixKeyFromSigned(e.dst_node) << 32) |
+                   radixKeyFromSigned(e.src_node);
+          });
+      horizon_sorter_.sortByKey(
+          horizon_batch_.data(), count, [](const RDLEvent &e) {
+            return static_cast<std::uint64_t>(e.timestamp);
+          });
+      for (std::size_t i = 0; i < count; ++i) {
+        while (!event_queue.empty() &&
+               event_queue.top() < horizon_batch_[i]) {
+          const RDLEvent early = event_queue.top();
+          (void)event_queue.pop();
+          dispatchEvent(early);
+          ++processed;
+        }
+        dispatchEvent(horizon_batch_[i]);
+        ++processed;
+      }
     }
+    return processed;
   }
 
   // Process at most max_events NEW events, returning the count processed
@@ -293,10 +585,41 @@ public:
   unsigned long long getCurrentTime() const { return current_time; }
   unsigned long long getEventsProcessed() const { return events_processed; }
 
+  // Timestamp of the next queued event, ~0ULL when idle. Flushes pending
+  // injections first so concurrent producers are visible; a tickless
+  // driver uses this as the deadline for its next wakeup instead of
+  // polling tick() against an empty queue.
+  unsigned long long nextEventTime() {
+    flushPendingEvents();
+    return event_queue.empty() ? ~0ULL : event_queue.top().timestamp;
+  }
+
   uint32_t getActiveProcessCount() const {
     return static_cast<uint32_t>(space.getProcessCount());
   }
 
+  bool hasProcessAt(int x, int y, int z) const {
+    return space.getCellProcessCount(x, y, z) > 0;
+  }
+
+  // ========== Flow profiling ==========
+
+  // Arm (or disarm) sampled traffic accounting in dispatchEvent. Off by
+  // default; when off the fan-out loop pays one branch per derived event.
+  void setFlowProfiling(bool enabled) { flow_profiling_ = enabled; }
+
+  // Copy the heaviest sampled (src, dst) flows, descending by count.
+  // Keys pack the pair as (src_node << 32) | dst_node; decode with
+  // node / 1024, (node % 1024) / 32, node % 32.
+  std::size_t topFlows(std::uint64_t *out_keys, std::uint64_t *out_counts,
+                       std::size_t max_out) const {
+    return flow_profile_.topK(out_keys, out_counts, max_out);
+  }
+
+  // Start a fresh accumulation epoch (the placement pass clears after
+  // each read so counts reflect one braid interval, not history)
+  void clearFlowProfile() { flow_profile_.clear(); }
+
   uint32_t getPendingEventCount() const {
     return static_cast<uint32_t>(event_queue.size() + pending_events.size());
   }
@@ -309,12 +632,30 @@ public:
     if (!out || count < static_cast<size_t>(kDim * kDim)) {
       return;
     }
-    for (int y = 0; y < kDim; ++y) {
-      for (int z = 0; z < kDim; ++z) {
-        const size_t idx = static_cast<size_t>(y * kDim + z);
-        out[idx] = static_cast<uint32_t>(space.getCellProcessCount(0, y, z));
+    // Materialized view: a plain copy, no per-cell lattice lookups
+    std::copy(boundary_view_.begin(), boundary_view_.end(), out);
+  }
+
+  // Generation counter advanced on every boundary cell change
+  uint64_t getBoundaryGeneration() const { return boundary_generation_; }
+
+  // Emit boundary cells changed after since_gen (index + current state).
+  // Returns the total number of changed cells, which may exceed max_count;
+  // callers fall back to a full fillBoundaryStates() in that case.
+  size_t fillBoundaryDeltas(uint64_t since_gen, uint32_t *out_indices,
+                            uint32_t *out_states, size_t max_count) const {
+    size_t dirty = 0;
+    for (size_t idx = 0; idx < boundary_cell_gen_.size(); ++idx) {
+      if (boundary_cell_gen_[idx] <= since_gen) {
+        continue;
+      }
+      if (dirty < max_count && out_indices && out_states) {
+        out_indices[dirty] = static_cast<uint32_t>(idx);
+        out_states[dirty] = boundary_view_[idx];
       }
+      ++dirty;
     }
+    return dirty;
   }
   
   /**
@@ -327,10 +668,11 @@ public:
       (void)event_queue.pop();  // Ignore return value
     }
     
-    // Clear pending events
+    // Drain pending events
     {
-      std::lock_guard<std::mutex> lock(event_injection_lock);
-      pending_events.clear();
+      RDLEvent evt{};
+      while (pending_events.pop(evt)) {
+      }
     }
     
     // Clear process pool (but keep allocator)
@@ -338,12 +680,24 @@ public:
     
     // Clear edges
     edge_count_ = 0;
+    edge_high_water_ = 0;
+    free_head_ = kInvalidEdge;
+    edge_map_.clear();
     out_head_.fill(kInvalidEdge);
     out_tail_.fill(kInvalidEdge);
     
     // Clear toroidal space
     space.clear();
-    
+
+    // Clear boundary view; every cell counts as changed so delta
+    // consumers resynchronize with a full snapshot
+    boundary_view_.fill(0);
+    boundary_cell_gen_.fill(++boundary_generation_);
+
+    // Clear flow profile (profiling stays armed if it was armed)
+    flow_profile_.clear();
+    flow_sample_tick_ = 0;
+
     // Reset counters
     current_time = 0;
     events_processed = 0;
@@ -29,6 +29,22 @@ int main() {
   std::cout << "\n[TEST 3] Beyond Traditional: 25 disks" << std::endl;
   solver.solve(25);
 
+  // Test 4: Batched expansion at the same depth — identical move total,
+  // injection overhead amortized across bulk chunks
+  std::cout << "\n[TEST 4] Batched Expansion: 25 disks" << std::endl;
+  solver.resetCounts();
+  solver.solveBatched(25);
+  if (solver.getMoveCount() != (1ull << 25) - 1) {
+    std::cout << "[ERROR] Batched move count mismatch!" << std::endl;
+    return 1;
+  }
+  std::cout << "[CHECK] Batched move total matches 2^25 - 1." << std::endl;
+
+  // Test 5: Depth the per-task mode cannot reach in reasonable time
+  std::cout << "\n[TEST 5] Batched Headline: 32 disks" << std::endl;
+  solver.resetCounts();
+  solver.solveBatched(32);
+
   std::cout << "\n================================================="
             << std::endl;
   std::cout << "   TESTS COMPLETE                               " << std::endl;
@@ -0,0 +1,563 @@
+#include "../BettiRDLCompute.h"
+#include "../../../../boot/net_projection.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Distributed braid: one logical 32^3 lattice sharded across OS
+// processes, cross-shard edges routed as RSEPX event-batch messages.
+//
+// Each shard process owns an x-slab and runs it through the domain
+// decomposition hooks (setOwnedXRange + boundary handler). Boundary
+// crossings are buffered per braid interval and flushed as one
+// RSEPX_MSG_EVENT_BATCH frame to the downstream shard — the same header
+// and framing boot/net_projection.cpp puts on the wire, carried here
+// over socketpairs so the demo runs on one box; pointing the fds at TCP
+// sockets distributes it across hosts unchanged. Once per interval every
+// shard also sends a braided::Projection to the coordinator, which
+// verifies the global constraint that every halo event sent was
+// received, decides when the braid has quiesced, and finally checks the
+// merged result against a single-kernel reference run: the update rule
+// is commutative, so interval-batched delivery reorders events across
+// timestamps without changing the final states.
+
+namespace {
+
+struct XorShift64 {
+  std::uint64_t state;
+
+  explicit XorShift64(std::uint64_t seed) : state(seed ? seed : 1u) {}
+
+  std::uint64_t next() {
+    std::uint64_t x = state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    state = x;
+    return x;
+  }
+};
+
+int wrap32(int v) {
+  int m = v % 32;
+  return m < 0 ? m + 32 : m;
+}
+
+int nodeId(int x, int y, int z) {
+  return wrap32(x) * 1024 + wrap32(y) * 32 + wrap32(z);
+}
+
+// --- RSEPX framing over stream sockets ---
+
+std::uint64_t fnv1a(const std::uint8_t *data, std::size_t len) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (std::size_t i = 0; i < len; ++i) {
+    hash ^= data[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool writeAll(int fd, const void *buf, std::size_t len) {
+  const std::uint8_t *p = static_cast<const std::uint8_t *>(buf);
+  while (len > 0) {
+    const ssize_t n = write(fd, p, len);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    len -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+bool readAll(int fd, void *buf, std::size_t len) {
+  std::uint8_t *p = static_cast<std::uint8_t *>(buf);
+  while (len > 0) {
+    const ssize_t n = read(fd, p, len);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    len -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+// One unfragmented RSEPX frame: stream transport delivers it whole, so
+// frag_index/frag_count stay 0/1 (the raw-ethernet path in
+// boot/net_projection.cpp is where fragmentation lives)
+bool sendFrame(int fd, std::uint16_t msg_type, std::uint32_t shard,
+               std::uint32_t round, std::uint64_t timestamp, std::uint64_t seq,
+               const void *payload, std::uint32_t payload_len) {
+  RsepxHeader hdr{};
+  hdr.magic[0] = 'R';
+  hdr.magic[1] = 'S';
+  hdr.magic[2] = 'E';
+  hdr.magic[3] = 'P';
+  hdr.version = 0x0002;
+  hdr.msg_type = msg_type;
+  hdr.torus_id = shard;
+  hdr.phase = round;
+  hdr.timestamp = timestamp;
+  hdr.seq = seq;
+  hdr.encoding = RSEPX_ENC_RAW;
+  hdr.payload_len = payload_len;
+  hdr.payload_hash =
+      fnv1a(static_cast<const std::uint8_t *>(payload), payload_len);
+  hdr.frag_index = 0;
+  hdr.frag_count = 1;
+  hdr.frag_len = payload_len;
+
+  if (!writeAll(fd, &hdr, sizeof(hdr))) {
+    return false;
+  }
+  return payload_len == 0 || writeAll(fd, payload, payload_len);
+}
+
+bool recvFrame(int fd, RsepxHeader &hdr, std::vector<std::uint8_t> &payload) {
+  if (!readAll(fd, &hdr, sizeof(hdr))) {
+    return false;
+  }
+  if (hdr.magic[0] != 'R' || hdr.magic[1] != 'S' || hdr.magic[2] != 'E' ||
+      hdr.magic[3] != 'P') {
+    return false;
+  }
+  payload.resize(hdr.payload_len);
+  if (hdr.payload_len > 0 && !readAll(fd, payload.data(), hdr.payload_len)) {
+    return false;
+  }
+  return fnv1a(payload.data(), payload.size()) == hdr.payload_hash;
+}
+
+// Coordinator verdict after each braid interval
+constexpr char kVerdictAdvance = 'A';
+constexpr char kVerdictHalt = 'H';
+
+// Constraint vector slots the shards publish for the coordinator
+constexpr std::size_t kConstraintSent = 0;      // Halo events sent this round
+constexpr std::size_t kConstraintReceived = 1;  // Halo events received
+constexpr std::size_t kConstraintIdle = 2;      // 1 when the queue is empty
+
+// Final per-shard report trailing the halt verdict
+struct ShardReport {
+  std::uint64_t events_processed;
+  std::uint64_t current_time;
+  std::uint32_t state_count;  // ShardState records follow
+};
+
+struct ShardState {
+  std::int32_t pid;
+  std::int32_t state;
+};
+
+struct Workload {
+  std::vector<std::array<int, 3>> coords;
+  std::vector<std::array<int, 4>> injections;  // x, y, z, value
+};
+
+// Every process derives the identical workload from the seed, so shards
+// need no setup traffic: each spawns and injects only what it owns
+Workload buildWorkload(std::uint64_t seed, int runtime_processes,
+                       int spacing) {
+  Workload load;
+  const int grid_size =
+      static_cast<int>(std::ceil(std::sqrt(runtime_processes)));
+  for (int i = 0; i < runtime_processes; i++) {
+    load.coords.push_back(
+        {(i % grid_size) * spacing, (i / grid_size) * spacing, 0});
+  }
+
+  XorShift64 rng(seed);
+  const int injections = std::min(4, runtime_processes);
+  for (int i = 0; i < injections; i++) {
+    const std::size_t idx = static_cast<std::size_t>(
+        rng.next() % static_cast<std::uint64_t>(runtime_processes));
+    const int value = static_cast<int>(rng.next() % 5u) + 1;
+    load.injections.push_back({load.coords[idx][0], load.coords[idx][1],
+                               load.coords[idx][2], value});
+  }
+  return load;
+}
+
+// Boundary handler context: crossings buffered until the interval flush
+void haloBuffer(const ComputeEvent &evt, void *ctx) {
+  static_cast<std::vector<ComputeEvent> *>(ctx)->push_back(evt);
+}
+
+// Shard process body. tx_fd feeds the downstream shard, rx_fd drains the
+// upstream one, ctrl_fd carries projections up and verdicts down.
+int runShard(int shard, int x_begin, int x_end, int braid_interval,
+             const Workload &load, int tx_fd, int rx_fd, int ctrl_fd) {
+  auto kernel = std::make_unique<BettiRDLCompute>();
+  std::vector<ComputeEvent> outbox;
+  kernel->setOwnedXRange(x_begin, x_end);
+  kernel->setBoundaryHandler(haloBuffer, &outbox);
+
+  auto owned = [&](int x) {
+    const int wx = wrap32(x);
+    return wx >= x_begin && wx < x_end;
+  };
+
+  for (const auto &coord : load.coords) {
+    if (owned(coord[0])) {
+      kernel->spawnProcess(coord[0], coord[1], coord[2]);
+    }
+  }
+  for (const auto &inj : load.injections) {
+    if (owned(inj[0])) {
+      kernel->injectEvent(inj[0], inj[1], inj[2], inj[3]);
+    }
+  }
+
+  unsigned long long window_end = braid_interval;
+  std::uint64_t seq = 0;
+  std::uint32_t round = 0;
+  RsepxHeader hdr;
+  std::vector<std::uint8_t> payload;
+
+  for (;;) {
+    // Process everything below the window boundary; crossings land in
+    // the outbox instead of the local queue
+    while (kernel->nextEventTime() < window_end) {
+      (void)kernel->tickBatch();
+    }
+
+    // Flush the outbox downstream as one RSEPX event batch. The in-memory
+    // ComputeEvent layout is the wire format: every shard runs the same
+    // binary, which is what RSEPX assumes for RAW payloads anyway.
+    const std::uint32_t sent = static_cast<std::uint32_t>(outbox.size());
+    if (!sendFrame(tx_fd, RSEPX_MSG_EVENT_BATCH, static_cast<std::uint32_t>(shard),
+                   round, window_end, seq, outbox.data(),
+                   sent * static_cast<std::uint32_t>(sizeof(ComputeEvent)))) {
+      return 1;
+    }
+    outbox.clear();
+
+    // Ingest the upstream batch, timestamps preserved
+    if (!recvFrame(rx_fd, hdr, payload) ||
+        hdr.msg_type != RSEPX_MSG_EVENT_BATCH ||
+        hdr.payload_len % sizeof(ComputeEvent) != 0) {
+      return 1;
+    }
+    const std::uint32_t received =
+        hdr.payload_len / static_cast<std::uint32_t>(sizeof(ComputeEvent));
+    const ComputeEvent *events =
+        reinterpret_cast<const ComputeEvent *>(payload.data());
+    for (std::uint32_t i = 0; i < received; i++) {
+      (void)kernel->injectRawEvent(events[i]);
+    }
+
+    // Project shard state up for the global constraint check. The
+    // boundary face is the slab's first owned column — the cells halo
+    // events from upstream land on.
+    braided::Projection proj{};
+    proj.torus_id = static_cast<std::uint32_t>(shard);
+    proj.timestamp = window_end;
+    proj.total_events_processed = kernel->getEventsProcessed();
+    proj.current_time = kernel->getCurrentTime();
+    proj.active_processes =
+        static_cast<std::uint32_t>(kernel->getProcessCount());
+    const unsigned long long next_time = kernel->nextEventTime();
+    proj.pending_events = next_time == ~0ULL ? 0 : 1;
+    for (int y = 0; y < 32; y++) {
+      for (int z = 0; z < 32; z++) {
+        proj.boundary_states[static_cast<std::size_t>(y * 32 + z)] =
+            static_cast<std::uint32_t>(
+                kernel->getProcessState(nodeId(x_begin, y, z)));
+      }
+    }
+    proj.constraint_vector[kConstraintSent] = static_cast<std::int32_t>(sent);
+    proj.constraint_vector[kConstraintReceived] =
+        static_cast<std::int32_t>(received);
+    proj.constraint_vector[kConstraintIdle] = next_time == ~0ULL ? 1 : 0;
+    proj.state_hash = proj.computeHash();
+
+    if (!sendFrame(ctrl_fd, RSEPX_MSG_PROJECTION,
+                   static_cast<std::uint32_t>(shard), round, window_end, seq,
+                   &proj, sizeof(proj))) {
+      return 1;
+    }
+
+    char verdict = 0;
+    if (!readAll(ctrl_fd, &verdict, 1)) {
+      return 1;
+    }
+    if (verdict == kVerdictHalt) {
+      break;
+    }
+    window_end += static_cast<unsigned long long>(braid_interval);
+    seq++;
+    round++;
+  }
+
+  // Final report: owned slice of the workload's process states
+  std::vector<ShardState> states;
+  for (const auto &coord : load.coords) {
+    if (owned(coord[0])) {
+      const int pid = nodeId(coord[0], coord[1], coord[2]);
+      states.push_back({pid, kernel->getProcessState(pid)});
+    }
+  }
+  ShardReport report{kernel->getEventsProcessed(), kernel->getCurrentTime(),
+                     static_cast<std::uint32_t>(states.size())};
+  if (!writeAll(ctrl_fd, &report, sizeof(report)) ||
+      !writeAll(ctrl_fd, states.data(),
+                states.size() * sizeof(ShardState))) {
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::uint64_t seed = 42;
+  int max_events = 100000;
+  int runtime_processes = 64;
+  int spacing = 1;
+  int shards = 4;
+  int braid_interval = 8;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    auto read_u64 = [&](std::uint64_t &out) {
+      if (i + 1 < argc) {
+        out = static_cast<std::uint64_t>(std::strtoull(argv[++i], nullptr, 10));
+      }
+    };
+
+    auto read_i32 = [&](int &out) {
+      if (i + 1 < argc) {
+        out = std::atoi(argv[++i]);
+      }
+    };
+
+    if (arg == "--seed") {
+      read_u64(seed);
+    } else if (arg == "--max-events") {
+      read_i32(max_events);
+    } else if (arg == "--processes") {
+      read_i32(runtime_processes);
+    } else if (arg == "--spacing") {
+      read_i32(spacing);
+    } else if (arg == "--shards") {
+      read_i32(shards);
+    } else if (arg == "--braid-interval") {
+      read_i32(braid_interval);
+    }
+  }
+
+  if (runtime_processes < 1) {
+    runtime_processes = 1;
+  }
+  if (shards < 1) {
+    shards = 1;
+  }
+  if (shards > 32) {
+    shards = 32;  // One x-column per shard at most
+  }
+  if (braid_interval < 1) {
+    braid_interval = 1;
+  }
+
+  // Slab bounds; trailing shards that would start past the lattice fold
+  // away, exactly like the in-process partitioned driver
+  const int slab_width = (32 + shards - 1) / shards;
+  std::vector<std::array<int, 2>> slabs;
+  for (int p = 0; p < shards; p++) {
+    const int begin = p * slab_width;
+    if (begin >= 32) {
+      break;
+    }
+    slabs.push_back({begin, std::min(begin + slab_width, 32)});
+  }
+  shards = static_cast<int>(slabs.size());
+
+  const Workload load = buildWorkload(seed, runtime_processes, spacing);
+
+  // Ring of halo links (shard i feeds shard i+1 — propagation only moves
+  // +x) plus one control link per shard for projections and verdicts
+  std::vector<std::array<int, 2>> halo(static_cast<std::size_t>(shards));
+  std::vector<std::array<int, 2>> ctrl(static_cast<std::size_t>(shards));
+  for (int p = 0; p < shards; p++) {
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, halo[p].data()) != 0 ||
+        socketpair(AF_UNIX, SOCK_STREAM, 0, ctrl[p].data()) != 0) {
+      std::cerr << "socketpair failed" << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<pid_t> children;
+  for (int p = 0; p < shards; p++) {
+    const pid_t pid = fork();
+    if (pid < 0) {
+      std::cerr << "fork failed" << std::endl;
+      return 1;
+    }
+    if (pid == 0) {
+      const int tx_fd = halo[static_cast<std::size_t>(p)][0];
+      const int rx_fd =
+          halo[static_cast<std::size_t>((p + shards - 1) % shards)][1];
+      const int ctrl_fd = ctrl[static_cast<std::size_t>(p)][1];
+      for (int q = 0; q < shards; q++) {
+        for (int side = 0; side < 2; side++) {
+          const int h = halo[static_cast<std::size_t>(q)][side];
+          const int c = ctrl[static_cast<std::size_t>(q)][side];
+          if (h != tx_fd && h != rx_fd) {
+            close(h);
+          }
+          if (c != ctrl_fd) {
+            close(c);
+          }
+        }
+      }
+      _exit(runShard(p, slabs[static_cast<std::size_t>(p)][0],
+                     slabs[static_cast<std::size_t>(p)][1], braid_interval,
+                     load, tx_fd, rx_fd, ctrl_fd));
+    }
+    children.push_back(pid);
+  }
+
+  // Coordinator keeps only the control links
+  for (int p = 0; p < shards; p++) {
+    close(halo[static_cast<std::size_t>(p)][0]);
+    close(halo[static_cast<std::size_t>(p)][1]);
+    close(ctrl[static_cast<std::size_t>(p)][1]);
+  }
+
+  // Braid loop: collect one projection per shard per interval, verify the
+  // conservation constraint (halo events sent == received, hashes intact),
+  // halt once every shard is idle with nothing in flight
+  std::uint64_t rounds = 0;
+  std::uint64_t halo_total = 0;
+  std::uint64_t violations = 0;
+  RsepxHeader hdr;
+  std::vector<std::uint8_t> payload;
+
+  for (;;) {
+    std::int64_t sent_total = 0;
+    std::int64_t received_total = 0;
+    std::uint64_t events_total = 0;
+    bool all_idle = true;
+
+    for (int p = 0; p < shards; p++) {
+      if (!recvFrame(ctrl[static_cast<std::size_t>(p)][0], hdr, payload) ||
+          hdr.msg_type != RSEPX_MSG_PROJECTION ||
+          payload.size() != sizeof(braided::Projection)) {
+        std::cerr << "shard " << p << " projection lost" << std::endl;
+        return 1;
+      }
+      const braided::Projection proj = braided::Projection::deserialize(
+          payload.data(), payload.size());
+      if (!proj.verify()) {
+        violations++;
+      }
+      sent_total += proj.constraint_vector[kConstraintSent];
+      received_total += proj.constraint_vector[kConstraintReceived];
+      events_total += proj.total_events_processed;
+      all_idle = all_idle && proj.constraint_vector[kConstraintIdle] == 1;
+    }
+
+    if (sent_total != received_total) {
+      violations++;
+    }
+    halo_total += static_cast<std::uint64_t>(received_total);
+    rounds++;
+
+    const bool halt = (all_idle && sent_total == 0) ||
+                      events_total >= static_cast<std::uint64_t>(max_events);
+    const char verdict = halt ? kVerdictHalt : kVerdictAdvance;
+    for (int p = 0; p < shards; p++) {
+      if (!writeAll(ctrl[static_cast<std::size_t>(p)][0], &verdict, 1)) {
+        return 1;
+      }
+    }
+    if (halt) {
+      break;
+    }
+  }
+
+  // Merge the final reports
+  std::uint64_t events_processed = 0;
+  unsigned long long current_time = 0;
+  std::map<int, int> process_states;
+  for (int p = 0; p < shards; p++) {
+    ShardReport report;
+    if (!readAll(ctrl[static_cast<std::size_t>(p)][0], &report,
+                 sizeof(report))) {
+      return 1;
+    }
+    events_processed += report.events_processed;
+    current_time = std::max(
+        current_time,
+        static_cast<unsigned long long>(report.current_time));
+    for (std::uint32_t i = 0; i < report.state_count; i++) {
+      ShardState state;
+      if (!readAll(ctrl[static_cast<std::size_t>(p)][0], &state,
+                   sizeof(state))) {
+        return 1;
+      }
+      process_states[state.pid] = state.state;
+    }
+  }
+
+  int exit_status = 0;
+  for (pid_t pid : children) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      exit_status = 1;
+    }
+  }
+
+  // Single-kernel reference over the same workload: the braid must land
+  // on identical states and event totals
+  auto reference = std::make_unique<BettiRDLCompute>();
+  for (const auto &coord : load.coords) {
+    reference->spawnProcess(coord[0], coord[1], coord[2]);
+  }
+  for (const auto &inj : load.injections) {
+    reference->injectEvent(inj[0], inj[1], inj[2], inj[3]);
+  }
+  (void)reference->run(max_events);
+
+  bool match = reference->getEventsProcessed() == events_processed;
+  for (const auto &coord : load.coords) {
+    const int pid = nodeId(coord[0], coord[1], coord[2]);
+    const auto it = process_states.find(pid);
+    if (it == process_states.end() ||
+        it->second != reference->getProcessState(pid)) {
+      match = false;
+    }
+  }
+
+  std::cout << "{";
+  std::cout << "\"seed_used\":" << seed << ",";
+  std::cout << "\"shards\":" << shards << ",";
+  std::cout << "\"braid_interval\":" << braid_interval << ",";
+  std::cout << "\"rounds\":" << rounds << ",";
+  std::cout << "\"halo_events\":" << halo_total << ",";
+  std::cout << "\"constraint_violations\":" << violations << ",";
+  std::cout << "\"events_processed\":" << events_processed << ",";
+  std::cout << "\"current_time\":" << current_time << ",";
+  std::cout << "\"reference_events\":" << reference->getEventsProcessed()
+            << ",";
+  std::cout << "\"match\":" << (match ? "true" : "false");
+  std::cout << "}" << std::endl;
+
+  return match ? exit_status : 1;
+}
@@ -1,12 +1,15 @@
 #include "../BettiRDLCompute.h"
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -38,6 +41,36 @@ int nodeId(int x, int y, int z) {
   return wx * 1024 + wy * 32 + wz;
 }
 
+// Domain decomposition: the lattice split into x-slabs, one
+// BettiRDLCompute instance per slab. Boundary infection events are
+// delivered to the owning slab through injectRawEvent (timestamps
+// preserved), the same extract-and-ingest shape the braided projection
+// exchange uses between tori.
+struct Partitioning {
+  std::vector<std::unique_ptr<BettiRDLCompute>> slabs;
+  std::vector<int> slab_begin;  // First owned x-column per slab
+  std::atomic<std::uint64_t> halo_events{0};
+
+  int ownerOf(int x) const {
+    const int wx = wrap32(x);
+    for (std::size_t p = slab_begin.size(); p-- > 0;) {
+      if (wx >= slab_begin[p]) {
+        return static_cast<int>(p);
+      }
+    }
+    return 0;
+  }
+};
+
+// Boundary handler: route a slab-crossing event to its owner
+void haloDeliver(const ComputeEvent &evt, void *ctx) {
+  Partitioning &part = *static_cast<Partitioning *>(ctx);
+  const int x = evt.dst_node / 1024;
+  (void)part.slabs[static_cast<std::size_t>(part.ownerOf(x))]
+      ->injectRawEvent(evt);
+  part.halo_events.fetch_add(1, std::memory_order_relaxed);
+}
+
 } // namespace
 
 int main(int argc, char **argv) {
@@ -45,6 +78,7 @@ int main(int argc, char **argv) {
   int max_events = 1000;
   int runtime_processes = 64;
   int spacing = 1;
+  int partitions = 1;
 
   for (int i = 1; i < argc; i++) {
     std::string arg = argv[i];
@@ -69,14 +103,20 @@ int main(int argc, char **argv) {
       read_i32(runtime_processes);
     } else if (arg == "--spacing") {
       read_i32(spacing);
+    } else if (arg == "--partitions") {
+      read_i32(partitions);
     }
   }
 
   if (runtime_processes < 1) {
     runtime_processes = 1;
   }
-
-  BettiRDLCompute kernel;
+  if (partitions < 1) {
+    partitions = 1;
+  }
+  if (partitions > 32) {
+    partitions = 32;  // One x-column per slab at most
+  }
 
   const int grid_size = static_cast<int>(std::ceil(std::sqrt(runtime_processes)));
   std::vector<std::array<int, 3>> coords;
@@ -87,24 +127,113 @@ int main(int argc, char **argv) {
     int y = (i / grid_size) * spacing;
     int z = 0;
     coords.push_back({x, y, z});
-    kernel.spawnProcess(x, y, z);
   }
 
   XorShift64 rng(seed);
   const int injections = std::min(4, runtime_processes);
 
-  for (int i = 0; i < injections; i++) {
-    const std::size_t idx = static_cast<std::size_t>(rng.next() % static_cast<std::uint64_t>(runtime_processes));
-    const int value = static_cast<int>(rng.next() % 5u) + 1;
-    kernel.injectEvent(coords[idx][0], coords[idx][1], coords[idx][2], value);
-  }
+  std::uint64_t events_processed = 0;
+  unsigned long long current_time = 0;
+  std::uint64_t halo_events = 0;
+  std::map<int, int> process_states;
 
-  (void)kernel.run(max_events);
+  if (partitions == 1) {
+    BettiRDLCompute kernel;
 
-  std::map<int, int> process_states;
-  for (const auto &coord : coords) {
-    const int pid = nodeId(coord[0], coord[1], coord[2]);
-    process_states[pid] = kernel.getProcessState(pid);
+    for (const auto &coord : coords) {
+      kernel.spawnProcess(coord[0], coord[1], coord[2]);
+    }
+    for (int i = 0; i < injections; i++) {
+      const std::size_t idx = static_cast<std::size_t>(rng.next() % static_cast<std::uint64_t>(runtime_processes));
+      const int value = static_cast<int>(rng.next() % 5u) + 1;
+      kernel.injectEvent(coords[idx][0], coords[idx][1], coords[idx][2], value);
+    }
+
+    (void)kernel.run(max_events);
+
+    events_processed = kernel.getEventsProcessed();
+    current_time = kernel.getCurrentTime();
+    for (const auto &coord : coords) {
+      const int pid = nodeId(coord[0], coord[1], coord[2]);
+      process_states[pid] = kernel.getProcessState(pid);
+    }
+  } else {
+    // Partitioned mode: x-slabs with one instance per partition. Each
+    // round all slabs holding events at the global minimum timestamp
+    // process that timestamp concurrently; boundary-crossing infections
+    // are delivered to the owning slab through the halo handler and show
+    // up one timestep later, exactly as they would inside one kernel —
+    // results match the single-kernel run event for event.
+    Partitioning part;
+    const int slab_width = (32 + partitions - 1) / partitions;
+    for (int p = 0; p < partitions; p++) {
+      const int begin = p * slab_width;
+      if (begin >= 32) {
+        break;
+      }
+      const int end = std::min(begin + slab_width, 32);
+      auto slab = std::make_unique<BettiRDLCompute>();
+      slab->setOwnedXRange(begin, end);
+      slab->setBoundaryHandler(haloDeliver, &part);
+      part.slab_begin.push_back(begin);
+      part.slabs.push_back(std::move(slab));
+    }
+    partitions = static_cast<int>(part.slabs.size());
+
+    for (const auto &coord : coords) {
+      part.slabs[static_cast<std::size_t>(part.ownerOf(coord[0]))]
+          ->spawnProcess(coord[0], coord[1], coord[2]);
+    }
+    for (int i = 0; i < injections; i++) {
+      const std::size_t idx = static_cast<std::size_t>(rng.next() % static_cast<std::uint64_t>(runtime_processes));
+      const int value = static_cast<int>(rng.next() % 5u) + 1;
+      part.slabs[static_cast<std::size_t>(part.ownerOf(coords[idx][0]))]
+          ->injectEvent(coords[idx][0], coords[idx][1], coords[idx][2], value);
+    }
+
+    // Lockstep timestep loop. Halo events always carry timestamp t+1,
+    // so a slab ticking at the global minimum can never receive work
+    // another slab is producing for the same timestamp.
+    std::vector<int> round_counts(part.slabs.size(), 0);
+    int total = 0;
+    while (total < max_events) {
+      unsigned long long gmin = ~0ULL;
+      for (auto &slab : part.slabs) {
+        gmin = std::min(gmin, slab->nextEventTime());
+      }
+      if (gmin == ~0ULL) {
+        break;
+      }
+
+      std::vector<std::thread> workers;
+      for (std::size_t p = 0; p < part.slabs.size(); p++) {
+        if (part.slabs[p]->nextEventTime() != gmin) {
+          round_counts[p] = 0;
+          continue;
+        }
+        workers.emplace_back([&part, &round_counts, p]() {
+          round_counts[p] = part.slabs[p]->tickBatch();
+        });
+      }
+      for (auto &worker : workers) {
+        worker.join();
+      }
+      for (std::size_t p = 0; p < part.slabs.size(); p++) {
+        total += round_counts[p];
+      }
+    }
+
+    for (auto &slab : part.slabs) {
+      events_processed += slab->getEventsProcessed();
+      current_time = std::max(current_time, slab->getCurrentTime());
+    }
+    halo_events = part.halo_events.load(std::memory_order_relaxed);
+    for (const auto &coord : coords) {
+      const int pid = nodeId(coord[0], coord[1], coord[2]);
+      process_states[pid] =
+          part.slabs[static_cast<std::size_t>(part.ownerOf(coord[0]))]
+              ->getProcessState(pid);
+    }
   }
 
   std::cout << "{";
@@ -112,8 +241,10 @@ int main(int argc, char **argv) {
   std::cout << "\"max_events\":" << max_events << ",";
   std::cout << "\"runtime_processes\":" << runtime_processes << ",";
   std::cout << "\"spacing\":" << spacing << ",";
-  std::cout << "\"events_processed\":" << kernel.getEventsProcessed() << ",";
-  std::cout << "\"current_time\":" << kernel.getCurrentTime() << ",";
+  std::cout << "\"partitions\":" << partitions << ",";
+  std::cout << "\"halo_events\":" << halo_events << ",";
+  std::cout << "\"events_processed\":" << events_processed << ",";
+  std::cout << "\"current_time\":" << current_time << ",";
   std::cout << "\"process_states\":{";
 
   bool first = true;
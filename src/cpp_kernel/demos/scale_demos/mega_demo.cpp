@@ -1,10 +1,14 @@
 #include "../../Allocator.h"
+#include "../../single_torus/EventTrace.h"
 #include "../BettiRDLCompute.h"
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <thread>
 #include <vector>
 
 // ============================================================================
@@ -191,6 +195,129 @@ void runContagionDemo(int population) {
             << std::endl;
 }
 
+// ----------------------------------------------------------------------------
+// DEMO 4: STREAMING INGESTION
+// "The Disk-Bound Firehose"
+// ----------------------------------------------------------------------------
+// The other demos pre-generate their workloads in memory, which caps
+// problem size by RAM and hides ingest cost. Here the workload lives on
+// disk in the event-trace format: a reader thread decodes records into
+// the injection ring while the kernel runs, throttled against the queue
+// depth sampled from the shared telemetry page — problem size is bounded
+// by the disk, and the measured rate includes decode + inject.
+void runStreamingDemo(std::uint64_t total_events) {
+  printBanner("DEMO 4: STREAMING INGESTION (Disk-Bound Firehose)");
+  std::cout << "Scenario: " << total_events
+            << " events streamed from disk while the kernel runs."
+            << std::endl;
+  std::cout << "Goal: Disk-bound problem sizes with ingest cost on the clock."
+            << std::endl;
+
+  const char *trace_path = "/tmp/mega_demo_stream.rset";
+
+  // 1. Generate the workload straight to disk (O(1) RAM: the writer
+  // holds a 64KB buffer, never the event set)
+  std::cout << "  [SETUP] Writing " << total_events << "-event trace..."
+            << std::endl;
+  {
+    rse_trace::EventTraceWriter writer;
+    if (!writer.open(trace_path, 32)) {
+      std::cout << "  [ERROR] Cannot open trace for writing." << std::endl;
+      return;
+    }
+    for (std::uint64_t i = 0; i < total_events; i++) {
+      const std::uint64_t ts = i >> 6;  // ~64 events per tick
+      (void)writer.record(ts, rand() % 32, rand() % 32, rand() % 32, 0, 0, 0,
+                          rand() % 5 + 1);
+    }
+    writer.close();
+  }
+  std::FILE *trace_file = std::fopen(trace_path, "rb");
+  std::fseek(trace_file, 0, SEEK_END);
+  const long trace_bytes = std::ftell(trace_file);
+  std::fclose(trace_file);
+  std::cout << "  [SETUP] Trace on disk: " << trace_bytes << " bytes ("
+            << (trace_bytes * 1.0 / total_events) << " B/event)" << std::endl;
+
+  BettiRDLCompute kernel;
+  std::cout << "  [SETUP] Activating full 32x32x32 lattice..." << std::endl;
+  for (int x = 0; x < 32; x++)
+    for (int y = 0; y < 32; y++)
+      for (int z = 0; z < 32; z++)
+        kernel.spawnProcess(x, y, z);
+
+  // Flow control: pause decoding while the kernel's queue sits above the
+  // high watermark. Depth comes from the telemetry page (relaxed atomic,
+  // no locks), so the reader never perturbs the tick loop to ask.
+  const std::uint64_t kHighWatermark = 2048;  // Queue capacity is 4096
+  const std::uint64_t kChunk = 1024;
+
+  std::atomic<bool> reader_done{false};
+  std::atomic<std::uint64_t> injected{0};
+  const auto *page = kernel.telemetryPage();
+
+  auto start = high_resolution_clock::now();
+
+  std::thread reader([&]() {
+    rse_trace::EventTraceReader trace;
+    if (!trace.open(trace_path)) {
+      reader_done.store(true, std::memory_order_release);
+      return;
+    }
+    rse_trace::TraceRecord rec{};
+    std::uint64_t in_chunk = 0;
+    while (trace.next(rec)) {
+      while (!kernel.injectEvent(rec.dst_x, rec.dst_y, rec.dst_z,
+                                 rec.payload)) {
+        std::this_thread::yield();  // Injection ring full: kernel is behind
+      }
+      injected.fetch_add(1, std::memory_order_relaxed);
+      if (++in_chunk == kChunk) {
+        in_chunk = 0;
+        while (page->queue_depth.load(std::memory_order_relaxed) >
+               kHighWatermark) {
+          std::this_thread::yield();
+        }
+      }
+    }
+    reader_done.store(true, std::memory_order_release);
+  });
+
+  // Consume concurrently with decoding; run() flushes the injection ring
+  std::uint64_t processed = 0;
+  while (!reader_done.load(std::memory_order_acquire)) {
+    const int n = kernel.run(static_cast<int>(kChunk));
+    if (n == 0) {
+      std::this_thread::yield();  // Starved: disk is the bottleneck
+    }
+    processed += static_cast<std::uint64_t>(n);
+  }
+  reader.join();
+
+  // Drain the tail (last injections plus their propagation waves)
+  for (int n = kernel.run(static_cast<int>(kChunk)); n > 0;
+       n = kernel.run(static_cast<int>(kChunk))) {
+    processed += static_cast<std::uint64_t>(n);
+  }
+
+  auto end = high_resolution_clock::now();
+  auto ms = duration_cast<milliseconds>(end - start).count();
+  if (ms < 1) {
+    ms = 1;
+  }
+
+  std::cout << "  [RESULT] Streamed " << injected.load() << " events, processed "
+            << processed << " (incl. propagation) in " << ms << "ms."
+            << std::endl;
+  std::cout << "  [METRIC] " << (processed * 1000.0 / ms)
+            << " Events/Sec end-to-end (decode + inject + compute)"
+            << std::endl;
+  std::cout << "  [STATUS] Peak in-memory footprint stayed at ring capacity."
+            << std::endl;
+
+  std::remove(trace_path);
+}
+
 int main() {
   std::cout << "Betti-RDL Scale Demos" << std::endl;
   std::cout << "Simulating massive agent-based workloads..." << std::endl;
@@ -204,5 +331,8 @@ int main() {
   // Run Contagion Demo
   runContagionDemo(1000000); // 1 Million Infections
 
+  // Run Streaming Demo
+  runStreamingDemo(1000000); // 1 Million Events from disk
+
   return 0;
 }
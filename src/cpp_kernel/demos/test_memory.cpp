@@ -31,7 +31,26 @@ void test_page_table() {
     pt.unmap(0x2000);
     assert(!pt.isMapped(0x2000));
     assert(pt.translate(0x2000) == 0);
-    
+
+    // Remap to a new frame: the software TLB must not serve the stale frame
+    assert(pt.map(0x2000, 0x60000));
+    assert(pt.translate(0x2000) == 0x60000);
+
+    // Large page: one L1 entry maps a 4MB region
+    assert(pt.mapLarge(0x00800000, 0x01000000));
+    assert(pt.isMapped(0x00800000));
+    assert(pt.translate(0x00800000) == 0x01000000);
+    assert(pt.translate(0x00812345) == 0x01012345);
+
+    // Small-page map inside a large region is rejected, as are misaligned
+    // large mappings
+    assert(!pt.map(0x00801000, 0x50000));
+    assert(!pt.mapLarge(0x00801000, 0x01000000));
+
+    pt.unmapLarge(0x00800000);
+    assert(!pt.isMapped(0x00800000));
+    assert(pt.translate(0x00800000) == 0);
+
     pt.printStats();
     
     std::cout << "✅ Test 1 passed!" << std::endl;
@@ -2,6 +2,15 @@
 
 #include "Device.h"
 #include "BlockFS.h"
+#include "Syscall.h"
+#include "../FixedStructures.h"
+#ifdef RSE_KERNEL
+// KernelStubs carries the std::atomic subset; hosted <atomic> collides
+// with the kernel's stream stubs (see KernelStubs.h)
+#include "KernelStubs.h"
+#else
+#include <atomic>
+#endif
 #include <cstdint>
 #include <cstring>
 #include <new>
@@ -13,6 +22,162 @@ struct BlockDeviceData {
     uint64_t cursor;
 };
 
+/**
+ * Multi-queue block submission front-end, mirroring NVMe SQ/CQ pairs:
+ * each torus owns a submission ring and a completion ring (SPSC — the
+ * torus produces submissions and consumes completions, the service side
+ * does the opposite), so tori queue block I/O without contending on
+ * shared state. Queues merge only at the physical device boundary:
+ * serviceAll() round-robins the submission rings, executes against
+ * rse_block_*, and posts each result to the owning torus's completion
+ * ring. Buffers stay caller-owned for the life of the request.
+ */
+struct BlockMQRequest {
+    uint8_t op;        // 0 = read, 1 = write
+    uint64_t lba;
+    uint32_t blocks;
+    void* buf;
+    uint32_t id;       // Per-queue, assigned by submit()
+};
+
+struct BlockMQCompletion {
+    uint32_t id;
+    int result;        // 0 on success, -1 on device error
+};
+
+class BlockMQ {
+public:
+    static constexpr uint32_t QUEUE_DEPTH = 32;
+    static constexpr uint8_t OP_READ = 0;
+    static constexpr uint8_t OP_WRITE = 1;
+
+    BlockMQ() : rr_next_(0) {
+        for (uint32_t q = 0; q < MAX_TORI; q++) {
+            next_id_[q] = 1;
+            submitted_[q].store(0, std::memory_order_relaxed);
+            completed_[q].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    BlockMQ(const BlockMQ&) = delete;
+    BlockMQ& operator=(const BlockMQ&) = delete;
+
+    /**
+     * Queue one request on `torus`'s submission ring. Returns false when
+     * the ring is full (per-queue backpressure; other queues are
+     * unaffected). `out_id` receives the request id for completion
+     * matching.
+     */
+    bool submit(uint32_t torus, uint8_t op, uint64_t lba, uint32_t blocks,
+                void* buf, uint32_t* out_id) {
+        if (torus >= MAX_TORI || op > OP_WRITE || blocks == 0 || !buf) {
+            return false;
+        }
+        BlockMQRequest req;
+        req.op = op;
+        req.lba = lba;
+        req.blocks = blocks;
+        req.buf = buf;
+        req.id = next_id_[torus];
+        if (!sq_[torus].push(req)) {
+            return false;
+        }
+        next_id_[torus]++;
+        if (next_id_[torus] == 0) {
+            next_id_[torus] = 1;
+        }
+        submitted_[torus].fetch_add(1, std::memory_order_relaxed);
+        if (out_id) {
+            *out_id = req.id;
+        }
+        return true;
+    }
+
+    /**
+     * The physical device boundary: pop up to `max` requests round-robin
+     * across the submission rings, execute them, and post completions.
+     * Single consumer — one service context per device. Returns the
+     * number of requests executed.
+     */
+    uint32_t serviceAll(uint32_t max) {
+        uint32_t done = 0;
+        uint32_t idle_queues = 0;
+        while (done < max && idle_queues < MAX_TORI) {
+            uint32_t q = rr_next_;
+            rr_next_ = (rr_next_ + 1) % MAX_TORI;
+            BlockMQRequest req;
+            if (!sq_[q].pop(req)) {
+                idle_queues++;
+                continue;
+            }
+            idle_queues = 0;
+            BlockMQCompletion cqe;
+            cqe.id = req.id;
+            if (req.op == OP_READ) {
+                cqe.result = rse_block_read(req.lba, req.buf, req.blocks);
+            } else {
+                cqe.result = rse_block_write(req.lba, req.buf, req.blocks);
+            }
+            // The CQ is as deep as the SQ and each in-flight request
+            // occupies exactly one slot across the pair, so this never
+            // fails for a well-formed queue
+            (void)cq_[q].push(cqe);
+            done++;
+        }
+        return done;
+    }
+
+    /**
+     * Torus-side completion poll: pops the oldest completion on `torus`'s
+     * ring. Returns false when none are ready.
+     */
+    bool complete(uint32_t torus, BlockMQCompletion* out) {
+        if (torus >= MAX_TORI || !out) {
+            return false;
+        }
+        if (!cq_[torus].pop(*out)) {
+            return false;
+        }
+        completed_[torus].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** Requests submitted but not yet collected by `torus`. */
+    uint64_t inflight(uint32_t torus) const {
+        if (torus >= MAX_TORI) {
+            return 0;
+        }
+        uint64_t sub = submitted_[torus].load(std::memory_order_relaxed);
+        uint64_t comp = completed_[torus].load(std::memory_order_relaxed);
+        return sub >= comp ? sub - comp : 0;
+    }
+
+    void printStats() const {
+        std::cout << "[BlockMQ]";
+        for (uint32_t q = 0; q < MAX_TORI; q++) {
+            uint64_t sub = submitted_[q].load(std::memory_order_relaxed);
+            if (sub == 0) {
+                continue;
+            }
+            std::cout << " q" << q << "=" << sub;
+        }
+        std::cout << std::endl;
+    }
+
+private:
+    FixedSPSCRing<BlockMQRequest, QUEUE_DEPTH> sq_[MAX_TORI];
+    FixedSPSCRing<BlockMQCompletion, QUEUE_DEPTH> cq_[MAX_TORI];
+    uint32_t next_id_[MAX_TORI];
+    std::atomic<uint64_t> submitted_[MAX_TORI];
+    std::atomic<uint64_t> completed_[MAX_TORI];
+    uint32_t rr_next_;
+};
+
+inline BlockMQ& block_mq() {
+    static BlockMQ mq;
+    return mq;
+}
+
 constexpr unsigned long BLOCK_IOCTL_GET_BLOCK_SIZE = 0x52534520ul;
 constexpr unsigned long BLOCK_IOCTL_GET_TOTAL_BLOCKS = 0x52534521ul;
 
@@ -8,6 +8,7 @@
 #ifdef RSE_KERNEL
 #include "KernelStubs.h"
 #else
+#include <fstream>
 #include <iostream>
 #endif
 
@@ -45,6 +46,300 @@ inline bool ensure_block_store() {
     return true;
 }
 
+/**
+ * Dirty-block tracking and incremental checkpoint streaming for the
+ * host-side block store.
+ *
+ * Every rse_block_write marks its blocks in a dirty bitmap (one bit per
+ * block, double-buffered per checkpoint epoch). A checkpoint begins by
+ * swapping bitmaps: the captured set defines exactly the blocks dirtied
+ * since the previous checkpoint, and writes issued while the checkpoint
+ * streams accumulate in the fresh bitmap for the next epoch. Streaming
+ * then copies captured blocks to a host-side file in bounded slices
+ * (streamSome between ticks), so execution continues while the
+ * checkpoint drains. Consistency for in-flight blocks is copy-on-write:
+ * when a write lands on a captured block that has not been streamed
+ * yet, its pre-image is streamed out before the store is modified, so
+ * the file always holds the state as of begin().
+ *
+ * The checkpoint is consistent at the store level. Callers that want a
+ * filesystem-consistent image sync BlockFS (and therefore the block
+ * cache) before begin(), the same contract raw device access already
+ * follows.
+ *
+ * The first checkpoint after boot captures every block written since
+ * the store was (zero-filled) configured, i.e. the full live state.
+ */
+class BlockCheckpointStream {
+public:
+    static constexpr uint32_t kMagic = 0x52534B50u;
+    static constexpr uint32_t kVersion = 1u;
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t block_size;
+        uint32_t reserved;
+        uint64_t total_blocks;
+        uint64_t epoch;
+        uint64_t block_count;
+    };
+
+    BlockCheckpointStream()
+        : active_(nullptr), capture_(nullptr), words_(0), tracked_blocks_(0),
+          active_count_(0), capture_count_(0), cursor_word_(0),
+          blocks_streamed_(0), epoch_(0), in_progress_(false) {}
+
+    /**
+     * Size the bitmaps for a (re)configured store. Drops all tracking
+     * state; an in-progress checkpoint is abandoned.
+     */
+    void reset(uint64_t total_blocks) {
+        delete[] active_;
+        delete[] capture_;
+        active_ = nullptr;
+        capture_ = nullptr;
+        tracked_blocks_ = total_blocks;
+        words_ = (total_blocks + 63u) / 64u;
+        active_count_ = 0;
+        capture_count_ = 0;
+        in_progress_ = false;
+        if (out_.is_open()) {
+            out_.close();
+        }
+    }
+
+    /** Blocks dirtied since the last checkpoint began. */
+    uint64_t dirtyCount() const { return active_count_; }
+
+    /** Captured blocks not yet streamed by the open checkpoint. */
+    uint64_t pendingCount() const { return in_progress_ ? capture_count_ : 0; }
+
+    uint64_t epoch() const { return epoch_; }
+    bool inProgress() const { return in_progress_; }
+
+    /** Called after the store memcpy: accumulate for the next epoch. */
+    void markDirty(uint64_t lba, uint32_t blocks) {
+        if (!ensureBitmaps()) {
+            return;
+        }
+        for (uint32_t b = 0; b < blocks; ++b) {
+            uint64_t bit = lba + b;
+            if (bit >= tracked_blocks_) {
+                break;
+            }
+            uint64_t& word = active_[bit >> 6];
+            uint64_t mask = 1ull << (bit & 63u);
+            if ((word & mask) == 0) {
+                word |= mask;
+                active_count_++;
+            }
+        }
+    }
+
+    /**
+     * Called before the store memcpy: copy-on-write for captured blocks.
+     * A captured block about to be overwritten is streamed immediately,
+     * so the file keeps its begin()-time image.
+     */
+    void preWrite(uint64_t lba, uint32_t blocks) {
+        if (!in_progress_) {
+            return;
+        }
+        for (uint32_t b = 0; b < blocks; ++b) {
+            uint64_t bit = lba + b;
+            if (bit >= tracked_blocks_) {
+                break;
+            }
+            if (capture_[bit >> 6] & (1ull << (bit & 63u))) {
+                streamBlock(bit);
+            }
+        }
+    }
+
+    /**
+     * Open a checkpoint: swap bitmaps (the captured set is this epoch's
+     * dirty set) and write the file header with a placeholder count.
+     * Fails if a checkpoint is already in progress or the file cannot be
+     * created; the dirty set is untouched on failure.
+     */
+    bool begin(const char* path) {
+        if (in_progress_ || !path || !ensureBitmaps()) {
+            return false;
+        }
+        out_.open(path, std::ios::binary | std::ios::trunc);
+        if (!out_) {
+            return false;
+        }
+        epoch_++;
+        FileHeader hdr = {};
+        hdr.magic = kMagic;
+        hdr.version = kVersion;
+        hdr.block_size = block_store().block_size;
+        hdr.total_blocks = tracked_blocks_;
+        hdr.epoch = epoch_;
+        hdr.block_count = 0;  // Patched by finish()
+        out_.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+
+        uint64_t* swap = capture_;
+        capture_ = active_;
+        active_ = swap;
+        std::memset(active_, 0, words_ * sizeof(uint64_t));
+        capture_count_ = active_count_;
+        active_count_ = 0;
+        cursor_word_ = 0;
+        blocks_streamed_ = 0;
+        in_progress_ = true;
+        return true;
+    }
+
+    /**
+     * Stream up to max_blocks captured blocks to the file. Returns the
+     * number streamed this call; 0 means the captured set has drained.
+     * Called between ticks so the torus keeps executing while the
+     * checkpoint trickles out.
+     */
+    uint64_t streamSome(uint64_t max_blocks) {
+        if (!in_progress_) {
+            return 0;
+        }
+        uint64_t streamed = 0;
+        while (streamed < max_blocks && cursor_word_ < words_) {
+            uint64_t word = capture_[cursor_word_];
+            if (word == 0) {
+                cursor_word_++;
+                continue;
+            }
+            // Lowest set bit in the word; streamBlock clears it
+            uint64_t bit = (cursor_word_ << 6) +
+                           (uint64_t)__builtin_ctzll(word);
+            streamBlock(bit);
+            streamed++;
+        }
+        return streamed;
+    }
+
+    /**
+     * Drain whatever remains, patch the header's block count, and close.
+     */
+    bool finish() {
+        if (!in_progress_) {
+            return false;
+        }
+        while (streamSome(256) > 0) {
+        }
+        out_.seekp(offsetof(FileHeader, block_count), std::ios::beg);
+        out_.write(reinterpret_cast<const char*>(&blocks_streamed_),
+                   sizeof(blocks_streamed_));
+        bool ok = static_cast<bool>(out_);
+        out_.close();
+        in_progress_ = false;
+        return ok;
+    }
+
+    /**
+     * Convenience: one-shot checkpoint (begin + drain + finish).
+     */
+    bool checkpoint(const char* path) {
+        return begin(path) && finish();
+    }
+
+    /**
+     * Apply a checkpoint file's records to the store. Validates the
+     * header against the current store geometry. Restored blocks mark
+     * the dirty bitmap, so they are captured by the next checkpoint.
+     */
+    bool restore(const char* path) {
+        if (!path || in_progress_) {
+            return false;
+        }
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            return false;
+        }
+        FileHeader hdr = {};
+        in.read(reinterpret_cast<char*>(&hdr), sizeof(hdr));
+        if (!in || hdr.magic != kMagic || hdr.version != kVersion ||
+            hdr.block_size != block_store().block_size ||
+            hdr.total_blocks != block_store().total_blocks) {
+            return false;
+        }
+        if (!ensure_block_store()) {
+            return false;
+        }
+        uint32_t block_size = block_store().block_size;
+        for (uint64_t r = 0; r < hdr.block_count; ++r) {
+            uint64_t lba = 0;
+            in.read(reinterpret_cast<char*>(&lba), sizeof(lba));
+            if (!in || lba >= block_store().total_blocks) {
+                return false;
+            }
+            in.read(reinterpret_cast<char*>(block_store().data +
+                                            lba * block_size),
+                    block_size);
+            if (!in) {
+                return false;
+            }
+            markDirty(lba, 1);
+        }
+        return true;
+    }
+
+private:
+    bool ensureBitmaps() {
+        if (active_) {
+            return true;
+        }
+        if (tracked_blocks_ == 0) {
+            tracked_blocks_ = block_store().total_blocks;
+            words_ = (tracked_blocks_ + 63u) / 64u;
+        }
+        active_ = new (std::nothrow) uint64_t[words_];
+        capture_ = new (std::nothrow) uint64_t[words_];
+        if (!active_ || !capture_) {
+            delete[] active_;
+            delete[] capture_;
+            active_ = nullptr;
+            capture_ = nullptr;
+            return false;
+        }
+        std::memset(active_, 0, words_ * sizeof(uint64_t));
+        std::memset(capture_, 0, words_ * sizeof(uint64_t));
+        return true;
+    }
+
+    // Append one record for a captured block and retire its bit. The
+    // store content is still the begin()-time image: post-begin writes
+    // reach captured blocks only through preWrite, which streams first.
+    void streamBlock(uint64_t bit) {
+        capture_[bit >> 6] &= ~(1ull << (bit & 63u));
+        capture_count_--;
+        out_.write(reinterpret_cast<const char*>(&bit), sizeof(bit));
+        out_.write(reinterpret_cast<const char*>(
+                       block_store().data +
+                       bit * block_store().block_size),
+                   block_store().block_size);
+        blocks_streamed_++;
+    }
+
+    uint64_t* active_;    // Dirtied since the last begin() (next epoch)
+    uint64_t* capture_;   // The open checkpoint's remaining blocks
+    uint64_t words_;
+    uint64_t tracked_blocks_;
+    uint64_t active_count_;
+    uint64_t capture_count_;
+    uint64_t cursor_word_;
+    uint64_t blocks_streamed_;
+    uint64_t epoch_;
+    bool in_progress_;
+    std::ofstream out_;
+};
+
+inline BlockCheckpointStream& block_checkpoint() {
+    static BlockCheckpointStream ckpt;
+    return ckpt;
+}
+
 inline void rse_block_configure(uint32_t block_size, uint64_t total_blocks) {
     if (block_size == 0 || total_blocks == 0) {
         return;
@@ -57,6 +352,7 @@ inline void rse_block_configure(uint32_t block_size, uint64_t total_blocks) {
     store.block_size = block_size;
     store.total_blocks = total_blocks;
     (void)ensure_block_store();
+    block_checkpoint().reset(total_blocks);
 }
 
 inline int rse_block_read(uint64_t lba, void* buf, uint32_t blocks) {
@@ -89,7 +385,9 @@ inline int rse_block_write(uint64_t lba, const void* buf, uint32_t blocks) {
     }
     uint64_t offset = lba * store.block_size;
     uint64_t bytes = (uint64_t)blocks * store.block_size;
+    block_checkpoint().preWrite(lba, blocks);
     std::memcpy(store.data + offset, buf, bytes);
+    block_checkpoint().markDirty(lba, blocks);
     return 0;
 }
 
@@ -101,13 +399,461 @@ inline uint64_t rse_block_total_blocks(void) {
 }
 #endif
 
+/**
+ * Write-back LRU cache between BlockFS and the block store.
+ *
+ * Reads are served from cached copies of recently touched blocks; writes
+ * land in the cache dirty and reach the device only on sync() (explicit or
+ * at BlockFS journal barriers) or when eviction needs the slot. sync()
+ * flushes in LBA order, coalescing contiguous dirty blocks into batched
+ * rse_block_write calls. Bounded: 128 cached blocks, open hash by LBA,
+ * intrusive LRU list.
+ *
+ * The cache sits above the device shims, so raw rse_block_read/write
+ * callers bypass it; anything mixing raw access with BlockFS must sync
+ * and invalidate() first.
+ */
+class BlockCache {
+public:
+    static constexpr uint32_t kNumBlocks = 128;
+    static constexpr uint32_t kMaxBlockSize = 4096;
+    static constexpr uint32_t kNumBuckets = 64;
+    static constexpr uint32_t kRunBlocks = 16;  // Max blocks per flush write
+    static constexpr uint32_t kInvalid = 0xFFFFFFFFu;
+
+    BlockCache() {
+        reset(512);
+    }
+
+    /**
+     * Drop everything and adopt a new block size (mount time). The caller
+     * syncs first if the previous contents matter.
+     */
+    void reset(uint32_t block_size) {
+        block_size_ = (block_size == 0 || block_size > kMaxBlockSize)
+                          ? kMaxBlockSize
+                          : block_size;
+        for (uint32_t i = 0; i < kNumBuckets; ++i) {
+            buckets_[i] = kInvalid;
+        }
+        for (uint32_t i = 0; i < kNumBlocks; ++i) {
+            entries_[i].valid = false;
+            entries_[i].dirty = false;
+            entries_[i].hash_next = (i + 1 < kNumBlocks) ? i + 1 : kInvalid;
+        }
+        free_head_ = 0;
+        lru_head_ = kInvalid;
+        lru_tail_ = kInvalid;
+        hits_ = 0;
+        misses_ = 0;
+        writebacks_ = 0;
+        flush_writes_ = 0;
+    }
+
+    /**
+     * Flush all dirty blocks, then drop every cached copy. Used when the
+     * device may change underneath the cache (raw access, remount).
+     */
+    int invalidate() {
+        int rc = sync();
+        reset(block_size_);
+        return rc;
+    }
+
+    int read(uint64_t lba, void* buf, uint32_t blocks) {
+        uint8_t* out = static_cast<uint8_t*>(buf);
+        for (uint32_t b = 0; b < blocks; ++b) {
+            uint32_t idx = lookup(lba + b);
+            if (idx == kInvalid) {
+                misses_++;
+                idx = insert(lba + b);
+                if (idx == kInvalid ||
+                    rse_block_read(lba + b, entries_[idx].data, 1) != 0) {
+                    if (idx != kInvalid) {
+                        removeEntry(idx);
+                    }
+                    return -1;
+                }
+            } else {
+                hits_++;
+            }
+            touch(idx);
+            std::memcpy(out, entries_[idx].data, block_size_);
+            out += block_size_;
+        }
+        return 0;
+    }
+
+    int write(uint64_t lba, const void* buf, uint32_t blocks) {
+        const uint8_t* in = static_cast<const uint8_t*>(buf);
+        for (uint32_t b = 0; b < blocks; ++b) {
+            // Full-block overwrite: no need to read the old contents
+            uint32_t idx = lookup(lba + b);
+            if (idx == kInvalid) {
+                idx = insert(lba + b);
+                if (idx == kInvalid) {
+                    return -1;
+                }
+            }
+            std::memcpy(entries_[idx].data, in, block_size_);
+            entries_[idx].dirty = true;
+            touch(idx);
+            in += block_size_;
+        }
+        return 0;
+    }
+
+    /**
+     * Write back every dirty block, LBA-sorted, contiguous runs coalesced
+     * into single device writes. Blocks stay cached (clean) afterwards.
+     */
+    int sync() {
+        uint32_t order[kNumBlocks];
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < kNumBlocks; ++i) {
+            if (entries_[i].valid && entries_[i].dirty) {
+                order[n++] = i;
+            }
+        }
+        // Insertion sort by LBA (n <= 128, mostly small)
+        for (uint32_t i = 1; i < n; ++i) {
+            uint32_t key = order[i];
+            uint32_t j = i;
+            while (j > 0 && entries_[order[j - 1]].lba > entries_[key].lba) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = key;
+        }
+
+        uint32_t i = 0;
+        while (i < n) {
+            // Extend the run while LBAs stay contiguous
+            uint32_t run = 1;
+            while (i + run < n && run < kRunBlocks &&
+                   entries_[order[i + run]].lba ==
+                       entries_[order[i]].lba + run) {
+                run++;
+            }
+            for (uint32_t r = 0; r < run; ++r) {
+                std::memcpy(scratch_ + (size_t)r * block_size_,
+                            entries_[order[i + r]].data, block_size_);
+            }
+            if (rse_block_write(entries_[order[i]].lba, scratch_, run) != 0) {
+                return -1;  // Blocks stay dirty; a later sync retries
+            }
+            flush_writes_++;
+            for (uint32_t r = 0; r < run; ++r) {
+                entries_[order[i + r]].dirty = false;
+            }
+            writebacks_ += run;
+            i += run;
+        }
+        return 0;
+    }
+
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+    uint32_t block_size() const { return block_size_; }
+
+    void printStats() const {
+        std::cout << "[BlockCache] hits=" << hits_
+                  << " misses=" << misses_
+                  << " writebacks=" << writebacks_
+                  << " flush_writes=" << flush_writes_
+                  << std::endl;
+    }
+
+private:
+    struct CacheBlock {
+        uint64_t lba;
+        uint32_t hash_next;  // Bucket chain, or free list when invalid
+        uint32_t lru_prev;
+        uint32_t lru_next;
+        bool valid;
+        bool dirty;
+        uint8_t data[kMaxBlockSize];
+    };
+
+    static uint32_t bucketFor(uint64_t lba) {
+        return (uint32_t)((lba * 2654435761u) >> 26) & (kNumBuckets - 1);
+    }
+
+    uint32_t lookup(uint64_t lba) const {
+        for (uint32_t idx = buckets_[bucketFor(lba)]; idx != kInvalid;
+             idx = entries_[idx].hash_next) {
+            if (entries_[idx].lba == lba) {
+                return idx;
+            }
+        }
+        return kInvalid;
+    }
+
+    // Claim a slot for lba (free list first, else evict LRU tail) and link
+    // it into its bucket and the LRU front. Contents are caller-filled.
+    uint32_t insert(uint64_t lba) {
+        uint32_t idx;
+        if (free_head_ != kInvalid) {
+            idx = free_head_;
+            free_head_ = entries_[idx].hash_next;
+        } else {
+            idx = lru_tail_;
+            if (idx == kInvalid) {
+                return kInvalid;
+            }
+            if (entries_[idx].dirty &&
+                rse_block_write(entries_[idx].lba, entries_[idx].data, 1) != 0) {
+                std::cerr << "[BlockCache] Writeback failed, dropping LBA "
+                          << entries_[idx].lba << std::endl;
+            } else if (entries_[idx].dirty) {
+                writebacks_++;
+                flush_writes_++;
+            }
+            unlink(idx);
+        }
+        entries_[idx].lba = lba;
+        entries_[idx].valid = true;
+        entries_[idx].dirty = false;
+        uint32_t bucket = bucketFor(lba);
+        entries_[idx].hash_next = buckets_[bucket];
+        buckets_[bucket] = idx;
+        lruPushFront(idx);
+        return idx;
+    }
+
+    void removeEntry(uint32_t idx) {
+        unlink(idx);
+        entries_[idx].hash_next = free_head_;
+        free_head_ = idx;
+    }
+
+    // Detach from bucket chain and LRU list
+    void unlink(uint32_t idx) {
+        uint32_t bucket = bucketFor(entries_[idx].lba);
+        uint32_t* link = &buckets_[bucket];
+        while (*link != kInvalid && *link != idx) {
+            link = &entries_[*link].hash_next;
+        }
+        if (*link == idx) {
+            *link = entries_[idx].hash_next;
+        }
+        lruRemove(idx);
+        entries_[idx].valid = false;
+        entries_[idx].dirty = false;
+    }
+
+    void lruPushFront(uint32_t idx) {
+        entries_[idx].lru_prev = kInvalid;
+        entries_[idx].lru_next = lru_head_;
+        if (lru_head_ != kInvalid) {
+            entries_[lru_head_].lru_prev = idx;
+        }
+        lru_head_ = idx;
+        if (lru_tail_ == kInvalid) {
+            lru_tail_ = idx;
+        }
+    }
+
+    void lruRemove(uint32_t idx) {
+        if (entries_[idx].lru_prev != kInvalid) {
+            entries_[entries_[idx].lru_prev].lru_next = entries_[idx].lru_next;
+        } else if (lru_head_ == idx) {
+            lru_head_ = entries_[idx].lru_next;
+        }
+        if (entries_[idx].lru_next != kInvalid) {
+            entries_[entries_[idx].lru_next].lru_prev = entries_[idx].lru_prev;
+        } else if (lru_tail_ == idx) {
+            lru_tail_ = entries_[idx].lru_prev;
+        }
+    }
+
+    void touch(uint32_t idx) {
+        if (lru_head_ == idx) {
+            return;
+        }
+        lruRemove(idx);
+        lruPushFront(idx);
+    }
+
+    CacheBlock entries_[kNumBlocks];
+    uint32_t buckets_[kNumBuckets];
+    uint32_t free_head_;
+    uint32_t lru_head_;
+    uint32_t lru_tail_;
+    uint32_t block_size_;
+    uint8_t scratch_[kRunBlocks * kMaxBlockSize];
+    uint64_t hits_;
+    uint64_t misses_;
+    uint64_t writebacks_;
+    uint64_t flush_writes_;
+};
+
+// One cache per block store (the store itself is global)
+inline BlockCache& block_cache() {
+    static BlockCache cache;
+    return cache;
+}
+
+/**
+ * Asynchronous single-block I/O requests. submit() stages a request and
+ * returns an id immediately; service() — called from the idle loop or a
+ * timer event — executes pending requests through the cache and marks
+ * them done, and the requester collects the result (and, for reads, the
+ * data) with poll(). Each request carries its own staging block, so
+ * completion never has to reach into the requester's address space: a
+ * blocked process's data waits in the slot until it wakes and polls.
+ */
+class BlockIOQueue {
+public:
+    static constexpr uint32_t kMaxRequests = 32;
+    static constexpr uint8_t kOpRead = 0;
+    static constexpr uint8_t kOpWrite = 1;
+
+    BlockIOQueue() : next_id_(1), pending_(0) {
+        for (uint32_t i = 0; i < kMaxRequests; ++i) {
+            slots_[i].state = State::FREE;
+        }
+    }
+
+    uint32_t pending() const { return pending_; }
+
+    /**
+     * Stage one block of I/O on `lba`. For writes, `src` supplies `len`
+     * bytes (a short `len` becomes read-modify-write at service time).
+     * Returns a positive request id, or -EAGAIN when the table is full.
+     */
+    int64_t submit(uint8_t op, uint64_t lba, const void* src, uint32_t len) {
+        uint32_t block_size = block_cache().block_size();
+        if (op > kOpWrite || len > block_size ||
+            (op == kOpWrite && (len == 0 || !src))) {
+            return -1;
+        }
+        for (uint32_t i = 0; i < kMaxRequests; ++i) {
+            if (slots_[i].state != State::FREE) {
+                continue;
+            }
+            Request& req = slots_[i];
+            req.state = State::PENDING;
+            req.op = op;
+            req.lba = lba;
+            req.len = (op == kOpWrite) ? len : block_size;
+            req.result = 0;
+            req.id = next_id_++;
+            if (next_id_ == 0) {
+                next_id_ = 1;
+            }
+            if (op == kOpWrite) {
+                std::memcpy(req.data, src, len);
+            }
+            pending_++;
+            return (int64_t)req.id;
+        }
+        return -2;  // Table full; caller retries after completions drain
+    }
+
+    /**
+     * Execute up to `max` pending requests in submission order, recording
+     * completed ids in `done_ids` (caller-sized to `max`). Returns the
+     * number completed. This is the polled completion path.
+     */
+    uint32_t service(uint32_t max, uint32_t* done_ids) {
+        uint32_t completed = 0;
+        uint32_t block_size = block_cache().block_size();
+        for (uint32_t i = 0; i < kMaxRequests && completed < max; ++i) {
+            Request& req = slots_[i];
+            if (req.state != State::PENDING) {
+                continue;
+            }
+            if (req.op == kOpRead) {
+                req.result = block_cache().read(req.lba, req.data, 1);
+            } else if (req.len == block_size) {
+                req.result = block_cache().write(req.lba, req.data, 1);
+            } else {
+                // Partial-block write: merge into the current contents
+                uint8_t merged[BlockCache::kMaxBlockSize];
+                req.result = block_cache().read(req.lba, merged, 1);
+                if (req.result == 0) {
+                    std::memcpy(merged, req.data, req.len);
+                    req.result = block_cache().write(req.lba, merged, 1);
+                }
+            }
+            req.state = State::DONE;
+            pending_--;
+            if (done_ids) {
+                done_ids[completed] = req.id;
+            }
+            completed++;
+        }
+        return completed;
+    }
+
+    /**
+     * Collect a completed request. Still pending → -2 (caller blocks and
+     * retries after wakeup); unknown id → -3. On completion the slot is
+     * freed and the result returned: bytes copied for reads, 0 for
+     * writes, -1 for device errors.
+     */
+    int64_t poll(uint32_t id, void* buf, uint32_t len) {
+        for (uint32_t i = 0; i < kMaxRequests; ++i) {
+            Request& req = slots_[i];
+            if (req.state == State::FREE || req.id != id) {
+                continue;
+            }
+            if (req.state == State::PENDING) {
+                return -2;
+            }
+            int64_t result = req.result;
+            if (result == 0 && req.op == kOpRead && buf && len != 0) {
+                uint32_t to_copy = len < req.len ? len : req.len;
+                std::memcpy(buf, req.data, to_copy);
+                result = (int64_t)to_copy;
+            }
+            req.state = State::FREE;
+            return result;
+        }
+        return -3;
+    }
+
+private:
+    enum class State : uint8_t { FREE, PENDING, DONE };
+
+    struct Request {
+        State state;
+        uint8_t op;
+        uint64_t lba;
+        uint32_t len;
+        int result;
+        uint32_t id;
+        uint8_t data[BlockCache::kMaxBlockSize];
+    };
+
+    Request slots_[kMaxRequests];
+    uint32_t next_id_;
+    uint32_t pending_;
+};
+
+inline BlockIOQueue& block_io_queue() {
+    static BlockIOQueue queue;
+    return queue;
+}
+
+// A run of contiguous data slots (and therefore contiguous LBAs)
+struct BlockFSExtent {
+    uint32_t start_slot;
+    uint32_t slot_count;
+};
+
 struct BlockFSEntry {
+    static constexpr uint32_t kMaxExtents = 4u;
+
     char name[32];
     uint32_t size;
-    uint32_t slot_index;
+    uint32_t slot_index;  // First data slot; mirrors extents[0].start_slot
     uint32_t checksum;
     uint8_t in_use;
-    uint8_t reserved[3];
+    uint8_t extent_count;
+    uint8_t reserved[2];
+    BlockFSExtent extents[kMaxExtents];
 };
 
 struct BlockFSHeader {
@@ -120,34 +866,46 @@ struct BlockFSHeader {
     uint64_t start_lba;
     uint64_t data_start_lba;
     uint64_t region_blocks;
-    uint32_t journal_active;
-    uint32_t journal_index;
-    uint32_t journal_crc;
+    uint32_t journal_slots;
     uint32_t reserved0;
-    BlockFSEntry journal_entry;
+    uint64_t journal_seq;  // Records below this are checkpointed
     uint32_t reserved[2];
 };
 
+/**
+ * One journaled metadata operation, one block per record. Records are
+ * self-describing (magic + seq + crc), so recovery never trusts a
+ * half-written block: replay walks forward from the header's checkpoint
+ * sequence and stops at the first record that fails validation.
+ */
+struct BlockFSJournalRecord {
+    uint32_t magic;
+    uint32_t index;  // Entry table index the record updates
+    uint64_t seq;
+    uint32_t crc;    // Over seq, index, and entry
+    uint32_t reserved;
+    BlockFSEntry entry;
+};
+
 class BlockFS {
 public:
     static constexpr uint32_t kMagic = 0x52534501u;
-    static constexpr uint32_t kVersion = 3u;
-    static constexpr uint32_t kMinVersion = 2u;
+    static constexpr uint32_t kVersion = 5u;
+    static constexpr uint32_t kMinVersion = 5u;  // v5 layout (journal region)
     static constexpr uint32_t kMaxFiles = 256u;
     static constexpr uint32_t kSlotBytes = 16384u;
     static constexpr uint32_t kNameMax = 31u;
     static constexpr uint32_t kGptGuardBlocks = 34u;
+    static constexpr uint32_t kJournalMagic = 0x524A4E4Cu;
+    static constexpr uint32_t kJournalSlots = 32u;  // One block per record
+    static constexpr uint32_t kGroupCommitOps = 8u;
 
     BlockFS() : mounted_(false), block_size_(0), slot_size_(0),
                 slot_blocks_(0), table_blocks_(0), start_lba_(0),
-                data_start_lba_(0), region_blocks_(0) {
-        for (uint32_t i = 0; i < kMaxFiles; ++i) {
-            entries_[i].name[0] = '\0';
-            entries_[i].size = 0;
-            entries_[i].slot_index = i;
-            entries_[i].checksum = 0;
-            entries_[i].in_use = 0;
-        }
+                journal_lba_(0), data_start_lba_(0), region_blocks_(0),
+                journal_next_seq_(0), pending_ops_(0) {
+        std::memset(entries_, 0, sizeof(entries_));
+        std::memset(slot_used_, 0, sizeof(slot_used_));
         std::memset(&header_, 0, sizeof(header_));
     }
 
@@ -162,12 +920,19 @@ public:
         slot_blocks_ = (kSlotBytes + block_size - 1u) / block_size;
         slot_size_ = slot_blocks_ * block_size;
         table_blocks_ = blocks_for_bytes(sizeof(BlockFSEntry) * kMaxFiles, block_size);
-        region_blocks_ = 1 + table_blocks_ + (uint64_t)slot_blocks_ * kMaxFiles;
+        region_blocks_ = 1 + kJournalSlots + table_blocks_ +
+                         (uint64_t)slot_blocks_ * kMaxFiles;
         if (total_blocks <= region_blocks_ + kGptGuardBlocks + 1) {
             return false;
         }
         start_lba_ = total_blocks - region_blocks_ - kGptGuardBlocks;
-        data_start_lba_ = start_lba_ + 1 + table_blocks_;
+        journal_lba_ = start_lba_ + 1;
+        data_start_lba_ = start_lba_ + 1 + kJournalSlots + table_blocks_;
+
+        // Drop any stale cached view of the device, then size the cache
+        // for this filesystem's blocks
+        block_cache().invalidate();
+        block_cache().reset(block_size);
 
         BlockFSHeader on_disk = {};
         if (!read_header(on_disk)) {
@@ -179,11 +944,7 @@ public:
                 return false;
             }
             apply_journal();
-            if (header_.version < kVersion) {
-                header_.version = kVersion;
-                clear_journal();
-                sync_header();
-            }
+            rebuild_slot_map();
             mounted_ = true;
             return true;
         }
@@ -253,9 +1014,27 @@ public:
         if (to_read == 0) {
             return 0;
         }
-        uint64_t file_off = offset;
-        uint64_t lba_base = data_start_lba_ + (uint64_t)entry->slot_index * slot_blocks_;
-        return block_read_at(lba_base, file_off, buf, to_read);
+        // One block_read_at per extent: inside an extent the LBAs are
+        // contiguous, so sequential reads stay sequential on the device
+        uint32_t done = 0;
+        while (done < to_read) {
+            uint64_t lba_base = 0;
+            uint64_t ext_off = 0;
+            uint64_t ext_bytes = 0;
+            if (!map_extent(entry, offset + done, &lba_base, &ext_off, &ext_bytes)) {
+                return -EIO;
+            }
+            uint32_t chunk = to_read - done;
+            if ((uint64_t)chunk > ext_bytes) {
+                chunk = (uint32_t)ext_bytes;
+            }
+            int64_t got = block_read_at(lba_base, ext_off, buf + done, chunk);
+            if (got < 0) {
+                return got;
+            }
+            done += chunk;
+        }
+        return to_read;
     }
 
     int64_t write(BlockFSEntry* entry, uint64_t offset, const uint8_t* buf, uint32_t count) {
@@ -265,20 +1044,47 @@ public:
         if (!entry->in_use) {
             return -EINVAL;
         }
-        if (offset >= slot_size_) {
+        uint64_t max_bytes = (uint64_t)kMaxFiles * slot_size_;  // Whole data pool
+        if (offset >= max_bytes) {
             return 0;
         }
         uint32_t remaining = count;
-        uint64_t max_len = slot_size_ - offset;
+        uint64_t max_len = max_bytes - offset;
         if (remaining > max_len) {
             remaining = (uint32_t)max_len;
         }
         if (remaining == 0) {
             return 0;
         }
-        uint64_t file_off = offset;
-        uint64_t lba_base = data_start_lba_ + (uint64_t)entry->slot_index * slot_blocks_;
-        int64_t wrote = block_write_at(lba_base, file_off, buf, remaining);
+        // Grow the extent table to cover the write; a partial grow caps
+        // the write at whatever capacity was reached
+        int grow = ensure_capacity(entry, offset + remaining);
+        if (grow != 0) {
+            uint64_t cap = capacity_of(entry);
+            if (offset >= cap) {
+                return grow;
+            }
+            remaining = (uint32_t)(cap - offset);
+        }
+        uint32_t done = 0;
+        while (done < remaining) {
+            uint64_t lba_base = 0;
+            uint64_t ext_off = 0;
+            uint64_t ext_bytes = 0;
+            if (!map_extent(entry, offset + done, &lba_base, &ext_off, &ext_bytes)) {
+                return -EIO;
+            }
+            uint32_t chunk = remaining - done;
+            if ((uint64_t)chunk > ext_bytes) {
+                chunk = (uint32_t)ext_bytes;
+            }
+            int64_t put = block_write_at(lba_base, ext_off, buf + done, chunk);
+            if (put < 0) {
+                return put;
+            }
+            done += chunk;
+        }
+        int64_t wrote = done;
         if (wrote > 0) {
             uint64_t new_size = offset + (uint64_t)wrote;
             if (new_size > entry->size) {
@@ -304,6 +1110,7 @@ public:
         }
         entry->size = 0;
         entry->checksum = 0;
+        release_slots(entry);
         uint32_t index = (uint32_t)(entry - entries_);
         if (!commit_entry(index)) {
             return -EIO;
@@ -323,6 +1130,7 @@ public:
         entry->size = 0;
         entry->checksum = 0;
         entry->in_use = 0;
+        release_slots(entry);
         uint32_t index = (uint32_t)(entry - entries_);
         if (!commit_entry(index)) {
             return false;
@@ -330,6 +1138,20 @@ public:
         return true;
     }
 
+    /**
+     * Group commit: one cache flush makes every operation journaled since
+     * the last commit durable, then a checkpoint folds them into the
+     * entry table and retires their journal records. commit_entry calls
+     * this every kGroupCommitOps operations; the idle/timer path calls it
+     * so a quiet batch never lingers. A no-op when nothing is pending.
+     */
+    int sync() {
+        if (!mounted_) {
+            return -EINVAL;
+        }
+        return group_commit();
+    }
+
     void printStats() const {
         if (!mounted_) {
             std::cout << "[BlockFS] not mounted" << std::endl;
@@ -379,10 +1201,14 @@ private:
     uint32_t slot_blocks_;
     uint32_t table_blocks_;
     uint64_t start_lba_;
+    uint64_t journal_lba_;
     uint64_t data_start_lba_;
     uint64_t region_blocks_;
+    uint64_t journal_next_seq_;  // Next record sequence to append
+    uint32_t pending_ops_;       // Journaled ops since the last commit
     BlockFSHeader header_;
     BlockFSEntry entries_[kMaxFiles];
+    uint8_t slot_used_[kMaxFiles];  // Data-slot pool map, rebuilt at mount
 
     static uint32_t blocks_for_bytes(uint32_t bytes, uint32_t block_size) {
         return (bytes + block_size - 1u) / block_size;
@@ -395,17 +1221,13 @@ private:
                hdr.block_size == block_size_ &&
                hdr.slot_size == slot_size_ &&
                hdr.max_files == kMaxFiles &&
-               hdr.table_blocks == table_blocks_;
+               hdr.table_blocks == table_blocks_ &&
+               hdr.journal_slots == kJournalSlots;
     }
 
     void init_fresh() {
-        for (uint32_t i = 0; i < kMaxFiles; ++i) {
-            entries_[i].name[0] = '\0';
-            entries_[i].size = 0;
-            entries_[i].slot_index = i;
-            entries_[i].checksum = 0;
-            entries_[i].in_use = 0;
-        }
+        std::memset(entries_, 0, sizeof(entries_));
+        std::memset(slot_used_, 0, sizeof(slot_used_));
         header_.magic = kMagic;
         header_.version = kVersion;
         header_.block_size = block_size_;
@@ -415,6 +1237,7 @@ private:
         header_.start_lba = start_lba_;
         header_.data_start_lba = data_start_lba_;
         header_.region_blocks = region_blocks_;
+        header_.journal_slots = kJournalSlots;
         clear_journal();
         sync_header();
         sync_entries();
@@ -425,7 +1248,7 @@ private:
         if (!scratch) {
             return false;
         }
-        if (rse_block_read(start_lba_, scratch, 1) != 0) {
+        if (block_cache().read(start_lba_, scratch, 1) != 0) {
             delete[] scratch;
             return false;
         }
@@ -441,7 +1264,11 @@ private:
         }
         std::memset(scratch, 0, block_size_);
         std::memcpy(scratch, &header_, sizeof(BlockFSHeader));
-        rse_block_write(start_lba_, scratch, 1);
+        // Write-through: the header carries the journal checkpoint, and
+        // replay correctness depends on it reaching the device before the
+        // retired records are reused
+        block_cache().write(start_lba_, scratch, 1);
+        block_cache().sync();
         delete[] scratch;
     }
 
@@ -452,7 +1279,7 @@ private:
         if (!scratch) {
             return false;
         }
-        if (rse_block_read(start_lba_ + 1, scratch, blocks) != 0) {
+        if (block_cache().read(start_lba_ + 1 + kJournalSlots, scratch, blocks) != 0) {
             delete[] scratch;
             return false;
         }
@@ -470,7 +1297,10 @@ private:
         }
         std::memset(scratch, 0, (size_t)blocks * block_size_);
         std::memcpy(scratch, entries_, bytes);
-        rse_block_write(start_lba_ + 1, scratch, blocks);
+        // Write-through for the same reason as sync_header: the journal
+        // replay contract orders table updates against the header
+        block_cache().write(start_lba_ + 1 + kJournalSlots, scratch, blocks);
+        block_cache().sync();
         delete[] scratch;
     }
 
@@ -486,14 +1316,134 @@ private:
     BlockFSEntry* find_free() {
         for (uint32_t i = 0; i < kMaxFiles; ++i) {
             if (!entries_[i].in_use) {
-                entries_[i].slot_index = i;
+                entries_[i].slot_index = 0;
                 entries_[i].checksum = 0;
+                entries_[i].extent_count = 0;
+                std::memset(entries_[i].extents, 0, sizeof(entries_[i].extents));
                 return &entries_[i];
             }
         }
         return nullptr;
     }
 
+    void rebuild_slot_map() {
+        std::memset(slot_used_, 0, sizeof(slot_used_));
+        for (uint32_t i = 0; i < kMaxFiles; ++i) {
+            if (!entries_[i].in_use) {
+                continue;
+            }
+            for (uint32_t e = 0; e < entries_[i].extent_count; ++e) {
+                const BlockFSExtent& ext = entries_[i].extents[e];
+                for (uint32_t s = 0; s < ext.slot_count; ++s) {
+                    if (ext.start_slot + s < kMaxFiles) {
+                        slot_used_[ext.start_slot + s] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    uint64_t capacity_of(const BlockFSEntry* entry) const {
+        uint64_t slots = 0;
+        for (uint32_t e = 0; e < entry->extent_count; ++e) {
+            slots += entry->extents[e].slot_count;
+        }
+        return slots * slot_size_;
+    }
+
+    /**
+     * Find the extent covering offset. Returns the extent's base LBA, the
+     * byte offset within the extent, and the contiguous bytes from there
+     * to the extent's end (one device run).
+     */
+    bool map_extent(const BlockFSEntry* entry, uint64_t offset,
+                    uint64_t* lba_base, uint64_t* ext_off,
+                    uint64_t* ext_bytes) const {
+        uint64_t span_start = 0;
+        for (uint32_t e = 0; e < entry->extent_count; ++e) {
+            const BlockFSExtent& ext = entry->extents[e];
+            uint64_t bytes = (uint64_t)ext.slot_count * slot_size_;
+            if (offset < span_start + bytes) {
+                *lba_base = data_start_lba_ + (uint64_t)ext.start_slot * slot_blocks_;
+                *ext_off = offset - span_start;
+                *ext_bytes = bytes - *ext_off;
+                return true;
+            }
+            span_start += bytes;
+        }
+        return false;
+    }
+
+    /**
+     * Grow the file's extents until capacity covers bytes. Each new slot
+     * extends the last extent when the next slot is free (keeping runs
+     * contiguous), otherwise opens a new extent at the first free slot.
+     */
+    int ensure_capacity(BlockFSEntry* entry, uint64_t bytes) {
+        while (capacity_of(entry) < bytes) {
+            uint32_t slot = kMaxFiles;
+            if (entry->extent_count > 0) {
+                BlockFSExtent& last = entry->extents[entry->extent_count - 1];
+                uint32_t next = last.start_slot + last.slot_count;
+                if (next < kMaxFiles && !slot_used_[next]) {
+                    slot_used_[next] = 1;
+                    last.slot_count++;
+                    zero_slot(next);
+                    continue;
+                }
+            }
+            if (entry->extent_count >= BlockFSEntry::kMaxExtents) {
+                return -ENOSPC;
+            }
+            for (uint32_t s = 0; s < kMaxFiles; ++s) {
+                if (!slot_used_[s]) {
+                    slot = s;
+                    break;
+                }
+            }
+            if (slot == kMaxFiles) {
+                return -ENOSPC;
+            }
+            slot_used_[slot] = 1;
+            entry->extents[entry->extent_count].start_slot = slot;
+            entry->extents[entry->extent_count].slot_count = 1;
+            entry->extent_count++;
+            if (entry->extent_count == 1) {
+                entry->slot_index = slot;
+            }
+            zero_slot(slot);
+        }
+        return 0;
+    }
+
+    void release_slots(BlockFSEntry* entry) {
+        for (uint32_t e = 0; e < entry->extent_count; ++e) {
+            const BlockFSExtent& ext = entry->extents[e];
+            for (uint32_t s = 0; s < ext.slot_count; ++s) {
+                if (ext.start_slot + s < kMaxFiles) {
+                    slot_used_[ext.start_slot + s] = 0;
+                }
+            }
+        }
+        entry->extent_count = 0;
+        std::memset(entry->extents, 0, sizeof(entry->extents));
+    }
+
+    // Slots are recycled between files; scrub before reuse so freshly
+    // grown regions never expose a previous file's data
+    void zero_slot(uint32_t slot) {
+        uint8_t* scratch = new uint8_t[block_size_];
+        if (!scratch) {
+            return;
+        }
+        std::memset(scratch, 0, block_size_);
+        uint64_t lba = data_start_lba_ + (uint64_t)slot * slot_blocks_;
+        for (uint32_t b = 0; b < slot_blocks_; ++b) {
+            block_cache().write(lba + b, scratch, 1);
+        }
+        delete[] scratch;
+    }
+
     static void write_name(char* dst, const char* src) {
         uint32_t i = 0;
         for (; src[i] && i < kNameMax; ++i) {
@@ -513,53 +1463,131 @@ private:
         return true;
     }
 
+    // Scrub the journal region so stale records from a previous format
+    // can never validate against a fresh checkpoint sequence
     void clear_journal() {
-        header_.journal_active = 0;
-        header_.journal_index = 0;
-        header_.journal_crc = 0;
-        std::memset(&header_.journal_entry, 0, sizeof(header_.journal_entry));
+        header_.journal_seq = 0;
+        journal_next_seq_ = 0;
+        pending_ops_ = 0;
+        uint8_t* scratch = new uint8_t[block_size_];
+        if (!scratch) {
+            return;
+        }
+        std::memset(scratch, 0, block_size_);
+        for (uint32_t i = 0; i < kJournalSlots; ++i) {
+            block_cache().write(journal_lba_ + i, scratch, 1);
+        }
+        delete[] scratch;
     }
 
-    uint32_t entry_crc(const BlockFSEntry& entry) const {
+    uint32_t record_crc(const BlockFSJournalRecord& rec) const {
         static constexpr uint32_t kOffset = 2166136261u;
-        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&entry);
-        return fnv1a_update(kOffset, bytes, (uint32_t)sizeof(BlockFSEntry));
+        uint32_t hash = fnv1a_update(
+            kOffset, reinterpret_cast<const uint8_t*>(&rec.seq),
+            (uint32_t)sizeof(rec.seq));
+        hash = fnv1a_update(hash, reinterpret_cast<const uint8_t*>(&rec.index),
+                            (uint32_t)sizeof(rec.index));
+        return fnv1a_update(hash, reinterpret_cast<const uint8_t*>(&rec.entry),
+                            (uint32_t)sizeof(rec.entry));
+    }
+
+    bool write_journal_record(const BlockFSJournalRecord& rec) {
+        uint8_t* scratch = new uint8_t[block_size_];
+        if (!scratch) {
+            return false;
+        }
+        std::memset(scratch, 0, block_size_);
+        std::memcpy(scratch, &rec, sizeof(rec));
+        int rc = block_cache().write(journal_lba_ + (rec.seq % kJournalSlots),
+                                     scratch, 1);
+        delete[] scratch;
+        return rc == 0;
     }
 
+    /**
+     * Mount-time recovery: replay the run of valid records starting at
+     * the header's checkpoint sequence. The first record whose magic,
+     * sequence, or crc fails ends the run — everything past a torn write
+     * was never acknowledged as committed.
+     */
     void apply_journal() {
-        if (header_.journal_active == 0) {
+        journal_next_seq_ = header_.journal_seq;
+        pending_ops_ = 0;
+        uint8_t* scratch = new uint8_t[block_size_];
+        if (!scratch) {
             return;
         }
-        if (header_.journal_index >= kMaxFiles) {
-            clear_journal();
-            sync_header();
-            return;
+        bool replayed = false;
+        for (uint32_t i = 0; i < kJournalSlots; ++i) {
+            uint64_t seq = header_.journal_seq + i;
+            if (block_cache().read(journal_lba_ + (seq % kJournalSlots),
+                                   scratch, 1) != 0) {
+                break;
+            }
+            BlockFSJournalRecord rec;
+            std::memcpy(&rec, scratch, sizeof(rec));
+            if (rec.magic != kJournalMagic || rec.seq != seq ||
+                rec.index >= kMaxFiles || record_crc(rec) != rec.crc) {
+                break;
+            }
+            entries_[rec.index] = rec.entry;
+            journal_next_seq_ = seq + 1;
+            replayed = true;
         }
-        if (entry_crc(header_.journal_entry) != header_.journal_crc) {
-            clear_journal();
+        delete[] scratch;
+        if (replayed) {
+            sync_entries();
+            header_.journal_seq = journal_next_seq_;
             sync_header();
-            return;
         }
-        header_.journal_entry.slot_index = header_.journal_index;
-        entries_[header_.journal_index] = header_.journal_entry;
-        sync_entries();
-        clear_journal();
-        sync_header();
     }
 
+    /**
+     * Journal one entry update. The record (and any file data behind it)
+     * stays in the write-back cache until the group commits — durability
+     * is batched, not per-operation.
+     */
     bool commit_entry(uint32_t index) {
         if (index >= kMaxFiles) {
             return false;
         }
-        header_.journal_active = 1;
-        header_.journal_index = index;
-        header_.journal_entry = entries_[index];
-        header_.journal_crc = entry_crc(header_.journal_entry);
-        sync_header();
+        // A full journal forces the batch out before appending
+        if (journal_next_seq_ - header_.journal_seq >= kJournalSlots &&
+            group_commit() != 0) {
+            return false;
+        }
+        BlockFSJournalRecord rec = {};
+        rec.magic = kJournalMagic;
+        rec.index = index;
+        rec.seq = journal_next_seq_;
+        rec.entry = entries_[index];
+        rec.crc = record_crc(rec);
+        if (!write_journal_record(rec)) {
+            return false;
+        }
+        journal_next_seq_++;
+        pending_ops_++;
+        if (pending_ops_ >= kGroupCommitOps) {
+            return group_commit() == 0;
+        }
+        return true;
+    }
+
+    int group_commit() {
+        if (pending_ops_ == 0 && journal_next_seq_ == header_.journal_seq) {
+            return 0;
+        }
+        // One flush covers the whole batch: file data and journal records
+        // reach the device together, and only then does the checkpoint
+        // retire the records
+        if (block_cache().sync() != 0) {
+            return -EIO;
+        }
         sync_entries();
-        clear_journal();
+        header_.journal_seq = journal_next_seq_;
         sync_header();
-        return true;
+        pending_ops_ = 0;
+        return 0;
     }
 
     int64_t block_read_at(uint64_t base_lba, uint64_t offset, uint8_t* buf, uint32_t count) {
@@ -577,7 +1605,7 @@ private:
         }
 
         if (block_off != 0) {
-            if (rse_block_read(lba, scratch, 1) != 0) {
+            if (block_cache().read(lba, scratch, 1) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -594,7 +1622,7 @@ private:
         uint32_t full_bytes = (remaining / block_size_) * block_size_;
         if (full_bytes > 0) {
             uint32_t blocks = full_bytes / block_size_;
-            if (rse_block_read(lba, out, blocks) != 0) {
+            if (block_cache().read(lba, out, blocks) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -604,7 +1632,7 @@ private:
         }
 
         if (remaining > 0) {
-            if (rse_block_read(lba, scratch, 1) != 0) {
+            if (block_cache().read(lba, scratch, 1) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -631,7 +1659,7 @@ private:
         }
 
         if (block_off != 0) {
-            if (rse_block_read(lba, scratch, 1) != 0) {
+            if (block_cache().read(lba, scratch, 1) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -640,7 +1668,7 @@ private:
                 take = remaining;
             }
             std::memcpy(scratch + block_off, in, take);
-            if (rse_block_write(lba, scratch, 1) != 0) {
+            if (block_cache().write(lba, scratch, 1) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -652,7 +1680,7 @@ private:
         uint32_t full_bytes = (remaining / block_size_) * block_size_;
         if (full_bytes > 0) {
             uint32_t blocks = full_bytes / block_size_;
-            if (rse_block_write(lba, in, blocks) != 0) {
+            if (block_cache().write(lba, in, blocks) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -662,12 +1690,12 @@ private:
         }
 
         if (remaining > 0) {
-            if (rse_block_read(lba, scratch, 1) != 0) {
+            if (block_cache().read(lba, scratch, 1) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
             std::memcpy(scratch, in, remaining);
-            if (rse_block_write(lba, scratch, 1) != 0) {
+            if (block_cache().write(lba, scratch, 1) != 0) {
                 delete[] scratch;
                 return -EIO;
             }
@@ -703,18 +1731,27 @@ private:
         uint32_t hash = kOffset;
         uint64_t remaining = entry->size;
         uint64_t offset = 0;
-        uint64_t lba_base = data_start_lba_ + (uint64_t)entry->slot_index * slot_blocks_;
         while (remaining > 0) {
-            uint64_t lba = lba_base + (offset / block_size_);
-            if (rse_block_read(lba, scratch, 1) != 0) {
+            uint64_t lba_base = 0;
+            uint64_t ext_off = 0;
+            uint64_t ext_bytes = 0;
+            if (!map_extent(entry, offset, &lba_base, &ext_off, &ext_bytes)) {
                 delete[] scratch;
                 return false;
             }
-            uint32_t block_off = (uint32_t)(offset % block_size_);
+            uint64_t lba = lba_base + (ext_off / block_size_);
+            if (block_cache().read(lba, scratch, 1) != 0) {
+                delete[] scratch;
+                return false;
+            }
+            uint32_t block_off = (uint32_t)(ext_off % block_size_);
             uint32_t take = block_size_ - block_off;
             if (take > remaining) {
                 take = (uint32_t)remaining;
             }
+            if ((uint64_t)take > ext_bytes) {
+                take = (uint32_t)ext_bytes;
+            }
             hash = fnv1a_update(hash, scratch + block_off, take);
             remaining -= take;
             offset += take;
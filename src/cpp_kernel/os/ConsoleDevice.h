@@ -20,22 +20,96 @@ namespace os {
 
 /**
  * Console device private data.
+ *
+ * Output is staged in a ring and drained in batches: writes complete as
+ * soon as their bytes are buffered, and the actual sink (UART in kernel
+ * builds, stdout on the host) is fed by console_flush — called from the
+ * idle path or a timer event, from close, or via CONSOLE_IOCTL_FLUSH.
+ * When the ring crosses the high watermark a write drains it down to
+ * the low watermark synchronously instead of blocking outright, so a
+ * chatty process pays for its own backlog in bounded slices.
  */
 struct ConsoleData {
+    static constexpr uint32_t OUTPUT_SIZE = 4096;   // Power of two
+    static constexpr uint32_t OUTPUT_MASK = OUTPUT_SIZE - 1;
+    static constexpr uint32_t OUTPUT_HIGH = (OUTPUT_SIZE * 3) / 4;
+    static constexpr uint32_t OUTPUT_LOW = OUTPUT_SIZE / 4;
+
     char input_buffer[1024];   // Line buffer for input
     uint32_t input_size;       // Current size of input buffer
     uint32_t input_pos;        // Current read position
     bool has_input;            // Is there buffered input?
-    
-    ConsoleData() : input_size(0), input_pos(0), has_input(false) {
+
+    char output_buffer[OUTPUT_SIZE];
+    uint32_t out_head;         // Next byte to drain (free-running)
+    uint32_t out_tail;         // Next free slot (free-running)
+    uint64_t bytes_flushed;    // Total bytes pushed to the sink
+
+    ConsoleData()
+        : input_size(0), input_pos(0), has_input(false),
+          out_head(0), out_tail(0), bytes_flushed(0) {
         input_buffer[0] = '\0';
     }
+
+    uint32_t outputPending() const {
+        return out_tail - out_head;
+    }
 };
 
 /**
  * Console device operations.
  */
 
+// Push buffered bytes to the real sink. Kernel builds feed the serial
+// port in chunks instead of a call per character.
+void console_sink(const char* buf, size_t count) {
+#ifdef RSE_KERNEL
+    char chunk[129];
+    while (count > 0) {
+        size_t n = count < sizeof(chunk) - 1 ? count : sizeof(chunk) - 1;
+        memcpy(chunk, buf, n);
+        chunk[n] = '\0';
+        serial_write(chunk);
+        buf += n;
+        count -= n;
+    }
+#else
+    std::cout.write(buf, count);
+    std::cout.flush();
+#endif
+}
+
+/**
+ * Drain up to max_bytes of buffered output. Returns bytes drained.
+ * This is the deferred half of console_write — idle loops and timer
+ * events call it with a bounded budget; close and the flush ioctl call
+ * it unbounded.
+ */
+uint32_t console_flush(Device* dev, uint32_t max_bytes = 0xFFFFFFFFu) {
+    if (!dev || !dev->private_data) {
+        return 0;
+    }
+    ConsoleData* data = (ConsoleData*)dev->private_data;
+    uint32_t to_drain = data->outputPending();
+    if (to_drain > max_bytes) {
+        to_drain = max_bytes;
+    }
+    uint32_t drained = 0;
+    while (drained < to_drain) {
+        uint32_t idx = data->out_head & ConsoleData::OUTPUT_MASK;
+        uint32_t contiguous = ConsoleData::OUTPUT_SIZE - idx;
+        uint32_t n = to_drain - drained;
+        if (n > contiguous) {
+            n = contiguous;
+        }
+        console_sink(&data->output_buffer[idx], n);
+        data->out_head += n;
+        drained += n;
+    }
+    data->bytes_flushed += drained;
+    return drained;
+}
+
 // Open console
 int console_open(Device* dev) {
     (void)dev;
@@ -45,7 +119,7 @@ int console_open(Device* dev) {
 
 // Close console
 int console_close(Device* dev) {
-    (void)dev;
+    console_flush(dev);
     std::cout << "[Console] Closed" << std::endl;
     return 0;
 }
@@ -97,33 +171,63 @@ ssize_t console_read(Device* dev, void* buf, size_t count) {
 #endif
 }
 
-// Write to console (stdout/stderr)
+// Write to console (stdout/stderr): stage bytes in the output ring and
+// return immediately; the sink is fed later by console_flush. Crossing
+// the high watermark drains down to the low watermark in-line so the
+// backlog stays bounded without ever hard-blocking the writer.
 ssize_t console_write(Device* dev, const void* buf, size_t count) {
-    (void)dev;
-#ifdef RSE_KERNEL
-    const char* data = (const char*)buf;
-    for (size_t i = 0; i < count; ++i) {
-        char tmp[2] = {data[i], '\0'};
-        serial_write(tmp);
+    if (!dev || !dev->private_data || !buf) {
+        return -1;
     }
-    return (ssize_t)count;
-#else
-    // Write directly to stdout (no buffering for simplicity)
-    std::cout.write((const char*)buf, count);
-    std::cout.flush();
-    
-    return count;
-#endif
+    ConsoleData* data = (ConsoleData*)dev->private_data;
+    const char* src = (const char*)buf;
+    size_t total = 0;
+    while (total < count) {
+        uint32_t pending = data->outputPending();
+        if (pending >= ConsoleData::OUTPUT_HIGH) {
+            console_flush(dev, pending - ConsoleData::OUTPUT_LOW);
+            pending = data->outputPending();
+        }
+        uint32_t room = ConsoleData::OUTPUT_SIZE - pending;
+        uint32_t idx = data->out_tail & ConsoleData::OUTPUT_MASK;
+        uint32_t contiguous = ConsoleData::OUTPUT_SIZE - idx;
+        uint32_t n = (uint32_t)(count - total);
+        if (n > room) {
+            n = room;
+        }
+        if (n > contiguous) {
+            n = contiguous;
+        }
+        memcpy(&data->output_buffer[idx], src + total, n);
+        data->out_tail += n;
+        total += n;
+    }
+    return (ssize_t)total;
 }
 
 constexpr unsigned long CONSOLE_IOCTL_GET_PENDING = 0x52534510ul;
 constexpr unsigned long CONSOLE_IOCTL_CLEAR_INPUT = 0x52534511ul;
+constexpr unsigned long CONSOLE_IOCTL_FLUSH = 0x52534512ul;
+constexpr unsigned long CONSOLE_IOCTL_GET_OUTPUT_PENDING = 0x52534513ul;
 
 // ioctl
 int console_ioctl(Device* dev, unsigned long request, void* arg) {
     if (!dev) {
         return -1;
     }
+    // Output-side requests are build-independent
+    if (request == CONSOLE_IOCTL_FLUSH) {
+        console_flush(dev);
+        return 0;
+    }
+    if (request == CONSOLE_IOCTL_GET_OUTPUT_PENDING) {
+        ConsoleData* data = (ConsoleData*)dev->private_data;
+        if (!data || !arg) {
+            return -1;
+        }
+        *static_cast<uint32_t*>(arg) = data->outputPending();
+        return 0;
+    }
 #ifdef RSE_KERNEL
     (void)arg;
     if (request == CONSOLE_IOCTL_GET_PENDING) {
@@ -191,6 +295,9 @@ Device* create_console_device() {
     data->input_pos = 0;
     data->has_input = false;
     data->input_buffer[0] = '\0';
+    data->out_head = 0;
+    data->out_tail = 0;
+    data->bytes_flushed = 0;
 
     strncpy(dev->name, "console", sizeof(dev->name) - 1);
     return dev;
@@ -215,6 +322,7 @@ Device* create_console_device() {
  * Destroy console device.
  */
 void destroy_console_device(Device* dev) {
+    console_flush(dev);
     if (dev->private_data) {
         delete (ConsoleData*)dev->private_data;
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Syscall.h"
 #include <cstdint>
 #include <cstddef>
 #include <cstring>
@@ -34,6 +35,10 @@ typedef int (*DeviceCloseFunc)(Device* dev);
 typedef ssize_t (*DeviceReadFunc)(Device* dev, void* buf, size_t count);
 typedef ssize_t (*DeviceWriteFunc)(Device* dev, const void* buf, size_t count);
 typedef int (*DeviceIoctlFunc)(Device* dev, unsigned long request, void* arg);
+// Scatter-gather variants: drivers that set these consume the segment
+// list in one pass instead of being called once per segment
+typedef ssize_t (*DeviceReadvFunc)(Device* dev, const rse_iovec* iov, int iovcnt);
+typedef ssize_t (*DeviceWritevFunc)(Device* dev, const rse_iovec* iov, int iovcnt);
 
 /**
  * Device structure.
@@ -49,10 +54,13 @@ struct Device {
     DeviceReadFunc read;
     DeviceWriteFunc write;
     DeviceIoctlFunc ioctl;
-    
-    Device() 
+    DeviceReadvFunc readv;     // Optional; nullptr falls back to read
+    DeviceWritevFunc writev;   // Optional; nullptr falls back to write
+
+    Device()
         : type(DeviceType::CHARACTER), private_data(nullptr),
-          open(nullptr), close(nullptr), read(nullptr), write(nullptr), ioctl(nullptr) {
+          open(nullptr), close(nullptr), read(nullptr), write(nullptr), ioctl(nullptr),
+          readv(nullptr), writev(nullptr) {
         name[0] = '\0';
     }
 };
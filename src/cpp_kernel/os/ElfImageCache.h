@@ -0,0 +1,257 @@
+#pragma once
+
+#include <cstring>
+#include "ElfLoader.h"
+#include "PageTable.h"
+#include "PhysicalAllocator.h"
+#include "../FixedStructures.h"
+#ifdef RSE_KERNEL
+#include "KernelStubs.h"
+#else
+#include <iostream>
+#endif
+
+/**
+ * ElfImageCache: warm-exec cache of parsed ELF images, keyed by VFS path.
+ *
+ * The first exec of a binary parses it once and stages its read-only
+ * PT_LOAD segments into cache-owned frames; every subsequent exec maps
+ * those frames copy-on-write into the new process and copies only the
+ * writable segments' initialization bytes - no VFS read, no parse, no
+ * text/rodata memcpy.
+ *
+ * Bounded: an image that exceeds the per-entry frame or data budget is
+ * simply not cached and keeps taking the cold path. Entries are never
+ * evicted while the cache lives, because running processes may still map
+ * their frames.
+ */
+
+namespace os {
+
+class ElfImageCache {
+public:
+    static constexpr uint32_t MAX_IMAGES = 8;
+    static constexpr uint32_t MAX_PATH = 64;
+    static constexpr uint32_t MAX_SHARED_FRAMES = 64;   // 256KB of ro segments
+    static constexpr uint32_t MAX_DATA_BYTES = 16384;
+
+    // Read-only segment backed by shared cache frames
+    struct SharedRange {
+        uint64_t vaddr;
+        uint64_t memsz;
+        uint32_t flags;
+        uint32_t first_frame;
+        uint32_t page_count;
+    };
+
+    // Writable segment: initialization bytes copied into each process
+    struct DataRange {
+        uint64_t vaddr;
+        uint64_t memsz;
+        uint64_t filesz;
+        uint32_t flags;
+        uint32_t data_off;
+    };
+
+    struct CachedElf {
+        bool valid = false;
+        char path[MAX_PATH] = {};
+        uint64_t entry = 0;
+        FixedVector<SharedRange, 8> ro_ranges;
+        FixedVector<DataRange, 8> data_ranges;
+        uint64_t frames[MAX_SHARED_FRAMES] = {};
+        uint32_t frame_count = 0;
+        uint8_t data_bytes[MAX_DATA_BYTES] = {};
+        uint32_t data_used = 0;
+        uint64_t hits = 0;
+    };
+
+    explicit ElfImageCache(PhysicalAllocator* phys_alloc)
+        : phys_alloc_(phys_alloc) {}
+
+    ElfImageCache(const ElfImageCache&) = delete;
+    ElfImageCache& operator=(const ElfImageCache&) = delete;
+
+    ~ElfImageCache() {
+        for (uint32_t i = 0; i < MAX_IMAGES; i++) {
+            release(entries_[i]);
+        }
+    }
+
+    /**
+     * Look up a cached image by path. Counts a hit when found.
+     */
+    CachedElf* lookup(const char* path) {
+        if (!path) {
+            return nullptr;
+        }
+        for (uint32_t i = 0; i < MAX_IMAGES; i++) {
+            if (entries_[i].valid &&
+                std::strncmp(entries_[i].path, path, MAX_PATH) == 0) {
+                entries_[i].hits++;
+                return &entries_[i];
+            }
+        }
+        misses_++;
+        return nullptr;
+    }
+
+    /**
+     * Parse and stage an image for future warm execs. Returns nullptr -
+     * leaving cold-path behavior untouched - when the cache is full, the
+     * path is too long, the image does not parse, or it exceeds the frame
+     * or data budget.
+     */
+    CachedElf* insert(const char* path, const uint8_t* data, size_t size) {
+        if (!path || !data || size == 0 || !phys_alloc_) {
+            return nullptr;
+        }
+        if (std::strlen(path) >= MAX_PATH) {
+            return nullptr;
+        }
+        CachedElf* slot = nullptr;
+        for (uint32_t i = 0; i < MAX_IMAGES; i++) {
+            if (!entries_[i].valid) {
+                slot = &entries_[i];
+                break;
+            }
+        }
+        if (!slot) {
+            return nullptr;
+        }
+
+        ElfImage image = {};
+        ElfLoadError err = ElfLoadError::kOk;
+        if (!parseElf64(data, size, image, &err)) {
+            return nullptr;
+        }
+
+        std::strncpy(slot->path, path, MAX_PATH - 1);
+        slot->entry = image.entry;
+
+        for (size_t i = 0; i < image.segments.size(); ++i) {
+            const ElfSegment& seg = image.segments[i];
+            if (seg.flags & PF_W) {
+                if (!stageDataSegment(*slot, seg, data)) {
+                    release(*slot);
+                    return nullptr;
+                }
+            } else {
+                if (!stageSharedSegment(*slot, seg, data)) {
+                    release(*slot);
+                    return nullptr;
+                }
+            }
+        }
+
+        slot->valid = true;
+        return slot;
+    }
+
+    void printStats() const {
+        uint32_t images = 0;
+        uint64_t frames = 0;
+        uint64_t hits = 0;
+        for (uint32_t i = 0; i < MAX_IMAGES; i++) {
+            if (entries_[i].valid) {
+                images++;
+                frames += entries_[i].frame_count;
+                hits += entries_[i].hits;
+            }
+        }
+        std::cout << "[ElfImageCache] " << images << "/" << MAX_IMAGES
+                  << " images, " << frames << " shared frames, "
+                  << hits << " hits, " << misses_ << " misses"
+                  << std::endl;
+    }
+
+private:
+    // Copy a writable segment's file bytes into the entry's data buffer
+    bool stageDataSegment(CachedElf& entry, const ElfSegment& seg,
+                          const uint8_t* data) {
+        if (entry.data_used + seg.filesz > MAX_DATA_BYTES) {
+            return false;
+        }
+        DataRange range = {};
+        range.vaddr = seg.vaddr;
+        range.memsz = seg.memsz;
+        range.filesz = seg.filesz;
+        range.flags = seg.flags;
+        range.data_off = entry.data_used;
+        std::memcpy(entry.data_bytes + entry.data_used, data + seg.offset,
+                    seg.filesz);
+        entry.data_used += static_cast<uint32_t>(seg.filesz);
+        return entry.data_ranges.push_back(range);
+    }
+
+    // Stage a read-only segment into cache-owned frames, zero-padded to
+    // page boundaries, ready to be mapped copy-on-write
+    bool stageSharedSegment(CachedElf& entry, const ElfSegment& seg,
+                            const uint8_t* data) {
+        uint64_t page_base = align_down(seg.vaddr);
+        uint64_t page_end = align_up(seg.vaddr + seg.memsz);
+        uint64_t page_count = (page_end - page_base) / PAGE_SIZE;
+        if (entry.frame_count + page_count > MAX_SHARED_FRAMES) {
+            return false;
+        }
+
+        SharedRange range = {};
+        range.vaddr = seg.vaddr;
+        range.memsz = seg.memsz;
+        range.flags = seg.flags;
+        range.first_frame = entry.frame_count;
+        range.page_count = static_cast<uint32_t>(page_count);
+
+        uint64_t file_start = seg.vaddr;
+        uint64_t file_end = seg.vaddr + seg.filesz;
+        for (uint64_t p = 0; p < page_count; p++) {
+            uint64_t frame = phys_alloc_->allocateFrame();
+            if (frame == 0) {
+                return false;
+            }
+            uint8_t* dst =
+                static_cast<uint8_t*>(phys_alloc_->ptrFromPhys(frame));
+            if (!dst) {
+                phys_alloc_->freeFrame(frame);
+                return false;
+            }
+            std::memset(dst, 0, PAGE_SIZE);
+
+            uint64_t page_virt = page_base + p * PAGE_SIZE;
+            uint64_t copy_start =
+                page_virt > file_start ? page_virt : file_start;
+            uint64_t copy_end = (page_virt + PAGE_SIZE) < file_end
+                                    ? (page_virt + PAGE_SIZE)
+                                    : file_end;
+            if (copy_start < copy_end) {
+                std::memcpy(dst + (copy_start - page_virt),
+                            data + seg.offset + (copy_start - file_start),
+                            copy_end - copy_start);
+            }
+            entry.frames[entry.frame_count++] = frame;
+        }
+
+        return entry.ro_ranges.push_back(range);
+    }
+
+    void release(CachedElf& entry) {
+        if (phys_alloc_) {
+            for (uint32_t i = 0; i < entry.frame_count; i++) {
+                phys_alloc_->freeFrame(entry.frames[i]);
+            }
+        }
+        entry.frame_count = 0;
+        entry.data_used = 0;
+        entry.ro_ranges.clear();
+        entry.data_ranges.clear();
+        entry.entry = 0;
+        entry.path[0] = '\0';
+        entry.valid = false;
+    }
+
+    CachedElf entries_[MAX_IMAGES];
+    PhysicalAllocator* phys_alloc_;
+    uint64_t misses_ = 0;
+};
+
+} // namespace os
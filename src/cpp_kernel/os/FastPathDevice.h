@@ -1,28 +1,50 @@
 #pragma once
 
 #include "Device.h"
+#ifdef RSE_KERNEL
+// KernelStubs carries the std::atomic subset; hosted <atomic> collides
+// with the kernel's stream stubs (see KernelStubs.h)
+#include "KernelStubs.h"
+#else
+#include <atomic>
+#endif
 #include <cstdint>
 #include <cstring>
 
 namespace os {
 
+/**
+ * Single-producer/single-consumer lock-free ring behind /dev/fastpath.
+ *
+ * head is written only by the producer, tail only by the consumer; each
+ * lives on its own cache line so the two sides never false-share. The
+ * producer publishes bytes with a release store of head, the consumer
+ * frees space with a release store of tail, and each side reads the
+ * other's index with acquire — one process can feed another without
+ * locks.
+ *
+ * The span API (reserve/commit, peek/advance) exposes the ring's
+ * contiguous regions directly, so bulk producers and consumers operate
+ * in place with no intermediate copy at all.
+ */
 struct FastPathState {
     static constexpr uint32_t kBufferSize = 1u << 16;
     static constexpr uint32_t kMask = kBufferSize - 1u;
     uint8_t buffer[kBufferSize];
-    uint32_t head;
-    uint32_t tail;
+    alignas(64) std::atomic<uint32_t> head;  // Producer-owned
+    alignas(64) std::atomic<uint32_t> tail;  // Consumer-owned
 };
 
 constexpr unsigned long FASTPATH_IOCTL_RESET = 0x52534501ul;
 
+// Reset is not concurrency-safe; callers quiesce both sides first
 inline void fastpath_reset(Device* dev) {
     if (!dev || !dev->private_data) {
         return;
     }
     FastPathState* st = static_cast<FastPathState*>(dev->private_data);
-    st->head = 0;
-    st->tail = 0;
+    st->head.store(0, std::memory_order_relaxed);
+    st->tail.store(0, std::memory_order_relaxed);
     std::memset(st->buffer, 0, sizeof(st->buffer));
 }
 
@@ -30,10 +52,12 @@ inline uint32_t fastpath_used(const FastPathState* st) {
     if (!st) {
         return 0;
     }
-    if (st->head >= st->tail) {
-        return st->head - st->tail;
+    const uint32_t head = st->head.load(std::memory_order_acquire);
+    const uint32_t tail = st->tail.load(std::memory_order_acquire);
+    if (head >= tail) {
+        return head - tail;
     }
-    return FastPathState::kBufferSize - (st->tail - st->head);
+    return FastPathState::kBufferSize - (tail - head);
 }
 
 inline uint32_t fastpath_free(const FastPathState* st) {
@@ -44,6 +68,82 @@ inline uint32_t fastpath_free(const FastPathState* st) {
     return (FastPathState::kBufferSize - 1u) - used;
 }
 
+// ========== Span API (memcpy-free batch production/consumption) ==========
+
+/**
+ * Producer side: reserve up to `max` bytes of writable space and return
+ * the contiguous span at the current head. May return fewer bytes than
+ * are free when the free region wraps; call again after committing to
+ * get the wrapped remainder.
+ */
+inline uint32_t fastpath_produce_reserve(FastPathState* st, uint8_t** out,
+                                         uint32_t max) {
+    if (!st || !out || max == 0) {
+        return 0;
+    }
+    const uint32_t head = st->head.load(std::memory_order_relaxed);
+    uint32_t space = fastpath_free(st);
+    if (space > max) {
+        space = max;
+    }
+    const uint32_t idx = head & FastPathState::kMask;
+    uint32_t contiguous = FastPathState::kBufferSize - idx;
+    if (space > contiguous) {
+        space = contiguous;
+    }
+    *out = &st->buffer[idx];
+    return space;
+}
+
+/**
+ * Publish `count` bytes previously written into a reserved span.
+ */
+inline void fastpath_produce_commit(FastPathState* st, uint32_t count) {
+    if (!st || count == 0) {
+        return;
+    }
+    const uint32_t head = st->head.load(std::memory_order_relaxed);
+    st->head.store((head + count) & FastPathState::kMask,
+                   std::memory_order_release);
+}
+
+/**
+ * Consumer side: peek at up to `max` readable bytes as a contiguous
+ * span. As with reserve, a wrap splits the data into two spans.
+ */
+inline uint32_t fastpath_consume_peek(FastPathState* st, const uint8_t** out,
+                                      uint32_t max) {
+    if (!st || !out || max == 0) {
+        return 0;
+    }
+    const uint32_t tail = st->tail.load(std::memory_order_relaxed);
+    uint32_t avail = fastpath_used(st);
+    if (avail > max) {
+        avail = max;
+    }
+    const uint32_t idx = tail & FastPathState::kMask;
+    uint32_t contiguous = FastPathState::kBufferSize - idx;
+    if (avail > contiguous) {
+        avail = contiguous;
+    }
+    *out = &st->buffer[idx];
+    return avail;
+}
+
+/**
+ * Release `count` bytes previously peeked.
+ */
+inline void fastpath_consume_advance(FastPathState* st, uint32_t count) {
+    if (!st || count == 0) {
+        return;
+    }
+    const uint32_t tail = st->tail.load(std::memory_order_relaxed);
+    st->tail.store((tail + count) & FastPathState::kMask,
+                   std::memory_order_release);
+}
+
+// ========== Device ops (built on the span API) ==========
+
 inline int fastpath_open(Device* dev) {
     return dev ? 0 : -1;
 }
@@ -60,14 +160,22 @@ inline ssize_t fastpath_read(Device* dev, void* buf, size_t count) {
     if (!st) {
         return -1;
     }
-    uint32_t available = fastpath_used(st);
-    uint32_t to_read = count > available ? available : static_cast<uint32_t>(count);
     uint8_t* dst = static_cast<uint8_t*>(buf);
-    for (uint32_t i = 0; i < to_read; ++i) {
-        dst[i] = st->buffer[st->tail];
-        st->tail = (st->tail + 1u) & FastPathState::kMask;
+    ssize_t total = 0;
+    while (count > 0) {
+        const uint8_t* span = nullptr;
+        uint32_t got = fastpath_consume_peek(
+            st, &span,
+            count > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(count));
+        if (got == 0) {
+            break;
+        }
+        std::memcpy(dst + total, span, got);
+        fastpath_consume_advance(st, got);
+        total += static_cast<ssize_t>(got);
+        count -= got;
     }
-    return static_cast<ssize_t>(to_read);
+    return total;
 }
 
 inline ssize_t fastpath_write(Device* dev, const void* buf, size_t count) {
@@ -78,14 +186,79 @@ inline ssize_t fastpath_write(Device* dev, const void* buf, size_t count) {
     if (!st) {
         return -1;
     }
-    uint32_t free = fastpath_free(st);
-    uint32_t to_write = count > free ? free : static_cast<uint32_t>(count);
     const uint8_t* src = static_cast<const uint8_t*>(buf);
-    for (uint32_t i = 0; i < to_write; ++i) {
-        st->buffer[st->head] = src[i];
-        st->head = (st->head + 1u) & FastPathState::kMask;
+    ssize_t total = 0;
+    while (count > 0) {
+        uint8_t* span = nullptr;
+        uint32_t room = fastpath_produce_reserve(
+            st, &span,
+            count > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(count));
+        if (room == 0) {
+            break;
+        }
+        std::memcpy(span, src + total, room);
+        fastpath_produce_commit(st, room);
+        total += static_cast<ssize_t>(room);
+        count -= room;
+    }
+    return total;
+}
+
+inline ssize_t fastpath_readv(Device* dev, const rse_iovec* iov, int iovcnt) {
+    if (!dev || !iov || iovcnt <= 0) {
+        return 0;
+    }
+    FastPathState* st = static_cast<FastPathState*>(dev->private_data);
+    if (!st) {
+        return -1;
+    }
+    // One pass over the ring, filling segments in order
+    ssize_t total = 0;
+    for (int seg = 0; seg < iovcnt; ++seg) {
+        uint8_t* dst = reinterpret_cast<uint8_t*>(iov[seg].base);
+        uint64_t len = iov[seg].len;
+        if (!dst || len == 0) {
+            continue;
+        }
+        ssize_t got = fastpath_read(dev, dst, len);
+        if (got <= 0) {
+            break;
+        }
+        total += got;
+        if (static_cast<uint64_t>(got) < len) {
+            break;
+        }
     }
-    return static_cast<ssize_t>(to_write);
+    return total;
+}
+
+inline ssize_t fastpath_writev(Device* dev, const rse_iovec* iov, int iovcnt) {
+    if (!dev || !iov || iovcnt <= 0) {
+        return 0;
+    }
+    FastPathState* st = static_cast<FastPathState*>(dev->private_data);
+    if (!st) {
+        return -1;
+    }
+    // Segments land back to back in the ring — header+payload callers
+    // get one contiguous message without an assembly copy
+    ssize_t total = 0;
+    for (int seg = 0; seg < iovcnt; ++seg) {
+        const uint8_t* src = reinterpret_cast<const uint8_t*>(iov[seg].base);
+        uint64_t len = iov[seg].len;
+        if (!src || len == 0) {
+            continue;
+        }
+        ssize_t put = fastpath_write(dev, src, len);
+        if (put <= 0) {
+            break;
+        }
+        total += put;
+        if (static_cast<uint64_t>(put) < len) {
+            break;
+        }
+    }
+    return total;
 }
 
 inline int fastpath_ioctl(Device* dev, unsigned long request, void* arg) {
@@ -106,7 +279,9 @@ inline Device* create_fastpath_device(const char* name) {
     if (!dev || !st) {
         return nullptr;
     }
-    std::memset(st, 0, sizeof(FastPathState));
+    std::memset(st->buffer, 0, sizeof(st->buffer));
+    st->head.store(0, std::memory_order_relaxed);
+    st->tail.store(0, std::memory_order_relaxed);
     const char* dev_name = name ? name : "fast0";
     std::strncpy(dev->name, dev_name, sizeof(dev->name) - 1);
     dev->name[sizeof(dev->name) - 1] = '\0';
@@ -117,6 +292,8 @@ inline Device* create_fastpath_device(const char* name) {
     dev->read = fastpath_read;
     dev->write = fastpath_write;
     dev->ioctl = fastpath_ioctl;
+    dev->readv = fastpath_readv;
+    dev->writev = fastpath_writev;
     return dev;
 }
 
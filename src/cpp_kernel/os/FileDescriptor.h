@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Syscall.h"
+#include "../FixedStructures.h"
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #ifdef RSE_KERNEL
@@ -28,7 +30,16 @@ struct Device;
 enum class FDKind : uint8_t {
     FILE,
     BLOCK_FILE,
-    DEVICE
+    DEVICE,
+    DIRECTORY
+};
+
+// The flat VFS exposes three directory namespaces; a directory
+// descriptor pins one of them as the base for relative opens
+enum class DirNS : uint8_t {
+    ROOT,     // MemFS names
+    DEV,      // /dev/* device nodes
+    PERSIST   // /persist/* BlockFS entries
 };
 
 /**
@@ -45,11 +56,12 @@ struct FileDescriptor {
     uint32_t flags;            // Open flags (O_RDONLY, O_WRONLY, etc.)
     uint32_t ref_count;        // Reference count (for dup)
     FDKind kind;               // File vs device
+    DirNS dir_ns;              // Namespace, for DIRECTORY descriptors
     bool in_use;               // Is this FD allocated?
-    
-    FileDescriptor() 
+
+    FileDescriptor()
         : fd(-1), file(nullptr), block_file(nullptr), device(nullptr), offset(0), flags(0),
-          ref_count(0), kind(FDKind::FILE), in_use(false) {}
+          ref_count(0), kind(FDKind::FILE), dir_ns(DirNS::ROOT), in_use(false) {}
     
     bool isReadable() const {
         return (flags & O_WRONLY) == 0;
@@ -74,6 +86,10 @@ struct FileDescriptor {
     bool isBlockFile() const {
         return kind == FDKind::BLOCK_FILE;
     }
+
+    bool isDirectory() const {
+        return kind == FDKind::DIRECTORY;
+    }
 };
 
 /**
@@ -84,8 +100,15 @@ struct FileDescriptor {
 class FileDescriptorTable {
 private:
     static constexpr uint32_t MAX_FDS = 1024;
+
     FileDescriptor fds_[MAX_FDS];
-    
+
+    // Allocation bitmap (bit set = fd in use) plus a floor below which no
+    // fd is free. allocate starts its find-first-zero at the floor, so
+    // open/dup touch one or two words instead of scanning slots.
+    FixedBitset<MAX_FDS> used_bits_;
+    uint32_t lowest_free_;
+
 public:
     FileDescriptorTable() {
         // Initialize all FDs as unused
@@ -93,35 +116,33 @@ public:
             fds_[i].fd = i;
             fds_[i].in_use = false;
         }
-        
         // Reserve FDs 0, 1, 2 for stdin, stdout, stderr
         fds_[0].in_use = true;  // stdin
         fds_[1].in_use = true;  // stdout
         fds_[2].in_use = true;  // stderr
+        used_bits_.setRange(0, 3);
+        lowest_free_ = 3;
     }
-    
+
     /**
      * Allocate a new file descriptor.
      * Returns FD number, or -1 if no FDs available.
      */
     int32_t allocate(MemFSFile* file, uint32_t flags) {
-        // Find first free FD (skip 0, 1, 2)
-        for (uint32_t i = 3; i < MAX_FDS; i++) {
-            if (!fds_[i].in_use) {
-                fds_[i].file = file;
-                fds_[i].block_file = nullptr;
-                fds_[i].device = nullptr;
-                fds_[i].offset = 0;
-                fds_[i].flags = flags;
-                fds_[i].ref_count = 1;
-                fds_[i].kind = FDKind::FILE;
-                fds_[i].in_use = true;
-                return i;
-            }
+        int32_t fd = allocateSlot();
+        if (fd < 0) {
+            std::cerr << "[FileDescriptorTable] No free FDs!" << std::endl;
+            return -1;
         }
-        
-        std::cerr << "[FileDescriptorTable] No free FDs!" << std::endl;
-        return -1;
+        fds_[fd].file = file;
+        fds_[fd].block_file = nullptr;
+        fds_[fd].device = nullptr;
+        fds_[fd].offset = 0;
+        fds_[fd].flags = flags;
+        fds_[fd].ref_count = 1;
+        fds_[fd].kind = FDKind::FILE;
+        fds_[fd].in_use = true;
+        return fd;
     }
 
     /**
@@ -131,20 +152,19 @@ public:
         if (!device) {
             return -1;
         }
-        for (uint32_t i = 3; i < MAX_FDS; i++) {
-            if (!fds_[i].in_use) {
-                fds_[i].file = nullptr;
-                fds_[i].block_file = nullptr;
-                fds_[i].device = device;
-                fds_[i].offset = 0;
-                fds_[i].flags = flags;
-                fds_[i].ref_count = 1;
-                fds_[i].kind = FDKind::DEVICE;
-                fds_[i].in_use = true;
-                return i;
-            }
+        int32_t fd = allocateSlot();
+        if (fd < 0) {
+            return -1;
         }
-        return -1;
+        fds_[fd].file = nullptr;
+        fds_[fd].block_file = nullptr;
+        fds_[fd].device = device;
+        fds_[fd].offset = 0;
+        fds_[fd].flags = flags;
+        fds_[fd].ref_count = 1;
+        fds_[fd].kind = FDKind::DEVICE;
+        fds_[fd].in_use = true;
+        return fd;
     }
 
     /**
@@ -154,22 +174,41 @@ public:
         if (!file) {
             return -1;
         }
-        for (uint32_t i = 3; i < MAX_FDS; i++) {
-            if (!fds_[i].in_use) {
-                fds_[i].file = nullptr;
-                fds_[i].block_file = file;
-                fds_[i].device = nullptr;
-                fds_[i].offset = 0;
-                fds_[i].flags = flags;
-                fds_[i].ref_count = 1;
-                fds_[i].kind = FDKind::BLOCK_FILE;
-                fds_[i].in_use = true;
-                return i;
-            }
+        int32_t fd = allocateSlot();
+        if (fd < 0) {
+            return -1;
         }
-        return -1;
+        fds_[fd].file = nullptr;
+        fds_[fd].block_file = file;
+        fds_[fd].device = nullptr;
+        fds_[fd].offset = 0;
+        fds_[fd].flags = flags;
+        fds_[fd].ref_count = 1;
+        fds_[fd].kind = FDKind::BLOCK_FILE;
+        fds_[fd].in_use = true;
+        return fd;
     }
     
+    /**
+     * Allocate a directory descriptor anchoring one VFS namespace.
+     */
+    int32_t allocateDir(DirNS ns, uint32_t flags) {
+        int32_t fd = allocateSlot();
+        if (fd < 0) {
+            return -1;
+        }
+        fds_[fd].file = nullptr;
+        fds_[fd].block_file = nullptr;
+        fds_[fd].device = nullptr;
+        fds_[fd].offset = 0;
+        fds_[fd].flags = flags;
+        fds_[fd].ref_count = 1;
+        fds_[fd].kind = FDKind::DIRECTORY;
+        fds_[fd].dir_ns = ns;
+        fds_[fd].in_use = true;
+        return fd;
+    }
+
     /**
      * Free a file descriptor.
      */
@@ -197,7 +236,9 @@ public:
             fds_[fd].offset = 0;
             fds_[fd].flags = 0;
             fds_[fd].kind = FDKind::FILE;
+            fds_[fd].dir_ns = DirNS::ROOT;
             fds_[fd].in_use = false;
+            markFree(static_cast<uint32_t>(fd));
         }
     }
     
@@ -216,7 +257,20 @@ public:
         
         return &fds_[fd];
     }
-    
+
+    /**
+     * Hot-path lookup for read/write: one bitmap test decides validity,
+     * no per-field re-validation. Out-of-range and closed fds still
+     * return nullptr.
+     */
+    FileDescriptor* getFast(int32_t fd) {
+        uint32_t idx = static_cast<uint32_t>(fd);
+        if (idx >= MAX_FDS) {
+            return nullptr;
+        }
+        return used_bits_.test(idx) ? &fds_[idx] : nullptr;
+    }
+
     /**
      * Duplicate a file descriptor (like dup()).
      */
@@ -225,19 +279,17 @@ public:
         if (!old_desc) {
             return -1;
         }
-        
-        // Find free FD
-        for (uint32_t i = 3; i < MAX_FDS; i++) {
-            if (!fds_[i].in_use) {
-                fds_[i] = *old_desc;
-                fds_[i].fd = i;
-                fds_[i].ref_count = 1;
-                old_desc->ref_count++;
-                return i;
-            }
+
+        int32_t fd = allocateSlot();
+        if (fd < 0) {
+            return -1;
         }
-        
-        return -1;
+        fds_[fd] = *old_desc;
+        fds_[fd].fd = fd;
+        fds_[fd].ref_count = 1;
+        fds_[fd].in_use = true;
+        old_desc->ref_count++;
+        return fd;
     }
 
     int32_t duplicateTo(int32_t old_fd, int32_t new_fd) {
@@ -260,14 +312,18 @@ public:
         fds_[new_fd] = *old_desc;
         fds_[new_fd].fd = new_fd;
         fds_[new_fd].ref_count = 1;
+        fds_[new_fd].in_use = true;
+        markUsed(static_cast<uint32_t>(new_fd));
         old_desc->ref_count++;
         return new_fd;
     }
 
     void closeOnExec() {
-        for (uint32_t i = 3; i < MAX_FDS; i++) {
-            if (fds_[i].in_use && fds_[i].closeOnExec()) {
-                free(static_cast<int32_t>(i));
+        // Walk only the occupied bits of the bitmap
+        for (std::size_t fd = used_bits_.findFirstSet(3);
+             fd != used_bits_.npos; fd = used_bits_.findFirstSet(fd + 1)) {
+            if (fds_[fd].closeOnExec()) {
+                free(static_cast<int32_t>(fd));
             }
         }
     }
@@ -295,13 +351,7 @@ public:
      * Get number of open file descriptors.
      */
     uint32_t count() const {
-        uint32_t c = 0;
-        for (uint32_t i = 0; i < MAX_FDS; i++) {
-            if (fds_[i].in_use) {
-                c++;
-            }
-        }
-        return c;
+        return static_cast<uint32_t>(used_bits_.count());
     }
     
     /**
@@ -309,9 +359,38 @@ public:
      */
     void printStats() const {
         uint32_t open_fds = count();
-        std::cout << "[FileDescriptorTable] Open FDs: " << open_fds 
+        std::cout << "[FileDescriptorTable] Open FDs: " << open_fds
                   << " / " << MAX_FDS << std::endl;
     }
+
+private:
+    /**
+     * Claim the lowest free fd: find-first-zero from the floor word, mark
+     * it used, and advance the floor past it. Returns -1 when the table
+     * is full.
+     */
+    int32_t allocateSlot() {
+        const std::size_t fd = used_bits_.findFirstZero(lowest_free_);
+        if (fd == used_bits_.npos) {
+            return -1;
+        }
+        used_bits_.set(fd);
+        lowest_free_ = static_cast<uint32_t>(fd) + 1;
+        return static_cast<int32_t>(fd);
+    }
+
+    // Mark a specific fd used (dup2 target); the floor stays a valid
+    // lower bound because no fd below it becomes free.
+    void markUsed(uint32_t fd) {
+        used_bits_.set(fd);
+    }
+
+    void markFree(uint32_t fd) {
+        used_bits_.clear(fd);
+        if (fd < lowest_free_) {
+            lowest_free_ = fd;
+        }
+    }
 };
 
 } // namespace os
@@ -57,6 +57,81 @@ inline ostream& flush(ostream& os) { return os; }
 inline ostream& hex(ostream& os) { return os; }
 inline ostream& dec(ostream& os) { return os; }
 
+// The hosted <atomic> cannot be used here: its bits/atomic_wait.h chain
+// drags in <iosfwd>, which collides with the stream stubs above. Mirror
+// the subset of std::atomic the kernel-reachable headers use straight
+// onto the GCC __atomic builtins (single-core pre-SMP code still wants
+// the compiler barriers, and the APs need the real fences).
+typedef int memory_order;
+constexpr memory_order memory_order_relaxed = __ATOMIC_RELAXED;
+constexpr memory_order memory_order_consume = __ATOMIC_CONSUME;
+constexpr memory_order memory_order_acquire = __ATOMIC_ACQUIRE;
+constexpr memory_order memory_order_release = __ATOMIC_RELEASE;
+constexpr memory_order memory_order_acq_rel = __ATOMIC_ACQ_REL;
+constexpr memory_order memory_order_seq_cst = __ATOMIC_SEQ_CST;
+
+template <typename T>
+struct atomic {
+    atomic() = default;
+    constexpr atomic(T v) : value_(v) {}
+    atomic(const atomic&) = delete;
+    atomic& operator=(const atomic&) = delete;
+
+    T load(memory_order order = memory_order_seq_cst) const {
+        T out;
+        __atomic_load(const_cast<T*>(&value_), &out, order);
+        return out;
+    }
+    void store(T v, memory_order order = memory_order_seq_cst) {
+        __atomic_store(&value_, &v, order);
+    }
+    T exchange(T v, memory_order order = memory_order_seq_cst) {
+        T out;
+        __atomic_exchange(&value_, &v, &out, order);
+        return out;
+    }
+    bool compare_exchange_weak(T& expected, T desired,
+                               memory_order success = memory_order_seq_cst,
+                               memory_order failure = memory_order_seq_cst) {
+        return __atomic_compare_exchange(&value_, &expected, &desired, true,
+                                         success, failure);
+    }
+    bool compare_exchange_strong(T& expected, T desired,
+                                 memory_order success = memory_order_seq_cst,
+                                 memory_order failure = memory_order_seq_cst) {
+        return __atomic_compare_exchange(&value_, &expected, &desired, false,
+                                         success, failure);
+    }
+    T fetch_add(T v, memory_order order = memory_order_seq_cst) {
+        return __atomic_fetch_add(&value_, v, order);
+    }
+    T fetch_sub(T v, memory_order order = memory_order_seq_cst) {
+        return __atomic_fetch_sub(&value_, v, order);
+    }
+    T fetch_or(T v, memory_order order = memory_order_seq_cst) {
+        return __atomic_fetch_or(&value_, v, order);
+    }
+    T fetch_and(T v, memory_order order = memory_order_seq_cst) {
+        return __atomic_fetch_and(&value_, v, order);
+    }
+    operator T() const { return load(); }
+    T operator=(T v) {
+        store(v);
+        return v;
+    }
+    T operator++() { return fetch_add(1) + 1; }
+    T operator++(int) { return fetch_add(1); }
+    T operator--() { return fetch_sub(1) - 1; }
+    T operator--(int) { return fetch_sub(1); }
+
+private:
+    T value_{};
+};
+
+inline void atomic_thread_fence(memory_order order) {
+    __atomic_thread_fence(order);
+}
+
 } // namespace std
 
 #endif
@@ -3,82 +3,196 @@
 #include "FileDescriptor.h"
 #include <cstdint>
 #include <cstring>
-#include <cstdlib>
 #include <cstddef>
 #ifdef RSE_KERNEL
 #include "KernelStubs.h"
-extern "C" {
-void* malloc(size_t size);
-void* realloc(void* ptr, size_t size);
-void free(void* ptr);
-}
 #else
 #include <iostream>
 #endif
 
 /**
  * Simple In-Memory File System (MemFS)
- * 
+ *
  * Files stored in RAM, no persistence.
- * Flat namespace (no directories).
+ * Hierarchical namespace with hashed path lookup; file contents live in
+ * fixed-size chunks so appends never copy existing data.
  */
 
 namespace os {
 
 /**
- * In-memory file.
+ * Bounded pool backing all MemFS file contents.
+ *
+ * Every block is one size class (the MemFS chunk size), handed out from
+ * a fixed arena through an intrusive free list, so file create/grow/
+ * delete cost one pop/push each and churn recycles blocks instead of
+ * fragmenting the kernel heap — whose free() is a no-op in kernel
+ * builds, so raw malloc'd chunks would never come back. Chunk-pointer
+ * tables draw from the same pool (one block holds 512 pointers), which
+ * caps a file at 2 MB and removes the realloc-based table growth.
+ */
+class MemFSChunkPool {
+public:
+    static constexpr uint32_t BLOCK_SIZE = 4096;
+    static constexpr uint32_t NUM_BLOCKS = 1024;  // 4 MB of pooled data
+
+    MemFSChunkPool()
+        : free_head_(0), allocs_(0), frees_(0), failures_(0), peak_(0) {
+        for (uint32_t i = 0; i < NUM_BLOCKS; i++) {
+            next_[i] = (i + 1 < NUM_BLOCKS) ? i + 1 : INVALID_BLOCK;
+        }
+    }
+
+    uint8_t* allocate() {
+        if (free_head_ == INVALID_BLOCK) {
+            failures_++;
+            return nullptr;
+        }
+        uint32_t idx = free_head_;
+        free_head_ = next_[idx];
+        allocs_++;
+        uint32_t used = (uint32_t)(allocs_ - frees_);
+        if (used > peak_) {
+            peak_ = used;
+        }
+        return blocks_[idx];
+    }
+
+    void release(uint8_t* block) {
+        if (!block) {
+            return;
+        }
+        uint32_t idx = (uint32_t)((block - blocks_[0]) / BLOCK_SIZE);
+        if (idx >= NUM_BLOCKS || blocks_[idx] != block) {
+            std::cerr << "[MemFSChunkPool] Release of foreign block!"
+                      << std::endl;
+            return;
+        }
+        next_[idx] = free_head_;
+        free_head_ = idx;
+        frees_++;
+    }
+
+    uint32_t inUse() const { return (uint32_t)(allocs_ - frees_); }
+    uint32_t peak() const { return peak_; }
+    uint64_t failures() const { return failures_; }
+
+    void printStats() const {
+        std::cout << "[MemFSChunkPool] In use: " << inUse()
+                  << " / " << NUM_BLOCKS
+                  << " blocks, Peak: " << peak_
+                  << ", Allocs: " << allocs_
+                  << ", Failures: " << failures_ << std::endl;
+    }
+
+private:
+    static constexpr uint32_t INVALID_BLOCK = 0xFFFFFFFFu;
+
+    uint8_t blocks_[NUM_BLOCKS][BLOCK_SIZE];
+    uint32_t next_[NUM_BLOCKS];  // Free-list links by block index
+    uint32_t free_head_;
+    uint64_t allocs_;
+    uint64_t frees_;
+    uint64_t failures_;
+    uint32_t peak_;
+};
+
+/**
+ * Pool shared by every MemFS instance (same pattern as block_cache()).
+ */
+inline MemFSChunkPool& memfs_chunk_pool() {
+    static MemFSChunkPool pool;
+    return pool;
+}
+
+/**
+ * In-memory file (or directory).
+ *
+ * Contents are a table of fixed-size pooled chunks. Growing a file pops
+ * chunks from the pool — the file bytes themselves are never moved, so
+ * log-style appends are O(1) in the file size, and deleting a file
+ * pushes its chunks back for the next create.
  */
 struct MemFSFile {
-    char name[256];            // File name
-    uint8_t* data;             // File contents
+    static constexpr uint32_t CHUNK_SIZE = MemFSChunkPool::BLOCK_SIZE;
+    static constexpr uint32_t MAX_CHUNKS =
+        MemFSChunkPool::BLOCK_SIZE / sizeof(uint8_t*);
+
+    char name[256];            // Full path
+    uint8_t** chunks;          // Chunk pointer table
+    uint32_t chunk_count;      // Allocated chunks
+    uint32_t chunk_cap;        // Chunk table capacity
     uint32_t size;             // Current size
-    uint32_t capacity;         // Allocated capacity
+    uint32_t capacity;         // Allocated capacity (chunk_count * CHUNK_SIZE)
     uint32_t mode;             // Permissions (not enforced yet)
     bool in_use;               // Is this file slot used?
-    
-    MemFSFile() 
-        : data(nullptr), size(0), capacity(0), mode(0644), in_use(false) {
+    bool is_dir;               // Directory marker (no contents)
+    uint32_t hash_next;        // Next slot in the same hash bucket
+
+    MemFSFile()
+        : chunks(nullptr), chunk_count(0), chunk_cap(0), size(0),
+          capacity(0), mode(0644), in_use(false), is_dir(false),
+          hash_next(0xFFFFFFFFu) {
         name[0] = '\0';
     }
-    
+
     ~MemFSFile() {
-        if (data) {
-            free(data);
-            data = nullptr;
+        freeChunks();
+    }
+
+    void freeChunks() {
+        if (chunks) {
+            for (uint32_t i = 0; i < chunk_count; i++) {
+                memfs_chunk_pool().release(chunks[i]);
+            }
+            memfs_chunk_pool().release((uint8_t*)chunks);
+            chunks = nullptr;
         }
+        chunk_count = 0;
+        chunk_cap = 0;
+        capacity = 0;
     }
-    
+
     /**
-     * Ensure capacity for at least `new_size` bytes.
+     * Ensure pooled chunks exist to back at least `new_size` bytes. New
+     * chunks are zeroed so sparse writes read back as zeros.
      */
     bool ensureCapacity(uint32_t new_size) {
-        if (new_size <= capacity) {
+        uint32_t needed = (new_size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        if (needed <= chunk_count) {
             return true;
         }
-        
-        // Round up to next power of 2
-        uint32_t new_capacity = capacity;
-        if (new_capacity == 0) {
-            new_capacity = 4096;  // Start with 4KB
-        }
-        
-        while (new_capacity < new_size) {
-            new_capacity *= 2;
-        }
-        
-        // Reallocate
-        uint8_t* new_data = (uint8_t*)realloc(data, new_capacity);
-        if (!new_data) {
-            std::cerr << "[MemFSFile] Out of memory!" << std::endl;
+        if (needed > MAX_CHUNKS) {
+            std::cerr << "[MemFSFile] File exceeds pooled capacity!"
+                      << std::endl;
             return false;
         }
-        
-        data = new_data;
-        capacity = new_capacity;
-        
+
+        if (!chunks) {
+            // The pointer table is one pooled block, sized for the
+            // largest file up front — no realloc on growth
+            chunks = (uint8_t**)memfs_chunk_pool().allocate();
+            if (!chunks) {
+                std::cerr << "[MemFSFile] Chunk pool exhausted!" << std::endl;
+                return false;
+            }
+            chunk_cap = MAX_CHUNKS;
+        }
+
+        while (chunk_count < needed) {
+            uint8_t* chunk = memfs_chunk_pool().allocate();
+            if (!chunk) {
+                std::cerr << "[MemFSFile] Chunk pool exhausted!" << std::endl;
+                return false;
+            }
+            std::memset(chunk, 0, CHUNK_SIZE);
+            chunks[chunk_count++] = chunk;
+            capacity += CHUNK_SIZE;
+        }
+
         return true;
     }
-    
+
     /**
      * Read from file at offset.
      */
@@ -86,38 +200,57 @@ struct MemFSFile {
         if (offset >= size) {
             return 0;  // EOF
         }
-        
+
         uint32_t available = size - offset;
         uint32_t to_read = (count < available) ? count : available;
-        
-        std::memcpy(buf, data + offset, to_read);
-        
+
+        uint32_t done = 0;
+        while (done < to_read) {
+            uint32_t chunk = (uint32_t)((offset + done) / CHUNK_SIZE);
+            uint32_t off = (uint32_t)((offset + done) % CHUNK_SIZE);
+            uint32_t take = CHUNK_SIZE - off;
+            if (take > to_read - done) {
+                take = to_read - done;
+            }
+            std::memcpy(buf + done, chunks[chunk] + off, take);
+            done += take;
+        }
+
         return to_read;
     }
-    
+
     /**
      * Write to file at offset.
      */
     int64_t write(const uint8_t* buf, uint64_t offset, uint32_t count) {
-        // Ensure capacity
+        // Ensure chunks cover the write; existing data stays in place
         uint32_t new_size = offset + count;
         if (!ensureCapacity(new_size)) {
             return -1;  // Out of memory
         }
-        
-        // Write data
-        std::memcpy(data + offset, buf, count);
-        
+
+        uint32_t done = 0;
+        while (done < count) {
+            uint32_t chunk = (uint32_t)((offset + done) / CHUNK_SIZE);
+            uint32_t off = (uint32_t)((offset + done) % CHUNK_SIZE);
+            uint32_t take = CHUNK_SIZE - off;
+            if (take > count - done) {
+                take = count - done;
+            }
+            std::memcpy(chunks[chunk] + off, buf + done, take);
+            done += take;
+        }
+
         // Update size if we wrote past end
         if (new_size > size) {
             size = new_size;
         }
-        
+
         return count;
     }
-    
+
     /**
-     * Truncate file to zero length.
+     * Truncate file to zero length (chunks are kept for reuse).
      */
     void truncate() {
         size = 0;
@@ -130,14 +263,141 @@ struct MemFSFile {
 class MemFS {
 private:
     static constexpr uint32_t MAX_FILES = 1024;
+    static constexpr uint32_t HASH_BUCKETS = 256;  // Power of two
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
     MemFSFile files_[MAX_FILES];
+    uint32_t buckets_[HASH_BUCKETS];
     uint32_t num_files_;
-    
+
+    static uint32_t hashName(const char* name) {
+        // FNV-1a over the full path
+        uint32_t hash = 2166136261u;
+        for (uint32_t i = 0; name[i]; i++) {
+            hash ^= (uint8_t)name[i];
+            hash *= 16777619u;
+        }
+        return hash & (HASH_BUCKETS - 1);
+    }
+
+    void hashInsert(uint32_t slot) {
+        uint32_t bucket = hashName(files_[slot].name);
+        files_[slot].hash_next = buckets_[bucket];
+        buckets_[bucket] = slot;
+    }
+
+    void hashRemove(uint32_t slot) {
+        uint32_t bucket = hashName(files_[slot].name);
+        uint32_t* link = &buckets_[bucket];
+        while (*link != INVALID_SLOT && *link != slot) {
+            link = &files_[*link].hash_next;
+        }
+        if (*link == slot) {
+            *link = files_[slot].hash_next;
+        }
+        files_[slot].hash_next = INVALID_SLOT;
+    }
+
+    uint32_t hashLookup(const char* name) const {
+        uint32_t slot = buckets_[hashName(name)];
+        while (slot != INVALID_SLOT) {
+            if (files_[slot].in_use && strcmp(files_[slot].name, name) == 0) {
+                return slot;
+            }
+            slot = files_[slot].hash_next;
+        }
+        return INVALID_SLOT;
+    }
+
+    uint32_t findFreeSlot() const {
+        for (uint32_t i = 0; i < MAX_FILES; i++) {
+            if (!files_[i].in_use) {
+                return i;
+            }
+        }
+        return INVALID_SLOT;
+    }
+
+    MemFSFile* insertEntry(const char* name, uint32_t mode, bool is_dir) {
+        uint32_t slot = findFreeSlot();
+        if (slot == INVALID_SLOT) {
+            std::cerr << "[MemFS] No free file slots!" << std::endl;
+            return nullptr;
+        }
+        size_t name_len = strlen(name);
+        if (name_len > sizeof(files_[slot].name) - 1) {
+            name_len = sizeof(files_[slot].name) - 1;
+        }
+        memcpy(files_[slot].name, name, name_len);
+        files_[slot].name[name_len] = '\0';
+        files_[slot].mode = mode;
+        files_[slot].in_use = true;
+        files_[slot].is_dir = is_dir;
+        files_[slot].size = 0;
+        files_[slot].freeChunks();
+        hashInsert(slot);
+        num_files_++;
+        return &files_[slot];
+    }
+
+    /**
+     * Make sure every directory on the path exists, creating missing
+     * ones. Callers predate the namespace being hierarchical, so create()
+     * behaves like mkdir -p for intermediate components.
+     */
+    bool ensureParents(const char* name) {
+        char dir[sizeof(files_[0].name)];
+        uint32_t len = 0;
+        for (; name[len] && len + 1 < sizeof(dir); len++) {
+            dir[len] = name[len];
+        }
+        dir[len] = '\0';
+
+        for (uint32_t i = 1; i < len; i++) {
+            if (dir[i] != '/') {
+                continue;
+            }
+            dir[i] = '\0';
+            uint32_t slot = hashLookup(dir);
+            if (slot == INVALID_SLOT) {
+                if (!insertEntry(dir, 0755, true)) {
+                    return false;
+                }
+            } else if (!files_[slot].is_dir) {
+                std::cerr << "[MemFS] Not a directory: " << dir << std::endl;
+                return false;
+            }
+            dir[i] = '/';
+        }
+        return true;
+    }
+
+    /**
+     * True if the directory path has any child entry.
+     */
+    bool hasChildren(const char* dir) const {
+        size_t len = strlen(dir);
+        for (uint32_t i = 0; i < MAX_FILES; i++) {
+            if (!files_[i].in_use) {
+                continue;
+            }
+            const char* name = files_[i].name;
+            if (strncmp(name, dir, len) == 0 && name[len] == '/') {
+                return true;
+            }
+        }
+        return false;
+    }
+
 public:
-    MemFS() : num_files_(0) {}
-    
+    MemFS() : num_files_(0) {
+        for (uint32_t i = 0; i < HASH_BUCKETS; i++) {
+            buckets_[i] = INVALID_SLOT;
+        }
+    }
+
     /**
-     * Create a new file.
+     * Create a new file (intermediate directories are created as needed).
      * Returns pointer to file, or nullptr if failed.
      */
     MemFSFile* create(const char* name, uint32_t mode) {
@@ -146,81 +406,103 @@ public:
         if (existing) {
             return existing;  // Already exists
         }
-        
-        // Find free slot
-        for (uint32_t i = 0; i < MAX_FILES; i++) {
-            if (!files_[i].in_use) {
-                strncpy(files_[i].name, name, sizeof(files_[i].name) - 1);
-                files_[i].name[sizeof(files_[i].name) - 1] = '\0';
-                files_[i].mode = mode;
-                files_[i].in_use = true;
-                files_[i].size = 0;
-                files_[i].capacity = 0;
-                files_[i].data = nullptr;
-                num_files_++;
-                
-                std::cout << "[MemFS] Created file: " << name << std::endl;
-                
-                return &files_[i];
-            }
+
+        if (!ensureParents(name)) {
+            return nullptr;
         }
-        
-        std::cerr << "[MemFS] No free file slots!" << std::endl;
-        return nullptr;
+
+        MemFSFile* file = insertEntry(name, mode, false);
+        if (file) {
+            std::cout << "[MemFS] Created file: " << name << std::endl;
+        }
+        return file;
+    }
+
+    /**
+     * Create a directory (and any missing parents).
+     */
+    MemFSFile* mkdir(const char* name, uint32_t mode) {
+        uint32_t slot = hashLookup(name);
+        if (slot != INVALID_SLOT) {
+            return files_[slot].is_dir ? &files_[slot] : nullptr;
+        }
+        if (!ensureParents(name)) {
+            return nullptr;
+        }
+        MemFSFile* dir = insertEntry(name, mode, true);
+        if (dir) {
+            std::cout << "[MemFS] Created directory: " << name << std::endl;
+        }
+        return dir;
     }
-    
+
     /**
-     * Look up a file by name.
+     * Look up a file by path (hashed, O(1)).
      * Returns pointer to file, or nullptr if not found.
      */
     MemFSFile* lookup(const char* name) {
-        for (uint32_t i = 0; i < MAX_FILES; i++) {
-            if (files_[i].in_use && strcmp(files_[i].name, name) == 0) {
-                return &files_[i];
-            }
+        uint32_t slot = hashLookup(name);
+        if (slot == INVALID_SLOT || files_[slot].is_dir) {
+            return nullptr;
         }
-        
-        return nullptr;
+        return &files_[slot];
     }
-    
+
     /**
-     * Delete a file.
+     * Look up a directory by path.
+     */
+    MemFSFile* lookupDir(const char* name) {
+        uint32_t slot = hashLookup(name);
+        if (slot == INVALID_SLOT || !files_[slot].is_dir) {
+            return nullptr;
+        }
+        return &files_[slot];
+    }
+
+    /**
+     * Delete a file, or an empty directory.
      */
     bool remove(const char* name) {
-        for (uint32_t i = 0; i < MAX_FILES; i++) {
-            if (files_[i].in_use && strcmp(files_[i].name, name) == 0) {
-                if (files_[i].data) {
-                    free(files_[i].data);
-                    files_[i].data = nullptr;
-                }
-                files_[i].in_use = false;
-                files_[i].size = 0;
-                files_[i].capacity = 0;
-                num_files_--;
-                
-                std::cout << "[MemFS] Deleted file: " << name << std::endl;
-                
-                return true;
-            }
+        uint32_t slot = hashLookup(name);
+        if (slot == INVALID_SLOT) {
+            std::cerr << "[MemFS] File not found: " << name << std::endl;
+            return false;
         }
-        
-        std::cerr << "[MemFS] File not found: " << name << std::endl;
-        return false;
+        if (files_[slot].is_dir && hasChildren(name)) {
+            std::cerr << "[MemFS] Directory not empty: " << name << std::endl;
+            return false;
+        }
+
+        hashRemove(slot);
+        files_[slot].freeChunks();
+        files_[slot].in_use = false;
+        files_[slot].is_dir = false;
+        files_[slot].size = 0;
+        num_files_--;
+
+        std::cout << "[MemFS] Deleted file: " << name << std::endl;
+
+        return true;
     }
-    
+
     /**
      * List all files.
      */
     void list() const {
         std::cout << "[MemFS] Files (" << num_files_ << "):" << std::endl;
         for (uint32_t i = 0; i < MAX_FILES; i++) {
-            if (files_[i].in_use) {
-                std::cout << "  " << files_[i].name 
+            if (!files_[i].in_use) {
+                continue;
+            }
+            if (files_[i].is_dir) {
+                std::cout << "  " << files_[i].name << " (dir)" << std::endl;
+            } else {
+                std::cout << "  " << files_[i].name
                           << " (" << files_[i].size << " bytes)" << std::endl;
             }
         }
     }
-    
+
     /**
      * Get statistics.
      */
@@ -231,10 +513,11 @@ public:
                 total_size += files_[i].size;
             }
         }
-        
+
         std::cout << "[MemFS] Files: " << num_files_ << " / " << MAX_FILES
                   << ", Total size: " << (total_size / 1024) << " KB"
                   << std::endl;
+        memfs_chunk_pool().printStats();
     }
 
     uint32_t list(char* out, uint32_t max) const {
@@ -251,6 +534,9 @@ public:
             while (name[j] && written + 1 < max) {
                 out[written++] = name[j++];
             }
+            if (files_[i].is_dir && written + 1 < max) {
+                out[written++] = '/';
+            }
             if (written + 1 >= max) {
                 break;
             }
@@ -7,21 +7,75 @@
 
 namespace os {
 
+/**
+ * Packet descriptor handed to receivers. `data` points straight into the
+ * device's buffer pool — the consumer reads in place (zero-copy) and
+ * returns the buffer with rse_net_recycle when done.
+ */
+struct NetRxHandle {
+    const uint8_t* data;
+    uint32_t len;
+    uint32_t buf;   // Pool index, opaque to the consumer
+};
+
 #ifdef RSE_KERNEL
 extern "C" int rse_net_init(void);
 extern "C" int rse_net_read(void* buf, uint32_t len);
 extern "C" int rse_net_write(const void* buf, uint32_t len);
+extern "C" int rse_net_send(const rse_iovec* pkts, int count);
+extern "C" int rse_net_recv(NetRxHandle* out, int max);
+extern "C" void rse_net_recycle(const NetRxHandle* handles, int count);
 #else
+/**
+ * Loopback backend: a descriptor ring over a pre-allocated buffer pool.
+ * Sends copy payloads into pool buffers and enqueue descriptors; the
+ * loopback's receive side is the same ring, so packets come back in
+ * order with their boundaries intact (the old byte FIFO had none).
+ */
 struct NetLoopback {
-    static constexpr size_t CAPACITY = 16384;
-    uint8_t buffer[CAPACITY];
-    size_t head;
-    size_t tail;
-    size_t size;
+    static constexpr uint32_t BUF_SIZE = 2048;    // Max packet bytes
+    static constexpr uint32_t NUM_BUFS = 64;
+    static constexpr uint32_t RING_SIZE = 64;     // Power of two
+    static constexpr uint32_t RING_MASK = RING_SIZE - 1;
+
+    struct Desc {
+        uint32_t buf;
+        uint32_t len;
+    };
+
+    uint8_t pool[NUM_BUFS][BUF_SIZE];
+    uint32_t free_stack[NUM_BUFS];
+    uint32_t free_top;
+
+    Desc ring[RING_SIZE];
+    uint32_t head;   // Next descriptor to receive
+    uint32_t tail;   // Next descriptor slot to fill
     bool online;
 
-    NetLoopback() : head(0), tail(0), size(0), online(false) {
-        std::memset(buffer, 0, sizeof(buffer));
+    NetLoopback() : free_top(NUM_BUFS), head(0), tail(0), online(false) {
+        for (uint32_t i = 0; i < NUM_BUFS; ++i) {
+            free_stack[i] = NUM_BUFS - 1 - i;
+        }
+        std::memset(pool, 0, sizeof(pool));
+        std::memset(ring, 0, sizeof(ring));
+    }
+
+    uint32_t queued() const {
+        return tail - head;
+    }
+
+    bool allocBuf(uint32_t* out) {
+        if (free_top == 0) {
+            return false;
+        }
+        *out = free_stack[--free_top];
+        return true;
+    }
+
+    void releaseBuf(uint32_t buf) {
+        if (buf < NUM_BUFS && free_top < NUM_BUFS) {
+            free_stack[free_top++] = buf;
+        }
     }
 };
 
@@ -36,22 +90,99 @@ inline int rse_net_init(void) {
     return 0;
 }
 
+/**
+ * Batch send: one packet per iovec segment. Payloads are copied into
+ * pool buffers and descriptors enqueued. Returns packets accepted
+ * (short when the ring or pool fills).
+ */
+inline int rse_net_send(const rse_iovec* pkts, int count) {
+    NetLoopback& state = net_loopback();
+    if (!state.online) {
+        return -1;
+    }
+    if (!pkts || count <= 0) {
+        return 0;
+    }
+    int sent = 0;
+    for (int i = 0; i < count; ++i) {
+        const uint8_t* src = reinterpret_cast<const uint8_t*>(pkts[i].base);
+        uint64_t len = pkts[i].len;
+        if (!src || len == 0 || len > NetLoopback::BUF_SIZE) {
+            break;
+        }
+        if (state.queued() >= NetLoopback::RING_SIZE) {
+            break;
+        }
+        uint32_t buf = 0;
+        if (!state.allocBuf(&buf)) {
+            break;
+        }
+        std::memcpy(state.pool[buf], src, len);
+        NetLoopback::Desc& desc = state.ring[state.tail & NetLoopback::RING_MASK];
+        desc.buf = buf;
+        desc.len = (uint32_t)len;
+        state.tail++;
+        sent++;
+    }
+    return sent;
+}
+
+/**
+ * Batch receive, zero-copy: pops up to `max` descriptors and hands out
+ * pointers into the buffer pool. Buffers stay owned by the consumer
+ * until returned via rse_net_recycle.
+ */
+inline int rse_net_recv(NetRxHandle* out, int max) {
+    NetLoopback& state = net_loopback();
+    if (!state.online) {
+        return -1;
+    }
+    if (!out || max <= 0) {
+        return 0;
+    }
+    int received = 0;
+    while (received < max && state.queued() > 0) {
+        const NetLoopback::Desc& desc =
+            state.ring[state.head & NetLoopback::RING_MASK];
+        out[received].data = state.pool[desc.buf];
+        out[received].len = desc.len;
+        out[received].buf = desc.buf;
+        state.head++;
+        received++;
+    }
+    return received;
+}
+
+/**
+ * Return received buffers to the pool.
+ */
+inline void rse_net_recycle(const NetRxHandle* handles, int count) {
+    NetLoopback& state = net_loopback();
+    if (!handles || count <= 0) {
+        return;
+    }
+    for (int i = 0; i < count; ++i) {
+        state.releaseBuf(handles[i].buf);
+    }
+}
+
+// Byte-oriented shims kept for existing callers: one write = one
+// packet, one read = one packet (truncated if the buffer is short)
+
 inline int rse_net_read(void* buf, uint32_t len) {
     NetLoopback& state = net_loopback();
     if (!state.online || !buf || len == 0) {
         return state.online ? 0 : -1;
     }
-    if (state.size == 0) {
-        return 0;
-    }
-    uint32_t to_read = len < state.size ? len : (uint32_t)state.size;
-    uint8_t* out = static_cast<uint8_t*>(buf);
-    for (uint32_t i = 0; i < to_read; ++i) {
-        out[i] = state.buffer[state.head];
-        state.head = (state.head + 1) % NetLoopback::CAPACITY;
+    NetRxHandle handle;
+    int got = rse_net_recv(&handle, 1);
+    if (got <= 0) {
+        return got;
     }
-    state.size -= to_read;
-    return (int)to_read;
+    uint32_t to_copy = handle.len < len ? handle.len : len;
+    std::memcpy(buf, handle.data, to_copy);
+    rse_net_recycle(&handle, 1);
+    return (int)to_copy;
 }
 
 inline int rse_net_write(const void* buf, uint32_t len) {
@@ -59,15 +190,14 @@ inline int rse_net_write(const void* buf, uint32_t len) {
     if (!state.online || !buf || len == 0) {
         return state.online ? 0 : -1;
     }
-    size_t space = NetLoopback::CAPACITY - state.size;
-    uint32_t to_write = len < space ? len : (uint32_t)space;
-    const uint8_t* in = static_cast<const uint8_t*>(buf);
-    for (uint32_t i = 0; i < to_write; ++i) {
-        state.buffer[state.tail] = in[i];
-        state.tail = (state.tail + 1) % NetLoopback::CAPACITY;
+    rse_iovec pkt;
+    pkt.base = (uint64_t)buf;
+    pkt.len = len;
+    int sent = rse_net_send(&pkt, 1);
+    if (sent < 0) {
+        return -1;
     }
-    state.size += to_write;
-    return (int)to_write;
+    return sent == 1 ? (int)len : 0;
 }
 #endif
 
@@ -99,6 +229,46 @@ inline ssize_t net_write(Device* dev, const void* buf, size_t count) {
     return ret < 0 ? -1 : (ssize_t)ret;
 }
 
+/**
+ * Vectored ops map segments to packets: one writev is one batch send,
+ * one readv drains one packet per segment.
+ */
+inline ssize_t net_writev(Device* dev, const rse_iovec* iov, int iovcnt) {
+    (void)dev;
+    if (!iov || iovcnt <= 0) {
+        return 0;
+    }
+    int sent = rse_net_send(iov, iovcnt);
+    if (sent < 0) {
+        return -1;
+    }
+    ssize_t total = 0;
+    for (int i = 0; i < sent; ++i) {
+        total += (ssize_t)iov[i].len;
+    }
+    return total;
+}
+
+inline ssize_t net_readv(Device* dev, const rse_iovec* iov, int iovcnt) {
+    (void)dev;
+    if (!iov || iovcnt <= 0) {
+        return 0;
+    }
+    ssize_t total = 0;
+    for (int seg = 0; seg < iovcnt; ++seg) {
+        uint8_t* dst = reinterpret_cast<uint8_t*>(iov[seg].base);
+        if (!dst || iov[seg].len == 0) {
+            continue;
+        }
+        int got = rse_net_read(dst, (uint32_t)iov[seg].len);
+        if (got <= 0) {
+            break;
+        }
+        total += (ssize_t)got;
+    }
+    return total;
+}
+
 inline int net_ioctl(Device* dev, unsigned long request, void* arg) {
     (void)dev;
     (void)request;
@@ -119,6 +289,8 @@ inline Device* create_net_device(const char* name) {
     dev->read = net_read;
     dev->write = net_write;
     dev->ioctl = net_ioctl;
+    dev->readv = net_readv;
+    dev->writev = net_writev;
     return dev;
 }
 
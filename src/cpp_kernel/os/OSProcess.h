@@ -1,10 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <cstring>
 #include "VirtualAllocator.h"
 #include "ElfLoader.h"
+#include "ElfImageCache.h"
 #include "FileDescriptor.h"
+#include "Syscall.h"
+#include "../FixedStructures.h"
 #ifdef RSE_KERNEL
 #include "KernelStubs.h"
 #else
@@ -13,6 +17,16 @@
 
 struct rse_syscalls;
 
+// Per-process syscall accounting: one plain counter per syscall number,
+// bumped on the dispatch path and reported by sys_ps. Define
+// RSE_NO_SYSCALL_STATS to compile the counters and every accounting
+// site out entirely.
+#if !defined(RSE_NO_SYSCALL_STATS)
+#define RSE_SYSCALL_STATS_ENABLED 1
+#else
+#define RSE_SYSCALL_STATS_ENABLED 0
+#endif
+
 /**
  * OSProcess: Real operating system process abstraction.
  * 
@@ -46,27 +60,59 @@ enum class ProcessState : uint8_t {
 
 /**
  * CPU context - saved/restored during context switch.
- * Simplified x86-64 register set.
+ * Simplified x86-64 register set, cache-aligned and split in two:
+ * the core (pointers, callee-saved registers, flags) moves on every
+ * switch; the extended scratch registers live on their own line and move
+ * only when the process has dirtied them, so a switch between processes
+ * that never touch them copies a single line.
  */
-struct CPUContext {
-    // Instruction and stack pointers
+struct alignas(64) CPUContext {
+    // ----- Core state: always saved/restored -----
     uint64_t rip;  // Instruction pointer
     uint64_t rsp;  // Stack pointer
     uint64_t rbp;  // Base pointer
-    
-    // General purpose registers
-    uint64_t rax, rbx, rcx, rdx;
-    uint64_t rsi, rdi;
-    uint64_t r8, r9, r10, r11, r12, r13, r14, r15;
-    
-    // Flags
+    uint64_t rbx, r12, r13, r14, r15;  // Callee-saved
     uint64_t rflags;
-    
+
+    // ----- Extended state: caller-saved scratch, lazily saved -----
+    alignas(64) uint64_t rax, rcx, rdx;
+    uint64_t rsi, rdi;
+    uint64_t r8, r9, r10, r11;
+
     CPUContext() {
         std::memset(this, 0, sizeof(CPUContext));
     }
+
+    void copyCore(const CPUContext& src) {
+        rip = src.rip;
+        rsp = src.rsp;
+        rbp = src.rbp;
+        rbx = src.rbx;
+        r12 = src.r12;
+        r13 = src.r13;
+        r14 = src.r14;
+        r15 = src.r15;
+        rflags = src.rflags;
+    }
+
+    void copyExt(const CPUContext& src) {
+        rax = src.rax;
+        rcx = src.rcx;
+        rdx = src.rdx;
+        rsi = src.rsi;
+        rdi = src.rdi;
+        r8 = src.r8;
+        r9 = src.r9;
+        r10 = src.r10;
+        r11 = src.r11;
+    }
 };
 
+static_assert(alignof(CPUContext) == 64,
+              "CPUContext must start on a cache line");
+static_assert(offsetof(CPUContext, rax) % 64 == 0,
+              "Extended state must start on its own cache line");
+
 /**
  * Memory layout for a process.
  */
@@ -116,6 +162,7 @@ public:
     CPUContext context;
     CPUContext saved_context;
     bool context_saved;
+    bool ext_state_dirty;       // Extended registers need save/restore
     
     // ========== Memory ==========
     MemoryLayout memory;
@@ -125,12 +172,32 @@ public:
     uint64_t time_slice;        // Ticks remaining in current slice
     uint64_t total_runtime;     // Total ticks this process has run
     uint64_t last_scheduled;    // Last time this process was scheduled
+
+#if RSE_SYSCALL_STATS_ENABLED
+    // Invocation count per syscall number; the dispatcher bumps the
+    // slot once per call. Sized past the highest registered number so
+    // new syscalls never need a resize.
+    static constexpr uint32_t SYSCALL_STATS_SLOTS = 128;
+    uint64_t syscall_counts[SYSCALL_STATS_SLOTS];
+#endif
+
+    // Intrusive ready/wait-queue links (owned by TorusScheduler)
+    OSProcess* sched_next;
+    OSProcess* sched_prev;
+    uint32_t sched_level;
+    uint64_t wait_channel;      // Channel key while blocked (0 = none)
     
     // ========== I/O ==========
     FileDescriptorTable fd_table;
 
     VirtualAllocator* vmem;
 
+    // Kernel-side view of the read-only shared info page (vDSO-style)
+    VdsoInfoPage* vdso_page;
+
+    // Inbound cross-torus messages, delivered by the mesh drain
+    FixedVector<TorusMessage, 16> mailbox;
+
     // Optional userspace entry hook (cooperative in-kernel runner)
     using UserStepFn = void (*)(OSProcess* proc, void* user_ctx, const ::rse_syscalls* sys);
     UserStepFn user_step;
@@ -151,18 +218,27 @@ public:
           context(),
           saved_context(),
           context_saved(false),
+          ext_state_dirty(false),
           memory(),
           priority(100),          // Default priority
           time_slice(100),        // Default time slice
           total_runtime(0),
           last_scheduled(0),
+          sched_next(nullptr),
+          sched_prev(nullptr),
+          sched_level(0),
+          wait_channel(0),
           fd_table(),
           vmem(nullptr),
+          vdso_page(nullptr),
           user_step(nullptr),
           user_ctx(nullptr),
           syscalls(nullptr),
           x(0), y(0), z(0)
     {
+#if RSE_SYSCALL_STATS_ENABLED
+        std::memset(syscall_counts, 0, sizeof(syscall_counts));
+#endif
     }
 
     void initMemory(PhysicalAllocator* phys_alloc) {
@@ -174,6 +250,61 @@ public:
         memory.heap_start = vmem->getHeapStart();
         memory.heap_end = vmem->getHeapEnd();
         memory.heap_brk = vmem->getHeapBrk();
+
+        initVdsoPage(phys_alloc);
+    }
+
+    /**
+     * Map this process's shared info page read-only at VDSO_BASE so
+     * informational queries are plain loads; the kernel writes through
+     * vdso_page. Replaces any inherited mapping (fork clones the parent's
+     * table, so the child must get its own frame).
+     */
+    bool initVdsoPage(PhysicalAllocator* phys_alloc) {
+        if (!memory.page_table || !phys_alloc) {
+            return false;
+        }
+        uint64_t frame = phys_alloc->allocateFrame();
+        if (frame == 0) {
+            return false;
+        }
+        // A table inherited from fork maps the parent's page copy-on-write;
+        // drop that reference before installing our own frame.
+        const PageTableEntry* old = memory.page_table->getPTE(VDSO_BASE);
+        if (old && old->isPresent() && (old->value & PTE_COW)) {
+            phys_alloc->freeFrame(old->getPhysAddr());
+        }
+        memory.page_table->unmap(VDSO_BASE);
+        if (!memory.page_table->map(VDSO_BASE, frame, PTE_PRESENT | PTE_USER)) {
+            phys_alloc->freeFrame(frame);
+            return false;
+        }
+        vdso_page = static_cast<VdsoInfoPage*>(phys_alloc->ptrFromPhys(frame));
+        if (vdso_page) {
+            std::memset(vdso_page, 0, sizeof(VdsoInfoPage));
+            vdso_page->pid = pid;
+            vdso_page->ppid = parent_pid;
+            vdso_page->torus_id = torus_id;
+            vdso_page->version = 1;
+        }
+        return vdso_page != nullptr;
+    }
+
+    /**
+     * Refresh the shared info page with current scheduler state. Called by
+     * the torus scheduler each tick for the running process.
+     */
+    void updateVdso(uint64_t ticks, uint64_t context_switches,
+                    uint32_t process_count, uint32_t ready_count) {
+        if (!vdso_page) {
+            return;
+        }
+        vdso_page->ticks = ticks;
+        vdso_page->runtime = total_runtime;
+        vdso_page->context_switches = context_switches;
+        vdso_page->process_count = process_count;
+        vdso_page->ready_count = ready_count;
+        vdso_page->version++;
     }
 
     bool loadElfImage(const uint8_t* data, size_t size, uint64_t stack_size = 64 * 1024) {
@@ -223,6 +354,104 @@ public:
             return false;
         }
 
+        return finishImageLoad(image.entry, min_vaddr, max_vaddr,
+                               data_start, data_end, has_writable,
+                               stack_size);
+    }
+
+    /**
+     * Populate the address space from a cached image: read-only segments
+     * map the cache's shared frames copy-on-write (no parse, no copy),
+     * writable segments copy their initialization bytes out of the cache.
+     */
+    bool loadElfImageShared(const ElfImageCache::CachedElf& img,
+                            uint64_t stack_size = 64 * 1024) {
+        if (!vmem || !img.valid) {
+            return false;
+        }
+
+        uint64_t min_vaddr = 0xFFFFFFFFFFFFFFFFull;
+        uint64_t max_vaddr = 0;
+        uint64_t data_start = 0xFFFFFFFFFFFFFFFFull;
+        uint64_t data_end = 0;
+        bool has_writable = false;
+
+        for (size_t i = 0; i < img.ro_ranges.size(); ++i) {
+            const ElfImageCache::SharedRange& r = img.ro_ranges[i];
+            uint64_t page_base = align_down(r.vaddr);
+            for (uint32_t p = 0; p < r.page_count; ++p) {
+                if (!vmem->mapSharedFrame(page_base + p * PAGE_SIZE,
+                                          img.frames[r.first_frame + p],
+                                          PTE_USER)) {
+                    return false;
+                }
+            }
+            if (r.vaddr < min_vaddr) {
+                min_vaddr = r.vaddr;
+            }
+            if (r.vaddr + r.memsz > max_vaddr) {
+                max_vaddr = r.vaddr + r.memsz;
+            }
+        }
+
+        for (size_t i = 0; i < img.data_ranges.size(); ++i) {
+            const ElfImageCache::DataRange& d = img.data_ranges[i];
+            if (!vmem->mapSegment(img.data_bytes + d.data_off, d.filesz,
+                                  d.vaddr, d.memsz, d.flags)) {
+                return false;
+            }
+            has_writable = true;
+            if (d.vaddr < min_vaddr) {
+                min_vaddr = d.vaddr;
+            }
+            if (d.vaddr + d.memsz > max_vaddr) {
+                max_vaddr = d.vaddr + d.memsz;
+            }
+            if (d.vaddr < data_start) {
+                data_start = d.vaddr;
+            }
+            if (d.vaddr + d.memsz > data_end) {
+                data_end = d.vaddr + d.memsz;
+            }
+        }
+
+        if (min_vaddr == 0xFFFFFFFFFFFFFFFFull) {
+            return false;
+        }
+
+        return finishImageLoad(img.entry, min_vaddr, max_vaddr,
+                               data_start, data_end, has_writable,
+                               stack_size);
+    }
+
+    bool loadElfImageWithArgs(const uint8_t* data, size_t size,
+                              const char* const* argv,
+                              const char* const* envp,
+                              uint64_t stack_size = 64 * 1024) {
+        if (!loadElfImage(data, size, stack_size)) {
+            return false;
+        }
+        return setupUserStack(argv, envp);
+    }
+
+    bool loadElfImageSharedWithArgs(const ElfImageCache::CachedElf& img,
+                                    const char* const* argv,
+                                    const char* const* envp,
+                                    uint64_t stack_size = 64 * 1024) {
+        if (!loadElfImageShared(img, stack_size)) {
+            return false;
+        }
+        return setupUserStack(argv, envp);
+    }
+
+    /**
+     * Shared tail of the image loaders: record the layout, place heap and
+     * stack, and point the context at the entry.
+     */
+    bool finishImageLoad(uint64_t entry, uint64_t min_vaddr,
+                         uint64_t max_vaddr, uint64_t data_start,
+                         uint64_t data_end, bool has_writable,
+                         uint64_t stack_size) {
         memory.code_start = min_vaddr;
         memory.code_end = max_vaddr;
         if (has_writable) {
@@ -248,23 +477,13 @@ public:
         memory.stack_start = memory.stack_end - stack_bytes + guard;
         memory.stack_pointer = sp;
 
-        context.rip = image.entry;
+        context.rip = entry;
         context.rsp = sp;
         if (context.rflags == 0) {
             context.rflags = 0x202;
         }
         return true;
     }
-
-    bool loadElfImageWithArgs(const uint8_t* data, size_t size,
-                              const char* const* argv,
-                              const char* const* envp,
-                              uint64_t stack_size = 64 * 1024) {
-        if (!loadElfImage(data, size, stack_size)) {
-            return false;
-        }
-        return setupUserStack(argv, envp);
-    }
     
     // ========== State Management ==========
     
@@ -275,7 +494,10 @@ public:
     
     void setReady() { state = ProcessState::READY; }
     void setRunning() { state = ProcessState::RUNNING; }
-    void setBlocked() { state = ProcessState::BLOCKED; }
+    void setBlocked(uint64_t channel = 0) {
+        state = ProcessState::BLOCKED;
+        wait_channel = channel;
+    }
     void setZombie(int code) { 
         state = ProcessState::ZOMBIE; 
         exit_code = code;
@@ -327,20 +549,27 @@ public:
     
     /**
      * Save CPU context (called when preempting).
-     * For the simulation, capture the tracked register state and stack pointer.
+     * The core line is always captured; the extended scratch registers are
+     * copied only when this process has dirtied them.
      */
     void saveContext() {
-        saved_context = context;
+        saved_context.copyCore(context);
+        if (ext_state_dirty) {
+            saved_context.copyExt(context);
+        }
         context_saved = true;
     }
     
     /**
      * Restore CPU context (called when resuming).
-     * For the simulation, restore the tracked register state.
+     * Skips the extended state of a process that never touched it.
      */
     void restoreContext() {
         if (context_saved) {
-            context = saved_context;
+            context.copyCore(saved_context);
+            if (ext_state_dirty) {
+                context.copyExt(saved_context);
+            }
         }
         if (context.rsp == 0 && memory.stack_pointer != 0) {
             context.rsp = memory.stack_pointer;
@@ -506,6 +735,7 @@ private:
         context.rdi = argc;
         context.rsi = argv_ptr;
         context.rdx = envp_ptr;
+        ext_state_dirty = true;
         if (context.rflags == 0) {
             context.rflags = 0x202;
         }
@@ -32,6 +32,38 @@ constexpr uint64_t PTE_USER      = (1ULL << 2);  // User mode can access
 constexpr uint64_t PTE_ACCESSED  = (1ULL << 3);  // Page was accessed
 constexpr uint64_t PTE_DIRTY     = (1ULL << 4);  // Page was written to
 
+// Large-page flag: the L1 entry maps a whole 4MB region directly (one L1
+// slot covers 22 address bits in this 10/10/12 layout), skipping the L2 walk.
+constexpr uint64_t PTE_LARGE     = (1ULL << 7);
+
+// Software flag (ignored by translation): frame contents are undefined and
+// must be zeroed on first touch. Set by VirtualAllocator when it defers
+// zeroing at map time; cleared by faultIn() when the page is first accessed.
+constexpr uint64_t PTE_LAZY_ZERO = (1ULL << 9);
+
+// Software flag (ignored by translation): the frame is shared with other
+// holders (the ELF image cache, or the other side of a fork). Reads go to
+// the shared frame; the first write through VirtualAllocator copies it
+// into a private frame and drops the flag. Unmap drops this mapping's
+// reference with the physical allocator rather than recycling the frame.
+constexpr uint64_t PTE_COW       = (1ULL << 10);
+
+// Software flag (ignored by translation): the page belongs to a
+// file-backed mapping and has not been filled yet. faultIn() pulls the
+// file contents into the frame on first touch and drops the flag, so
+// only pages the process actually reads ever do I/O.
+constexpr uint64_t PTE_FILE      = (1ULL << 11);
+
+// Software flag (ignored by translation): demand-paged anonymous
+// mapping. The entry is not present and owns no frame; faultIn()
+// allocates and zeroes one on first touch, so untouched pages of a
+// large speculative mapping never cost memory or time. The protection
+// bits are carried in the entry until then.
+constexpr uint64_t PTE_DEMAND    = (1ULL << 8);
+
+// Large page geometry: one L1 entry spans L2_ENTRIES small pages
+constexpr uint64_t LARGE_PAGE_SIZE = PAGE_SIZE * L2_ENTRIES;  // 4MB
+
 // Extract page table indices from virtual address
 inline uint32_t get_l1_index(uint64_t virt_addr) {
     return (virt_addr >> 22) & 0x3FF;  // Bits 22-31
@@ -161,11 +193,27 @@ inline L2PageTable* alloc_kernel_l2_table() {
  */
 class PageTable {
 private:
+    // Direct-mapped software TLB consulted before the L1+L2 walk.
+    // Indexed by low bits of the virtual page number; invalidated on unmap.
+    static constexpr uint32_t TLB_ENTRIES = 64;
+    static constexpr uint64_t TLB_INVALID_VPN = UINT64_MAX;
+
+    struct TlbEntry {
+        uint64_t vpn;         // Virtual page number (virt >> PAGE_SHIFT)
+        uint64_t frame_addr;  // Physical address of the backing 4KB page
+    };
+
     L2PageTable* l2_tables_[L1_ENTRIES];
-    
+    PageTableEntry l1_large_[L1_ENTRIES];  // PTE_LARGE mappings live in L1
+
+    mutable TlbEntry tlb_[TLB_ENTRIES];
+    mutable uint64_t tlb_hits_ = 0;
+    mutable uint64_t tlb_misses_ = 0;
+
 public:
     PageTable() {
         std::memset(l2_tables_, 0, sizeof(l2_tables_));
+        flushTLB();
     }
     
 #ifdef RSE_KERNEL
@@ -187,7 +235,12 @@ public:
     bool map(uint64_t virt_addr, uint64_t phys_addr, uint64_t flags = PTE_PRESENT | PTE_WRITABLE | PTE_USER) {
         uint32_t l1_idx = get_l1_index(virt_addr);
         uint32_t l2_idx = get_l2_index(virt_addr);
-        
+
+        // Region already owned by a large page
+        if (l1_large_[l1_idx].isPresent()) {
+            return false;
+        }
+
         // Allocate L2 table if needed
         if (!l2_tables_[l1_idx]) {
 #ifdef RSE_KERNEL
@@ -204,43 +257,101 @@ public:
         PageTableEntry& pte = (*l2_tables_[l1_idx])[l2_idx];
         pte.setPhysAddr(phys_addr);
         pte.value |= flags;
-        
+        invalidateTLB(virt_addr);
+
         return true;
     }
-    
+
     /**
-     * Unmap a virtual address.
+     * Map a 4MB region with a single large-page L1 entry.
+     * Both addresses must be 4MB-aligned; fails if the region already has
+     * small-page mappings.
+     */
+    bool mapLarge(uint64_t virt_addr, uint64_t phys_addr, uint64_t flags = PTE_PRESENT | PTE_WRITABLE | PTE_USER) {
+        if ((virt_addr & (LARGE_PAGE_SIZE - 1)) != 0 ||
+            (phys_addr & (LARGE_PAGE_SIZE - 1)) != 0) {
+            return false;
+        }
+        uint32_t l1_idx = get_l1_index(virt_addr);
+        if (l2_tables_[l1_idx] || l1_large_[l1_idx].isPresent()) {
+            return false;
+        }
+        PageTableEntry& pte = l1_large_[l1_idx];
+        pte.setPhysAddr(phys_addr);
+        pte.value |= flags | PTE_PRESENT | PTE_LARGE;
+        return true;
+    }
+
+    /**
+     * Unmap a virtual address (small pages only; see unmapLarge).
      */
     void unmap(uint64_t virt_addr) {
         uint32_t l1_idx = get_l1_index(virt_addr);
         uint32_t l2_idx = get_l2_index(virt_addr);
-        
+
+        invalidateTLB(virt_addr);
+
         if (!l2_tables_[l1_idx]) {
             return;  // Not mapped
         }
-        
+
         // Clear page table entry
         (*l2_tables_[l1_idx])[l2_idx].value = 0;
     }
-    
+
+    /**
+     * Unmap a 4MB large-page region.
+     */
+    void unmapLarge(uint64_t virt_addr) {
+        uint32_t l1_idx = get_l1_index(virt_addr);
+        if (!l1_large_[l1_idx].isPresent()) {
+            return;
+        }
+        l1_large_[l1_idx].value = 0;
+        // The region spans many TLB slots; a full flush is cheaper than
+        // invalidating 1024 page entries one by one.
+        flushTLB();
+    }
+
     /**
      * Translate virtual address to physical address.
      * Returns 0 if not mapped.
      */
     uint64_t translate(uint64_t virt_addr) const {
+        uint64_t vpn = virt_addr >> PAGE_SHIFT;
+        uint32_t offset = get_page_offset(virt_addr);
+
+        // TLB hit: no walk
+        TlbEntry& slot = tlb_[vpn & (TLB_ENTRIES - 1)];
+        if (slot.vpn == vpn) {
+            tlb_hits_++;
+            return slot.frame_addr + offset;
+        }
+        tlb_misses_++;
+
         uint32_t l1_idx = get_l1_index(virt_addr);
         uint32_t l2_idx = get_l2_index(virt_addr);
-        uint32_t offset = get_page_offset(virt_addr);
-        
+
+        // Large page: one L1 entry covers the whole region
+        if (l1_large_[l1_idx].isPresent()) {
+            uint64_t frame_addr = l1_large_[l1_idx].getPhysAddr() +
+                                  (align_down(virt_addr) & (LARGE_PAGE_SIZE - 1));
+            slot.vpn = vpn;
+            slot.frame_addr = frame_addr;
+            return frame_addr + offset;
+        }
+
         if (!l2_tables_[l1_idx]) {
             return 0;  // Not mapped
         }
-        
+
         const PageTableEntry& pte = (*l2_tables_[l1_idx])[l2_idx];
         if (!pte.isPresent()) {
             return 0;  // Not present
         }
-        
+
+        slot.vpn = vpn;
+        slot.frame_addr = pte.getPhysAddr();
         return pte.getPhysAddr() + offset;
     }
     
@@ -251,39 +362,51 @@ public:
     PageTableEntry* getPTE(uint64_t virt_addr) {
         uint32_t l1_idx = get_l1_index(virt_addr);
         uint32_t l2_idx = get_l2_index(virt_addr);
-        
+
+        if (l1_large_[l1_idx].isPresent()) {
+            return &l1_large_[l1_idx];
+        }
+
         if (!l2_tables_[l1_idx]) {
             return nullptr;
         }
-        
+
         return &(*l2_tables_[l1_idx])[l2_idx];
     }
 
     const PageTableEntry* getPTE(uint64_t virt_addr) const {
         uint32_t l1_idx = get_l1_index(virt_addr);
         uint32_t l2_idx = get_l2_index(virt_addr);
-        
+
+        if (l1_large_[l1_idx].isPresent()) {
+            return &l1_large_[l1_idx];
+        }
+
         if (!l2_tables_[l1_idx]) {
             return nullptr;
         }
-        
+
         return &(*l2_tables_[l1_idx])[l2_idx];
     }
-    
+
     /**
      * Check if a virtual address is mapped.
      */
     bool isMapped(uint64_t virt_addr) const {
         uint32_t l1_idx = get_l1_index(virt_addr);
         uint32_t l2_idx = get_l2_index(virt_addr);
-        
+
+        if (l1_large_[l1_idx].isPresent()) {
+            return true;
+        }
+
         if (!l2_tables_[l1_idx]) {
             return false;
         }
-        
+
         return (*l2_tables_[l1_idx])[l2_idx].isPresent();
     }
-    
+
     /**
      * Change protection flags for a virtual address.
      */
@@ -292,14 +415,43 @@ public:
         if (!pte || !pte->isPresent()) {
             return false;
         }
-        
-        // Preserve frame, update flags
+
+        // Preserve frame and page-size marker, update flags
         uint64_t frame = pte->getFrame();
-        pte->value = (frame << 12) | flags | PTE_PRESENT;
-        
+        pte->value = (frame << 12) | flags | PTE_PRESENT | (pte->value & PTE_LARGE);
+
         return true;
     }
+
+    /**
+     * Drop all cached translations.
+     */
+    void flushTLB() const {
+        for (uint32_t i = 0; i < TLB_ENTRIES; i++) {
+            tlb_[i].vpn = TLB_INVALID_VPN;
+            tlb_[i].frame_addr = 0;
+        }
+    }
     
+    /**
+     * Visit every present small-page entry. Large-page mappings stay with
+     * their owner and are not visited.
+     */
+    template <typename Fn>
+    void forEachEntry(Fn&& fn) {
+        for (uint32_t i = 0; i < L1_ENTRIES; i++) {
+            if (!l2_tables_[i]) {
+                continue;
+            }
+            for (uint32_t j = 0; j < L2_ENTRIES; j++) {
+                PageTableEntry& pte = (*l2_tables_[i])[j];
+                if (pte.isPresent()) {
+                    fn(pte);
+                }
+            }
+        }
+    }
+
     /**
      * Copy page table (for fork).
      */
@@ -309,20 +461,21 @@ public:
             return nullptr;
         }
         
-        // Copy all L2 tables
+        // Copy all L2 tables and large-page entries
         for (uint32_t i = 0; i < L1_ENTRIES; i++) {
+            new_pt->l1_large_[i] = l1_large_[i];
             if (l2_tables_[i]) {
                 new_pt->l2_tables_[i] = new L2PageTable();
                 if (!new_pt->l2_tables_[i]) {
                     delete new_pt;
                     return nullptr;
                 }
-                
+
                 // Copy entries
                 std::memcpy(new_pt->l2_tables_[i], l2_tables_[i], sizeof(L2PageTable));
             }
         }
-        
+
         return new_pt;
     }
     
@@ -332,11 +485,15 @@ public:
     void printStats() const {
         uint32_t l2_count = 0;
         uint32_t mapped_pages = 0;
-        
+        uint32_t large_pages = 0;
+
         for (uint32_t i = 0; i < L1_ENTRIES; i++) {
+            if (l1_large_[i].isPresent()) {
+                large_pages++;
+            }
             if (l2_tables_[i]) {
                 l2_count++;
-                
+
                 for (uint32_t j = 0; j < L2_ENTRIES; j++) {
                     if ((*l2_tables_[i])[j].isPresent()) {
                         mapped_pages++;
@@ -344,12 +501,25 @@ public:
                 }
             }
         }
-        
-        std::cout << "[PageTable] L2 tables: " << l2_count 
+
+        uint64_t mapped_bytes = static_cast<uint64_t>(mapped_pages) * PAGE_SIZE +
+                                static_cast<uint64_t>(large_pages) * LARGE_PAGE_SIZE;
+        std::cout << "[PageTable] L2 tables: " << l2_count
                   << ", Mapped pages: " << mapped_pages
-                  << ", Memory used: " << (mapped_pages * PAGE_SIZE / 1024) << " KB"
+                  << ", Large pages: " << large_pages
+                  << ", Memory used: " << (mapped_bytes / 1024) << " KB"
+                  << ", TLB: " << tlb_hits_ << " hits / " << tlb_misses_ << " misses"
                   << std::endl;
     }
+
+private:
+    void invalidateTLB(uint64_t virt_addr) const {
+        uint64_t vpn = virt_addr >> PAGE_SHIFT;
+        TlbEntry& slot = tlb_[vpn & (TLB_ENTRIES - 1)];
+        if (slot.vpn == vpn) {
+            slot.vpn = TLB_INVALID_VPN;
+        }
+    }
 };
 
 } // namespace os
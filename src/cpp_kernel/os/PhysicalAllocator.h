@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PageTable.h"
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #ifdef RSE_KERNEL
@@ -11,13 +12,32 @@
 
 /**
  * Physical Memory Allocator for Braided OS
- * 
- * Manages physical RAM frames (4KB each) using a bitmap.
- * O(1) allocation and deallocation.
+ *
+ * Manages physical RAM frames (4KB each) with a binary buddy system:
+ * per-order freelists give O(1) single-frame allocation and constant-time
+ * contiguous multi-frame allocation (ELF segments, DMA buffers, block cache
+ * slabs), with O(1) split and coalesce on free.
  */
 
 namespace os {
 
+// Largest buddy block: 2^10 frames = 4MB
+constexpr uint32_t BUDDY_MAX_ORDER = 10;
+
+/**
+ * Point-in-time view of allocator state, including fragmentation counters.
+ * Plain data, in the same spirit as the kernel allocator's AllocationSnapshot.
+ */
+struct PhysicalAllocSnapshot {
+    uint64_t total_frames;
+    uint64_t free_frames;
+    uint64_t splits;                // Blocks split to satisfy smaller orders
+    uint64_t coalesces;             // Buddy merges performed on free
+    uint64_t failed_allocations;
+    uint64_t free_blocks_per_order[BUDDY_MAX_ORDER + 1];
+    uint32_t largest_free_order;    // Largest order with a free block
+};
+
 /**
  * Simple bitmap for tracking free/used frames.
  */
@@ -58,115 +78,239 @@ public:
         bits_[word] &= ~(1ULL << bit);
     }
     
-    // Find first zero bit (free frame)
+    // Find first zero bit (free frame) via count-trailing-zeros
     uint64_t findFirstZero() const {
         uint64_t num_words = (size_ + 63) / 64;
-        
+
         for (uint64_t w = 0; w < num_words; w++) {
             if (bits_[w] != UINT64_MAX) {
-                // This word has at least one zero bit
-                for (uint64_t b = 0; b < 64; b++) {
-                    uint64_t index = w * 64 + b;
-                    if (index >= size_) return size_;
-                    if (!get(index)) {
-                        return index;
-                    }
-                }
+                uint64_t index = w * 64 +
+                    static_cast<uint64_t>(std::countr_zero(~bits_[w]));
+                return index < size_ ? index : size_;
             }
         }
-        
+
         return size_;  // No free bit found
     }
 };
 
 /**
  * Physical Memory Allocator
- * 
- * Manages physical RAM frames using a bitmap.
+ *
+ * Manages physical RAM frames with per-order buddy freelists.
  */
 class PhysicalAllocator {
 private:
-    Bitmap* free_frames_;
+    static constexpr uint32_t NIL = UINT32_MAX;
+
     uint64_t total_frames_;
     uint64_t free_count_;
     uint64_t base_addr_;  // Base physical address
     uint64_t size_bytes_;
-    
+
+    // Per-frame metadata, indexed by frame number. `order_` and `is_free_`
+    // describe the block headed at that frame; `next_`/`prev_` link free
+    // block heads into their order's freelist (doubly linked so a buddy can
+    // be unlinked in O(1) during coalescing).
+    uint32_t* next_;
+    uint32_t* prev_;
+    uint8_t* order_;
+    uint8_t* is_free_;
+    uint32_t heads_[BUDDY_MAX_ORDER + 1];
+
+    // Reference count per allocated block head. allocateFrames() hands out
+    // one reference; retainFrame() adds more (copy-on-write sharing), and
+    // freeFrames() only returns the block once the last holder drops it.
+    uint16_t* refs_;
+
+    // Fragmentation counters
+    uint64_t split_count_ = 0;
+    uint64_t coalesce_count_ = 0;
+    uint64_t failed_allocations_ = 0;
+
 public:
     /**
      * Initialize with a range of physical memory.
-     * 
+     *
      * @param base_addr Base physical address
      * @param size Total size in bytes
      */
-    PhysicalAllocator(uint64_t base_addr, uint64_t size) 
-        : free_frames_(nullptr),
-          total_frames_(size / PAGE_SIZE),
+    PhysicalAllocator(uint64_t base_addr, uint64_t size)
+        : total_frames_(size / PAGE_SIZE),
           free_count_(size / PAGE_SIZE),
           base_addr_(base_addr),
           size_bytes_(size) {
-        
-        free_frames_ = new Bitmap(total_frames_);
-        
-        std::cout << "[PhysicalAllocator] Initialized with " 
-                  << total_frames_ << " frames (" 
+
+        next_ = new uint32_t[total_frames_];
+        prev_ = new uint32_t[total_frames_];
+        order_ = new uint8_t[total_frames_];
+        is_free_ = new uint8_t[total_frames_];
+        refs_ = new uint16_t[total_frames_];
+        std::memset(order_, 0, total_frames_);
+        std::memset(is_free_, 0, total_frames_);
+        std::memset(refs_, 0, total_frames_ * sizeof(uint16_t));
+        for (uint32_t o = 0; o <= BUDDY_MAX_ORDER; o++) {
+            heads_[o] = NIL;
+        }
+
+        // Seed freelists: carve the range into maximal naturally-aligned
+        // power-of-two blocks (handles totals that aren't a power of two).
+        uint64_t idx = 0;
+        while (idx < total_frames_) {
+            uint32_t o = BUDDY_MAX_ORDER;
+            while (o > 0 && ((idx & ((1ULL << o) - 1)) != 0 ||
+                             idx + (1ULL << o) > total_frames_)) {
+                o--;
+            }
+            listPush(o, static_cast<uint32_t>(idx));
+            idx += 1ULL << o;
+        }
+
+        std::cout << "[PhysicalAllocator] Initialized with "
+                  << total_frames_ << " frames ("
                   << (size / 1024 / 1024) << " MB)" << std::endl;
     }
-    
+
     ~PhysicalAllocator() {
-        delete free_frames_;
+        delete[] next_;
+        delete[] prev_;
+        delete[] order_;
+        delete[] is_free_;
+        delete[] refs_;
     }
-    
+
+    PhysicalAllocator(const PhysicalAllocator&) = delete;
+    PhysicalAllocator& operator=(const PhysicalAllocator&) = delete;
+
     /**
      * Allocate a physical frame.
      * Returns physical address, or 0 if out of memory.
      */
     uint64_t allocateFrame() {
-        if (free_count_ == 0) {
+        return allocateFrames(0);
+    }
+
+    /**
+     * Allocate 2^order contiguous, naturally-aligned frames.
+     * Returns physical address of the first frame, or 0 if out of memory.
+     */
+    uint64_t allocateFrames(uint32_t order) {
+        if (order > BUDDY_MAX_ORDER) {
+            std::cerr << "[PhysicalAllocator] Order too large: " << order << std::endl;
+            failed_allocations_++;
+            return 0;
+        }
+
+        // Smallest order with a free block
+        uint32_t o = order;
+        while (o <= BUDDY_MAX_ORDER && heads_[o] == NIL) {
+            o++;
+        }
+        if (o > BUDDY_MAX_ORDER) {
             std::cerr << "[PhysicalAllocator] Out of memory!" << std::endl;
+            failed_allocations_++;
             return 0;
         }
-        
-        // Find first free frame
-        uint64_t frame_index = free_frames_->findFirstZero();
-        if (frame_index >= total_frames_) {
-            std::cerr << "[PhysicalAllocator] No free frames found!" << std::endl;
+
+        uint32_t idx = heads_[o];
+        listRemove(o, idx);
+
+        // Split down to the requested order, returning upper halves
+        while (o > order) {
+            o--;
+            split_count_++;
+            listPush(o, idx + (1U << o));
+        }
+
+        order_[idx] = static_cast<uint8_t>(order);
+        refs_[idx] = 1;
+        free_count_ -= 1ULL << order;
+        return base_addr_ + (static_cast<uint64_t>(idx) * PAGE_SIZE);
+    }
+
+    /**
+     * Take an additional reference on an allocated block (copy-on-write
+     * sharing). Each reference is dropped by one freeFrames() call. A
+     * saturated count pins the block forever rather than risking an early
+     * free.
+     */
+    void retainFrame(uint64_t phys_addr) {
+        if (phys_addr < base_addr_ || phys_addr >= base_addr_ + size_bytes_) {
+            return;
+        }
+        uint64_t frame_index = (phys_addr - base_addr_) / PAGE_SIZE;
+        if (is_free_[frame_index] || refs_[frame_index] == 0) {
+            std::cerr << "[PhysicalAllocator] Retain of unallocated frame: "
+                      << std::hex << phys_addr << std::dec << std::endl;
+            return;
+        }
+        if (refs_[frame_index] != UINT16_MAX) {
+            refs_[frame_index]++;
+        }
+    }
+
+    /**
+     * References currently held on the block at phys_addr (0 if free).
+     */
+    uint32_t frameRefs(uint64_t phys_addr) const {
+        if (phys_addr < base_addr_ || phys_addr >= base_addr_ + size_bytes_) {
             return 0;
         }
-        
-        // Mark as used
-        free_frames_->set(frame_index);
-        free_count_--;
-        
-        // Return physical address
-        return base_addr_ + (frame_index * PAGE_SIZE);
+        return refs_[(phys_addr - base_addr_) / PAGE_SIZE];
     }
-    
+
     /**
      * Free a physical frame.
      */
     void freeFrame(uint64_t phys_addr) {
+        freeFrames(phys_addr, 0);
+    }
+
+    /**
+     * Free 2^order contiguous frames previously returned by allocateFrames.
+     */
+    void freeFrames(uint64_t phys_addr, uint32_t order) {
         if (phys_addr < base_addr_) {
             std::cerr << "[PhysicalAllocator] Invalid address: " << std::hex << phys_addr << std::dec << std::endl;
             return;
         }
-        
+
         uint64_t frame_index = (phys_addr - base_addr_) / PAGE_SIZE;
-        if (frame_index >= total_frames_) {
+        if (frame_index >= total_frames_ || order > BUDDY_MAX_ORDER ||
+            (frame_index & ((1ULL << order) - 1)) != 0) {
             std::cerr << "[PhysicalAllocator] Frame index out of range: " << frame_index << std::endl;
             return;
         }
-        
-        if (!free_frames_->get(frame_index)) {
+
+        if (is_free_[frame_index]) {
             std::cerr << "[PhysicalAllocator] Double free detected: " << std::hex << phys_addr << std::dec << std::endl;
             return;
         }
-        
-        // Mark as free
-        free_frames_->clear(frame_index);
-        free_count_++;
+
+        // Shared block: drop one reference, free only when the last goes
+        if (refs_[frame_index] > 1) {
+            refs_[frame_index]--;
+            return;
+        }
+        refs_[frame_index] = 0;
+
+        free_count_ += 1ULL << order;
+
+        // Coalesce with free buddies of the same order
+        uint32_t idx = static_cast<uint32_t>(frame_index);
+        while (order < BUDDY_MAX_ORDER) {
+            uint32_t buddy = idx ^ (1U << order);
+            if (buddy >= total_frames_ || !is_free_[buddy] || order_[buddy] != order) {
+                break;
+            }
+            listRemove(order, buddy);
+            coalesce_count_++;
+            idx &= ~(1U << order);
+            order++;
+        }
+        listPush(order, idx);
     }
-    
+
     /**
      * Get number of free frames.
      */
@@ -187,12 +331,45 @@ public:
     void printStats() const {
         uint64_t used = total_frames_ - free_count_;
         double usage_percent = 100.0 * used / total_frames_;
-        
+
         std::cout << "[PhysicalAllocator] "
                   << "Used: " << used << " frames (" << (used * PAGE_SIZE / 1024 / 1024) << " MB), "
                   << "Free: " << free_count_ << " frames (" << (free_count_ * PAGE_SIZE / 1024 / 1024) << " MB), "
                   << "Usage: " << usage_percent << "%"
                   << std::endl;
+
+        PhysicalAllocSnapshot snap = snapshot();
+        std::cout << "[PhysicalAllocator] "
+                  << "Splits: " << snap.splits << ", "
+                  << "Coalesces: " << snap.coalesces << ", "
+                  << "Failed: " << snap.failed_allocations << ", "
+                  << "Largest free block: "
+                  << ((1ULL << snap.largest_free_order) * PAGE_SIZE / 1024) << " KB"
+                  << std::endl;
+    }
+
+    /**
+     * Capture allocator state and fragmentation counters.
+     */
+    PhysicalAllocSnapshot snapshot() const {
+        PhysicalAllocSnapshot snap = {};
+        snap.total_frames = total_frames_;
+        snap.free_frames = free_count_;
+        snap.splits = split_count_;
+        snap.coalesces = coalesce_count_;
+        snap.failed_allocations = failed_allocations_;
+        snap.largest_free_order = 0;
+        for (uint32_t o = 0; o <= BUDDY_MAX_ORDER; o++) {
+            uint64_t count = 0;
+            for (uint32_t idx = heads_[o]; idx != NIL; idx = next_[idx]) {
+                count++;
+            }
+            snap.free_blocks_per_order[o] = count;
+            if (count > 0) {
+                snap.largest_free_order = o;
+            }
+        }
+        return snap;
     }
 
     /**
@@ -204,6 +381,30 @@ public:
         }
         return reinterpret_cast<void*>(phys_addr);
     }
+
+private:
+    void listPush(uint32_t order, uint32_t idx) {
+        next_[idx] = heads_[order];
+        prev_[idx] = NIL;
+        if (heads_[order] != NIL) {
+            prev_[heads_[order]] = idx;
+        }
+        heads_[order] = idx;
+        order_[idx] = static_cast<uint8_t>(order);
+        is_free_[idx] = 1;
+    }
+
+    void listRemove(uint32_t order, uint32_t idx) {
+        if (prev_[idx] != NIL) {
+            next_[prev_[idx]] = next_[idx];
+        } else {
+            heads_[order] = next_[idx];
+        }
+        if (next_[idx] != NIL) {
+            prev_[next_[idx]] = prev_[idx];
+        }
+        is_free_[idx] = 0;
+    }
 };
 
 } // namespace os
@@ -32,6 +32,9 @@ constexpr int SYS_LSEEK     = 14;
 constexpr int SYS_STAT      = 15;
 constexpr int SYS_UNLINK    = 16;
 constexpr int SYS_LIST      = 17;
+constexpr int SYS_READV     = 18;
+constexpr int SYS_WRITEV    = 19;
+constexpr int SYS_OPENAT    = 35;  // File I/O overflow; 10-19 are taken
 
 // Memory management
 constexpr int SYS_BRK       = 20;
@@ -44,12 +47,24 @@ constexpr int SYS_PIPE      = 30;
 constexpr int SYS_DUP       = 31;
 constexpr int SYS_DUP2      = 32;
 constexpr int SYS_SIGNAL    = 33;
+constexpr int SYS_SPLICE    = 34;
 
 // Time
 constexpr int SYS_TIME      = 40;
 constexpr int SYS_SLEEP     = 41;
 constexpr int SYS_NANOSLEEP = 42;
 
+// Batched submission
+constexpr int SYS_BATCH     = 50;
+
+// Cross-torus messaging
+constexpr int SYS_SEND      = 60;
+constexpr int SYS_RECV      = 61;
+
+// Asynchronous block I/O
+constexpr int SYS_BIO_SUBMIT = 70;
+constexpr int SYS_BIO_POLL   = 71;
+
 // ========== Error Codes ==========
 
 #ifndef EPERM
@@ -85,9 +100,18 @@ constexpr int EACCES    = 13;  // Permission denied
 #ifndef EFAULT
 constexpr int EFAULT    = 14;  // Bad address
 #endif
+#ifndef ENOTDIR
+constexpr int ENOTDIR   = 20;  // Not a directory
+#endif
+#ifndef EISDIR
+constexpr int EISDIR    = 21;  // Is a directory
+#endif
 #ifndef EINVAL
 constexpr int EINVAL    = 22;  // Invalid argument
 #endif
+#ifndef ENOSPC
+constexpr int ENOSPC    = 28;  // No space left on device
+#endif
 #ifndef ENOSYS
 constexpr int ENOSYS    = 38;  // Function not implemented
 #endif
@@ -117,12 +141,39 @@ struct rse_stat {
     uint32_t type;
 };
 
+// ========== Vectored I/O ==========
+
+// Upper bound on segments per readv/writev call
+constexpr uint32_t RSE_IOV_MAX = 16;
+
+/**
+ * One scatter-gather segment. Layout matches what drivers consume
+ * directly, so a writev descends to the device without coalescing.
+ */
+struct rse_iovec {
+    uint64_t base;
+    uint64_t len;
+};
+
 // ========== Memory Protection Flags ==========
 
+// Values match the host's <sys/mman.h>, which may have defined these
+// as macros already in hosted builds
+#ifndef PROT_NONE
 constexpr int PROT_NONE  = 0x00;
+#endif
+#ifndef PROT_READ
 constexpr int PROT_READ  = 0x01;
+#endif
+#ifndef PROT_WRITE
 constexpr int PROT_WRITE = 0x02;
+#endif
+#ifndef PROT_EXEC
 constexpr int PROT_EXEC  = 0x04;
+#endif
+
+// mmap flags (arg4): default is an anonymous mapping
+constexpr uint64_t RSE_MAP_FILE = 0x01;  // arg5 = fd, arg6 = file offset
 
 // ========== Seek Whence ==========
 
@@ -142,6 +193,70 @@ constexpr int SEEK_END  = 2;  // Seek from end of file
 constexpr int WNOHANG   = 1;  // Don't block if no child has exited
 #endif
 
+// ========== vDSO-Style Shared Info Page ==========
+
+// Fixed user virtual address of the read-only per-process info page,
+// just below the stack region.
+constexpr uint64_t VDSO_BASE = 0x00007FFF'FFFE0000ULL;
+
+/**
+ * Read-only page the kernel keeps current for each process, so
+ * informational queries (pid, time, scheduler stats) are plain loads
+ * instead of trips through the dispatcher. `version` is bumped after
+ * every kernel update.
+ */
+struct VdsoInfoPage {
+    uint32_t version;
+    uint32_t pid;
+    uint32_t ppid;
+    uint32_t torus_id;
+    uint64_t ticks;             // Scheduler tick count on this torus
+    uint64_t runtime;           // This process's accumulated runtime
+    uint64_t context_switches;  // Torus-wide context switches
+    uint32_t process_count;     // Running + ready + blocked on this torus
+    uint32_t ready_count;
+};
+
+// ========== Cross-Torus Messaging ==========
+
+// Upper bound on tori a mesh connects and on one message's payload.
+constexpr uint32_t MAX_TORI = 8;
+constexpr uint32_t TORUS_MSG_MAX = 64;
+
+/**
+ * One bounded message between processes on (possibly different) tori.
+ * dst_pid 0 addresses whichever process on the destination torus asks first.
+ */
+struct TorusMessage {
+    uint32_t src_torus;
+    uint32_t src_pid;
+    uint32_t dst_pid;
+    uint32_t length;
+    uint8_t payload[TORUS_MSG_MAX];
+};
+
+// ========== Batched Syscall Rings ==========
+
+/**
+ * One entry in the submission ring. `user_data` is an opaque tag echoed back
+ * in the matching completion so callers can pair results with requests.
+ */
+struct SyscallRecord {
+    int32_t number;
+    uint32_t reserved;
+    uint64_t args[6];
+    uint64_t user_data;
+};
+
+/**
+ * One entry in the completion ring: the handler's return value plus the
+ * submitter's tag.
+ */
+struct SyscallCompletion {
+    uint64_t user_data;
+    int64_t result;
+};
+
 // ========== System Call Handler Type ==========
 
 typedef int64_t (*syscall_handler_t)(uint64_t arg1, uint64_t arg2, 
@@ -206,6 +321,15 @@ inline int64_t open(const char* path, int flags) {
     return syscall(SYS_OPEN, (uint64_t)path, flags);
 }
 
+/**
+ * Open `name` relative to an open directory descriptor: the kernel goes
+ * straight to the directory's backing store, skipping path resolution.
+ * An absolute `name` ignores `dirfd`.
+ */
+inline int64_t openat(int dirfd, const char* name, int flags) {
+    return syscall(SYS_OPENAT, (uint64_t)dirfd, (uint64_t)name, flags);
+}
+
 inline int64_t close(int fd) {
     return syscall(SYS_CLOSE, fd);
 }
@@ -218,6 +342,14 @@ inline int64_t write(int fd, const void* buf, size_t count) {
     return syscall(SYS_WRITE, fd, (uint64_t)buf, count);
 }
 
+inline int64_t readv(int fd, const rse_iovec* iov, int iovcnt) {
+    return syscall(SYS_READV, fd, (uint64_t)iov, (uint64_t)iovcnt);
+}
+
+inline int64_t writev(int fd, const rse_iovec* iov, int iovcnt) {
+    return syscall(SYS_WRITEV, fd, (uint64_t)iov, (uint64_t)iovcnt);
+}
+
 inline int64_t lseek(int fd, int64_t offset, int whence) {
     return syscall(SYS_LSEEK, fd, offset, whence);
 }
@@ -246,6 +378,49 @@ inline int64_t dup2(int old_fd, int new_fd) {
     return syscall(SYS_DUP2, old_fd, new_fd);
 }
 
+/**
+ * Move up to `len` bytes from a ring-backed fd (pipe, /dev/fastpath)
+ * into another fd without bouncing through a user buffer.
+ */
+inline int64_t splice(int in_fd, int out_fd, uint64_t len) {
+    return syscall(SYS_SPLICE, (uint64_t)in_fd, (uint64_t)out_fd, len);
+}
+
+/**
+ * Batched submission wrapper: submit `count` records and receive `count`
+ * completions in one dispatch.
+ */
+inline int64_t syscall_batch(const SyscallRecord* records, size_t count,
+                             SyscallCompletion* completions) {
+    return syscall(SYS_BATCH, (uint64_t)records, count, (uint64_t)completions);
+}
+
+/**
+ * Cross-torus messaging wrappers
+ */
+inline int64_t send_msg(uint32_t dst_torus, uint32_t dst_pid,
+                        const void* buf, size_t len) {
+    return syscall(SYS_SEND, dst_torus, dst_pid, (uint64_t)buf, len);
+}
+
+inline int64_t recv_msg(void* buf, size_t len, uint32_t* src_pid) {
+    return syscall(SYS_RECV, (uint64_t)buf, len, (uint64_t)src_pid);
+}
+
+/**
+ * Asynchronous block I/O wrappers. bio_submit stages one block of I/O
+ * (op 0 = read, 1 = write) and returns a request id; bio_poll collects
+ * the completion (blocking the caller while it is still in flight).
+ */
+inline int64_t bio_submit(uint32_t op, uint64_t lba, const void* buf,
+                          uint32_t len) {
+    return syscall(SYS_BIO_SUBMIT, op, lba, (uint64_t)buf, len);
+}
+
+inline int64_t bio_poll(uint32_t id, void* buf, uint32_t len) {
+    return syscall(SYS_BIO_POLL, id, (uint64_t)buf, len);
+}
+
 /**
  * Memory management wrappers
  */
@@ -257,6 +432,12 @@ inline int64_t mmap(void* addr, size_t size, int prot) {
     return syscall(SYS_MMAP, (uint64_t)addr, size, prot);
 }
 
+inline int64_t mmap_file(void* addr, size_t size, int prot, int32_t fd,
+                         uint64_t offset) {
+    return syscall(SYS_MMAP, (uint64_t)addr, size, prot, RSE_MAP_FILE,
+                   (uint64_t)fd, offset);
+}
+
 inline int64_t munmap(void* addr, size_t size) {
     return syscall(SYS_MUNMAP, (uint64_t)addr, size);
 }
@@ -3,9 +3,13 @@
 #include "Syscall.h"
 #include "OSProcess.h"
 #include "TorusScheduler.h"
+#include "TorusChannel.h"
+#include "ElfImageCache.h"
 #include "VFS.h"
 #include "PhysicalAllocator.h"
 #include "LoopbackDevice.h"
+#include "FastPathDevice.h"
+#include "../Profiler.h"
 #include <cstring>
 #ifdef RSE_KERNEL
 #include "KernelStubs.h"
@@ -30,10 +34,14 @@ struct TorusContext {
     SyscallDispatcher* dispatcher;
     VFS* vfs;
     PhysicalAllocator* phys_alloc;
+    TorusMesh* mesh;            // Shared cross-torus fabric (may be null)
+    ElfImageCache* elf_cache;   // Warm-exec image cache (may be null)
+    uint32_t torus_id;
     uint32_t next_pid;
     
     TorusContext() : scheduler(nullptr), dispatcher(nullptr), vfs(nullptr),
-                     phys_alloc(nullptr), next_pid(1) {}
+                     phys_alloc(nullptr), mesh(nullptr), elf_cache(nullptr),
+                     torus_id(0), next_pid(1) {}
 };
 
 // Thread-local torus context (simulated for now)
@@ -218,6 +226,11 @@ inline int64_t sys_exit(uint64_t status, uint64_t, uint64_t,
     std::cout << "[sys_exit] Process " << current->pid 
               << " exited with status " << status << std::endl;
     
+    // Wake anyone blocked waiting for this process to exit
+    if (TorusScheduler* scheduler = get_current_scheduler()) {
+        scheduler->wakeChannel(TorusScheduler::channelForPid(current->pid));
+    }
+    
     // Scheduler will clean up on next tick
     return 0;
 }
@@ -246,6 +259,7 @@ inline int64_t sys_fork(uint64_t, uint64_t, uint64_t,
     
     // Copy parent's context
     child->context = parent->context;
+    child->ext_state_dirty = parent->ext_state_dirty;
     child->memory = parent->memory;
     child->priority = parent->priority;
     
@@ -268,6 +282,10 @@ inline int64_t sys_fork(uint64_t, uint64_t, uint64_t,
         child->memory.heap_start = cloned->getHeapStart();
         child->memory.heap_end = cloned->getHeapEnd();
         child->memory.heap_brk = cloned->getHeapBrk();
+        // The cloned table still maps the parent's info page
+        if (current_torus_context && current_torus_context->phys_alloc) {
+            child->initVdsoPage(current_torus_context->phys_alloc);
+        }
     } else if (current_torus_context && current_torus_context->phys_alloc) {
         child->initMemory(current_torus_context->phys_alloc);
     }
@@ -461,26 +479,38 @@ inline int64_t sys_exec(uint64_t path_ptr, uint64_t argv_ptr, uint64_t envp_ptr,
         return -EFAULT;
     }
 
-    int32_t fd = current_torus_context->vfs->open(fdt, path_buf, O_RDONLY);
-    if (fd < 0) {
-        return -ENOENT;
-    }
+    // Warm path: a cached image skips the VFS read, the parse, and the
+    // read-only segment copies entirely.
+    ElfImageCache::CachedElf* cached =
+        current_torus_context->elf_cache
+            ? current_torus_context->elf_cache->lookup(path_buf)
+            : nullptr;
 
     static constexpr uint32_t kChunk = 4096;
     static constexpr uint32_t kMaxElfSize = 512 * 1024;
 #ifdef RSE_KERNEL
     static uint8_t image[kMaxElfSize];
-    uint8_t* image_buf = image;
+#endif
+    uint8_t* image_buf = nullptr;
+    uint32_t total = 0;
+    int32_t fd = -1;
+    if (!cached) {
+        fd = current_torus_context->vfs->open(fdt, path_buf, O_RDONLY);
+        if (fd < 0) {
+            return -ENOENT;
+        }
+#ifdef RSE_KERNEL
+        image_buf = image;
 #else
-    uint8_t* image_buf = new uint8_t[kMaxElfSize];
-    if (!image_buf) {
-        current_torus_context->vfs->close(fdt, fd);
-        return -ENOMEM;
-    }
+        image_buf = new uint8_t[kMaxElfSize];
+        if (!image_buf) {
+            current_torus_context->vfs->close(fdt, fd);
+            return -ENOMEM;
+        }
 #endif
+    }
 
-    uint32_t total = 0;
-    while (true) {
+    while (!cached) {
         if (total + kChunk > kMaxElfSize) {
             current_torus_context->vfs->close(fdt, fd);
 #ifndef RSE_KERNEL
@@ -501,13 +531,14 @@ inline int64_t sys_exec(uint64_t path_ptr, uint64_t argv_ptr, uint64_t envp_ptr,
         }
         total += static_cast<uint32_t>(bytes);
     }
-    current_torus_context->vfs->close(fdt, fd);
-
-    if (total == 0) {
+    if (!cached) {
+        current_torus_context->vfs->close(fdt, fd);
+        if (total == 0) {
 #ifndef RSE_KERNEL
-        delete[] image_buf;
+            delete[] image_buf;
 #endif
-        return -EINVAL;
+            return -EINVAL;
+        }
     }
 
     VirtualAllocator* old_vmem = current->vmem;
@@ -551,7 +582,12 @@ inline int64_t sys_exec(uint64_t path_ptr, uint64_t argv_ptr, uint64_t envp_ptr,
 #else
     const uint64_t stack_size = 64 * 1024;
 #endif
-    if (!current->loadElfImageWithArgs(image_buf, total, argv.ptrs, envp.ptrs, stack_size)) {
+    bool loaded = cached
+        ? current->loadElfImageSharedWithArgs(*cached, argv.ptrs, envp.ptrs,
+                                              stack_size)
+        : current->loadElfImageWithArgs(image_buf, total, argv.ptrs,
+                                        envp.ptrs, stack_size);
+    if (!loaded) {
         delete new_va;
         delete new_pt;
         current->vmem = old_vmem;
@@ -563,6 +599,13 @@ inline int64_t sys_exec(uint64_t path_ptr, uint64_t argv_ptr, uint64_t envp_ptr,
         return -EINVAL;
     }
 
+    // Stage the image for future warm execs (best-effort: oversized or
+    // surplus images just keep taking the cold path)
+    if (!cached && current_torus_context->elf_cache) {
+        (void)current_torus_context->elf_cache->insert(path_buf, image_buf,
+                                                       total);
+    }
+
     current->fd_table.closeOnExec();
     if (old_vmem) {
         delete old_vmem;
@@ -577,6 +620,20 @@ inline int64_t sys_exec(uint64_t path_ptr, uint64_t argv_ptr, uint64_t envp_ptr,
     return 0;
 }
 
+/**
+ * Wake readers blocked on the device behind `fd` (pipe, console, net).
+ * No-op for regular files or when nobody waits.
+ */
+inline void wake_fd_waiters(OSProcess* proc, int32_t fd) {
+    FileDescriptor* desc = proc->fd_table.get(fd);
+    if (!desc || !desc->device) {
+        return;
+    }
+    if (TorusScheduler* scheduler = get_current_scheduler()) {
+        scheduler->wakeChannel(TorusScheduler::channelForObject(desc->device));
+    }
+}
+
 /**
  * sys_write: Write to file descriptor
  */
@@ -617,12 +674,19 @@ inline int64_t sys_write(uint64_t fd, uint64_t buf_addr, uint64_t count,
             addr += static_cast<uint64_t>(written);
             remaining -= static_cast<uint64_t>(written);
         }
+        if (total > 0) {
+            wake_fd_waiters(current, static_cast<int32_t>(fd));
+        }
         return total;
     }
-    return current_torus_context->vfs->write(&current->fd_table,
-                                             static_cast<int32_t>(fd),
-                                             (const void *)buf_addr,
-                                             static_cast<uint32_t>(count));
+    int64_t written = current_torus_context->vfs->write(&current->fd_table,
+                                                        static_cast<int32_t>(fd),
+                                                        (const void *)buf_addr,
+                                                        static_cast<uint32_t>(count));
+    if (written > 0) {
+        wake_fd_waiters(current, static_cast<int32_t>(fd));
+    }
+    return written;
 }
 
 /**
@@ -676,6 +740,212 @@ inline int64_t sys_read(uint64_t fd, uint64_t buf_addr, uint64_t count,
                                             static_cast<uint32_t>(count));
 }
 
+/**
+ * Copy and validate a user iovec array. Returns the segment count, or a
+ * negative errno.
+ */
+inline int collect_iovecs(OSProcess* proc, uint64_t iov_addr, uint64_t iovcnt,
+                          rse_iovec* out, bool write_segments) {
+    if (iov_addr == 0 || iovcnt > RSE_IOV_MAX) {
+        return -EINVAL;
+    }
+    if (iovcnt == 0) {
+        return 0;
+    }
+    if (!read_user_bytes(proc, iov_addr, out, iovcnt * sizeof(rse_iovec))) {
+        return -EFAULT;
+    }
+    for (uint64_t i = 0; i < iovcnt; ++i) {
+        if (out[i].len == 0) {
+            continue;
+        }
+        if (!validate_user_range(proc, out[i].base, out[i].len, write_segments)) {
+            return -EFAULT;
+        }
+    }
+    return static_cast<int>(iovcnt);
+}
+
+/**
+ * sys_writev: Gather-write an iovec array to a file descriptor
+ */
+inline int64_t sys_writev(uint64_t fd, uint64_t iov_addr, uint64_t iovcnt,
+                          uint64_t, uint64_t, uint64_t) {
+    if (!current_torus_context || !current_torus_context->vfs) {
+        return -ENOSYS;
+    }
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    rse_iovec iov[RSE_IOV_MAX];
+    int count = collect_iovecs(current, iov_addr, iovcnt, iov, false);
+    if (count < 0) {
+        return count;
+    }
+    int64_t total = 0;
+    if (enforce_user_memory(current)) {
+        // Segments live in user memory: bounce each through sys_write's
+        // copying path
+        for (int seg = 0; seg < count; ++seg) {
+            if (iov[seg].len == 0) {
+                continue;
+            }
+            int64_t put = sys_write(fd, iov[seg].base, iov[seg].len, 0, 0, 0);
+            if (put < 0) {
+                return total != 0 ? total : put;
+            }
+            total += put;
+            if (static_cast<uint64_t>(put) < iov[seg].len) {
+                break;
+            }
+        }
+        return total;
+    }
+    // Kernel-reachable segments descend as one scatter list — drivers
+    // with a writev op consume it without any assembly copy
+    total = current_torus_context->vfs->writev(&current->fd_table,
+                                               static_cast<int32_t>(fd),
+                                               iov, count);
+    if (total > 0) {
+        wake_fd_waiters(current, static_cast<int32_t>(fd));
+    }
+    return total;
+}
+
+/**
+ * sys_splice: move up to `len` bytes from `in_fd` to `out_fd` entirely
+ * in kernel space. The source must be ring-backed (pipe or
+ * /dev/fastpath): its contiguous span is handed straight to the sink
+ * device's write op, so bytes go ring-to-ring without ever touching a
+ * user buffer, and the source only advances by what actually landed —
+ * a full sink loses nothing. Returns bytes moved; 0 when the source is
+ * dry or the sink is full.
+ */
+inline int64_t sys_splice(uint64_t in_fd, uint64_t out_fd, uint64_t len,
+                          uint64_t, uint64_t, uint64_t) {
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    FileDescriptor* src = current->fd_table.get(static_cast<int32_t>(in_fd));
+    FileDescriptor* dst = current->fd_table.get(static_cast<int32_t>(out_fd));
+    if (!src || !dst) {
+        return -EBADF;
+    }
+    if (!src->isReadable() || !dst->isWritable()) {
+        return -EBADF;
+    }
+    Device* sdev = src->device;
+    Device* ddev = dst->device;
+    if (!sdev || !ddev || sdev == ddev || !ddev->write) {
+        return -EINVAL;
+    }
+    const bool src_pipe = sdev->read == loop_read;
+    const bool src_fastpath = sdev->read == fastpath_read;
+    if (!src_pipe && !src_fastpath) {
+        return -EINVAL;  // Only ring-backed sources can be peeked safely
+    }
+    if (len == 0) {
+        return 0;
+    }
+
+    int64_t total = 0;
+    while (static_cast<uint64_t>(total) < len) {
+        uint64_t want = len - static_cast<uint64_t>(total);
+        uint32_t want32 =
+            want > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(want);
+        const uint8_t* span = nullptr;
+        uint32_t avail = 0;
+        if (src_pipe) {
+            LoopbackData* ring = static_cast<LoopbackData*>(sdev->private_data);
+            if (!ring) {
+                return total != 0 ? total : -EINVAL;
+            }
+            uint32_t contiguous =
+                static_cast<uint32_t>(LoopbackData::CAPACITY - ring->head);
+            avail = ring->size < contiguous
+                        ? static_cast<uint32_t>(ring->size)
+                        : contiguous;
+            if (avail > want32) {
+                avail = want32;
+            }
+            span = &ring->buffer[ring->head];
+        } else {
+            FastPathState* st = static_cast<FastPathState*>(sdev->private_data);
+            if (!st) {
+                return total != 0 ? total : -EINVAL;
+            }
+            avail = fastpath_consume_peek(st, &span, want32);
+        }
+        if (avail == 0) {
+            break;
+        }
+        ssize_t written = ddev->write(ddev, span, avail);
+        if (written <= 0) {
+            break;
+        }
+        // Consume exactly what the sink accepted
+        if (src_pipe) {
+            LoopbackData* ring = static_cast<LoopbackData*>(sdev->private_data);
+            ring->head = (ring->head + static_cast<size_t>(written)) %
+                         LoopbackData::CAPACITY;
+            ring->size -= static_cast<size_t>(written);
+        } else {
+            fastpath_consume_advance(
+                static_cast<FastPathState*>(sdev->private_data),
+                static_cast<uint32_t>(written));
+        }
+        total += written;
+        if (static_cast<uint32_t>(written) < avail) {
+            break;
+        }
+    }
+    if (total > 0) {
+        wake_fd_waiters(current, static_cast<int32_t>(out_fd));
+    }
+    return total;
+}
+
+/**
+ * sys_readv: Scatter-read from a file descriptor into an iovec array
+ */
+inline int64_t sys_readv(uint64_t fd, uint64_t iov_addr, uint64_t iovcnt,
+                         uint64_t, uint64_t, uint64_t) {
+    if (!current_torus_context || !current_torus_context->vfs) {
+        return -ENOSYS;
+    }
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    rse_iovec iov[RSE_IOV_MAX];
+    int count = collect_iovecs(current, iov_addr, iovcnt, iov, true);
+    if (count < 0) {
+        return count;
+    }
+    if (enforce_user_memory(current)) {
+        int64_t total = 0;
+        for (int seg = 0; seg < count; ++seg) {
+            if (iov[seg].len == 0) {
+                continue;
+            }
+            int64_t got = sys_read(fd, iov[seg].base, iov[seg].len, 0, 0, 0);
+            if (got < 0) {
+                return total != 0 ? total : got;
+            }
+            total += got;
+            if (static_cast<uint64_t>(got) < iov[seg].len) {
+                break;
+            }
+        }
+        return total;
+    }
+    return current_torus_context->vfs->readv(&current->fd_table,
+                                             static_cast<int32_t>(fd),
+                                             iov, count);
+}
+
 /**
  * sys_open: Open a file
  */
@@ -698,6 +968,30 @@ inline int64_t sys_open(uint64_t path_addr, uint64_t flags, uint64_t mode,
                                             static_cast<uint32_t>(mode));
 }
 
+/**
+ * sys_openat: Open a name relative to a directory descriptor
+ */
+inline int64_t sys_openat(uint64_t dirfd, uint64_t name_addr, uint64_t flags,
+                          uint64_t mode, uint64_t, uint64_t) {
+    if (!current_torus_context || !current_torus_context->vfs) {
+        return -ENOSYS;
+    }
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    static constexpr uint32_t kMaxPath = 256;
+    char name_buf[kMaxPath] = {};
+    if (!copy_user_string(current, name_addr, name_buf, kMaxPath, nullptr)) {
+        return -EFAULT;
+    }
+    return current_torus_context->vfs->openat(&current->fd_table,
+                                              static_cast<int32_t>(dirfd),
+                                              name_buf,
+                                              static_cast<uint32_t>(flags),
+                                              static_cast<uint32_t>(mode));
+}
+
 /**
  * sys_close: Close a file descriptor
  */
@@ -838,6 +1132,53 @@ inline int64_t sys_stat(uint64_t path_addr, uint64_t stat_addr, uint64_t,
     return 0;
 }
 
+#if RSE_SYSCALL_STATS_ENABLED
+/**
+ * Short name for a syscall number, for the sys_ps accounting column.
+ */
+inline const char* syscall_name(int num) {
+    switch (num) {
+        case SYS_FORK: return "fork";
+        case SYS_EXEC: return "exec";
+        case SYS_EXIT: return "exit";
+        case SYS_WAIT: return "wait";
+        case SYS_GETPID: return "getpid";
+        case SYS_GETPPID: return "getppid";
+        case SYS_KILL: return "kill";
+        case SYS_PS: return "ps";
+        case SYS_OPEN: return "open";
+        case SYS_OPENAT: return "openat";
+        case SYS_CLOSE: return "close";
+        case SYS_READ: return "read";
+        case SYS_WRITE: return "write";
+        case SYS_LSEEK: return "lseek";
+        case SYS_STAT: return "stat";
+        case SYS_UNLINK: return "unlink";
+        case SYS_LIST: return "list";
+        case SYS_READV: return "readv";
+        case SYS_WRITEV: return "writev";
+        case SYS_BRK: return "brk";
+        case SYS_MMAP: return "mmap";
+        case SYS_MUNMAP: return "munmap";
+        case SYS_MPROTECT: return "mprotect";
+        case SYS_PIPE: return "pipe";
+        case SYS_SPLICE: return "splice";
+        case SYS_DUP: return "dup";
+        case SYS_DUP2: return "dup2";
+        case SYS_SIGNAL: return "signal";
+        case SYS_TIME: return "time";
+        case SYS_SLEEP: return "sleep";
+        case SYS_NANOSLEEP: return "nanosleep";
+        case SYS_BATCH: return "batch";
+        case SYS_SEND: return "send";
+        case SYS_RECV: return "recv";
+        case SYS_BIO_SUBMIT: return "bio_submit";
+        case SYS_BIO_POLL: return "bio_poll";
+        default: return "?";
+    }
+}
+#endif
+
 inline int64_t sys_ps(uint64_t buf_addr, uint64_t count, uint64_t,
                       uint64_t, uint64_t, uint64_t) {
     OSProcess* current = get_current_process();
@@ -921,11 +1262,36 @@ inline int64_t sys_ps(uint64_t buf_addr, uint64_t count, uint64_t,
         if (!proc) {
             return;
         }
-        if (!append_str("pid=") || !append_u64(proc->pid) ||
-            !append_str(" torus=") || !append_u64(proc->torus_id) ||
-            !append_str(" state=") || !append_str(state_str(proc->state)) ||
-            !append_str(" runtime=") || !append_u64(proc->total_runtime) ||
-            !append_char('\n')) {
+        bool ok = append_str("pid=") && append_u64(proc->pid) &&
+                  append_str(" torus=") && append_u64(proc->torus_id) &&
+                  append_str(" state=") && append_str(state_str(proc->state)) &&
+                  append_str(" runtime=") && append_u64(proc->total_runtime);
+#if RSE_SYSCALL_STATS_ENABLED
+        // Top three syscall consumers, busiest first
+        uint32_t picked[3] = {};
+        for (uint32_t rank = 0; rank < 3 && ok; ++rank) {
+            uint32_t best = OSProcess::SYSCALL_STATS_SLOTS;
+            uint64_t best_count = 0;
+            for (uint32_t i = 0; i < OSProcess::SYSCALL_STATS_SLOTS; ++i) {
+                bool taken = false;
+                for (uint32_t r = 0; r < rank; ++r) {
+                    taken = taken || picked[r] == i;
+                }
+                if (!taken && proc->syscall_counts[i] > best_count) {
+                    best_count = proc->syscall_counts[i];
+                    best = i;
+                }
+            }
+            if (best == OSProcess::SYSCALL_STATS_SLOTS) {
+                break;
+            }
+            picked[rank] = best;
+            ok = append_str(rank == 0 ? " top=" : ",") &&
+                 append_str(syscall_name(static_cast<int>(best))) &&
+                 append_char(':') && append_u64(best_count);
+        }
+#endif
+        if (!ok || !append_char('\n')) {
             return;
         }
         wrote = true;
@@ -969,8 +1335,25 @@ inline int64_t sys_brk(uint64_t addr, uint64_t, uint64_t,
     return new_brk;
 }
 
+/**
+ * Page filler for BlockFS-backed mappings: ctx is the BlockFS, arg the
+ * entry. Entry pointers are slots in the BlockFS table, so a mapping
+ * that outlives its file degrades to reading whatever the slot holds —
+ * the in_use check catches plain deletion.
+ */
+inline int64_t blockfs_fill_page(void* ctx, uint64_t arg,
+                                 uint64_t file_offset, uint8_t* dst,
+                                 uint64_t len) {
+    BlockFS* fs = static_cast<BlockFS*>(ctx);
+    BlockFSEntry* entry = reinterpret_cast<BlockFSEntry*>(arg);
+    if (!fs || !entry || !entry->in_use) {
+        return -1;
+    }
+    return fs->read(entry, file_offset, dst, (uint32_t)len);
+}
+
 inline int64_t sys_mmap(uint64_t addr, uint64_t size, uint64_t prot,
-                        uint64_t, uint64_t, uint64_t) {
+                        uint64_t flags, uint64_t fd, uint64_t offset) {
     OSProcess* current = get_current_process();
     if (!current || !current->vmem) {
         return -ESRCH;
@@ -979,7 +1362,24 @@ inline int64_t sys_mmap(uint64_t addr, uint64_t size, uint64_t prot,
         !current->vmem->isUserRange(addr, size)) {
         return -EFAULT;
     }
-    uint64_t mapped = current->vmem->mmap(addr, size, prot);
+    uint64_t mapped;
+    if (flags & RSE_MAP_FILE) {
+        FileDescriptor* desc =
+            current->fd_table.get(static_cast<int32_t>(fd));
+        if (!desc || !desc->block_file) {
+            return -EBADF;
+        }
+        if (!current_torus_context || !current_torus_context->vfs ||
+            !current_torus_context->vfs->getBlockFS()) {
+            return -ENOSYS;
+        }
+        mapped = current->vmem->mmapFile(
+            addr, size, prot, offset, blockfs_fill_page,
+            current_torus_context->vfs->getBlockFS(),
+            reinterpret_cast<uint64_t>(desc->block_file));
+    } else {
+        mapped = current->vmem->mmap(addr, size, prot);
+    }
     if (mapped == 0) {
         return -ENOMEM;
     }
@@ -1016,43 +1416,332 @@ inline int64_t sys_mprotect(uint64_t addr, uint64_t size, uint64_t prot,
     return 0;
 }
 
+// ========== Cross-Torus Messaging ==========
+
+/**
+ * Drain this torus's inbound mesh traffic: adopt migrated processes and
+ * deliver messages into process mailboxes, waking blocked receivers.
+ * Dropped when the target is gone or its mailbox is full (message traffic
+ * is best-effort, like a saturated NIC queue).
+ */
+inline void drain_torus_mesh() {
+    TorusContext* ctx = current_torus_context;
+    if (!ctx || !ctx->mesh || !ctx->scheduler) {
+        return;
+    }
+    TorusScheduler* scheduler = ctx->scheduler;
+    ctx->mesh->drainMigrations(ctx->torus_id, [&](OSProcess* proc) {
+        (void)scheduler->receiveProcess(proc);
+    });
+    ctx->mesh->drainMessages(ctx->torus_id, [&](const TorusMessage& msg) {
+        OSProcess* target = msg.dst_pid != 0
+                                ? scheduler->findProcess(msg.dst_pid)
+                                : scheduler->getCurrentProcess();
+        if (!target) {
+            return;
+        }
+        if (target->mailbox.push_back(msg)) {
+            scheduler->wakeChannel(
+                TorusScheduler::channelForMailbox(target->pid));
+        }
+    });
+}
+
+/**
+ * sys_send: Send a bounded message to a process on another torus (or this
+ * one). Non-blocking: -EAGAIN when the pair's ring is full.
+ */
+inline int64_t sys_send(uint64_t dst_torus, uint64_t dst_pid,
+                        uint64_t buf_addr, uint64_t len,
+                        uint64_t, uint64_t) {
+    TorusContext* ctx = current_torus_context;
+    if (!ctx || !ctx->mesh) {
+        return -ENOSYS;
+    }
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    if (dst_torus >= MAX_TORI || len > TORUS_MSG_MAX) {
+        return -EINVAL;
+    }
+    TorusMessage msg;
+    msg.src_torus = ctx->torus_id;
+    msg.src_pid = current->pid;
+    msg.dst_pid = static_cast<uint32_t>(dst_pid);
+    msg.length = static_cast<uint32_t>(len);
+    if (len != 0 && !read_user_bytes(current, buf_addr, msg.payload, len)) {
+        return -EFAULT;
+    }
+    if (!ctx->mesh->send(ctx->torus_id, static_cast<uint32_t>(dst_torus), msg)) {
+        return -EAGAIN;
+    }
+    return static_cast<int64_t>(len);
+}
+
+/**
+ * sys_recv: Receive the oldest message addressed to the calling process.
+ * arg3, when non-zero, names a user uint32_t that receives the sender pid.
+ * Non-blocking: -EAGAIN when the mailbox is empty (block on
+ * channelForMailbox(pid) to wait).
+ */
+inline int64_t sys_recv(uint64_t buf_addr, uint64_t len,
+                        uint64_t src_pid_addr, uint64_t,
+                        uint64_t, uint64_t) {
+    TorusContext* ctx = current_torus_context;
+    if (!ctx || !ctx->mesh) {
+        return -ENOSYS;
+    }
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+
+    // Pull anything the mesh has queued for this torus first
+    drain_torus_mesh();
+
+    if (current->mailbox.empty()) {
+        return -EAGAIN;
+    }
+    TorusMessage msg = current->mailbox[0];
+    uint64_t copy_len = msg.length < len ? msg.length : len;
+    if (copy_len != 0 &&
+        !write_user_bytes(current, buf_addr, msg.payload, copy_len)) {
+        return -EFAULT;
+    }
+    if (src_pid_addr != 0 &&
+        !write_user_bytes(current, src_pid_addr, &msg.src_pid,
+                          sizeof(msg.src_pid))) {
+        return -EFAULT;
+    }
+    current->mailbox.erase_at(0);
+    return static_cast<int64_t>(copy_len);
+}
+
+/**
+ * Migrate a ready process to another torus at a braid boundary. The
+ * destination adopts it on its next mesh drain. Returns 0, -ESRCH when the
+ * pid is not ready on this torus, or -EAGAIN when the migration ring is
+ * full (the process is re-queued locally).
+ */
+inline int64_t migrate_process(uint32_t pid, uint32_t dst_torus) {
+    TorusContext* ctx = current_torus_context;
+    if (!ctx || !ctx->mesh || !ctx->scheduler) {
+        return -ENOSYS;
+    }
+    if (dst_torus >= MAX_TORI) {
+        return -EINVAL;
+    }
+    if (dst_torus == ctx->torus_id) {
+        return 0;
+    }
+    OSProcess* proc = ctx->scheduler->takeReadyProcess(pid);
+    if (!proc) {
+        return -ESRCH;
+    }
+    if (!ctx->mesh->pushMigration(ctx->torus_id, dst_torus, proc)) {
+        (void)ctx->scheduler->receiveProcess(proc);
+        return -EAGAIN;
+    }
+    return 0;
+}
+
+// ========== Asynchronous Block I/O ==========
+
+/**
+ * Polled completion path: execute up to `max` staged block requests and
+ * wake their waiters. The idle loop or a timer event calls this so disk
+ * work proceeds while blocked submitters stay off the ready queue.
+ */
+inline uint32_t block_io_service(uint32_t max = BlockIOQueue::kMaxRequests) {
+    if (max > BlockIOQueue::kMaxRequests) {
+        max = BlockIOQueue::kMaxRequests;
+    }
+    uint32_t done_ids[BlockIOQueue::kMaxRequests];
+    uint32_t completed = block_io_queue().service(max, done_ids);
+    if (TorusScheduler* scheduler = get_current_scheduler()) {
+        for (uint32_t i = 0; i < completed; ++i) {
+            scheduler->wakeChannel(
+                TorusScheduler::channelForBlockIO(done_ids[i]));
+        }
+    }
+    // Same cadence drives BlockFS group commit, so a partial metadata
+    // batch never waits on further operations to become durable
+    if (current_torus_context && current_torus_context->vfs) {
+        if (BlockFS* bfs = current_torus_context->vfs->getBlockFS()) {
+            bfs->sync();
+        }
+    }
+    return completed;
+}
+
+/**
+ * sys_bio_submit: stage one block of async I/O (arg1 op, arg2 lba, arg3
+ * buffer, arg4 length). Returns the request id without waiting for the
+ * device; -EAGAIN when the request table is full.
+ */
+inline int64_t sys_bio_submit(uint64_t op, uint64_t lba, uint64_t buf_addr,
+                              uint64_t len, uint64_t, uint64_t) {
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    if (op > BlockIOQueue::kOpWrite || len > BlockCache::kMaxBlockSize) {
+        return -EINVAL;
+    }
+    uint8_t staged[BlockCache::kMaxBlockSize];
+    const void* src = nullptr;
+    if (op == BlockIOQueue::kOpWrite) {
+        if (len == 0 ||
+            !validate_user_range(current, buf_addr, len, false)) {
+            return -EFAULT;
+        }
+        if (enforce_user_memory(current)) {
+            if (!read_user_bytes(current, buf_addr, staged, len)) {
+                return -EFAULT;
+            }
+            src = staged;
+        } else {
+            src = (const void*)buf_addr;
+        }
+    }
+    int64_t id = block_io_queue().submit((uint8_t)op, lba, src,
+                                         (uint32_t)len);
+    if (id == -1) {
+        return -EINVAL;
+    }
+    if (id == -2) {
+        return -EAGAIN;
+    }
+    return id;
+}
+
+/**
+ * sys_bio_poll: collect the completion for request arg1, copying read
+ * data into the arg2/arg3 buffer. While the request is still in flight
+ * the caller is parked BLOCKED on the request's wait channel and sees
+ * -EAGAIN; block_io_service wakes it when the I/O completes.
+ */
+inline int64_t sys_bio_poll(uint64_t id, uint64_t buf_addr, uint64_t len,
+                            uint64_t, uint64_t, uint64_t) {
+    OSProcess* current = get_current_process();
+    if (!current) {
+        return -ESRCH;
+    }
+    if (len > BlockCache::kMaxBlockSize) {
+        return -EINVAL;
+    }
+    if (len != 0 && !validate_user_range(current, buf_addr, len, true)) {
+        return -EFAULT;
+    }
+    uint8_t staged[BlockCache::kMaxBlockSize];
+    bool bounce = enforce_user_memory(current);
+    void* dst = (len != 0) ? (bounce ? (void*)staged : (void*)buf_addr)
+                           : nullptr;
+    int64_t result = block_io_queue().poll((uint32_t)id, dst, (uint32_t)len);
+    if (result == -2) {
+        if (TorusScheduler* scheduler = get_current_scheduler()) {
+            scheduler->blockProcess(
+                current->pid,
+                TorusScheduler::channelForBlockIO((uint32_t)id));
+        }
+        return -EAGAIN;
+    }
+    if (result == -3) {
+        return -EINVAL;
+    }
+    if (result == -1) {
+        return -EIO;
+    }
+    if (result > 0 && bounce &&
+        !write_user_bytes(current, buf_addr, staged, (uint64_t)result)) {
+        return -EFAULT;
+    }
+    return result;
+}
+
 // ========== System Call Dispatcher ==========
 
+// Forward declaration (defined after SyscallDispatcher)
+inline int64_t sys_batch(uint64_t records_addr, uint64_t count,
+                         uint64_t completions_addr, uint64_t arg4,
+                         uint64_t arg5, uint64_t arg6);
+
+/**
+ * Default syscall table, built at compile time. Every dispatcher starts
+ * from this one constant image (a plain copy instead of a chain of
+ * register_handler calls), and entries remain overridable per instance.
+ */
+struct SyscallTable {
+    syscall_handler_t entries[256];
+};
+
+constexpr SyscallTable build_syscall_table() {
+    SyscallTable t{};
+    t.entries[SYS_GETPID] = sys_getpid;
+    t.entries[SYS_GETPPID] = sys_getppid;
+    t.entries[SYS_EXIT] = sys_exit;
+    t.entries[SYS_FORK] = sys_fork;
+    t.entries[SYS_WAIT] = sys_wait;
+    t.entries[SYS_KILL] = sys_kill;
+    t.entries[SYS_PS] = sys_ps;
+    t.entries[SYS_EXEC] = sys_exec;
+    t.entries[SYS_PIPE] = sys_pipe;
+    t.entries[SYS_SPLICE] = sys_splice;
+    t.entries[SYS_DUP] = sys_dup;
+    t.entries[SYS_DUP2] = sys_dup2;
+    t.entries[SYS_OPEN] = sys_open;
+    t.entries[SYS_OPENAT] = sys_openat;
+    t.entries[SYS_CLOSE] = sys_close;
+    t.entries[SYS_WRITE] = sys_write;
+    t.entries[SYS_READ] = sys_read;
+    t.entries[SYS_WRITEV] = sys_writev;
+    t.entries[SYS_READV] = sys_readv;
+    t.entries[SYS_LSEEK] = sys_lseek;
+    t.entries[SYS_STAT] = sys_stat;
+    t.entries[SYS_UNLINK] = sys_unlink;
+    t.entries[SYS_LIST] = sys_list;
+    t.entries[SYS_BRK] = sys_brk;
+    t.entries[SYS_MMAP] = sys_mmap;
+    t.entries[SYS_MUNMAP] = sys_munmap;
+    t.entries[SYS_MPROTECT] = sys_mprotect;
+    t.entries[SYS_BATCH] = sys_batch;
+    t.entries[SYS_SEND] = sys_send;
+    t.entries[SYS_RECV] = sys_recv;
+    t.entries[SYS_BIO_SUBMIT] = sys_bio_submit;
+    t.entries[SYS_BIO_POLL] = sys_bio_poll;
+    return t;
+}
+
+inline constexpr SyscallTable kDefaultSyscallTable = build_syscall_table();
+
 class SyscallDispatcher {
+public:
+    // Submission/completion ring capacity (power of two)
+    static constexpr uint32_t BATCH_RING_ENTRIES = 64;
+
 private:
+    static constexpr uint32_t BATCH_RING_MASK = BATCH_RING_ENTRIES - 1;
+
     syscall_handler_t handlers_[256];  // Up to 256 syscalls
-    
+
+    // io_uring-style rings: records are submitted into sq_, executed in one
+    // pass by processSubmissions(), and their results land in cq_. Per-torus
+    // like the dispatcher itself, so no locking is needed.
+    SyscallRecord sq_[BATCH_RING_ENTRIES];
+    SyscallCompletion cq_[BATCH_RING_ENTRIES];
+    uint32_t sq_head_ = 0;
+    uint32_t sq_tail_ = 0;
+    uint32_t cq_head_ = 0;
+    uint32_t cq_tail_ = 0;
+
 public:
     SyscallDispatcher() {
-        // Initialize all handlers to nullptr
+        // Start from the constexpr default table; unlisted numbers stay
+        // nullptr and report ENOSYS
         for (int i = 0; i < 256; i++) {
-            handlers_[i] = nullptr;
+            handlers_[i] = kDefaultSyscallTable.entries[i];
         }
-        
-        // Register core syscalls
-        register_handler(SYS_GETPID, sys_getpid);
-        register_handler(SYS_GETPPID, sys_getppid);
-        register_handler(SYS_EXIT, sys_exit);
-        register_handler(SYS_FORK, sys_fork);
-        register_handler(SYS_WAIT, sys_wait);
-        register_handler(SYS_KILL, sys_kill);
-        register_handler(SYS_PS, sys_ps);
-        register_handler(SYS_EXEC, sys_exec);
-        register_handler(SYS_PIPE, sys_pipe);
-        register_handler(SYS_DUP, sys_dup);
-        register_handler(SYS_DUP2, sys_dup2);
-        register_handler(SYS_OPEN, sys_open);
-        register_handler(SYS_CLOSE, sys_close);
-        register_handler(SYS_WRITE, sys_write);
-        register_handler(SYS_READ, sys_read);
-        register_handler(SYS_LSEEK, sys_lseek);
-        register_handler(SYS_STAT, sys_stat);
-        register_handler(SYS_UNLINK, sys_unlink);
-        register_handler(SYS_LIST, sys_list);
-        register_handler(SYS_BRK, sys_brk);
-        register_handler(SYS_MMAP, sys_mmap);
-        register_handler(SYS_MUNMAP, sys_munmap);
-        register_handler(SYS_MPROTECT, sys_mprotect);
     }
     
     /**
@@ -1067,10 +1756,11 @@ public:
     /**
      * Dispatch a syscall to its handler.
      */
-    int64_t dispatch(int syscall_num, 
+    int64_t dispatch(int syscall_num,
                      uint64_t arg1, uint64_t arg2, uint64_t arg3,
                      uint64_t arg4, uint64_t arg5, uint64_t arg6) {
-        
+        RSE_PROFILE_SCOPE(SITE_SYSCALL_DISPATCH);
+
         // Check syscall number
         if (syscall_num < 0 || syscall_num >= 256) {
             std::cerr << "[SyscallDispatcher] Invalid syscall number: " 
@@ -1081,16 +1771,172 @@ public:
         // Get handler
         syscall_handler_t handler = handlers_[syscall_num];
         if (!handler) {
-            std::cerr << "[SyscallDispatcher] Syscall not implemented: " 
+            std::cerr << "[SyscallDispatcher] Syscall not implemented: "
                       << syscall_num << std::endl;
             return -ENOSYS;
         }
-        
+
+#if RSE_SYSCALL_STATS_ENABLED
+        // One plain increment on a line the scheduler already touches
+        if (OSProcess* current = get_current_process()) {
+            if (static_cast<uint32_t>(syscall_num) <
+                OSProcess::SYSCALL_STATS_SLOTS) {
+                current->syscall_counts[syscall_num]++;
+            }
+        }
+#endif
+
+        // Hot-call fast path: read and write dominate dynamic frequency,
+        // so they dispatch through a predicted compare and a direct call
+        // the compiler can see through, instead of the indirect table
+        // jump. Comparing the loaded entry against the default handler
+        // keeps per-instance overrides honest — a replaced entry falls
+        // through to the indirect path.
+        if (handler == sys_read) {
+            return sys_read(arg1, arg2, arg3, arg4, arg5, arg6);
+        }
+        if (handler == sys_write) {
+            return sys_write(arg1, arg2, arg3, arg4, arg5, arg6);
+        }
+
         // Call handler
         return handler(arg1, arg2, arg3, arg4, arg5, arg6);
     }
+
+    /**
+     * Whether a syscall may run from the submission ring. Process-control
+     * calls that replace or destroy the caller (and nested batches) must go
+     * through the single-shot path.
+     */
+    static bool batchable(int syscall_num) {
+        switch (syscall_num) {
+            case SYS_FORK:
+            case SYS_EXEC:
+            case SYS_EXIT:
+            case SYS_WAIT:
+            case SYS_BATCH:
+                return false;
+            default:
+                return true;
+        }
+    }
+
+    /**
+     * Push a record into the submission ring.
+     */
+    bool submit(const SyscallRecord& record) {
+        if (sq_tail_ - sq_head_ >= BATCH_RING_ENTRIES) {
+            return false;
+        }
+        sq_[sq_tail_++ & BATCH_RING_MASK] = record;
+        return true;
+    }
+
+    /**
+     * Execute all pending submissions in one pass; each result lands in the
+     * completion ring tagged with the record's user_data. Returns the number
+     * of records executed.
+     */
+    uint32_t processSubmissions() {
+        uint32_t done = 0;
+        while (sq_head_ != sq_tail_ &&
+               cq_tail_ - cq_head_ < BATCH_RING_ENTRIES) {
+            const SyscallRecord& rec = sq_[sq_head_++ & BATCH_RING_MASK];
+            int64_t result;
+            if (!batchable(rec.number)) {
+                result = -EINVAL;
+            } else {
+                result = dispatch(rec.number, rec.args[0], rec.args[1],
+                                  rec.args[2], rec.args[3], rec.args[4],
+                                  rec.args[5]);
+            }
+            SyscallCompletion& comp = cq_[cq_tail_++ & BATCH_RING_MASK];
+            comp.user_data = rec.user_data;
+            comp.result = result;
+            done++;
+        }
+        return done;
+    }
+
+    /**
+     * Pop the oldest completion. Returns false when the ring is empty.
+     */
+    bool reapCompletion(SyscallCompletion& out) {
+        if (cq_head_ == cq_tail_) {
+            return false;
+        }
+        out = cq_[cq_head_++ & BATCH_RING_MASK];
+        return true;
+    }
 };
 
+// ========== Batched Submission ==========
+
+/**
+ * SYS_BATCH: copy `count` SyscallRecords from user memory into the
+ * submission ring, execute them in one dispatcher pass, and write the
+ * completions back. Batches larger than the ring are processed in ring-sized
+ * chunks, so the copy-in/copy-out and dispatch overhead is amortized across
+ * the whole array either way. Returns the number of completed records.
+ */
+inline int64_t sys_batch(uint64_t records_addr, uint64_t count,
+                         uint64_t completions_addr, uint64_t arg4,
+                         uint64_t arg5, uint64_t arg6) {
+    (void)arg4; (void)arg5; (void)arg6;
+
+    if (!current_torus_context || !current_torus_context->dispatcher) {
+        return -ENOSYS;
+    }
+    SyscallDispatcher* dispatcher = current_torus_context->dispatcher;
+
+    if (count == 0) {
+        return 0;
+    }
+    if (!records_addr || !completions_addr) {
+        return -EFAULT;
+    }
+
+    OSProcess* proc = get_current_process();
+    uint64_t completed = 0;
+
+    while (completed < count) {
+        uint64_t chunk = count - completed;
+        if (chunk > SyscallDispatcher::BATCH_RING_ENTRIES) {
+            chunk = SyscallDispatcher::BATCH_RING_ENTRIES;
+        }
+
+        for (uint64_t i = 0; i < chunk; ++i) {
+            SyscallRecord record;
+            uint64_t src = records_addr +
+                           (completed + i) * sizeof(SyscallRecord);
+            if (!read_user_bytes(proc, src, &record, sizeof(record))) {
+                return completed > 0 ? static_cast<int64_t>(completed)
+                                     : -EFAULT;
+            }
+            if (!dispatcher->submit(record)) {
+                return -EAGAIN;
+            }
+        }
+
+        dispatcher->processSubmissions();
+
+        // The current process may have been descheduled by a record (e.g. a
+        // blocking read); completions still refer to the submitting process.
+        SyscallCompletion comp;
+        while (dispatcher->reapCompletion(comp)) {
+            uint64_t dst = completions_addr +
+                           completed * sizeof(SyscallCompletion);
+            if (!write_user_bytes(proc, dst, &comp, sizeof(comp))) {
+                return completed > 0 ? static_cast<int64_t>(completed)
+                                     : -EFAULT;
+            }
+            completed++;
+        }
+    }
+
+    return static_cast<int64_t>(completed);
+}
+
 // ========== Global Syscall Function ==========
 
 /**
@@ -1109,4 +1955,30 @@ inline int64_t syscall(int syscall_num,
         syscall_num, arg1, arg2, arg3, arg4, arg5, arg6);
 }
 
+// ========== vDSO Fast Path ==========
+
+/**
+ * The current process's shared info page, or nullptr when none is mapped.
+ * Reads are plain loads — no dispatcher, no handler table.
+ */
+inline const VdsoInfoPage* vdso_info() {
+    OSProcess* proc = get_current_process();
+    return proc ? proc->vdso_page : nullptr;
+}
+
+inline int64_t fast_getpid() {
+    const VdsoInfoPage* info = vdso_info();
+    return info ? info->pid : syscall(SYS_GETPID);
+}
+
+inline int64_t fast_getppid() {
+    const VdsoInfoPage* info = vdso_info();
+    return info ? info->ppid : syscall(SYS_GETPPID);
+}
+
+inline int64_t fast_time() {
+    const VdsoInfoPage* info = vdso_info();
+    return info ? static_cast<int64_t>(info->ticks) : syscall(SYS_TIME);
+}
+
 } // namespace os
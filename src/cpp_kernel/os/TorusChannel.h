@@ -0,0 +1,110 @@
+#pragma once
+
+#include "OSProcess.h"
+#include "../FixedStructures.h"
+
+/**
+ * TorusMesh: lock-free cross-torus communication fabric.
+ *
+ * One bounded SPSC ring per ordered torus pair carries messages, and a
+ * second (smaller) ring per pair carries migrating processes. Each ring has
+ * exactly one producer (the source torus) and one consumer (the destination
+ * torus), so no locks and no CAS loops are needed: tori exchange work
+ * without ever contending on shared state.
+ *
+ * Migration hands over the OSProcess pointer wholesale - context, page
+ * table, and frame ownership move with it. That requires the tori to share
+ * one PhysicalAllocator (a braid-global pool); with per-torus pools a
+ * migrated process would free frames into the wrong allocator.
+ */
+
+namespace os {
+
+class TorusMesh {
+public:
+    static constexpr uint32_t MSG_RING_ENTRIES = 64;
+    static constexpr uint32_t MIGRATION_RING_ENTRIES = 16;
+
+    TorusMesh() = default;
+    TorusMesh(const TorusMesh&) = delete;
+    TorusMesh& operator=(const TorusMesh&) = delete;
+
+    /**
+     * Enqueue a message from torus `src` to torus `dst`.
+     * Returns false when the pair's ring is full or the ids are out of range.
+     */
+    bool send(uint32_t src, uint32_t dst, const TorusMessage& msg) {
+        if (src >= MAX_TORI || dst >= MAX_TORI) {
+            return false;
+        }
+        return msg_rings_[src][dst].push(msg);
+    }
+
+    /**
+     * Hand a process from torus `src` over to torus `dst`. The destination
+     * adopts it on its next drain. Returns false when the ring is full.
+     */
+    bool pushMigration(uint32_t src, uint32_t dst, OSProcess* proc) {
+        if (src >= MAX_TORI || dst >= MAX_TORI || !proc) {
+            return false;
+        }
+        return migration_rings_[src][dst].push(proc);
+    }
+
+    /**
+     * Drain every inbound message ring of torus `dst`, invoking
+     * `deliver(const TorusMessage&)` for each message in FIFO order per
+     * source. Must only be called from the destination torus (single
+     * consumer).
+     */
+    template <typename Fn>
+    void drainMessages(uint32_t dst, Fn&& deliver) {
+        if (dst >= MAX_TORI) {
+            return;
+        }
+        for (uint32_t src = 0; src < MAX_TORI; src++) {
+            TorusMessage msg;
+            while (msg_rings_[src][dst].pop(msg)) {
+                deliver(msg);
+            }
+        }
+    }
+
+    /**
+     * Drain every inbound migration ring of torus `dst`, invoking
+     * `receive(OSProcess*)` for each arriving process. Must only be called
+     * from the destination torus.
+     */
+    template <typename Fn>
+    void drainMigrations(uint32_t dst, Fn&& receive) {
+        if (dst >= MAX_TORI) {
+            return;
+        }
+        for (uint32_t src = 0; src < MAX_TORI; src++) {
+            OSProcess* proc = nullptr;
+            while (migration_rings_[src][dst].pop(proc)) {
+                receive(proc);
+            }
+        }
+    }
+
+    /**
+     * Messages queued toward torus `dst` (approximate under concurrency).
+     */
+    uint64_t pendingMessages(uint32_t dst) const {
+        if (dst >= MAX_TORI) {
+            return 0;
+        }
+        uint64_t total = 0;
+        for (uint32_t src = 0; src < MAX_TORI; src++) {
+            total += msg_rings_[src][dst].size();
+        }
+        return total;
+    }
+
+private:
+    FixedSPSCRing<TorusMessage, MSG_RING_ENTRIES> msg_rings_[MAX_TORI][MAX_TORI];
+    FixedSPSCRing<OSProcess*, MIGRATION_RING_ENTRIES> migration_rings_[MAX_TORI][MAX_TORI];
+};
+
+} // namespace os
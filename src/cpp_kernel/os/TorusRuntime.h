@@ -0,0 +1,99 @@
+#pragma once
+
+#include "TorusScheduler.h"
+#include "../single_torus/BettiRDLKernel.h"
+
+/**
+ * TorusRuntime: one prioritized loop per torus for both process execution
+ * and RDL event processing — the integration EMERGENT_SCHEDULER_DESIGN.md
+ * sketches as BraidedKernelV5.
+ *
+ * Scheduler time slices are control events in the torus event queue: the
+ * runtime arms a slice event, the kernel pops it in timestamp order like
+ * any other event, the handler runs one TorusScheduler tick and re-arms
+ * the next slice. The torus therefore alternates between running
+ * processes and routing events with no second loop and no idle-spin
+ * handoff between the two subsystems; when only one side has work, the
+ * queue serves only that side. The slice chain lapses on its own when
+ * the scheduler runs out of processes and is re-armed by start().
+ */
+
+namespace os {
+
+template <typename KernelT = BettiRDLKernel>
+class TorusRuntime {
+public:
+    // Control-event payload tag for a scheduler time slice
+    static constexpr int PAYLOAD_TIME_SLICE = 1;
+
+    TorusRuntime(KernelT* kernel, TorusScheduler* scheduler,
+                 unsigned long long slice_interval = 1)
+        : kernel_(kernel),
+          scheduler_(scheduler),
+          slice_interval_(slice_interval == 0 ? 1 : slice_interval),
+          slices_run_(0),
+          armed_(false) {
+        kernel_->setControlHandler(&TorusRuntime::onControlEvent, this);
+    }
+
+    TorusRuntime(const TorusRuntime&) = delete;
+    TorusRuntime& operator=(const TorusRuntime&) = delete;
+
+    /**
+     * Arm the slice chain. Call after adding processes; a no-op while a
+     * slice event is already queued.
+     */
+    bool start() {
+        if (armed_) {
+            return true;
+        }
+        armed_ = kernel_->scheduleControlEvent(
+            kernel_->getCurrentTime() + slice_interval_, PAYLOAD_TIME_SLICE);
+        return armed_;
+    }
+
+    /** Let the pending slice event lapse without re-arming. */
+    void stop() {
+        armed_ = false;
+    }
+
+    /**
+     * Drive the fused loop: processes up to max_events queue entries
+     * (lattice events and time slices together, in timestamp order).
+     */
+    int run(int max_events) {
+        return kernel_->run(max_events);
+    }
+
+    unsigned long long slicesRun() const { return slices_run_; }
+    bool isArmed() const { return armed_; }
+    TorusScheduler* scheduler() const { return scheduler_; }
+    KernelT* kernel() const { return kernel_; }
+
+private:
+    static void onControlEvent(const RDLEvent& evt, void* ctx) {
+        TorusRuntime* self = static_cast<TorusRuntime*>(ctx);
+        if (evt.payload != PAYLOAD_TIME_SLICE || !self->armed_) {
+            return;
+        }
+        self->scheduler_->tick();
+        self->slices_run_++;
+        // Re-arm only while there is something to run; otherwise the
+        // chain lapses instead of spinning an empty scheduler.
+        if (self->scheduler_->getProcessCount() > 0) {
+            self->armed_ = self->kernel_->scheduleControlEvent(
+                self->kernel_->getCurrentTime() + self->slice_interval_,
+                PAYLOAD_TIME_SLICE);
+        } else {
+            self->armed_ = false;
+        }
+    }
+
+    KernelT* kernel_;
+    TorusScheduler* scheduler_;
+    unsigned long long slice_interval_;
+    unsigned long long slices_run_;
+    bool armed_;
+};
+
+} // namespace os
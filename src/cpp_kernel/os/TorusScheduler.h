@@ -2,7 +2,9 @@
 
 #include "OSProcess.h"
 #include "../FixedStructures.h"
+#include "../Profiler.h"
 #include <algorithm>
+#include <bit>
 #ifdef RSE_KERNEL
 #include "KernelStubs.h"
 #else
@@ -34,24 +36,362 @@ public:
     };
     
     Policy policy_;
-    
+
+    // ========== Wait Channels ==========
+
+    // A wait channel names the event a blocked process sleeps on. The tag
+    // in the top byte keeps pid-keyed and object-keyed channels from
+    // colliding.
+    static constexpr uint64_t WAIT_CHANNEL_NONE = 0;
+
+    /** Channel for waiters on a process's exit (e.g. sys_wait). */
+    static constexpr uint64_t channelForPid(uint32_t pid) {
+        return (1ULL << 56) | pid;
+    }
+
+    /** Channel for waiters on a kernel object (device, pipe buffer). */
+    static uint64_t channelForObject(const void* obj) {
+        return (2ULL << 56) |
+               (reinterpret_cast<uint64_t>(obj) & 0x00FFFFFF'FFFFFFFFULL);
+    }
+
+    /** Channel a parent blocks on while waiting for any child to exit. */
+    static constexpr uint64_t channelForChildrenOf(uint32_t parent_pid) {
+        return (3ULL << 56) | parent_pid;
+    }
+
+    /** Channel a process blocks on while waiting for cross-torus messages. */
+    static constexpr uint64_t channelForMailbox(uint32_t pid) {
+        return (4ULL << 56) | pid;
+    }
+
+    /** Channel a process blocks on while an async block request is in flight. */
+    static constexpr uint64_t channelForBlockIO(uint32_t request_id) {
+        return (5ULL << 56) | request_id;
+    }
+
 private:
+    // All three process tables chain through the same embedded links
+    using ProcList =
+        IntrusiveList<OSProcess, &OSProcess::sched_next, &OSProcess::sched_prev>;
+
+    /**
+     * Multi-level ready queue: one intrusive doubly-linked FIFO per level
+     * plus an occupancy bitmap, so push, pop-next (find-first-set), and
+     * unlink of a known process are all O(1) regardless of process count.
+     * Links live in OSProcess (sched_next/sched_prev/sched_level).
+     */
+    class ReadyQueue {
+    public:
+        static constexpr uint32_t NUM_LEVELS = 256;
+
+        ReadyQueue() = default;
+
+        bool pushBack(OSProcess* proc, uint32_t level) {
+            if (!proc || count_ >= CAPACITY) {
+                return false;
+            }
+            if (level >= NUM_LEVELS) {
+                level = NUM_LEVELS - 1;
+            }
+            proc->sched_level = level;
+            if (levels_[level].empty()) {
+                bitmap_.set(level);
+            }
+            levels_[level].pushBack(proc);
+            count_++;
+            return true;
+        }
+
+        // Head of the highest occupied level (priority scheduling)
+        OSProcess* popHighest() {
+            const std::size_t level = bitmap_.findLastSet();
+            if (level == bitmap_.npos) {
+                return nullptr;
+            }
+            return popHead(static_cast<uint32_t>(level));
+        }
+
+        // Head of the lowest occupied level (FIFO / least-vruntime)
+        OSProcess* popLowest() {
+            const std::size_t level = bitmap_.findFirstSet();
+            if (level == bitmap_.npos) {
+                return nullptr;
+            }
+            return popHead(static_cast<uint32_t>(level));
+        }
+
+        // Tail of the highest occupied level (migration victim)
+        OSProcess* popTailHighest() {
+            const std::size_t level = bitmap_.findLastSet();
+            if (level == bitmap_.npos) {
+                return nullptr;
+            }
+            OSProcess* proc = levels_[level].back();
+            unlink(proc);
+            return proc;
+        }
+
+        // Lowest occupied level, or NUM_LEVELS when the queue is empty
+        uint32_t lowestOccupiedLevel() const {
+            return static_cast<uint32_t>(bitmap_.findFirstSet());
+        }
+
+        // Detach the entire chain at `level`; the caller re-enqueues the
+        // nodes (they keep their sched_next links until then)
+        OSProcess* detachLevel(uint32_t level) {
+            OSProcess* head = levels_[level].front();
+            for (OSProcess* p = head; p; p = p->sched_next) {
+                count_--;
+            }
+            levels_[level].clear();
+            bitmap_.clear(level);
+            return head;
+        }
+
+        // O(1) unlink of a process known to be in the queue
+        void unlink(OSProcess* proc) {
+            uint32_t level = proc->sched_level;
+            levels_[level].unlink(proc);
+            if (levels_[level].empty()) {
+                bitmap_.clear(level);
+            }
+            count_--;
+        }
+
+        OSProcess* findByPid(uint32_t pid) const {
+            for (std::size_t level = bitmap_.findFirstSet();
+                 level != bitmap_.npos;
+                 level = bitmap_.findFirstSet(level + 1)) {
+                for (OSProcess* p = levels_[level].front(); p;
+                     p = p->sched_next) {
+                    if (p->pid == pid) {
+                        return p;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename Fn>
+        void forEach(Fn&& fn) const {
+            for (std::size_t level = bitmap_.findFirstSet();
+                 level != bitmap_.npos;
+                 level = bitmap_.findFirstSet(level + 1)) {
+                for (OSProcess* p = levels_[level].front(); p;
+                     p = p->sched_next) {
+                    fn(p);
+                }
+            }
+        }
+
+        bool empty() const { return count_ == 0; }
+        uint32_t size() const { return count_; }
+
+    private:
+        static constexpr uint32_t CAPACITY = 1024;
+
+        OSProcess* popHead(uint32_t level) {
+            OSProcess* proc = levels_[level].front();
+            if (proc) {
+                unlink(proc);
+            }
+            return proc;
+        }
+
+        ProcList levels_[NUM_LEVELS];
+        FixedBitset<NUM_LEVELS> bitmap_;
+        uint32_t count_ = 0;
+    };
+
+    /**
+     * Blocked processes indexed by wait channel: a small hash of intrusive
+     * FIFO lists reusing the OSProcess scheduler links (sched_level holds
+     * the bucket index), so waking a channel touches only that channel's
+     * waiters instead of scanning every blocked process.
+     */
+    class WaitTable {
+    public:
+        static constexpr uint32_t NUM_BUCKETS = 64;
+
+        void push(OSProcess* proc, uint64_t channel) {
+            uint32_t b = bucketOf(channel);
+            proc->wait_channel = channel;
+            proc->sched_level = b;
+            buckets_[b].pushBack(proc);
+            count_++;
+        }
+
+        // Longest-waiting process on `channel`, unlinked; nullptr if none
+        OSProcess* popChannel(uint64_t channel) {
+            for (OSProcess* p = buckets_[bucketOf(channel)].front(); p;
+                 p = p->sched_next) {
+                if (p->wait_channel == channel) {
+                    unlink(p);
+                    return p;
+                }
+            }
+            return nullptr;
+        }
+
+        OSProcess* findByPid(uint32_t pid) const {
+            for (uint32_t b = 0; b < NUM_BUCKETS; b++) {
+                for (OSProcess* p = buckets_[b].front(); p; p = p->sched_next) {
+                    if (p->pid == pid) {
+                        return p;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        // O(1) unlink of a process known to be in the table
+        void unlink(OSProcess* proc) {
+            buckets_[proc->sched_level].unlink(proc);
+            proc->wait_channel = 0;
+            count_--;
+        }
+
+        template <typename Fn>
+        void forEach(Fn&& fn) const {
+            for (uint32_t b = 0; b < NUM_BUCKETS; b++) {
+                for (OSProcess* p = buckets_[b].front(); p; p = p->sched_next) {
+                    fn(p);
+                }
+            }
+        }
+
+        bool empty() const { return count_ == 0; }
+        uint32_t size() const { return count_; }
+
+    private:
+        // Fibonacci hash: top 6 bits of the multiplied key
+        static uint32_t bucketOf(uint64_t channel) {
+            return static_cast<uint32_t>((channel * 0x9E3779B97F4A7C15ULL) >> 58);
+        }
+
+        ProcList buckets_[NUM_BUCKETS];
+        uint32_t count_ = 0;
+    };
+
+    /**
+     * Zombies indexed by parent pid: chained per-parent lists over the same
+     * intrusive links (sched_level holds the bucket index), so reaping in
+     * sys_wait is O(zombies of that parent) instead of a scan over every
+     * exited process.
+     */
+    class ZombieTable {
+    public:
+        static constexpr uint32_t NUM_BUCKETS = 64;
+        static constexpr uint32_t CAPACITY = 1024;
+
+        bool push(OSProcess* proc) {
+            if (!proc || count_ >= CAPACITY) {
+                return false;
+            }
+            uint32_t b = bucketOf(proc->parent_pid);
+            proc->sched_level = b;
+            buckets_[b].pushBack(proc);
+            count_++;
+            return true;
+        }
+
+        // Oldest zombie whose parent is `parent_pid`, unlinked; nullptr if none
+        OSProcess* popByParent(uint32_t parent_pid) {
+            for (OSProcess* p = buckets_[bucketOf(parent_pid)].front(); p;
+                 p = p->sched_next) {
+                if (p->parent_pid == parent_pid) {
+                    unlink(p);
+                    return p;
+                }
+            }
+            return nullptr;
+        }
+
+        OSProcess* findByPid(uint32_t pid) const {
+            for (uint32_t b = 0; b < NUM_BUCKETS; b++) {
+                for (OSProcess* p = buckets_[b].front(); p; p = p->sched_next) {
+                    if (p->pid == pid) {
+                        return p;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        void unlink(OSProcess* proc) {
+            buckets_[proc->sched_level].unlink(proc);
+            count_--;
+        }
+
+        bool empty() const { return count_ == 0; }
+        uint32_t size() const { return count_; }
+
+    private:
+        static uint32_t bucketOf(uint32_t parent_pid) {
+            return (parent_pid * 2654435761u) >> 26;
+        }
+
+        ProcList buckets_[NUM_BUCKETS];
+        uint32_t count_ = 0;
+    };
+
     // Process queues
-    FixedVector<OSProcess*, 1024> ready_queue_;     // Processes ready to run
-    FixedVector<OSProcess*, 1024> blocked_queue_;   // Processes waiting for I/O
-    FixedVector<OSProcess*, 1024> zombie_queue_;    // Exited, waiting for parent
-    
+    ReadyQueue ready_queue_;                        // Processes ready to run
+    WaitTable blocked_queue_;                       // Processes waiting on a channel
+    ZombieTable zombie_queue_;                      // Exited, waiting for parent
+
     // Current running process
     OSProcess* current_process_;
-    
+
     // Statistics
     uint64_t total_ticks_;
     uint64_t idle_ticks_;
     uint64_t context_switches_;
-    
+
+    // Monotone floor of ready-process runtimes; FAIR buckets processes by
+    // (total_runtime - min_vruntime_) so the lowest occupied level holds the
+    // processes that have run least.
+    uint64_t min_vruntime_;
+
+    // FAIR processes whose runtime delta exceeds the level range share
+    // the top level until the floor catches up.
+    static constexpr uint32_t FAIR_OVERFLOW_LEVEL = ReadyQueue::NUM_LEVELS - 1;
+
+    /**
+     * Re-spread the saturated overflow level against the current fairness
+     * floor. The floor first advances to the least runtime in the chain,
+     * so at least one process lands on an exact level and the next pop
+     * makes progress. Amortized O(1) per enqueue: a process pays one
+     * re-bucket per trip through the overflow level.
+     */
+    void rebucketFairOverflow() {
+        OSProcess* head = ready_queue_.detachLevel(FAIR_OVERFLOW_LEVEL);
+        if (!head) {
+            return;
+        }
+        uint64_t least = head->total_runtime;
+        for (OSProcess* p = head->sched_next; p; p = p->sched_next) {
+            if (p->total_runtime < least) {
+                least = p->total_runtime;
+            }
+        }
+        if (least > min_vruntime_) {
+            min_vruntime_ = least;
+        }
+        OSProcess* p = head;
+        while (p) {
+            OSProcess* next = p->sched_next;
+            p->sched_next = nullptr;
+            p->sched_prev = nullptr;
+            (void)enqueueReady(p);
+            p = next;
+        }
+    }
+
     // Torus ID (for debugging)
     uint32_t torus_id_;
-    
+
 public:
     TorusScheduler(uint32_t torus_id, Policy policy = Policy::FAIR)
         : policy_(policy),
@@ -59,6 +399,7 @@ public:
           total_ticks_(0),
           idle_ticks_(0),
           context_switches_(0),
+          min_vruntime_(0),
           torus_id_(torus_id)
     {
     }
@@ -70,46 +411,95 @@ public:
      */
     bool addProcess(OSProcess* proc) {
         if (!proc) return false;
-        
+
         proc->setReady();
         proc->torus_id = torus_id_;
-        
-        if (!ready_queue_.push_back(proc)) {
+
+        if (!enqueueReady(proc)) {
             std::cerr << "[TorusScheduler " << torus_id_ << "] Ready queue full!" << std::endl;
             return false;
         }
-        
+
         return true;
     }
 
+    /**
+     * Enqueue a ready process at its policy-determined level: priority for
+     * PRIORITY, runtime distance above the fairness floor for FAIR, a single
+     * FIFO level for ROUND_ROBIN. O(1).
+     */
+    bool enqueueReady(OSProcess* proc) {
+        uint32_t level = 0;
+        switch (policy_) {
+            case Policy::PRIORITY:
+                level = proc->priority;
+                break;
+            case Policy::FAIR: {
+                uint64_t delta = proc->total_runtime > min_vruntime_
+                                     ? proc->total_runtime - min_vruntime_
+                                     : 0;
+                level = delta < ReadyQueue::NUM_LEVELS
+                            ? static_cast<uint32_t>(delta)
+                            : ReadyQueue::NUM_LEVELS - 1;
+                break;
+            }
+            case Policy::ROUND_ROBIN:
+            default:
+                level = 0;
+                break;
+        }
+        return ready_queue_.pushBack(proc, level);
+    }
+
     bool pushZombie(OSProcess* proc) {
         if (!proc) {
             return false;
         }
-        if (!zombie_queue_.push_back(proc)) {
+        if (!zombie_queue_.push(proc)) {
             std::cerr << "[TorusScheduler " << torus_id_ << "] Zombie queue full!" << std::endl;
             return false;
         }
+        // Wake exactly the parent, if it is blocked waiting for a child
+        wakeChannel(channelForChildrenOf(proc->parent_pid));
         return true;
     }
 
     OSProcess* reapZombie(uint32_t parent_pid, int* exit_code) {
-        for (size_t i = 0; i < zombie_queue_.size(); ++i) {
-            OSProcess* proc = zombie_queue_[i];
-            if (!proc) {
-                continue;
-            }
-            if (proc->parent_pid == parent_pid) {
-                if (exit_code) {
-                    *exit_code = proc->exit_code;
-                }
-                zombie_queue_.erase_at(i);
-                return proc;
-            }
+        OSProcess* proc = zombie_queue_.popByParent(parent_pid);
+        if (!proc) {
+            return nullptr;
         }
-        return nullptr;
+        if (exit_code) {
+            *exit_code = proc->exit_code;
+        }
+        return proc;
     }
     
+    /**
+     * Find a live (non-zombie) process by pid.
+     */
+    OSProcess* findProcess(uint32_t pid) {
+        if (current_process_ && current_process_->pid == pid) {
+            return current_process_;
+        }
+        if (OSProcess* proc = ready_queue_.findByPid(pid)) {
+            return proc;
+        }
+        return blocked_queue_.findByPid(pid);
+    }
+
+    /**
+     * Detach a ready process by pid, e.g. to migrate it to another torus.
+     * The running and blocked processes stay put.
+     */
+    OSProcess* takeReadyProcess(uint32_t pid) {
+        if (OSProcess* proc = ready_queue_.findByPid(pid)) {
+            ready_queue_.unlink(proc);
+            return proc;
+        }
+        return nullptr;
+    }
+
     /**
      * Remove a process from all queues.
      */
@@ -121,54 +511,45 @@ public:
         }
         
         // Check ready queue
-        for (size_t i = 0; i < ready_queue_.size(); i++) {
-            if (ready_queue_[i]->pid == pid) {
-                ready_queue_.erase_at(i);
-                return true;
-            }
+        if (OSProcess* proc = ready_queue_.findByPid(pid)) {
+            ready_queue_.unlink(proc);
+            return true;
         }
-        
-        // Check blocked queue
-        for (size_t i = 0; i < blocked_queue_.size(); i++) {
-            if (blocked_queue_[i]->pid == pid) {
-                blocked_queue_.erase_at(i);
-                return true;
-            }
+
+        // Check blocked table
+        if (OSProcess* proc = blocked_queue_.findByPid(pid)) {
+            blocked_queue_.unlink(proc);
+            return true;
         }
 
-        for (size_t i = 0; i < zombie_queue_.size(); i++) {
-            if (zombie_queue_[i]->pid == pid) {
-                zombie_queue_.erase_at(i);
-                return true;
-            }
+        if (OSProcess* proc = zombie_queue_.findByPid(pid)) {
+            zombie_queue_.unlink(proc);
+            return true;
         }
         
         return false;
     }
     
     /**
-     * Block a process (move to blocked queue).
+     * Block a process on a wait channel (move to blocked table).
      */
-    bool blockProcess(uint32_t pid) {
+    bool blockProcess(uint32_t pid, uint64_t channel = WAIT_CHANNEL_NONE) {
         // Check if it's the current process
         if (current_process_ && current_process_->pid == pid) {
-            current_process_->setBlocked();
-            (void)blocked_queue_.push_back(current_process_);
+            current_process_->setBlocked(channel);
+            blocked_queue_.push(current_process_, channel);
             current_process_ = nullptr;
             return true;
         }
         
         // Check ready queue
-        for (size_t i = 0; i < ready_queue_.size(); i++) {
-            if (ready_queue_[i]->pid == pid) {
-                OSProcess* proc = ready_queue_[i];
-                ready_queue_.erase_at(i);
-                proc->setBlocked();
-                (void)blocked_queue_.push_back(proc);
-                return true;
-            }
+        if (OSProcess* proc = ready_queue_.findByPid(pid)) {
+            ready_queue_.unlink(proc);
+            proc->setBlocked(channel);
+            blocked_queue_.push(proc, channel);
+            return true;
         }
-        
+
         return false;
     }
     
@@ -176,19 +557,43 @@ public:
      * Unblock a process (move to ready queue).
      */
     bool unblockProcess(uint32_t pid) {
-        for (size_t i = 0; i < blocked_queue_.size(); i++) {
-            if (blocked_queue_[i]->pid == pid) {
-                OSProcess* proc = blocked_queue_[i];
-                blocked_queue_.erase_at(i);
-                proc->setReady();
-                (void)ready_queue_.push_back(proc);
-                return true;
-            }
+        if (OSProcess* proc = blocked_queue_.findByPid(pid)) {
+            blocked_queue_.unlink(proc);
+            proc->setReady();
+            (void)enqueueReady(proc);
+            return true;
         }
         
         return false;
     }
 
+    /**
+     * Wake every process blocked on `channel`. Touches only that channel's
+     * waiters. Returns the number woken.
+     */
+    uint32_t wakeChannel(uint64_t channel) {
+        uint32_t woken = 0;
+        while (OSProcess* proc = blocked_queue_.popChannel(channel)) {
+            proc->setReady();
+            (void)enqueueReady(proc);
+            woken++;
+        }
+        return woken;
+    }
+
+    /**
+     * Wake the longest-waiting process on `channel`, if any.
+     */
+    bool wakeOne(uint64_t channel) {
+        OSProcess* proc = blocked_queue_.popChannel(channel);
+        if (!proc) {
+            return false;
+        }
+        proc->setReady();
+        (void)enqueueReady(proc);
+        return true;
+    }
+
     /**
      * Mark a process as zombie and move it to the zombie queue.
      * Returns false if the PID is not found in any active queue.
@@ -201,28 +606,20 @@ public:
             current_process_->setZombie(exit_code);
             return true;
         }
-        for (size_t i = 0; i < ready_queue_.size(); ++i) {
-            if (ready_queue_[i]->pid == pid) {
-                OSProcess* proc = ready_queue_[i];
-                ready_queue_.erase_at(i);
-                proc->setZombie(exit_code);
-                (void)pushZombie(proc);
-                return true;
-            }
+        if (OSProcess* proc = ready_queue_.findByPid(pid)) {
+            ready_queue_.unlink(proc);
+            proc->setZombie(exit_code);
+            (void)pushZombie(proc);
+            return true;
         }
-        for (size_t i = 0; i < blocked_queue_.size(); ++i) {
-            if (blocked_queue_[i]->pid == pid) {
-                OSProcess* proc = blocked_queue_[i];
-                blocked_queue_.erase_at(i);
-                proc->setZombie(exit_code);
-                (void)pushZombie(proc);
-                return true;
-            }
+        if (OSProcess* proc = blocked_queue_.findByPid(pid)) {
+            blocked_queue_.unlink(proc);
+            proc->setZombie(exit_code);
+            (void)pushZombie(proc);
+            return true;
         }
-        for (size_t i = 0; i < zombie_queue_.size(); ++i) {
-            if (zombie_queue_[i]->pid == pid) {
-                return true;
-            }
+        if (zombie_queue_.findByPid(pid)) {
+            return true;
         }
         return false;
     }
@@ -233,40 +630,16 @@ public:
      * Pick next process to run (Round-Robin).
      */
     OSProcess* scheduleRoundRobin() {
-        if (ready_queue_.empty()) {
-            return nullptr;
-        }
-        
-        // Simple: pick first, move to back
-        OSProcess* next = ready_queue_[0];
-        ready_queue_.erase_at(0);
-        
-        return next;
+        // All processes share one FIFO level: pop the head
+        return ready_queue_.popLowest();
     }
     
     /**
      * Pick next process to run (Priority-based).
      */
     OSProcess* schedulePriority() {
-        if (ready_queue_.empty()) {
-            return nullptr;
-        }
-        
-        // Find highest priority process
-        size_t best_idx = 0;
-        uint32_t best_priority = ready_queue_[0]->priority;
-        
-        for (size_t i = 1; i < ready_queue_.size(); i++) {
-            if (ready_queue_[i]->priority > best_priority) {
-                best_idx = i;
-                best_priority = ready_queue_[i]->priority;
-            }
-        }
-        
-        OSProcess* next = ready_queue_[best_idx];
-        ready_queue_.erase_at(best_idx);
-        
-        return next;
+        // Find-first-set over the level bitmap, pop that level's head
+        return ready_queue_.popHighest();
     }
     
     /**
@@ -274,24 +647,20 @@ public:
      * Picks the process with the least total runtime.
      */
     OSProcess* scheduleFair() {
-        if (ready_queue_.empty()) {
-            return nullptr;
+        // Processes more than NUM_LEVELS-1 ticks above the fairness floor
+        // all share the saturated top level, where FIFO order hides their
+        // relative vruntimes. Only when that level is the next to be
+        // popped does it matter: spread it back out against the current
+        // floor first, so pick order stays exact at any process count.
+        if (ready_queue_.lowestOccupiedLevel() == FAIR_OVERFLOW_LEVEL) {
+            rebucketFairOverflow();
+        }
+        // The lowest occupied level holds the least-run processes; advance
+        // the fairness floor so future enqueues bucket relative to it.
+        OSProcess* next = ready_queue_.popLowest();
+        if (next && next->total_runtime > min_vruntime_) {
+            min_vruntime_ = next->total_runtime;
         }
-        
-        // Find process with least runtime
-        size_t best_idx = 0;
-        uint64_t least_runtime = ready_queue_[0]->total_runtime;
-        
-        for (size_t i = 1; i < ready_queue_.size(); i++) {
-            if (ready_queue_[i]->total_runtime < least_runtime) {
-                best_idx = i;
-                least_runtime = ready_queue_[i]->total_runtime;
-            }
-        }
-        
-        OSProcess* next = ready_queue_[best_idx];
-        ready_queue_.erase_at(best_idx);
-        
         return next;
     }
     
@@ -299,6 +668,7 @@ public:
      * Pick next process based on current policy.
      */
     OSProcess* schedule() {
+        RSE_PROFILE_SCOPE(SITE_SCHED_SCHEDULE);
         switch (policy_) {
             case Policy::ROUND_ROBIN:
                 return scheduleRoundRobin();
@@ -317,6 +687,7 @@ public:
      * Main scheduler tick - called every tick.
      */
     void tick() {
+        RSE_PROFILE_SCOPE(SITE_SCHED_TICK);
         total_ticks_++;
         
         // Check if current process should be preempted
@@ -326,14 +697,14 @@ public:
                 // Preempt: save context and put back in ready queue
                 current_process_->saveContext();
                 current_process_->setReady();
-                (void)ready_queue_.push_back(current_process_);
+                (void)enqueueReady(current_process_);
                 current_process_ = nullptr;
                 context_switches_++;
             }
             // Check if process blocked itself
             else if (current_process_->isBlocked()) {
-                // Move to blocked queue
-                (void)blocked_queue_.push_back(current_process_);
+                // Move to blocked table, on whatever channel it chose
+                blocked_queue_.push(current_process_, current_process_->wait_channel);
                 current_process_ = nullptr;
                 context_switches_++;
             }
@@ -366,6 +737,12 @@ public:
         if (current_process_) {
             current_process_->execute();
         }
+
+        // Keep the running process's shared info page current
+        if (current_process_) {
+            current_process_->updateVdso(total_ticks_, context_switches_,
+                                         getProcessCount(), getReadyCount());
+        }
     }
     
     // ========== Statistics ==========
@@ -379,6 +756,17 @@ public:
     uint32_t getReadyCount() const {
         return ready_queue_.size();
     }
+
+    /**
+     * True when a tick would make progress: a process is running or
+     * waiting in the ready queue. Blocked processes are woken by other
+     * processes' syscalls, never by the tick itself, so a driver may
+     * skip ticking an idle scheduler entirely (tickless idle) without
+     * losing a wakeup.
+     */
+    bool hasRunnableWork() const {
+        return current_process_ != nullptr || ready_queue_.size() > 0;
+    }
     
     uint32_t getBlockedCount() const {
         return blocked_queue_.size();
@@ -402,12 +790,8 @@ public:
         if (current_process_) {
             fn(current_process_);
         }
-        for (size_t i = 0; i < ready_queue_.size(); ++i) {
-            fn(ready_queue_[i]);
-        }
-        for (size_t i = 0; i < blocked_queue_.size(); ++i) {
-            fn(blocked_queue_[i]);
-        }
+        ready_queue_.forEach(fn);
+        blocked_queue_.forEach(fn);
     }
 
     void forceCurrentProcess(OSProcess* proc) {
@@ -430,14 +814,9 @@ public:
             return nullptr;
         }
         
-        // Pick a ready process (not the currently running one)
-        if (!ready_queue_.empty()) {
-            OSProcess* proc = ready_queue_[ready_queue_.size() - 1];
-            ready_queue_.erase_at(ready_queue_.size() - 1);
-            return proc;
-        }
-        
-        return nullptr;
+        // Pick a ready process (not the currently running one): the tail of
+        // the highest occupied level is the one that has waited least there.
+        return ready_queue_.popTailHighest();
     }
     
     /**
@@ -448,7 +827,7 @@ public:
         
         proc->torus_id = torus_id_;
         proc->setReady();
-        return ready_queue_.push_back(proc);
+        return enqueueReady(proc);
     }
     
     // ========== Debugging ==========
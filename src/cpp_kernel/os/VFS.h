@@ -25,17 +25,186 @@ private:
     MemFS* fs_;
     DeviceManager* device_mgr_;
     BlockFS* blockfs_;
-    
+
+    /**
+     * Path resolution cache (dentry-style).
+     *
+     * Direct-mapped by path hash: a hit hands back the resolved target
+     * (MemFS file, device, or BlockFS entry) without prefix matching or
+     * the backing store's lookup. Entries are revalidated against the
+     * target on every hit (slot still in use, name still matches), so a
+     * removal that bypassed the VFS degrades to a miss instead of a
+     * stale open. unlink() invalidates; swapping a backing store resets.
+     */
+    static constexpr uint32_t PC_ENTRIES = 64;   // Power of two
+    static constexpr uint32_t PC_PATH_MAX = 128;
+
+    enum : uint8_t { PC_NONE = 0, PC_MEMFS, PC_DEVICE, PC_BLOCKFS };
+
+    struct PathCacheEntry {
+        char path[PC_PATH_MAX];
+        MemFSFile* file;
+        Device* dev;
+        BlockFSEntry* block;
+        uint8_t kind;
+    };
+
+    mutable PathCacheEntry path_cache_[PC_ENTRIES];
+    mutable uint64_t path_cache_hits_;
+    mutable uint64_t path_cache_misses_;
+
+    static uint32_t pathHash(const char* path) {
+        uint32_t hash = 2166136261u;
+        for (uint32_t i = 0; path[i]; i++) {
+            hash ^= (uint8_t)path[i];
+            hash *= 16777619u;
+        }
+        return hash & (PC_ENTRIES - 1);
+    }
+
+    PathCacheEntry* cacheFind(const char* path) const {
+        PathCacheEntry& entry = path_cache_[pathHash(path)];
+        if (entry.kind != PC_NONE && strcmp(entry.path, path) == 0 &&
+            cacheValid(entry)) {
+            path_cache_hits_++;
+            return &entry;
+        }
+        path_cache_misses_++;
+        return nullptr;
+    }
+
+    bool cacheValid(PathCacheEntry& entry) const {
+        switch (entry.kind) {
+            case PC_MEMFS:
+                // Slot may have been recycled for another path
+                if (!entry.file || !entry.file->in_use ||
+                    strcmp(entry.file->name, entry.path) != 0) {
+                    entry.kind = PC_NONE;
+                    return false;
+                }
+                return true;
+            case PC_DEVICE:
+                return entry.dev != nullptr;
+            case PC_BLOCKFS: {
+                const char* persist = persistName(entry.path);
+                if (!blockfs_ || !blockfs_->isMounted() || !entry.block ||
+                    !entry.block->in_use || !persist ||
+                    strncmp(entry.block->name, persist,
+                            sizeof(entry.block->name)) != 0) {
+                    entry.kind = PC_NONE;
+                    return false;
+                }
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    void cacheStore(const char* path, uint8_t kind, MemFSFile* file,
+                    Device* dev, BlockFSEntry* block) const {
+        uint32_t len = 0;
+        while (path[len]) {
+            len++;
+        }
+        if (len + 1 > PC_PATH_MAX) {
+            return;  // Too long to cache; resolution still works
+        }
+        PathCacheEntry& entry = path_cache_[pathHash(path)];
+        std::memcpy(entry.path, path, len + 1);
+        entry.kind = kind;
+        entry.file = file;
+        entry.dev = dev;
+        entry.block = block;
+    }
+
+    void cacheInvalidate(const char* path) const {
+        if (!path) {
+            return;
+        }
+        PathCacheEntry& entry = path_cache_[pathHash(path)];
+        if (entry.kind != PC_NONE && strcmp(entry.path, path) == 0) {
+            entry.kind = PC_NONE;
+        }
+    }
+
+    void cacheReset() const {
+        for (uint32_t i = 0; i < PC_ENTRIES; i++) {
+            path_cache_[i].kind = PC_NONE;
+            path_cache_[i].path[0] = '\0';
+        }
+    }
+
+    int32_t openDevice(FileDescriptorTable* fd_table, Device* dev,
+                       uint32_t flags) {
+        if (dev->open) {
+            dev->open(dev);
+        }
+        int32_t fd = fd_table->allocateDevice(dev, flags);
+        if (fd < 0) {
+            std::cerr << "[VFS] Failed to allocate device FD" << std::endl;
+            return -1;
+        }
+        return fd;
+    }
+
+    int32_t openBlock(FileDescriptorTable* fd_table, BlockFSEntry* entry,
+                      uint32_t flags) {
+        if (flags & O_TRUNC) {
+            blockfs_->truncate(entry);
+        }
+        int32_t fd = fd_table->allocateBlock(entry, flags);
+        if (fd < 0) {
+            std::cerr << "[VFS] Failed to allocate BlockFS FD" << std::endl;
+            return -1;
+        }
+        if (flags & O_APPEND) {
+            FileDescriptor* desc = fd_table->get(fd);
+            if (desc) {
+                desc->offset = entry->size;
+            }
+        }
+        return fd;
+    }
+
+    int32_t openMem(FileDescriptorTable* fd_table, MemFSFile* file,
+                    uint32_t flags) {
+        if (flags & O_TRUNC) {
+            file->truncate();
+        }
+        int32_t fd = fd_table->allocate(file, flags);
+        if (fd < 0) {
+            std::cerr << "[VFS] Failed to allocate FD" << std::endl;
+            return -1;
+        }
+        if (flags & O_APPEND) {
+            FileDescriptor* desc = fd_table->get(fd);
+            if (desc) {
+                desc->offset = file->size;
+            }
+        }
+        return fd;
+    }
+
 public:
     VFS(MemFS* fs)
-        : fs_(fs), device_mgr_(nullptr), blockfs_(nullptr) {}
+        : fs_(fs), device_mgr_(nullptr), blockfs_(nullptr),
+          path_cache_hits_(0), path_cache_misses_(0) {
+        cacheReset();
+    }
 
     void setDeviceManager(DeviceManager* mgr) {
         device_mgr_ = mgr;
+        cacheReset();
     }
 
     void setBlockFS(BlockFS* fs) {
         blockfs_ = fs;
+        cacheReset();
+    }
+
+    BlockFS* getBlockFS() const {
+        return blockfs_;
     }
 
     Device* lookupDevice(const char* path) const {
@@ -55,6 +224,27 @@ public:
         return device_mgr_->lookup(name);
     }
 
+    /**
+     * Match the directory paths the flat namespace exposes. Returns true
+     * and the namespace when `path` names a directory that currently
+     * exists (mirrors stat()'s availability checks).
+     */
+    bool dirPathNS(const char* path, DirNS* ns) const {
+        if (strcmp(path, "/") == 0 || strcmp(path, "") == 0) {
+            *ns = DirNS::ROOT;
+            return true;
+        }
+        if (strcmp(path, "/dev") == 0 || strcmp(path, "/dev/") == 0) {
+            *ns = DirNS::DEV;
+            return device_mgr_ != nullptr;
+        }
+        if (strcmp(path, "/persist") == 0 || strcmp(path, "/persist/") == 0) {
+            *ns = DirNS::PERSIST;
+            return blockfs_ && blockfs_->isMounted();
+        }
+        return false;
+    }
+
     const char* persistName(const char* path) const {
         if (!path) {
             return nullptr;
@@ -82,21 +272,34 @@ public:
      */
     int32_t open(FileDescriptorTable* fd_table, const char* path,
                  uint32_t flags, uint32_t mode = 0644) {
-        if (!fd_table) {
+        if (!fd_table || !path) {
             return -EINVAL;
         }
+        // Hot path: a cache hit skips prefix matching and backing-store
+        // lookup entirely
+        PathCacheEntry* hit = cacheFind(path);
+        if (hit) {
+            switch (hit->kind) {
+                case PC_DEVICE:
+                    return openDevice(fd_table, hit->dev, flags);
+                case PC_BLOCKFS:
+                    return openBlock(fd_table, hit->block, flags);
+                default:
+                    return openMem(fd_table, hit->file, flags);
+            }
+        }
+
+        // Directory opens anchor relative resolution (openat)
+        DirNS ns;
+        if (dirPathNS(path, &ns)) {
+            return fd_table->allocateDir(ns, flags);
+        }
+
         // Device nodes (/dev/*)
         Device* dev = lookupDevice(path);
         if (dev) {
-            if (dev->open) {
-                dev->open(dev);
-            }
-            int32_t fd = fd_table->allocateDevice(dev, flags);
-            if (fd < 0) {
-                std::cerr << "[VFS] Failed to allocate device FD" << std::endl;
-                return -1;
-            }
-            return fd;
+            cacheStore(path, PC_DEVICE, nullptr, dev, nullptr);
+            return openDevice(fd_table, dev, flags);
         }
 
         const char* persist = persistName(path);
@@ -110,26 +313,13 @@ public:
                 std::cerr << "[VFS] BlockFS open failed: " << persist << std::endl;
                 return -1;
             }
-            if (flags & O_TRUNC) {
-                blockfs_->truncate(entry);
-            }
-            int32_t fd = fd_table->allocateBlock(entry, flags);
-            if (fd < 0) {
-                std::cerr << "[VFS] Failed to allocate BlockFS FD" << std::endl;
-                return -1;
-            }
-            if (flags & O_APPEND) {
-                FileDescriptor* desc = fd_table->get(fd);
-                if (desc) {
-                    desc->offset = entry->size;
-                }
-            }
-            return fd;
+            cacheStore(path, PC_BLOCKFS, nullptr, nullptr, entry);
+            return openBlock(fd_table, entry, flags);
         }
 
         // Look up file
         MemFSFile* file = fs_->lookup(path);
-        
+
         // Create if doesn't exist and O_CREAT is set
         if (!file && (flags & O_CREAT)) {
             file = fs_->create(path, mode);
@@ -138,36 +328,67 @@ public:
                 return -1;
             }
         }
-        
+
         // File not found
         if (!file) {
             std::cerr << "[VFS] File not found: " << path << std::endl;
             return -1;
         }
-        
-        // Truncate if O_TRUNC is set
-        if (flags & O_TRUNC) {
-            file->truncate();
+
+        cacheStore(path, PC_MEMFS, file, nullptr, nullptr);
+        return openMem(fd_table, file, flags);
+    }
+
+    /**
+     * Open `name` relative to a directory descriptor. The directory is
+     * already resolved to its backing store, so the open goes straight
+     * there — no prefix matching, no dentry cache probe. An absolute
+     * name falls back to a plain open and ignores `dirfd`.
+     */
+    int32_t openat(FileDescriptorTable* fd_table, int32_t dirfd,
+                   const char* name, uint32_t flags, uint32_t mode = 0644) {
+        if (!fd_table || !name || name[0] == '\0') {
+            return -EINVAL;
         }
-        
-        // Allocate file descriptor
-        int32_t fd = fd_table->allocate(file, flags);
-        if (fd < 0) {
-            std::cerr << "[VFS] Failed to allocate FD" << std::endl;
-            return -1;
+        if (name[0] == '/') {
+            return open(fd_table, name, flags, mode);
         }
-        
-        // If O_APPEND, set offset to end
-        if (flags & O_APPEND) {
-            FileDescriptor* desc = fd_table->get(fd);
-            if (desc) {
-                desc->offset = file->size;
+        FileDescriptor* dir = fd_table->get(dirfd);
+        if (!dir || !dir->isDirectory()) {
+            return -ENOTDIR;
+        }
+        switch (dir->dir_ns) {
+            case DirNS::DEV: {
+                Device* dev = device_mgr_ ? device_mgr_->lookup(name) : nullptr;
+                if (!dev) {
+                    return -ENOENT;
+                }
+                return openDevice(fd_table, dev, flags);
+            }
+            case DirNS::PERSIST: {
+                if (!blockfs_ || !blockfs_->isMounted()) {
+                    return -ENOENT;
+                }
+                BlockFSEntry* entry =
+                    blockfs_->open(name, (flags & O_CREAT) != 0);
+                if (!entry) {
+                    return -ENOENT;
+                }
+                return openBlock(fd_table, entry, flags);
+            }
+            default: {  // ROOT: MemFS names are flat
+                MemFSFile* file = fs_->lookup(name);
+                if (!file && (flags & O_CREAT)) {
+                    file = fs_->create(name, mode);
+                }
+                if (!file) {
+                    return -ENOENT;
+                }
+                return openMem(fd_table, file, flags);
             }
         }
-        
-        return fd;
     }
-    
+
     /**
      * Read from a file.
      * 
@@ -180,8 +401,8 @@ public:
         if (!fd_table) {
             return -EINVAL;
         }
-        // Get file descriptor
-        FileDescriptor* desc = fd_table->get(fd);
+        // Hot path: one bitmap test resolves the descriptor
+        FileDescriptor* desc = fd_table->getFast(fd);
         if (!desc) {
             std::cerr << "[VFS] Invalid FD: " << fd << std::endl;
             return -1;
@@ -189,6 +410,9 @@ public:
         if (!desc->isReadable()) {
             return -EACCES;
         }
+        if (desc->isDirectory()) {
+            return -EISDIR;
+        }
 
         if (desc->isBlockFile()) {
             if (!blockfs_ || !desc->block_file) {
@@ -313,8 +537,8 @@ public:
         if (!fd_table) {
             return -EINVAL;
         }
-        // Get file descriptor
-        FileDescriptor* desc = fd_table->get(fd);
+        // Hot path: one bitmap test resolves the descriptor
+        FileDescriptor* desc = fd_table->getFast(fd);
         if (!desc) {
             std::cerr << "[VFS] Invalid FD: " << fd << std::endl;
             return -1;
@@ -322,6 +546,9 @@ public:
         if (!desc->isWritable()) {
             return -EACCES;
         }
+        if (desc->isDirectory()) {
+            return -EISDIR;
+        }
 
         if (desc->isBlockFile()) {
             if (!blockfs_ || !desc->block_file) {
@@ -437,10 +664,87 @@ public:
         
         // Update offset
         desc->offset += bytes_written;
-        
+
         return bytes_written;
     }
-    
+
+    /**
+     * Vectored read: fill the segments in order. Devices advertising a
+     * readv op consume the whole scatter list in one driver call;
+     * everything else falls back to one read per segment.
+     */
+    int64_t readv(FileDescriptorTable* fd_table, int32_t fd,
+                  const rse_iovec* iov, int iovcnt) {
+        if (!fd_table || !iov || iovcnt < 0 || (uint32_t)iovcnt > RSE_IOV_MAX) {
+            return -EINVAL;
+        }
+        FileDescriptor* desc = fd_table->getFast(fd);
+        if (!desc) {
+            std::cerr << "[VFS] Invalid FD: " << fd << std::endl;
+            return -1;
+        }
+        if (!desc->isReadable()) {
+            return -EACCES;
+        }
+        if (desc->isDevice() && desc->device && desc->device->readv) {
+            return desc->device->readv(desc->device, iov, iovcnt);
+        }
+        int64_t total = 0;
+        for (int seg = 0; seg < iovcnt; ++seg) {
+            if (iov[seg].base == 0 || iov[seg].len == 0) {
+                continue;
+            }
+            int64_t got = read(fd_table, fd, (void*)iov[seg].base,
+                               (uint32_t)iov[seg].len);
+            if (got < 0) {
+                return total != 0 ? total : got;
+            }
+            total += got;
+            if ((uint64_t)got < iov[seg].len) {
+                break;
+            }
+        }
+        return total;
+    }
+
+    /**
+     * Vectored write: gather the segments in order. Devices advertising
+     * a writev op take the scatter list directly — no assembly copy.
+     */
+    int64_t writev(FileDescriptorTable* fd_table, int32_t fd,
+                   const rse_iovec* iov, int iovcnt) {
+        if (!fd_table || !iov || iovcnt < 0 || (uint32_t)iovcnt > RSE_IOV_MAX) {
+            return -EINVAL;
+        }
+        FileDescriptor* desc = fd_table->getFast(fd);
+        if (!desc) {
+            std::cerr << "[VFS] Invalid FD: " << fd << std::endl;
+            return -1;
+        }
+        if (!desc->isWritable()) {
+            return -EACCES;
+        }
+        if (desc->isDevice() && desc->device && desc->device->writev) {
+            return desc->device->writev(desc->device, iov, iovcnt);
+        }
+        int64_t total = 0;
+        for (int seg = 0; seg < iovcnt; ++seg) {
+            if (iov[seg].base == 0 || iov[seg].len == 0) {
+                continue;
+            }
+            int64_t put = write(fd_table, fd, (const void*)iov[seg].base,
+                                (uint32_t)iov[seg].len);
+            if (put < 0) {
+                return total != 0 ? total : put;
+            }
+            total += put;
+            if ((uint64_t)put < iov[seg].len) {
+                break;
+            }
+        }
+        return total;
+    }
+
     /**
      * Close a file descriptor.
      * 
@@ -483,6 +787,9 @@ public:
             std::cerr << "[VFS] Invalid FD: " << fd << std::endl;
             return -1;
         }
+        if (desc->isDirectory()) {
+            return -EISDIR;
+        }
         if (desc->isBlockFile()) {
             int64_t new_offset = 0;
             uint64_t file_size = desc->block_file ? desc->block_file->size : 0;
@@ -567,6 +874,7 @@ public:
      * @return 0 on success, -1 on error
      */
     int32_t unlink(const char* path) {
+        cacheInvalidate(path);
         const char* persist = persistName(path);
         if (persist) {
             if (!blockfs_ || !blockfs_->isMounted()) {
@@ -700,6 +1008,8 @@ public:
      * Print VFS statistics.
      */
     void printStats(const FileDescriptorTable* fd_table) const {
+        std::cout << "[VFS] Path cache: hits=" << path_cache_hits_
+                  << " misses=" << path_cache_misses_ << std::endl;
         fs_->printStats();
         if (fd_table) {
             fd_table->printStats();
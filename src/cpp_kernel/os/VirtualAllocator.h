@@ -10,18 +10,58 @@
 
 /**
  * Virtual Memory Allocator for Braided OS
- * 
+ *
  * Manages virtual address space for a process.
  * Integrates with page table and physical allocator.
+ *
+ * Zeroing is lazy: pages are mapped with PTE_LAZY_ZERO and cleared on first
+ * touch (readUser/writeUser fault them in), so spawn only pays for pages the
+ * process actually uses. Freed frames go to a per-process recycled-frame
+ * cache; recycling skips the physical allocator's frame scan, and heap pages
+ * recycled into the same process skip re-zeroing entirely (their stale
+ * contents belong to this process, so nothing leaks).
  */
 
 namespace os {
 
+/**
+ * Fills one page of a file-backed mapping: copy up to `len` bytes at
+ * `file_offset` into `dst`, returning bytes copied (short or zero at
+ * EOF) or negative on error. `ctx`/`arg` identify the file to whoever
+ * registered the mapping — the allocator never learns about
+ * filesystems.
+ */
+using FileFillFunc = int64_t (*)(void* ctx, uint64_t arg,
+                                 uint64_t file_offset, uint8_t* dst,
+                                 uint64_t len);
+
 class VirtualAllocator {
 private:
+    // Frames cached here were freed by this process and are handed back
+    // before asking the physical allocator for fresh ones.
+    static constexpr uint32_t RECYCLED_CACHE_FRAMES = 64;
+
+    // File-backed mapping regions: which range demand-fills from where
+    static constexpr uint32_t MAX_FILE_MAPPINGS = 8;
+
+    struct FileMapping {
+        bool in_use;
+        uint64_t start;
+        uint64_t size;
+        uint64_t file_offset;   // File offset backing `start`
+        FileFillFunc fill;
+        void* fill_ctx;
+        uint64_t fill_arg;
+    };
+
     PageTable* page_table_;
     PhysicalAllocator* phys_alloc_;
-    
+
+    uint64_t recycled_frames_[RECYCLED_CACHE_FRAMES];
+    uint32_t recycled_count_ = 0;
+
+    FileMapping file_mappings_[MAX_FILE_MAPPINGS] = {};
+
     // Virtual memory regions
     uint64_t heap_start_;
     uint64_t heap_end_;
@@ -37,10 +77,18 @@ public:
           heap_start_(0x00000000'00400000ULL),   // 4MB
           heap_end_(0x00000000'40000000ULL),     // 1GB
           heap_brk_(0x00000000'00400000ULL),
-          stack_start_(0x00007FFF'FFFF0000ULL),  // Near top of user space
-          stack_end_(0x00007FFF'FFFFF000ULL) {
+          stack_start_(0x00007FFF'FFFE1000ULL),  // Just above the vDSO page
+          stack_end_(0x00007FFF'FFFFF000ULL) {   // Near top of user space
     }
-    
+
+    ~VirtualAllocator() {
+        // Return cached frames to the physical allocator
+        for (uint32_t i = 0; i < recycled_count_; i++) {
+            phys_alloc_->freeFrame(recycled_frames_[i]);
+        }
+        recycled_count_ = 0;
+    }
+
     /**
      * Allocate virtual memory (like brk/sbrk).
      * 
@@ -64,37 +112,31 @@ public:
         
         // Allocate and map physical frames
         for (uint64_t virt = virt_start; virt < virt_end; virt += PAGE_SIZE) {
-            // Allocate physical frame
-            uint64_t phys = phys_alloc_->allocateFrame();
+            // Allocate physical frame (recycled frames skip re-zeroing:
+            // their stale contents already belong to this process)
+            bool recycled = false;
+            uint64_t phys = acquireFrame(recycled);
             if (phys == 0) {
                 // Out of memory - unmap what we've allocated
-                for (uint64_t v = virt_start; v < virt; v += PAGE_SIZE) {
-                    uint64_t p = page_table_->translate(v);
-                    if (p != 0) {
-                        phys_alloc_->freeFrame(p);
-                        page_table_->unmap(v);
-                    }
-                }
+                unmapRangeFrames(virt_start, virt);
                 return 0;
             }
-            
-            // Map virtual to physical
-            if (!page_table_->map(virt, phys, PTE_PRESENT | PTE_WRITABLE | PTE_USER)) {
+
+            // Map virtual to physical; fresh frames are zeroed on first touch
+            uint64_t flags = PTE_PRESENT | PTE_WRITABLE | PTE_USER;
+            if (!recycled) {
+                flags |= PTE_LAZY_ZERO;
+            }
+            if (!page_table_->map(virt, phys, flags)) {
                 // Mapping failed - free frame
-                phys_alloc_->freeFrame(phys);
-                
+                releaseFrame(phys);
+
                 // Unmap what we've allocated
-                for (uint64_t v = virt_start; v < virt; v += PAGE_SIZE) {
-                    uint64_t p = page_table_->translate(v);
-                    if (p != 0) {
-                        phys_alloc_->freeFrame(p);
-                        page_table_->unmap(v);
-                    }
-                }
+                unmapRangeFrames(virt_start, virt);
                 return 0;
             }
         }
-        
+
         // Update break
         heap_brk_ = virt_end;
         
@@ -114,14 +156,8 @@ public:
         uint64_t virt_start = align_down(addr);
         uint64_t virt_end = align_up(addr + size);
         
-        // Unmap and free physical frames
-        for (uint64_t virt = virt_start; virt < virt_end; virt += PAGE_SIZE) {
-            uint64_t phys = page_table_->translate(virt);
-            if (phys != 0) {
-                phys_alloc_->freeFrame(phys);
-                page_table_->unmap(virt);
-            }
-        }
+        // Unmap and recycle physical frames
+        unmapRangeFrames(virt_start, virt_end);
     }
     
     /**
@@ -191,54 +227,110 @@ public:
         }
         
         // Convert protection flags to PTE flags
-        uint64_t pte_flags = PTE_PRESENT | PTE_USER;
+        uint64_t pte_flags = PTE_USER | PTE_DEMAND;
         if (prot & 0x02) {  // PROT_WRITE
             pte_flags |= PTE_WRITABLE;
         }
-        
-        // Allocate and map physical frames
+
+        // Demand paging: install not-present entries carrying the
+        // protection bits and no frame. faultIn() allocates and zeroes
+        // a frame on first touch, so a large speculative mapping pays
+        // only for the pages it actually uses.
         for (uint64_t virt = addr; virt < addr + size; virt += PAGE_SIZE) {
-            // Allocate physical frame
-            uint64_t phys = phys_alloc_->allocateFrame();
+            if (!page_table_->map(virt, 0, pte_flags)) {
+                unmapRangeFrames(addr, virt);
+                return 0;
+            }
+        }
+
+        return addr;
+    }
+    
+    /**
+     * Map a file-backed region with demand paging. Pages are mapped up
+     * front but marked PTE_FILE; the first touch pulls that page's file
+     * contents in through `fill` (faultIn), so only touched pages ever
+     * do I/O. Writes stay private to the mapping (no write-back).
+     *
+     * @return Virtual address, or 0 on error.
+     */
+    uint64_t mmapFile(uint64_t addr, uint64_t size, uint64_t prot,
+                      uint64_t file_offset, FileFillFunc fill,
+                      void* fill_ctx, uint64_t fill_arg) {
+        if (size == 0 || !fill) {
+            return 0;
+        }
+        FileMapping* region = nullptr;
+        for (uint32_t i = 0; i < MAX_FILE_MAPPINGS; i++) {
+            if (!file_mappings_[i].in_use) {
+                region = &file_mappings_[i];
+                break;
+            }
+        }
+        if (!region) {
+            std::cerr << "[VirtualAllocator] File mapping table full!"
+                      << std::endl;
+            return 0;
+        }
+
+        size = align_up(size);
+        if (addr == 0) {
+            addr = heap_brk_;
+        }
+        addr = align_down(addr);
+        if (addr < heap_start_ || addr + size > heap_end_) {
+            std::cerr << "[VirtualAllocator] mmap address out of range!"
+                      << std::endl;
+            return 0;
+        }
+
+        uint64_t pte_flags = PTE_PRESENT | PTE_USER | PTE_FILE;
+        if (prot & 0x02) {  // PROT_WRITE
+            pte_flags |= PTE_WRITABLE;
+        }
+        for (uint64_t virt = addr; virt < addr + size; virt += PAGE_SIZE) {
+            bool recycled = false;
+            uint64_t phys = acquireFrame(recycled);
             if (phys == 0) {
-                // Out of memory - unmap what we've allocated
-                for (uint64_t v = addr; v < virt; v += PAGE_SIZE) {
-                    uint64_t p = page_table_->translate(v);
-                    if (p != 0) {
-                        phys_alloc_->freeFrame(p);
-                        page_table_->unmap(v);
-                    }
-                }
+                unmapRangeFrames(addr, virt);
                 return 0;
             }
-            
-            // Map virtual to physical
             if (!page_table_->map(virt, phys, pte_flags)) {
-                phys_alloc_->freeFrame(phys);
-                
-                // Unmap what we've allocated
-                for (uint64_t v = addr; v < virt; v += PAGE_SIZE) {
-                    uint64_t p = page_table_->translate(v);
-                    if (p != 0) {
-                        phys_alloc_->freeFrame(p);
-                        page_table_->unmap(v);
-                    }
-                }
+                releaseFrame(phys);
+                unmapRangeFrames(addr, virt);
                 return 0;
             }
         }
-        
+
+        region->in_use = true;
+        region->start = addr;
+        region->size = size;
+        region->file_offset = file_offset;
+        region->fill = fill;
+        region->fill_ctx = fill_ctx;
+        region->fill_arg = fill_arg;
         return addr;
     }
-    
+
     /**
      * Unmap memory (like munmap syscall).
-     * 
+     *
      * @param addr Virtual address
      * @param size Size in bytes
      */
     void munmap(uint64_t addr, uint64_t size) {
         free(addr, size);
+        // Drop file-backing for any region the range covers; a partial
+        // unmap keeps the region so the remainder still demand-fills
+        uint64_t virt_start = align_down(addr);
+        uint64_t virt_end = align_up(addr + size);
+        for (uint32_t i = 0; i < MAX_FILE_MAPPINGS; i++) {
+            FileMapping& region = file_mappings_[i];
+            if (region.in_use && virt_start <= region.start &&
+                region.start + region.size <= virt_end) {
+                region.in_use = false;
+            }
+        }
     }
 
     /**
@@ -301,9 +393,20 @@ public:
             pte_flags |= PTE_WRITABLE;
         }
         
-        // Update protection for each page
+        // Update protection for each page, preserving the pending-zero marker
         for (uint64_t virt = virt_start; virt < virt_end; virt += PAGE_SIZE) {
-            if (!page_table_->protect(virt, pte_flags)) {
+            PageTableEntry* pte = page_table_->getPTE(virt);
+            uint64_t sw_flags =
+                pte ? (pte->value & (PTE_LAZY_ZERO | PTE_COW | PTE_FILE |
+                                     PTE_DEMAND))
+                    : 0;
+            if (pte && !pte->isPresent() && (sw_flags & PTE_DEMAND)) {
+                // Untouched demand page: swap the carried protection bits
+                // in place; it stays frameless until first touch
+                pte->value = (pte_flags & ~PTE_PRESENT) | sw_flags;
+                continue;
+            }
+            if (!page_table_->protect(virt, pte_flags | sw_flags)) {
                 return false;
             }
         }
@@ -379,7 +482,12 @@ public:
         uint64_t virt_end = align_up(addr + size);
         for (uint64_t virt = virt_start; virt < virt_end; virt += PAGE_SIZE) {
             const PageTableEntry* pte = page_table_->getPTE(virt);
-            if (!pte || !pte->isPresent() || !pte->isUser()) {
+            if (!pte || !pte->isUser()) {
+                return false;
+            }
+            // Untouched demand pages are valid: the fault path
+            // materializes them on access
+            if (!pte->isPresent() && !(pte->value & PTE_DEMAND)) {
                 return false;
             }
             if (write && !pte->isWritable()) {
@@ -389,7 +497,7 @@ public:
         return true;
     }
 
-    bool readUser(void* dst, uint64_t src, uint64_t size) const {
+    bool readUser(void* dst, uint64_t src, uint64_t size) {
         if (!dst || size == 0) {
             return false;
         }
@@ -400,6 +508,7 @@ public:
         uint64_t addr = src;
         uint64_t remaining = size;
         while (remaining > 0) {
+            faultIn(addr);
             uint64_t phys = page_table_->translate(addr);
             if (phys == 0) {
                 return false;
@@ -424,7 +533,7 @@ public:
         return true;
     }
 
-    bool writeUser(uint64_t dst, const void* src, uint64_t size) const {
+    bool writeUser(uint64_t dst, const void* src, uint64_t size) {
         if (!src || size == 0) {
             return false;
         }
@@ -435,6 +544,7 @@ public:
         uint64_t addr = dst;
         uint64_t remaining = size;
         while (remaining > 0) {
+            faultIn(addr, /*write=*/true);
             uint64_t phys = page_table_->translate(addr);
             if (phys == 0) {
                 return false;
@@ -459,17 +569,145 @@ public:
         return true;
     }
 
-    VirtualAllocator* clone() const {
-        PageTable* new_pt = page_table_ ? page_table_->clone() : nullptr;
+    /**
+     * Service a software fault on the page backing `virt`. Demand-paged
+     * entries get a frame on first touch; deferred-zero pages are cleared
+     * on any access; copy-on-write pages are copied into a private frame
+     * on write access. Safe to call on any address.
+     */
+    void faultIn(uint64_t virt, bool write = false) {
+        if (!page_table_ || !phys_alloc_) {
+            return;
+        }
+        PageTableEntry* pte = page_table_->getPTE(virt);
+        if (!pte) {
+            return;
+        }
+        if (!pte->isPresent()) {
+            if (!(pte->value & PTE_DEMAND)) {
+                return;
+            }
+            // First touch of a demand mapping: materialize a frame under
+            // the protection bits the entry carried. Fresh frames pick up
+            // the deferred-zero marker and are cleared just below.
+            bool recycled = false;
+            uint64_t phys = acquireFrame(recycled);
+            if (phys == 0) {
+                return;
+            }
+            uint64_t flags =
+                (pte->value & (PAGE_SIZE - 1) & ~PTE_DEMAND) | PTE_PRESENT;
+            if (!recycled) {
+                flags |= PTE_LAZY_ZERO;
+            }
+            uint64_t page = align_down(virt);
+            page_table_->unmap(page);
+            if (!page_table_->map(page, phys, flags)) {
+                releaseFrame(phys);
+                return;
+            }
+            pte = page_table_->getPTE(page);
+            if (!pte) {
+                return;
+            }
+        }
+        if (pte->value & PTE_FILE) {
+            fillFilePage(virt, pte);
+        }
+        if (pte->value & PTE_LAZY_ZERO) {
+            void* page_ptr = phys_alloc_->ptrFromPhys(pte->getPhysAddr());
+            if (page_ptr) {
+                uint8_t* dst = static_cast<uint8_t*>(page_ptr);
+                for (uint64_t i = 0; i < PAGE_SIZE; ++i) {
+                    dst[i] = 0;
+                }
+            }
+            pte->value &= ~PTE_LAZY_ZERO;
+        }
+        if (write && (pte->value & PTE_COW)) {
+            uint64_t shared_phys = pte->getPhysAddr();
+            uint64_t flags = (pte->value & (PAGE_SIZE - 1)) & ~PTE_COW;
+            const uint8_t* src =
+                static_cast<const uint8_t*>(phys_alloc_->ptrFromPhys(shared_phys));
+            bool recycled = false;
+            uint64_t phys = acquireFrame(recycled);
+            if (phys == 0 || !src) {
+                return;
+            }
+            uint8_t* dst = static_cast<uint8_t*>(phys_alloc_->ptrFromPhys(phys));
+            if (!dst) {
+                releaseFrame(phys);
+                return;
+            }
+            for (uint64_t i = 0; i < PAGE_SIZE; ++i) {
+                dst[i] = src[i];
+            }
+            uint64_t page = align_down(virt);
+            page_table_->unmap(page);
+            if (!page_table_->map(page, phys, flags | PTE_DIRTY)) {
+                releaseFrame(phys);
+                return;
+            }
+            // Drop this mapping's reference on the shared original
+            phys_alloc_->freeFrame(shared_phys);
+        }
+    }
+
+    /**
+     * Map a frame owned by someone else (e.g. the ELF image cache)
+     * copy-on-write at `virt`: reads share the frame, the first write
+     * through writeUser lands in a private copy. The mapping holds its own
+     * reference on the frame, dropped on unmap or on the write fault.
+     */
+    bool mapSharedFrame(uint64_t virt, uint64_t phys, uint64_t pte_flags) {
+        if (!page_table_ || !phys_alloc_) {
+            return false;
+        }
+        phys_alloc_->retainFrame(phys);
+        if (!page_table_->map(virt, phys, pte_flags | PTE_PRESENT | PTE_COW)) {
+            phys_alloc_->freeFrame(phys);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Copy-on-write clone for fork. Every mapped frame is shared between
+     * parent and child; the first write on either side (all user writes
+     * funnel through writeUser's fault path) lands in a private copy of
+     * just that page. Per-frame reference counts in the physical allocator
+     * decide which side's unmap frees a frame last.
+     */
+    VirtualAllocator* clone() {
+        if (!page_table_) {
+            return nullptr;
+        }
+        // Mark the parent's mappings shared first so the copied child
+        // entries inherit the flag, then take the child's reference on
+        // each shared frame.
+        page_table_->forEachEntry([](PageTableEntry& pte) {
+            pte.value |= PTE_COW;
+        });
+        PageTable* new_pt = page_table_->clone();
         if (!new_pt) {
             return nullptr;
         }
+        if (phys_alloc_) {
+            new_pt->forEachEntry([this](PageTableEntry& pte) {
+                phys_alloc_->retainFrame(pte.getPhysAddr());
+            });
+        }
         VirtualAllocator* va = new VirtualAllocator(new_pt, phys_alloc_);
         va->heap_start_ = heap_start_;
         va->heap_end_ = heap_end_;
         va->heap_brk_ = heap_brk_;
         va->stack_start_ = stack_start_;
         va->stack_end_ = stack_end_;
+        // File-backed regions carry over: the child's untouched PTE_FILE
+        // pages still need somewhere to fill from
+        for (uint32_t i = 0; i < MAX_FILE_MAPPINGS; i++) {
+            va->file_mappings_[i] = file_mappings_[i];
+        }
         return va;
     }
     
@@ -478,16 +716,92 @@ public:
      */
     void printStats() const {
         uint64_t heap_used = heap_brk_ - heap_start_;
-        
+
         std::cout << "[VirtualAllocator] "
                   << "Heap: " << (heap_used / 1024) << " KB used, "
-                  << ((heap_end_ - heap_brk_) / 1024 / 1024) << " MB available"
+                  << ((heap_end_ - heap_brk_) / 1024 / 1024) << " MB available, "
+                  << recycled_count_ << " recycled frames cached"
                   << std::endl;
-        
+
         page_table_->printStats();
     }
 
 private:
+    /**
+     * Pop a cached frame if available, else fall back to the physical
+     * allocator. `recycled` tells the caller whether re-zeroing can be
+     * skipped (the frame's stale contents already belong to this process).
+     */
+    // Materialize one page of a file-backed mapping: zero the frame,
+    // copy the file's bytes for this page over it (short at EOF, so the
+    // tail reads as zero), and drop the fill marker.
+    void fillFilePage(uint64_t virt, PageTableEntry* pte) {
+        uint64_t page = align_down(virt);
+        FileMapping* region = nullptr;
+        for (uint32_t i = 0; i < MAX_FILE_MAPPINGS; i++) {
+            FileMapping& m = file_mappings_[i];
+            if (m.in_use && page >= m.start && page < m.start + m.size) {
+                region = &m;
+                break;
+            }
+        }
+        uint8_t* dst =
+            static_cast<uint8_t*>(phys_alloc_->ptrFromPhys(pte->getPhysAddr()));
+        if (!dst) {
+            return;
+        }
+        for (uint64_t i = 0; i < PAGE_SIZE; ++i) {
+            dst[i] = 0;
+        }
+        if (region && region->fill) {
+            uint64_t file_off = region->file_offset + (page - region->start);
+            (void)region->fill(region->fill_ctx, region->fill_arg, file_off,
+                               dst, PAGE_SIZE);
+        }
+        pte->value &= ~(PTE_FILE | PTE_LAZY_ZERO);
+    }
+
+    uint64_t acquireFrame(bool& recycled) {
+        if (recycled_count_ > 0) {
+            recycled = true;
+            return recycled_frames_[--recycled_count_];
+        }
+        recycled = false;
+        return phys_alloc_ ? phys_alloc_->allocateFrame() : 0;
+    }
+
+    void releaseFrame(uint64_t phys) {
+        if (recycled_count_ < RECYCLED_CACHE_FRAMES) {
+            recycled_frames_[recycled_count_++] = phys;
+            return;
+        }
+        phys_alloc_->freeFrame(phys);
+    }
+
+    // Unmap [virt_start, virt_end) and recycle the backing frames. Shared
+    // copy-on-write frames may have other holders, so their reference goes
+    // back to the physical allocator instead of the local recycle cache.
+    void unmapRangeFrames(uint64_t virt_start, uint64_t virt_end) {
+        for (uint64_t virt = virt_start; virt < virt_end; virt += PAGE_SIZE) {
+            uint64_t phys = page_table_->translate(virt);
+            if (phys != 0) {
+                const PageTableEntry* pte = page_table_->getPTE(virt);
+                if (pte && (pte->value & PTE_COW)) {
+                    phys_alloc_->freeFrame(phys);
+                } else {
+                    releaseFrame(phys);
+                }
+                page_table_->unmap(virt);
+            } else {
+                // Untouched demand pages own no frame; just drop the entry
+                const PageTableEntry* pte = page_table_->getPTE(virt);
+                if (pte && (pte->value & PTE_DEMAND)) {
+                    page_table_->unmap(virt);
+                }
+            }
+        }
+    }
+
     bool mapRange(uint64_t addr, uint64_t size, uint64_t pte_flags,
                   const uint8_t* init_data, uint64_t init_size) {
         if (!page_table_ || !phys_alloc_ || size == 0) {
@@ -502,40 +816,44 @@ private:
         bool ok = true;
 
         for (uint64_t virt = virt_start; virt < virt_end; virt += PAGE_SIZE) {
-            uint64_t phys = phys_alloc_->allocateFrame();
+            bool recycled = false;
+            uint64_t phys = acquireFrame(recycled);
             if (phys == 0) {
                 ok = false;
                 break;
             }
+            // Pages carrying init data are materialized eagerly; the rest
+            // (bss tails, stacks) must read as zero but are only cleared on
+            // first touch — that's the bulk of the spawn-time saving.
+            bool has_data = init_data && data_remaining > 0;
             uint64_t map_flags = pte_flags | PTE_PRESENT;
+            if (!has_data) {
+                map_flags |= PTE_LAZY_ZERO;
+            }
             if (!page_table_->map(virt, phys, map_flags)) {
-                phys_alloc_->freeFrame(phys);
+                releaseFrame(phys);
                 ok = false;
                 break;
             }
             mapped_end = virt + PAGE_SIZE;
 
-            void* page_ptr = phys_alloc_->ptrFromPhys(phys);
-            if (page_ptr) {
-                uint8_t* dst = static_cast<uint8_t*>(page_ptr);
-                for (uint64_t i = 0; i < PAGE_SIZE; ++i) {
-                    dst[i] = 0;
-                }
-            }
-
-            if (init_data && data_remaining > 0) {
+            if (has_data) {
+                void* page_ptr = phys_alloc_->ptrFromPhys(phys);
                 if (!page_ptr) {
                     ok = false;
                     break;
                 }
+                uint8_t* dst = static_cast<uint8_t*>(page_ptr);
+                for (uint64_t i = 0; i < PAGE_SIZE; ++i) {
+                    dst[i] = 0;
+                }
                 uint64_t copy_size = PAGE_SIZE - data_offset;
                 if (copy_size > data_remaining) {
                     copy_size = data_remaining;
                 }
-                uint8_t* dst = static_cast<uint8_t*>(page_ptr) + data_offset;
                 const uint8_t* src = init_data + (init_size - data_remaining);
                 for (uint64_t i = 0; i < copy_size; ++i) {
-                    dst[i] = src[i];
+                    dst[data_offset + i] = src[i];
                 }
                 data_remaining -= copy_size;
             }
@@ -544,13 +862,7 @@ private:
         }
 
         if (!ok || data_remaining > 0) {
-            for (uint64_t virt = virt_start; virt < mapped_end; virt += PAGE_SIZE) {
-                uint64_t phys = page_table_->translate(virt);
-                if (phys != 0) {
-                    phys_alloc_->freeFrame(phys);
-                    page_table_->unmap(virt);
-                }
-            }
+            unmapRangeFrames(virt_start, mapped_end);
             return false;
         }
 
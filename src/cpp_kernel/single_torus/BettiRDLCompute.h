@@ -47,9 +47,9 @@ private:
   static constexpr std::size_t kMaxProcesses = 2048;
 
   static constexpr std::uint32_t nodeId(int x, int y, int z) {
-    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap(x, kDim);
-    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap(y, kDim);
-    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap(z, kDim);
+    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(x);
+    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(y);
+    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap<kDim>(z);
     return static_cast<std::uint32_t>(wx * 1024 + wy * 32 + wz);
   }
 
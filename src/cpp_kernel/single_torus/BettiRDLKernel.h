@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../FixedStructures.h"
+#include "../Profiler.h"
 #include "../ToroidalSpace.h"
 
 #include <algorithm>
@@ -11,20 +12,41 @@
 constexpr std::size_t LATTICE_SIZE = 32 * 32 * 32;
 #else
 #include "../Allocator.h"
+#include <atomic>
+#include <barrier>
 #include <chrono>
 #include <iostream>
-#include <mutex>
+#include <thread>
+#ifndef _WIN32
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #endif
 
 // Betti-RDL Integration
 // Combines toroidal space (Betti) with time-native events (RDL)
 
+// Compile-time switch for in-kernel inject-to-tick latency histograms.
+// Define BETTI_RDL_LATENCY_TRACKING to enable; when off the event struct,
+// tick loop and query API compile down to the untracked versions.
+#if defined(BETTI_RDL_LATENCY_TRACKING) && !defined(RSE_KERNEL)
+#define BETTI_RDL_LATENCY_ENABLED 1
+#else
+#define BETTI_RDL_LATENCY_ENABLED 0
+#endif
+
 // RDL Event: timestamped message between processes
 struct RDLEvent {
   unsigned long long timestamp;
   int dst_node;
   int src_node;
   int payload;
+#if BETTI_RDL_LATENCY_ENABLED
+  unsigned long long inject_ns = 0; // Wall-clock injection time; 0 = derived
+#endif
 
   // Canonical ordering for determinism
   bool operator<(const RDLEvent &other) const {
@@ -63,31 +85,96 @@ struct AdaptiveEdge {
   }
 };
 
-class BettiRDLKernel {
+#if BETTI_RDL_LATENCY_ENABLED
+// Fixed log2-bucket latency histogram: no allocation, O(1) record, bucket i
+// covers [2^i, 2^(i+1)) nanoseconds.
+struct LatencyHistogram {
+  static constexpr std::size_t kNumBuckets = 64;
+
+  void record(unsigned long long ns) {
+    std::size_t bucket = 0;
+    while (bucket + 1 < kNumBuckets && (1ULL << (bucket + 1)) <= ns) {
+      ++bucket;
+    }
+    ++buckets[bucket];
+    ++samples;
+  }
+
+  // Upper bound of the bucket containing the requested percentile (0..100).
+  [[nodiscard]] unsigned long long percentileNs(double p) const {
+    if (samples == 0) {
+      return 0;
+    }
+    const unsigned long long rank = static_cast<unsigned long long>(
+        (p / 100.0) * static_cast<double>(samples - 1));
+    unsigned long long seen = 0;
+    for (std::size_t i = 0; i + 1 < kNumBuckets; ++i) {
+      seen += buckets[i];
+      if (seen > rank) {
+        return 1ULL << (i + 1);
+      }
+    }
+    return ~0ULL; // Top bucket: unbounded
+  }
+
+  std::array<unsigned long long, kNumBuckets> buckets{};
+  unsigned long long samples = 0;
+};
+#endif
+
+// Lattice dimension is a compile-time parameter so each configuration (8^3
+// latency-sensitive jobs up to 128^3 simulations) compiles to specialized
+// code with constexpr-derived strides. The event-queue policy is likewise a
+// template parameter so the FixedMinHeap baseline can be A/B tested against
+// alternatives (e.g. FixedTimingWheel) without touching the tick loop. Any
+// queue exposing push/pushBatch/pop/top/empty/size works.
+template <int DIM = 32, typename EventQueueT = FixedMinHeap<RDLEvent, 8192>,
+          typename NodeOrderT = RowMajorOrder>
+class BettiRDLKernelT {
+  static_assert(DIM > 0, "lattice dimension must be > 0");
+
 private:
-  static constexpr int kDim = 32;
+  static constexpr int kDim = DIM;
+  static constexpr std::size_t kLatticeSize =
+      static_cast<std::size_t>(DIM) * static_cast<std::size_t>(DIM) *
+      static_cast<std::size_t>(DIM);
   static constexpr std::uint32_t kInvalidEdge = 0xFFFFFFFFu;
 
+  // Node ids share the lattice index encoding (row-major by default,
+  // Morton when NodeOrderT = MortonOrder).
   static constexpr std::uint32_t nodeId(int x, int y, int z) {
-    const int wx = ToroidalSpace<kDim, kDim, kDim>::wrap(x, kDim);
-    const int wy = ToroidalSpace<kDim, kDim, kDim>::wrap(y, kDim);
-    const int wz = ToroidalSpace<kDim, kDim, kDim>::wrap(z, kDim);
-    return static_cast<std::uint32_t>(wx * 1024 + wy * 32 + wz);
+    const int wx = ToroidalSpace<kDim, kDim, kDim>::template wrap<kDim>(x);
+    const int wy = ToroidalSpace<kDim, kDim, kDim>::template wrap<kDim>(y);
+    const int wz = ToroidalSpace<kDim, kDim, kDim>::template wrap<kDim>(z);
+    return static_cast<std::uint32_t>(
+        NodeOrderT::template index<kDim, kDim, kDim>(wx, wy, wz));
   }
 
   static constexpr void decodeNode(std::uint32_t node, int &x, int &y, int &z) {
-    x = static_cast<int>(node / 1024u);
-    y = static_cast<int>((node % 1024u) / 32u);
-    z = static_cast<int>(node % 32u);
+    NodeOrderT::template decode<kDim>(static_cast<std::size_t>(node), x, y, z);
   }
 
   static constexpr std::size_t kMaxPendingEvents = 8192;
   static constexpr std::size_t kMaxEdges = 8192;
   static constexpr std::size_t kMaxProcesses = 4096;
 
-  ToroidalSpace<kDim, kDim, kDim> space;
-  FixedMinHeap<RDLEvent, kMaxPendingEvents> event_queue;
+  ToroidalSpace<kDim, kDim, kDim, 8, DenseCells, NodeOrderT> space;
+  EventQueueT event_queue;
   FixedObjectPool<BettiRDLProcess, kMaxProcesses> process_pool;
+  FixedVector<BettiRDLProcess *, kMaxProcesses> live_processes_;
+
+  bool spawnProcessWithPid(int pid, int x, int y, int z, int state) {
+    BettiRDLProcess *p = process_pool.create(pid, x, y, z);
+    if (!p) {
+      return false;
+    }
+    p->state = state;
+    if (!space.addProcess(reinterpret_cast<Process *>(p), x, y, z)) {
+      process_pool.destroy(p);
+      return false;
+    }
+    return live_processes_.push_back(p);
+  }
 
   struct EdgeEntry {
     std::uint32_t from_node;
@@ -96,30 +183,206 @@ private:
     std::uint32_t next_out = kInvalidEdge;
   };
 
-  std::array<std::uint32_t, LATTICE_SIZE> out_head_{};
-  std::array<std::uint32_t, LATTICE_SIZE> out_tail_{};
+  std::array<std::uint32_t, kLatticeSize> out_head_{};
+  std::array<std::uint32_t, kLatticeSize> out_tail_{};
   std::array<EdgeEntry, kMaxEdges> edges_{};
   std::size_t edge_count_ = 0;
 
+  // Structure-of-arrays view of the outgoing edges, grouped into one
+  // contiguous run per source node (CSR layout). The tick loop reads and
+  // updates only these hot arrays, so a node's whole fan-out is walked as
+  // dense, vectorizable passes instead of pointer-chased EdgeEntry chains.
+  // Rebuilt lazily (counting sort over edges_) after topology changes;
+  // edge_delay_ is authoritative between rebuilds.
+  std::array<std::uint32_t, kLatticeSize> run_start_{};
+  std::array<std::uint32_t, kLatticeSize> run_len_{};
+  std::array<unsigned long long, kMaxEdges> edge_delay_{};
+  std::array<std::uint32_t, kMaxEdges> edge_to_{};
+  std::array<std::uint32_t, kMaxEdges> edge_index_{};
+  std::size_t run_count_ = 0;
+  bool edge_runs_dirty_ = false;
+  bool edge_runs_valid_ = false;
+
+  // Edge identity (from,to) -> slot, so existence checks cost one probe
+  // instead of walking the source's out-chain
+  FixedHashMap<std::uint64_t, std::uint32_t, kMaxEdges> edge_map_;
+
+  static constexpr std::uint64_t edgeKey(std::uint32_t from, std::uint32_t to) {
+    return (static_cast<std::uint64_t>(from) << 32) | to;
+  }
+
+  void rebuildEdgeRuns() {
+    if (!edge_runs_dirty_) {
+      return;
+    }
+
+    // Preserve adapted delays across topology changes.
+    if (edge_runs_valid_) {
+      for (std::size_t i = 0; i < run_count_; ++i) {
+        edges_[edge_index_[i]].edge.delay = edge_delay_[i];
+      }
+    }
+
+    run_len_.fill(0);
+    for (std::size_t e = 0; e < edge_count_; ++e) {
+      ++run_len_[edges_[e].from_node];
+    }
+
+    std::uint32_t offset = 0;
+    for (std::size_t n = 0; n < kLatticeSize; ++n) {
+      run_start_[n] = offset;
+      offset += run_len_[n];
+    }
+
+    std::array<std::uint32_t, kLatticeSize> cursor = run_start_;
+    for (std::size_t e = 0; e < edge_count_; ++e) {
+      const EdgeEntry &entry = edges_[e];
+      const std::uint32_t slot = cursor[entry.from_node]++;
+      edge_delay_[slot] = entry.edge.delay;
+      edge_to_[slot] = entry.to_node;
+      edge_index_[slot] = static_cast<std::uint32_t>(e);
+    }
+
+    run_count_ = edge_count_;
+    edge_runs_dirty_ = false;
+    edge_runs_valid_ = true;
+  }
+
+  // Vectorizable delay update over one node's contiguous fan-out run.
+  void updateRunDelays(std::uint32_t start, std::uint32_t len, int payload) {
+    if (payload > 0) {
+      for (std::uint32_t i = start; i < start + len; ++i) {
+        const unsigned long long d = edge_delay_[i];
+        edge_delay_[i] = d > 1 ? d - 1 : 1;
+      }
+    } else {
+      for (std::uint32_t i = start; i < start + len; ++i) {
+        edge_delay_[i] += 1;
+      }
+    }
+  }
+
   unsigned long long current_time = 0;
   unsigned long long events_processed = 0;  // Lifetime total
   int process_counter = 0;
 
-  // Thread-safety for concurrent injectEvent
-  std::mutex event_injection_lock;
-  FixedVector<RDLEvent, 16384> pending_events;
+  // Control-event handler: events addressed to kControlNode bypass lattice
+  // routing and invoke this instead (plain function pointer + context, no
+  // allocation). The OS layer threads scheduler time slices through the
+  // event queue this way — see os/EMERGENT_SCHEDULER_DESIGN.md.
+  void (*control_handler_)(const RDLEvent &, void *) = nullptr;
+  void *control_ctx_ = nullptr;
+
+  // Thread-safety for concurrent injectEvent: bounded lock-free MPSC ring.
+  // Producers never block; flushPendingEvents is the single consumer.
+  FixedMPSCRing<RDLEvent, 16384> pending_events;
+
+  // Queue pressure accounting. Queue-side counters are owned by the tick
+  // thread; the pending-ring counters are touched by concurrent producers
+  // and are therefore atomic (approximate while hot, exact when quiescent —
+  // the same contract as the ring's size()).
+  std::size_t queue_high_watermark_ = 0;
+  unsigned long long queue_drops_ = 0;
+  std::atomic<std::size_t> pending_high_watermark_{0};
+  std::atomic<unsigned long long> pending_drops_{0};
+
+  void (*backpressure_handler_)(std::size_t, std::size_t, void *) = nullptr;
+  void *backpressure_ctx_ = nullptr;
+  std::size_t backpressure_threshold_ = 0;  // Set from capacity in ctor
+  bool backpressure_active_ = false;
+
+  // Record the post-push depth: update the watermark and fire the
+  // backpressure handler on an upward threshold crossing. Edge-triggered:
+  // fires once per excursion, re-arms when a later push observes the depth
+  // back below the threshold.
+  void noteQueueDepth() {
+    const std::size_t depth = event_queue.size();
+    if (depth > queue_high_watermark_) {
+      queue_high_watermark_ = depth;
+    }
+    if (depth >= backpressure_threshold_) {
+      if (!backpressure_active_) {
+        backpressure_active_ = true;
+        if (backpressure_handler_) {
+          backpressure_handler_(depth, event_queue.capacity(),
+                                backpressure_ctx_);
+        }
+      }
+    } else {
+      backpressure_active_ = false;
+    }
+  }
+
+  // All main-queue pushes route through here so capacity rejections are
+  // counted instead of vanishing behind a (void) cast.
+  bool pushQueueEvent(const RDLEvent &evt) {
+    if (!event_queue.push(evt)) {
+      ++queue_drops_;
+      return false;
+    }
+    noteQueueDepth();
+    return true;
+  }
+
+#if BETTI_RDL_LATENCY_ENABLED
+  LatencyHistogram inject_latency_;
+
+  static unsigned long long nowNs() {
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
+#endif
+
+  // Scratch buffers for tickBatch (bounded, reused across calls)
+  FixedVector<RDLEvent, kMaxPendingEvents> batch_scratch_;
+  FixedVector<RDLEvent, kMaxPendingEvents> derived_scratch_;
+
+#ifndef RSE_KERNEL
+  // Sharded execution state for runParallel(): the lattice is cut into
+  // kMaxShards z-slabs, each with its own event queue. Cross-slab derived
+  // events travel through per-shard MPSC inboxes and are drained at epoch
+  // boundaries, so shards never touch each other's queues mid-epoch.
+  static constexpr int kMaxShards = 8;
+
+  struct Shard {
+    FixedMinHeap<RDLEvent, kMaxPendingEvents> queue;
+    FixedMPSCRing<RDLEvent, 4096> inbox;
+  };
+
+  std::array<Shard, kMaxShards> shards_;
+  std::atomic<unsigned long long> cross_region_events_{0};
+
+  static constexpr int shardOf(std::uint32_t node, int num_shards) {
+    // Slab by z keeps spatially local fan-out (small |dz|) mostly
+    // shard-local.
+    int x = 0, y = 0, z = 0;
+    decodeNode(node, x, y, z);
+    return (z * num_shards) / kDim;
+  }
+#endif
 
   [[nodiscard]] bool insertOrUpdateEdge(const AdaptiveEdge &edge) {
     const std::uint32_t from = nodeId(edge.from_x, edge.from_y, edge.from_z);
     const std::uint32_t to = nodeId(edge.to_x, edge.to_y, edge.to_z);
 
-    // Check existing edges for this source (bounded, deterministic scan)
-    for (std::uint32_t idx = out_head_[from]; idx != kInvalidEdge;
-         idx = edges_[idx].next_out) {
-      if (edges_[idx].to_node == to) {
-        edges_[idx].edge = edge;
-        return true;
+    // One probe decides existence; the out-chains stay for run rebuilds
+    if (std::uint32_t *existing = edge_map_.find(edgeKey(from, to))) {
+      const std::uint32_t idx = *existing;
+      edges_[idx].edge = edge;
+      // Keep the SoA view authoritative: mirror the explicit delay reset
+      // into the run slot so the next rebuild does not clobber it.
+      if (edge_runs_valid_) {
+        const std::uint32_t start = run_start_[from];
+        for (std::uint32_t s = start; s < start + run_len_[from]; ++s) {
+          if (edge_index_[s] == idx) {
+            edge_delay_[s] = edge.delay;
+            break;
+          }
+        }
       }
+      return true;
     }
 
     if (edge_count_ >= kMaxEdges) {
@@ -129,6 +392,7 @@ private:
 
     const std::uint32_t new_idx = static_cast<std::uint32_t>(edge_count_++);
     edges_[new_idx] = EdgeEntry{from, to, edge, kInvalidEdge};
+    (void)edge_map_.insert(edgeKey(from, to), new_idx);
 
     if (out_head_[from] == kInvalidEdge) {
       out_head_[from] = new_idx;
@@ -138,11 +402,12 @@ private:
       out_tail_[from] = new_idx;
     }
 
+    edge_runs_dirty_ = true;
     return true;
   }
 
 public:
-  BettiRDLKernel() {
+  BettiRDLKernelT() {
 #ifndef RSE_KERNEL
     std::cout << "[BETTI-RDL] Initializing space-time kernel..." << std::endl;
     std::cout << "    > Spatial: ToroidalSpace<32,32,32>" << std::endl;
@@ -151,14 +416,11 @@ public:
 
     out_head_.fill(kInvalidEdge);
     out_tail_.fill(kInvalidEdge);
+    backpressure_threshold_ = (event_queue.capacity() * 7) / 8;
   }
 
   bool spawnProcess(int x, int y, int z) {
-    BettiRDLProcess *p = process_pool.create(++process_counter, x, y, z);
-    if (!p) {
-      return false;
-    }
-    return space.addProcess(reinterpret_cast<Process *>(p), x, y, z);
+    return spawnProcessWithPid(++process_counter, x, y, z, 0);
   }
 
   bool createEdge(int x1, int y1, int z1, int x2, int y2, int z2,
@@ -175,6 +437,31 @@ public:
     return insertOrUpdateEdge(edge);
   }
 
+  // Destination id that marks a control event rather than a lattice node.
+  static constexpr int kControlNode = -1;
+
+  using ControlHandler = void (*)(const RDLEvent &, void *);
+
+  void setControlHandler(ControlHandler handler, void *ctx) {
+    control_handler_ = handler;
+    control_ctx_ = ctx;
+  }
+
+  /**
+   * Queue a control event: it sorts with ordinary RDL events by timestamp
+   * but is delivered to the registered handler instead of the lattice.
+   * Timestamps in the past are clamped to the current time so kernel time
+   * stays monotone.
+   */
+  bool scheduleControlEvent(unsigned long long timestamp, int payload) {
+    RDLEvent evt{};
+    evt.timestamp = timestamp < current_time ? current_time : timestamp;
+    evt.dst_node = kControlNode;
+    evt.src_node = kControlNode;
+    evt.payload = payload;
+    return pushQueueEvent(evt);
+  }
+
   bool injectEvent(int dst_x, int dst_y, int dst_z, int src_x, int src_y,
                    int src_z, int payload) {
     RDLEvent evt{};
@@ -182,13 +469,19 @@ public:
     evt.dst_node = static_cast<int>(nodeId(dst_x, dst_y, dst_z));
     evt.src_node = static_cast<int>(nodeId(src_x, src_y, src_z));
     evt.payload = payload;
+#if BETTI_RDL_LATENCY_ENABLED
+    evt.inject_ns = nowNs();
+#endif
 
-    // Thread-safe injection: add to pending queue
-    {
-      std::lock_guard<std::mutex> lock(event_injection_lock);
-      if (!pending_events.push_back(evt)) {
-        return false;
-      }
+    // Thread-safe injection: lock-free push into the pending ring
+    if (!pending_events.push(evt)) {
+      pending_drops_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    const std::size_t depth = pending_events.size();
+    std::size_t seen = pending_high_watermark_.load(std::memory_order_relaxed);
+    while (depth > seen && !pending_high_watermark_.compare_exchange_weak(
+                               seen, depth, std::memory_order_relaxed)) {
     }
     return true;
   }
@@ -196,11 +489,10 @@ public:
   // Transfer pending events to the main event queue (single-threaded from scheduler)
   private:
   void flushPendingEvents() {
-    std::lock_guard<std::mutex> lock(event_injection_lock);
-    for (std::size_t i = 0; i < pending_events.size(); ++i) {
-      (void)event_queue.push(pending_events[i]);
+    RDLEvent evt{};
+    while (pending_events.pop(evt)) {
+      (void)pushQueueEvent(evt);
     }
-    pending_events.clear();
   }
 
   public:
@@ -209,6 +501,9 @@ public:
     if (event_queue.empty()) {
       return;
     }
+    RSE_PROFILE_SCOPE(SITE_RDL_TICK);
+
+    rebuildEdgeRuns();
 
     RDLEvent evt = event_queue.top();
     (void)event_queue.pop();
@@ -216,24 +511,109 @@ public:
     current_time = evt.timestamp;
     events_processed++;
 
-    // Iterate all outgoing edges from the destination node
+#if BETTI_RDL_LATENCY_ENABLED
+    if (evt.inject_ns != 0) {
+      inject_latency_.record(nowNs() - evt.inject_ns);
+    }
+#endif
+
+    if (evt.dst_node == kControlNode) {
+      if (control_handler_) {
+        control_handler_(evt, control_ctx_);
+      }
+      return;
+    }
+
+    // Walk the destination node's contiguous fan-out run: one dense pass
+    // over the delays (vectorizable), then derived-event emission.
     const std::uint32_t dst_node = static_cast<std::uint32_t>(evt.dst_node);
-    for (std::uint32_t idx = out_head_[dst_node]; idx != kInvalidEdge;
-         idx = edges_[idx].next_out) {
-      EdgeEntry &entry = edges_[idx];
+    const std::uint32_t start = run_start_[dst_node];
+    const std::uint32_t len = run_len_[dst_node];
 
-      entry.edge.updateDelay(evt.payload, current_time);
+    updateRunDelays(start, len, evt.payload);
 
+    for (std::uint32_t i = start; i < start + len; ++i) {
       RDLEvent new_evt{};
-      new_evt.timestamp = current_time + entry.edge.delay;
-      new_evt.dst_node = static_cast<int>(entry.to_node);
+      new_evt.timestamp = current_time + edge_delay_[i];
+      new_evt.dst_node = static_cast<int>(edge_to_[i]);
       new_evt.src_node = evt.dst_node;
       new_evt.payload = evt.payload + 1;
 
-      (void)event_queue.push(new_evt);
+      (void)pushQueueEvent(new_evt);
     }
   }
 
+  // Batch-drain variant of tick(): pops every event sharing the minimum
+  // timestamp in one pass, processes them together, and bulk-inserts the
+  // derived events with a single heapify. Amortizes the per-event heap sift
+  // at high event rates. Returns the number of events processed.
+  int tickBatch() {
+    if (event_queue.empty()) {
+      return 0;
+    }
+    RSE_PROFILE_SCOPE(SITE_RDL_TICK_BATCH);
+
+    rebuildEdgeRuns();
+
+    const unsigned long long batch_time = event_queue.top().timestamp;
+    current_time = batch_time;
+
+    FixedVector<RDLEvent, kMaxPendingEvents> &batch = batch_scratch_;
+    batch.clear();
+    while (!event_queue.empty() &&
+           event_queue.top().timestamp == batch_time) {
+      (void)batch.push_back(event_queue.top());
+      (void)event_queue.pop();
+    }
+
+    FixedVector<RDLEvent, kMaxPendingEvents> &derived = derived_scratch_;
+    derived.clear();
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      const RDLEvent &evt = batch[i];
+      events_processed++;
+
+#if BETTI_RDL_LATENCY_ENABLED
+      if (evt.inject_ns != 0) {
+        inject_latency_.record(nowNs() - evt.inject_ns);
+      }
+#endif
+
+      if (evt.dst_node == kControlNode) {
+        if (control_handler_) {
+          control_handler_(evt, control_ctx_);
+        }
+        continue;
+      }
+
+      const std::uint32_t dst_node = static_cast<std::uint32_t>(evt.dst_node);
+      const std::uint32_t start = run_start_[dst_node];
+      const std::uint32_t len = run_len_[dst_node];
+
+      updateRunDelays(start, len, evt.payload);
+
+      for (std::uint32_t i = start; i < start + len; ++i) {
+        RDLEvent new_evt{};
+        new_evt.timestamp = current_time + edge_delay_[i];
+        new_evt.dst_node = static_cast<int>(edge_to_[i]);
+        new_evt.src_node = evt.dst_node;
+        new_evt.payload = evt.payload + 1;
+
+        if (!derived.push_back(new_evt)) {
+          queue_drops_ += (start + len) - i;  // Rest of this fan-out run
+          break;
+        }
+      }
+    }
+
+    // All-or-nothing insert: on overflow the whole derived batch is lost.
+    if (event_queue.pushBatch(derived.begin(), derived.size())) {
+      noteQueueDepth();
+    } else {
+      queue_drops_ += derived.size();
+    }
+    return static_cast<int>(batch.size());
+  }
+
   // Process at most max_events NEW events, returning the count processed
   // Does not depend on lifetime events_processed total
   int run(int max_events) {
@@ -293,6 +673,393 @@ public:
 #endif
   }
 
+#ifndef RSE_KERNEL
+  // Intra-torus parallel execution: shards the event queue by z-slab and
+  // processes independent slabs on separate threads. Conservative epoch
+  // synchronization — every epoch handles exactly the events at the global
+  // minimum timestamp, which is safe because AdaptiveEdge delays are >= 1,
+  // so derived events always land in a later epoch. Returns the number of
+  // events processed (may slightly exceed max_events at an epoch boundary).
+  int runParallel(int max_events, int num_shards) {
+    num_shards = std::clamp(num_shards, 1, kMaxShards);
+
+    flushPendingEvents();
+    rebuildEdgeRuns();
+
+    // Distribute the global queue across the shards. Control events are
+    // pinned to shard 0, which runs on the calling thread.
+    while (!event_queue.empty()) {
+      const RDLEvent evt = event_queue.top();
+      (void)event_queue.pop();
+      const int s =
+          evt.dst_node == kControlNode
+              ? 0
+              : shardOf(static_cast<std::uint32_t>(evt.dst_node), num_shards);
+      (void)shards_[s].queue.push(evt);
+    }
+
+    std::atomic<int> processed{0};
+    std::atomic<bool> done{false};
+    unsigned long long window = 0;
+
+    auto computeWindow = [&]() {
+      bool any = false;
+      unsigned long long min_ts = 0;
+      for (int s = 0; s < num_shards; ++s) {
+        // Epoch boundary: cross-shard arrivals become visible here.
+        RDLEvent evt{};
+        while (shards_[s].inbox.pop(evt)) {
+          (void)shards_[s].queue.push(evt);
+        }
+      }
+      for (int s = 0; s < num_shards; ++s) {
+        if (!shards_[s].queue.empty()) {
+          const unsigned long long ts = shards_[s].queue.top().timestamp;
+          if (!any || ts < min_ts) {
+            min_ts = ts;
+            any = true;
+          }
+        }
+      }
+      if (!any || processed.load(std::memory_order_relaxed) >= max_events) {
+        done.store(true, std::memory_order_relaxed);
+      } else {
+        window = min_ts;
+      }
+    };
+
+    std::barrier sync(num_shards, computeWindow);
+
+    auto worker = [&](int shard_id) {
+      Shard &shard = shards_[shard_id];
+      for (;;) {
+        sync.arrive_and_wait();
+        if (done.load(std::memory_order_relaxed)) {
+          return;
+        }
+
+        int local = 0;
+        while (!shard.queue.empty() &&
+               shard.queue.top().timestamp == window) {
+          const RDLEvent evt = shard.queue.top();
+          (void)shard.queue.pop();
+          ++local;
+
+          if (evt.dst_node == kControlNode) {
+            if (control_handler_) {
+              control_handler_(evt, control_ctx_);
+            }
+            continue;
+          }
+
+          const std::uint32_t dst_node =
+              static_cast<std::uint32_t>(evt.dst_node);
+          const std::uint32_t start = run_start_[dst_node];
+          const std::uint32_t len = run_len_[dst_node];
+
+          updateRunDelays(start, len, evt.payload);
+
+          for (std::uint32_t i = start; i < start + len; ++i) {
+            RDLEvent new_evt{};
+            new_evt.timestamp = window + edge_delay_[i];
+            new_evt.dst_node = static_cast<int>(edge_to_[i]);
+            new_evt.src_node = evt.dst_node;
+            new_evt.payload = evt.payload + 1;
+
+            const int target = shardOf(edge_to_[i], num_shards);
+            if (target == shard_id) {
+              (void)shard.queue.push(new_evt);
+            } else {
+              cross_region_events_.fetch_add(1, std::memory_order_relaxed);
+              (void)shards_[target].inbox.push(new_evt);
+            }
+          }
+        }
+        processed.fetch_add(local, std::memory_order_relaxed);
+      }
+    };
+
+    std::array<std::thread, kMaxShards> threads;
+    for (int s = 1; s < num_shards; ++s) {
+      threads[s] = std::thread(worker, s);
+    }
+    worker(0);
+    for (int s = 1; s < num_shards; ++s) {
+      threads[s].join();
+    }
+
+    // Fold surviving shard events back into the global queue so tick()/run()
+    // can resume where the parallel phase stopped.
+    for (int s = 0; s < num_shards; ++s) {
+      RDLEvent evt{};
+      while (shards_[s].inbox.pop(evt)) {
+        (void)event_queue.push(evt);
+      }
+      while (!shards_[s].queue.empty()) {
+        (void)event_queue.push(shards_[s].queue.top());
+        (void)shards_[s].queue.pop();
+      }
+    }
+
+    const int total = processed.load(std::memory_order_relaxed);
+    if (total > 0) {
+      current_time = window;
+    }
+    events_processed += static_cast<unsigned long long>(total);
+    return total;
+  }
+
+  // Cross-slab events routed through shard inboxes by runParallel().
+  unsigned long long getCrossRegionEvents() const {
+    return cross_region_events_.load(std::memory_order_relaxed);
+  }
+
+#ifndef _WIN32
+  // Snapshot/restore: the whole kernel state is bounded POD-ish storage, so
+  // a torus restarts from an mmap'd image instead of replaying its event
+  // history. The image stores value records (edges, queued events, process
+  // records); restore replays them through the normal construction paths,
+  // so adjacency chains and SoA runs rebuild themselves and no pointer
+  // fixup is needed.
+  struct SnapshotHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t dim;
+    std::uint64_t current_time;
+    std::uint64_t events_processed;
+    std::int32_t process_counter;
+    std::uint32_t edge_count;
+    std::uint32_t queue_size;
+    std::uint32_t process_count;
+  };
+
+  struct ProcessRecord {
+    std::int32_t pid;
+    std::int32_t x, y, z;
+    std::int32_t state;
+  };
+
+  static constexpr std::uint64_t kSnapshotMagic = 0x314C44525F545242ull;
+  static constexpr std::uint32_t kSnapshotVersion = 1;
+
+  bool snapshotToFile(const char *path) {
+    flushPendingEvents();
+
+    // Sync adapted delays back into the edge records before dumping them.
+    if (edge_runs_valid_) {
+      for (std::size_t i = 0; i < run_count_; ++i) {
+        edges_[edge_index_[i]].edge.delay = edge_delay_[i];
+      }
+    }
+
+    // Drain the queue into scratch (and push it straight back) so the image
+    // holds plain event records regardless of the queue policy.
+    batch_scratch_.clear();
+    while (!event_queue.empty()) {
+      (void)batch_scratch_.push_back(event_queue.top());
+      (void)event_queue.pop();
+    }
+    (void)event_queue.pushBatch(batch_scratch_.begin(), batch_scratch_.size());
+
+    const std::size_t total_size =
+        sizeof(SnapshotHeader) + edge_count_ * sizeof(AdaptiveEdge) +
+        batch_scratch_.size() * sizeof(RDLEvent) +
+        live_processes_.size() * sizeof(ProcessRecord);
+
+    const int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      return false;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(total_size)) != 0) {
+      ::close(fd);
+      return false;
+    }
+    void *map =
+        ::mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      return false;
+    }
+
+    auto *header = static_cast<SnapshotHeader *>(map);
+    header->magic = kSnapshotMagic;
+    header->version = kSnapshotVersion;
+    header->dim = static_cast<std::uint32_t>(kDim);
+    header->current_time = current_time;
+    header->events_processed = events_processed;
+    header->process_counter = process_counter;
+    header->edge_count = static_cast<std::uint32_t>(edge_count_);
+    header->queue_size = static_cast<std::uint32_t>(batch_scratch_.size());
+    header->process_count =
+        static_cast<std::uint32_t>(live_processes_.size());
+
+    auto *edges_out = reinterpret_cast<AdaptiveEdge *>(header + 1);
+    for (std::size_t e = 0; e < edge_count_; ++e) {
+      edges_out[e] = edges_[e].edge;
+    }
+
+    auto *events_out = reinterpret_cast<RDLEvent *>(edges_out + edge_count_);
+    std::memcpy(events_out, batch_scratch_.begin(),
+                batch_scratch_.size() * sizeof(RDLEvent));
+
+    auto *procs_out =
+        reinterpret_cast<ProcessRecord *>(events_out + batch_scratch_.size());
+    for (std::size_t i = 0; i < live_processes_.size(); ++i) {
+      const BettiRDLProcess *p = live_processes_[i];
+      procs_out[i] = ProcessRecord{p->pid, p->x, p->y, p->z, p->state};
+    }
+
+    const bool ok = ::msync(map, total_size, MS_SYNC) == 0;
+    ::munmap(map, total_size);
+    return ok;
+  }
+
+  bool restoreFromFile(const char *path) {
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<std::size_t>(st.st_size) < sizeof(SnapshotHeader)) {
+      ::close(fd);
+      return false;
+    }
+    const std::size_t total_size = static_cast<std::size_t>(st.st_size);
+    void *map = ::mmap(nullptr, total_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      return false;
+    }
+
+    const auto *header = static_cast<const SnapshotHeader *>(map);
+    if (header->magic != kSnapshotMagic ||
+        header->version != kSnapshotVersion ||
+        header->dim != static_cast<std::uint32_t>(kDim) ||
+        header->edge_count > kMaxEdges ||
+        header->queue_size > kMaxPendingEvents ||
+        header->process_count > kMaxProcesses) {
+      ::munmap(map, total_size);
+      return false;
+    }
+
+    // Wipe current state.
+    space.clear();
+    process_pool.clear();
+    live_processes_.clear();
+    event_queue.clear();
+    {
+      RDLEvent drain{};
+      while (pending_events.pop(drain)) {
+      }
+    }
+    edge_count_ = 0;
+    edge_map_.clear();
+    out_head_.fill(kInvalidEdge);
+    out_tail_.fill(kInvalidEdge);
+    edge_runs_dirty_ = false;
+    edge_runs_valid_ = false;
+    run_count_ = 0;
+
+    // Replay the records through the normal construction paths.
+    const auto *edges_in =
+        reinterpret_cast<const AdaptiveEdge *>(header + 1);
+    for (std::uint32_t e = 0; e < header->edge_count; ++e) {
+      (void)insertOrUpdateEdge(edges_in[e]);
+    }
+
+    const auto *events_in =
+        reinterpret_cast<const RDLEvent *>(edges_in + header->edge_count);
+    (void)event_queue.pushBatch(events_in, header->queue_size);
+
+    const auto *procs_in = reinterpret_cast<const ProcessRecord *>(
+        events_in + header->queue_size);
+    for (std::uint32_t i = 0; i < header->process_count; ++i) {
+      const ProcessRecord &rec = procs_in[i];
+      (void)spawnProcessWithPid(rec.pid, rec.x, rec.y, rec.z, rec.state);
+    }
+
+    current_time = header->current_time;
+    events_processed = header->events_processed;
+    process_counter = header->process_counter;
+
+    ::munmap(map, total_size);
+    return true;
+  }
+#endif
+#endif
+
+  // Queue pressure instrumentation. Watermarks record the deepest each
+  // bounded queue has been since the last reset, for capacity tuning; drop
+  // counters count events lost to capacity (derived/flushed/control events
+  // for the main queue, rejected injectEvent calls for the pending ring).
+  struct QueueStats {
+    std::size_t queue_high_watermark;
+    std::size_t pending_high_watermark;
+    unsigned long long queue_drops;
+    unsigned long long pending_drops;
+  };
+
+  QueueStats getQueueStats() const {
+    return QueueStats{
+        queue_high_watermark_,
+        pending_high_watermark_.load(std::memory_order_relaxed),
+        queue_drops_,
+        pending_drops_.load(std::memory_order_relaxed)};
+  }
+
+  void resetQueueStats() {
+    queue_high_watermark_ = 0;
+    queue_drops_ = 0;
+    pending_high_watermark_.store(0, std::memory_order_relaxed);
+    pending_drops_.store(0, std::memory_order_relaxed);
+    backpressure_active_ = false;
+  }
+
+  using BackpressureHandler = void (*)(std::size_t depth,
+                                       std::size_t capacity, void *ctx);
+
+  /**
+   * Register a handler fired from the push path when the main queue depth
+   * crosses the threshold upward (edge-triggered: once per excursion, so
+   * load shedding or braid-interval widening runs before events are lost,
+   * not on every push while saturated). Plain function pointer + context,
+   * same shape as the control handler. Default threshold is 7/8 of the
+   * event queue capacity.
+   */
+  void setBackpressureHandler(BackpressureHandler handler, void *ctx) {
+    backpressure_handler_ = handler;
+    backpressure_ctx_ = ctx;
+  }
+
+  void setBackpressureThreshold(std::size_t depth) {
+    backpressure_threshold_ = depth;
+    backpressure_active_ = false;
+  }
+
+  std::size_t getBackpressureThreshold() const {
+    return backpressure_threshold_;
+  }
+
+  // Inject-to-tick latency queries. Percentile is a log2-bucket upper
+  // bound in nanoseconds; both return 0 when BETTI_RDL_LATENCY_TRACKING
+  // is not compiled in.
+  unsigned long long getLatencyPercentileNs([[maybe_unused]] double p) const {
+#if BETTI_RDL_LATENCY_ENABLED
+    return inject_latency_.percentileNs(p);
+#else
+    return 0;
+#endif
+  }
+
+  unsigned long long getLatencySampleCount() const {
+#if BETTI_RDL_LATENCY_ENABLED
+    return inject_latency_.samples;
+#else
+    return 0;
+#endif
+  }
+
   unsigned long long getCurrentTime() const { return current_time; }
   unsigned long long getEventsProcessed() const { return events_processed; }
 
@@ -320,3 +1087,20 @@ public:
     }
   }
 };
+
+// Default configuration: 32^3 lattice, bounded binary min-heap (baseline).
+using BettiRDLKernel = BettiRDLKernelT<>;
+
+// Timing-wheel policy: O(1) amortized scheduling for the small bounded
+// delays produced by AdaptiveEdge.
+using BettiRDLKernelWheel =
+    BettiRDLKernelT<32, FixedTimingWheel<RDLEvent, 8192>>;
+
+// Morton node ordering: Z-order-curve node ids so spatial neighbors land
+// on nearby cache lines in the per-node edge tables.
+using BettiRDLKernelMorton =
+    BettiRDLKernelT<32, FixedMinHeap<RDLEvent, 8192>, MortonOrder>;
+
+// Other lattice sizes specialize via the first parameter, e.g.
+// BettiRDLKernelT<8> for latency-sensitive jobs or BettiRDLKernelT<64> /
+// BettiRDLKernelT<128> for large simulations.
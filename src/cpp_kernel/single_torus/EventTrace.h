@@ -0,0 +1,278 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Deterministic event-trace recording and replay.
+//
+// RDLEvent ordering is canonical (operator< in BettiRDLKernel.h), so a
+// kernel run is reproducible from its injection sequence alone. The
+// recorder logs injected events into a compact append-only binary format:
+// varint delta-encoded timestamps (injection timestamps are monotone, so
+// deltas are tiny), one byte per lattice coordinate, and zigzag-varint
+// payloads — a typical record is 8-10 bytes. Encoding is a handful of
+// byte stores into a buffered stream, cheap enough to leave on in
+// production. The replayer feeds a fresh kernel at maximum speed so
+// performance anomalies reproduce offline and optimizations benchmark
+// against recorded traffic instead of synthetic loads.
+//
+// Host-side tooling only: record/replay go through stdio, which the
+// RSE_KERNEL freestanding build does not have.
+
+namespace rse_trace {
+
+constexpr uint32_t kTraceMagic = 0x54455352u;  // "RSET"
+constexpr uint32_t kTraceVersion = 1;
+
+struct TraceHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t dim;       // Lattice dimension the coordinates refer to
+    uint32_t reserved;
+};
+
+// One decoded injection record
+struct TraceRecord {
+    uint64_t timestamp;  // Kernel time at injection
+    int dst_x, dst_y, dst_z;
+    int src_x, src_y, src_z;
+    int payload;
+};
+
+class EventTraceWriter {
+public:
+    EventTraceWriter() = default;
+    ~EventTraceWriter() { close(); }
+
+    EventTraceWriter(const EventTraceWriter&) = delete;
+    EventTraceWriter& operator=(const EventTraceWriter&) = delete;
+
+    bool open(const char* path, uint32_t dim) {
+        close();
+        file_ = std::fopen(path, "wb");
+        if (!file_) {
+            return false;
+        }
+        TraceHeader header{kTraceMagic, kTraceVersion, dim, 0};
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+            close();
+            return false;
+        }
+        last_timestamp_ = 0;
+        used_ = 0;
+        records_ = 0;
+        return true;
+    }
+
+    // Append one injection. Coordinates must already be lattice-wrapped
+    // (record at the same boundary injectEvent sees). Timestamps must be
+    // nondecreasing — which injection-time kernel clocks are.
+    bool record(uint64_t timestamp, int dst_x, int dst_y, int dst_z,
+                int src_x, int src_y, int src_z, int payload) {
+        if (!file_) {
+            return false;
+        }
+        if (used_ + kMaxRecordBytes > kBufferSize && !flush()) {
+            return false;
+        }
+        putVarint(timestamp - last_timestamp_);
+        last_timestamp_ = timestamp;
+        buffer_[used_++] = static_cast<uint8_t>(dst_x);
+        buffer_[used_++] = static_cast<uint8_t>(dst_y);
+        buffer_[used_++] = static_cast<uint8_t>(dst_z);
+        buffer_[used_++] = static_cast<uint8_t>(src_x);
+        buffer_[used_++] = static_cast<uint8_t>(src_y);
+        buffer_[used_++] = static_cast<uint8_t>(src_z);
+        putVarint(zigzag(payload));
+        records_++;
+        return true;
+    }
+
+    uint64_t recordCount() const { return records_; }
+
+    bool flush() {
+        if (!file_ || used_ == 0) {
+            return file_ != nullptr;
+        }
+        const bool ok = std::fwrite(buffer_, 1, used_, file_) == used_;
+        used_ = 0;
+        return ok;
+    }
+
+    void close() {
+        if (file_) {
+            (void)flush();
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+private:
+    // Worst case: two 10-byte varints + six coordinate bytes
+    static constexpr size_t kMaxRecordBytes = 26;
+    static constexpr size_t kBufferSize = 64 * 1024;
+
+    static uint64_t zigzag(int v) {
+        const int64_t s = v;
+        return static_cast<uint64_t>((s << 1) ^ (s >> 63));
+    }
+
+    void putVarint(uint64_t v) {
+        while (v >= 0x80) {
+            buffer_[used_++] = static_cast<uint8_t>(v) | 0x80;
+            v >>= 7;
+        }
+        buffer_[used_++] = static_cast<uint8_t>(v);
+    }
+
+    std::FILE* file_ = nullptr;
+    uint8_t buffer_[kBufferSize];
+    size_t used_ = 0;
+    uint64_t last_timestamp_ = 0;
+    uint64_t records_ = 0;
+};
+
+class EventTraceReader {
+public:
+    EventTraceReader() = default;
+    ~EventTraceReader() { close(); }
+
+    EventTraceReader(const EventTraceReader&) = delete;
+    EventTraceReader& operator=(const EventTraceReader&) = delete;
+
+    bool open(const char* path) {
+        close();
+        file_ = std::fopen(path, "rb");
+        if (!file_) {
+            return false;
+        }
+        TraceHeader header{};
+        if (std::fread(&header, sizeof(header), 1, file_) != 1 ||
+            header.magic != kTraceMagic || header.version != kTraceVersion) {
+            close();
+            return false;
+        }
+        dim_ = header.dim;
+        last_timestamp_ = 0;
+        used_ = 0;
+        pos_ = 0;
+        eof_ = false;
+        return true;
+    }
+
+    uint32_t dim() const { return dim_; }
+
+    // Decode the next record; false at end of trace (or on a truncated
+    // tail, which is treated as the end — append-only files cut off by a
+    // crash replay up to the last complete record).
+    bool next(TraceRecord& out) {
+        uint64_t delta = 0;
+        if (!getVarint(delta)) {
+            return false;
+        }
+        uint8_t coords[6];
+        for (size_t i = 0; i < 6; ++i) {
+            int b = getByte();
+            if (b < 0) {
+                return false;
+            }
+            coords[i] = static_cast<uint8_t>(b);
+        }
+        uint64_t zz = 0;
+        if (!getVarint(zz)) {
+            return false;
+        }
+        last_timestamp_ += delta;
+        out.timestamp = last_timestamp_;
+        out.dst_x = coords[0];
+        out.dst_y = coords[1];
+        out.dst_z = coords[2];
+        out.src_x = coords[3];
+        out.src_y = coords[4];
+        out.src_z = coords[5];
+        out.payload = static_cast<int>(unzigzag(zz));
+        return true;
+    }
+
+    /**
+     * Feed the whole trace into a fresh kernel at maximum speed. Events
+     * are injected in batches of batch_size and drained with run() between
+     * batches so the pending ring never overflows; batch_size = 0 injects
+     * everything up front (small traces only). Returns the number of
+     * records replayed. Works with any kernel exposing the
+     * injectEvent(dst..., src..., payload) / run(max) shape.
+     */
+    template <typename Kernel>
+    uint64_t replayInto(Kernel& kernel, size_t batch_size = 8192) {
+        TraceRecord rec{};
+        uint64_t replayed = 0;
+        size_t in_batch = 0;
+        while (next(rec)) {
+            (void)kernel.injectEvent(rec.dst_x, rec.dst_y, rec.dst_z,
+                                     rec.src_x, rec.src_y, rec.src_z,
+                                     rec.payload);
+            replayed++;
+            if (batch_size != 0 && ++in_batch == batch_size) {
+                (void)kernel.run(static_cast<int>(batch_size * 12));
+                in_batch = 0;
+            }
+        }
+        return replayed;
+    }
+
+    void close() {
+        if (file_) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+private:
+    static constexpr size_t kBufferSize = 64 * 1024;
+
+    static int64_t unzigzag(uint64_t v) {
+        return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+
+    int getByte() {
+        if (pos_ == used_) {
+            if (eof_) {
+                return -1;
+            }
+            used_ = std::fread(buffer_, 1, kBufferSize, file_);
+            pos_ = 0;
+            if (used_ == 0) {
+                eof_ = true;
+                return -1;
+            }
+        }
+        return buffer_[pos_++];
+    }
+
+    bool getVarint(uint64_t& out) {
+        uint64_t v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const int b = getByte();
+            if (b < 0) {
+                return false;
+            }
+            v |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if ((b & 0x80) == 0) {
+                out = v;
+                return true;
+            }
+        }
+        return false;  // Over-long varint: corrupt trace
+    }
+
+    std::FILE* file_ = nullptr;
+    uint8_t buffer_[kBufferSize];
+    size_t used_ = 0;
+    size_t pos_ = 0;
+    bool eof_ = false;
+    uint32_t dim_ = 0;
+    uint64_t last_timestamp_ = 0;
+};
+
+} // namespace rse_trace
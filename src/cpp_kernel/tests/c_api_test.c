@@ -23,6 +23,36 @@ int main() {
   betti_rdl_inject_event(kernel, 0, 0, 0, 2);
   betti_rdl_inject_event(kernel, 0, 0, 0, 3);
 
+  // Bulk APIs: one FFI crossing per frame
+  printf("[BATCH] Spawning 4 processes and injecting 4 events in bulk...\n");
+  BettiRDLSpawnDesc spawns[4] = {
+      {0, 1, 0}, {1, 1, 0}, {2, 1, 0}, {3, 1, 0}};
+  size_t spawned = betti_rdl_spawn_batch(kernel, spawns, 4);
+  BettiRDLEventDesc events[4] = {
+      {0, 1, 0, 10}, {1, 1, 0, 20}, {2, 1, 0, 30}, {3, 1, 0, 40}};
+  size_t injected = betti_rdl_inject_batch(kernel, events, 4);
+  printf("  Spawned: %zu, Injected: %zu\n", spawned, injected);
+  if (spawned != 4 || injected != 4) {
+    printf("  [FAIL] bulk spawn/inject rejected entries\n");
+    return 1;
+  }
+
+  // Async command queue: append without entering the kernel, drain once
+  printf("[QUEUE] Enqueuing 1 spawn + 3 injects, draining once...\n");
+  BettiRDLCommandQueue *queue = betti_rdl_command_queue(kernel);
+  BettiRDLCommand spawn_cmd = {BETTI_RDL_CMD_SPAWN, 5, 5, 0, 0};
+  queue->commands[queue->tail % BETTI_RDL_COMMAND_CAPACITY] = spawn_cmd;
+  queue->tail++;  /* direct producer protocol, as a binding would */
+  betti_rdl_enqueue(kernel, BETTI_RDL_CMD_INJECT, 5, 5, 0, 7);
+  betti_rdl_enqueue(kernel, BETTI_RDL_CMD_INJECT, 5, 5, 0, 8);
+  betti_rdl_enqueue(kernel, BETTI_RDL_CMD_INJECT, 6, 5, 0, 9);
+  int drained = betti_rdl_drain(kernel);
+  printf("  Drained: %d\n", drained);
+  if (drained != 4 || queue->head != queue->tail || queue->dropped != 0) {
+    printf("  [FAIL] drain did not consume the queued commands\n");
+    return 1;
+  }
+
   // Run computation
   printf("\n[COMPUTE] Running distributed counter...\n");
   int events_in_run = betti_rdl_run(kernel, 100);
@@ -34,6 +64,59 @@ int main() {
   printf("  Current time: %lu\n", betti_rdl_get_current_time(kernel));
   printf("  Active processes: %zu\n", betti_rdl_get_process_count(kernel));
 
+  // Telemetry page: live counters without a polling call
+  printf("\n[TELEMETRY PAGE]\n");
+  const BettiRDLTelemetryPage *page = betti_rdl_get_telemetry_page(kernel);
+  printf("  events=%lu time=%lu depth=%lu mem=%lu\n",
+         (unsigned long)page->events_processed,
+         (unsigned long)page->current_time,
+         (unsigned long)page->queue_depth,
+         (unsigned long)page->memory_used);
+  if (page->events_processed != betti_rdl_get_events_processed(kernel) ||
+      page->current_time != betti_rdl_get_current_time(kernel) ||
+      page->queue_depth != 0) {
+    printf("  [FAIL] telemetry page out of sync after run\n");
+    return 1;
+  }
+  if (page->commands_applied != 4 || page->commands_pending != 0) {
+    printf("  [FAIL] command completion counters out of sync\n");
+    return 1;
+  }
+  if (betti_rdl_get_telemetry_page(0) != 0) {
+    printf("  [FAIL] null kernel must yield null page\n");
+    return 1;
+  }
+
+  // Zero-copy lattice view: stable pointer aliasing live kernel state
+  printf("\n[LATTICE VIEW]\n");
+  const int32_t *lattice = betti_rdl_lattice_states(kernel);
+  size_t cells = betti_rdl_lattice_size();
+  printf("  cells=%zu\n", cells);
+  if (!lattice || cells == 0) {
+    printf("  [FAIL] lattice view unavailable\n");
+    return 1;
+  }
+  /* The view must agree with the per-process query, in place */
+  for (int i = 0; i < 10; i++) {
+    int node = i * 1024; /* (i, 0, 0) */
+    if (lattice[node] != betti_rdl_get_process_state(kernel, node)) {
+      printf("  [FAIL] lattice view out of sync at node %d\n", node);
+      return 1;
+    }
+  }
+  /* The pointer is stable across runs, so bindings may cache the view */
+  betti_rdl_inject_event(kernel, 0, 0, 0, 1);
+  betti_rdl_run(kernel, 10);
+  if (lattice != betti_rdl_lattice_states(kernel)) {
+    printf("  [FAIL] lattice pointer moved across run\n");
+    return 1;
+  }
+  if (betti_rdl_lattice_states(0) != 0) {
+    printf("  [FAIL] null kernel must yield null lattice view\n");
+    return 1;
+  }
+  printf("  [OK] zero-copy lattice view\n");
+
   printf("\n[VALIDATION]\n");
   printf("  [OK] C API working\n");
   printf("  [OK] O(1) memory maintained\n");
@@ -0,0 +1,181 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/ElfImageCache.h"
+#include "../os/MemFS.h"
+#include "../os/VFS.h"
+#include "../os/PhysicalAllocator.h"
+#include "../os/TorusScheduler.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
+using os::Elf64_Ehdr;
+using os::Elf64_Phdr;
+
+// Two PT_LOAD segments: read-only text at `entry`, writable data one page up
+static void writeElfImage(std::array<uint8_t, 4096>& buf,
+                          const char* text, size_t text_len,
+                          const char* data, size_t data_len,
+                          uint64_t entry) {
+  std::memset(buf.data(), 0, buf.size());
+
+  Elf64_Ehdr ehdr{};
+  ehdr.e_ident[os::EI_MAG0] = os::ELF_MAGIC_0;
+  ehdr.e_ident[os::EI_MAG1] = os::ELF_MAGIC_1;
+  ehdr.e_ident[os::EI_MAG2] = os::ELF_MAGIC_2;
+  ehdr.e_ident[os::EI_MAG3] = os::ELF_MAGIC_3;
+  ehdr.e_ident[os::EI_CLASS] = os::ELFCLASS64;
+  ehdr.e_ident[os::EI_DATA] = os::ELFDATA2LSB;
+  ehdr.e_ident[os::EI_VERSION] = 1;
+  ehdr.e_machine = os::EM_X86_64;
+  ehdr.e_entry = entry;
+  ehdr.e_phoff = sizeof(Elf64_Ehdr);
+  ehdr.e_phentsize = sizeof(Elf64_Phdr);
+  ehdr.e_phnum = 2;
+
+  Elf64_Phdr text_ph{};
+  text_ph.p_type = os::PT_LOAD;
+  text_ph.p_flags = os::PF_R | os::PF_X;
+  text_ph.p_offset = 0x200;
+  text_ph.p_vaddr = entry;
+  text_ph.p_paddr = entry;
+  text_ph.p_filesz = text_len;
+  text_ph.p_memsz = 0x1000;
+  text_ph.p_align = 0x1000;
+
+  Elf64_Phdr data_ph{};
+  data_ph.p_type = os::PT_LOAD;
+  data_ph.p_flags = os::PF_R | os::PF_W;
+  data_ph.p_offset = 0x400;
+  data_ph.p_vaddr = entry + 0x1000;
+  data_ph.p_paddr = entry + 0x1000;
+  data_ph.p_filesz = data_len;
+  data_ph.p_memsz = 0x1000;
+  data_ph.p_align = 0x1000;
+
+  std::memcpy(buf.data(), &ehdr, sizeof(ehdr));
+  std::memcpy(buf.data() + ehdr.e_phoff, &text_ph, sizeof(text_ph));
+  std::memcpy(buf.data() + ehdr.e_phoff + sizeof(text_ph), &data_ph, sizeof(data_ph));
+  std::memcpy(buf.data() + text_ph.p_offset, text, text_len);
+  std::memcpy(buf.data() + data_ph.p_offset, data, data_len);
+}
+
+int main() {
+  std::cout << "[ELF Image Cache Tests]" << std::endl;
+
+  alignas(os::PAGE_SIZE) std::array<uint8_t, 1 << 20> phys{};
+  os::PhysicalAllocator phys_alloc(reinterpret_cast<uint64_t>(phys.data()), phys.size());
+  os::ElfImageCache cache(&phys_alloc);
+
+  const char text[] = "CACHED-TEXT";
+  const char data[] = "CACHED-DATA";
+  constexpr uint64_t kEntry = 0x400000;
+  std::array<uint8_t, 4096> image{};
+  writeElfImage(image, text, sizeof(text), data, sizeof(data), kEntry);
+
+  // Staging parses once; lookups after that are hits
+  assert(cache.lookup("/bin/tool") == nullptr);
+  os::ElfImageCache::CachedElf* cached =
+      cache.insert("/bin/tool", image.data(), image.size());
+  assert(cached != nullptr);
+  assert(cached->entry == kEntry);
+  assert(cached->ro_ranges.size() == 1);
+  assert(cached->data_ranges.size() == 1);
+  assert(cache.lookup("/bin/tool") == cached);
+  assert(cached->hits == 1);
+
+  // Two processes load the cached image; text pages share one frame
+  os::OSProcess proc1(1, 0, 0);
+  os::OSProcess proc2(2, 0, 0);
+  proc1.initMemory(&phys_alloc);
+  proc2.initMemory(&phys_alloc);
+  assert(proc1.loadElfImageShared(*cached));
+  assert(proc2.loadElfImageShared(*cached));
+  assert(proc1.context.rip == kEntry);
+
+  uint64_t text_phys1 = proc1.memory.page_table->translate(kEntry);
+  uint64_t text_phys2 = proc2.memory.page_table->translate(kEntry);
+  assert(text_phys1 != 0 && text_phys1 == text_phys2);
+
+  char out[32] = {};
+  assert(proc1.vmem->readUser(out, kEntry, sizeof(text)));
+  assert(std::strcmp(out, text) == 0);
+
+  // Data segments are private copies with the staged init bytes
+  uint64_t data_phys1 = proc1.memory.page_table->translate(kEntry + 0x1000);
+  uint64_t data_phys2 = proc2.memory.page_table->translate(kEntry + 0x1000);
+  assert(data_phys1 != 0 && data_phys2 != 0 && data_phys1 != data_phys2);
+  std::memset(out, 0, sizeof(out));
+  assert(proc2.vmem->readUser(out, kEntry + 0x1000, sizeof(data)));
+  assert(std::strcmp(out, data) == 0);
+
+  // A write through one process copies the text page; the other still
+  // reads the shared original
+  const char patch[] = "PATCHED";
+  assert(proc1.vmem->writeUser(kEntry, patch, sizeof(patch)));
+  assert(proc1.memory.page_table->translate(kEntry) != text_phys1);
+  assert(proc2.memory.page_table->translate(kEntry) == text_phys2);
+  std::memset(out, 0, sizeof(out));
+  assert(proc1.vmem->readUser(out, kEntry, sizeof(patch)));
+  assert(std::strcmp(out, patch) == 0);
+  std::memset(out, 0, sizeof(out));
+  assert(proc2.vmem->readUser(out, kEntry, sizeof(text)));
+  assert(std::strcmp(out, text) == 0);
+
+  // End-to-end: the second exec of the same path is served from the cache
+  os::MemFS fs;
+  os::VFS vfs(&fs);
+  os::TorusScheduler scheduler(0);
+  os::SyscallDispatcher dispatcher;
+  os::ElfImageCache exec_cache(&phys_alloc);
+  os::TorusContext ctx;
+  ctx.scheduler = &scheduler;
+  ctx.dispatcher = &dispatcher;
+  ctx.vfs = &vfs;
+  ctx.phys_alloc = &phys_alloc;
+  ctx.elf_cache = &exec_cache;
+  os::current_torus_context = &ctx;
+
+  os::OSProcess proc3(3, 0, 0);
+  proc3.initMemory(&phys_alloc);
+  scheduler.addProcess(&proc3);
+  scheduler.tick();
+
+  const char path[] = "/bin/tool";
+  int32_t fd = vfs.open(&proc3.fd_table, path,
+                        os::O_CREAT | os::O_TRUNC | os::O_WRONLY);
+  assert(fd >= 0);
+  assert(vfs.write(&proc3.fd_table, fd, image.data(), image.size()) ==
+         static_cast<int64_t>(image.size()));
+  vfs.close(&proc3.fd_table, fd);
+
+  auto execOnce = [&](os::OSProcess& proc) {
+    uint64_t user_path = proc.vmem->allocate(sizeof(path));
+    assert(user_path != 0);
+    assert(proc.vmem->writeUser(user_path, path, sizeof(path)));
+    int64_t rc = os::syscall(os::SYS_EXEC, user_path, 0, 0);
+    assert(rc == 0);
+    assert(proc.context.rip == kEntry);
+    char check[32] = {};
+    assert(proc.vmem->readUser(check, kEntry, sizeof(text)));
+    assert(std::strcmp(check, text) == 0);
+  };
+
+  execOnce(proc3);  // Cold: reads the VFS, stages the image
+  os::ElfImageCache::CachedElf* staged = exec_cache.lookup(path);
+  assert(staged != nullptr);
+  uint64_t hits_before = staged->hits;
+  execOnce(proc3);  // Warm: no VFS read, shared text frames
+  assert(staged->hits > hits_before);
+  assert(proc3.memory.page_table->translate(kEntry) == staged->frames[0]);
+
+  cache.printStats();
+  std::cout << "  ✓ all tests passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,164 @@
+#include "../single_torus/EventTrace.h"
+#include "../single_torus/BettiRDLKernel.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <unistd.h>
+
+// Event trace recorder/replayer: roundtrip fidelity, compactness,
+// truncated-tail handling, and replay determinism against the kernel.
+
+static const char* kTracePath = "/tmp/event_trace_test.rset";
+
+int main() {
+    std::printf("Running Event Trace Test...\n");
+
+    // 1. Roundtrip: every field survives encode/decode, including
+    // negative payloads and large timestamp deltas
+    {
+        rse_trace::EventTraceWriter writer;
+        if (!writer.open(kTracePath, 32)) {
+            std::printf("FAIL: writer open\n");
+            return 1;
+        }
+        uint64_t ts = 0;
+        for (int i = 0; i < 1000; i++) {
+            ts += (i % 7 == 0) ? 1000000 : (i % 3);
+            if (!writer.record(ts, i % 32, (i * 3) % 32, (i * 7) % 32,
+                               (i + 1) % 32, 0, 31, (i % 2) ? i : -i)) {
+                std::printf("FAIL: record %d\n", i);
+                return 1;
+            }
+        }
+        writer.close();
+
+        rse_trace::EventTraceReader reader;
+        if (!reader.open(kTracePath) || reader.dim() != 32) {
+            std::printf("FAIL: reader open\n");
+            return 1;
+        }
+        rse_trace::TraceRecord rec{};
+        uint64_t expect_ts = 0;
+        int count = 0;
+        while (reader.next(rec)) {
+            const int i = count;
+            expect_ts += (i % 7 == 0) ? 1000000 : (i % 3);
+            if (rec.timestamp != expect_ts || rec.dst_x != i % 32 ||
+                rec.dst_y != (i * 3) % 32 || rec.dst_z != (i * 7) % 32 ||
+                rec.src_x != (i + 1) % 32 || rec.src_y != 0 ||
+                rec.src_z != 31 || rec.payload != ((i % 2) ? i : -i)) {
+                std::printf("FAIL: record %d mismatch\n", i);
+                return 1;
+            }
+            count++;
+        }
+        if (count != 1000) {
+            std::printf("FAIL: read %d of 1000 records\n", count);
+            return 1;
+        }
+        std::printf("  [OK] roundtrip (1000 records)\n");
+
+        // Compactness: header + ~10 bytes/record worst case in this mix
+        std::FILE* f = std::fopen(kTracePath, "rb");
+        std::fseek(f, 0, SEEK_END);
+        const long size = std::ftell(f);
+        std::fclose(f);
+        if (size > 1000 * 12 + 16) {
+            std::printf("FAIL: trace too large (%ld bytes)\n", size);
+            return 1;
+        }
+        std::printf("  [OK] compact encoding (%ld bytes, %.1f/record)\n",
+                    size, (size - 16.0) / 1000.0);
+    }
+
+    // 2. Truncated tail (crash mid-append): replay stops at the last
+    // complete record instead of erroring
+    {
+        std::FILE* f = std::fopen(kTracePath, "rb");
+        std::fseek(f, 0, SEEK_END);
+        const long size = std::ftell(f);
+        std::fclose(f);
+        if (truncate(kTracePath, size - 3) != 0) {
+            std::printf("FAIL: truncate\n");
+            return 1;
+        }
+
+        rse_trace::EventTraceReader reader;
+        if (!reader.open(kTracePath)) {
+            std::printf("FAIL: reopen truncated\n");
+            return 1;
+        }
+        rse_trace::TraceRecord rec{};
+        int count = 0;
+        while (reader.next(rec)) {
+            count++;
+        }
+        if (count != 999) {
+            std::printf("FAIL: truncated trace read %d records\n", count);
+            return 1;
+        }
+        std::printf("  [OK] truncated tail drops only the cut record\n");
+    }
+
+    // 3. Replay determinism: record a kernel's injection sequence, replay
+    // into a fresh kernel, compare lifetime totals after equal drains
+    {
+        // Kernels are several MB each — keep them off the stack
+        static BettiRDLKernel original;
+        rse_trace::EventTraceWriter writer;
+        if (!writer.open(kTracePath, 32)) {
+            std::printf("FAIL: writer reopen\n");
+            return 1;
+        }
+        for (int x = 0; x < 4; x++) {
+            for (int y = 0; y < 4; y++) {
+                (void)original.spawnProcess(x, y, 0);
+            }
+        }
+        (void)original.createEdge(0, 0, 0, 1, 0, 0, 1);
+        (void)original.createEdge(1, 0, 0, 2, 0, 0, 2);
+        for (int i = 0; i < 500; i++) {
+            const int dx = i % 4, dy = (i / 4) % 4;
+            (void)original.injectEvent(dx, dy, 0, 0, 0, 0, i % 16);
+            (void)writer.record(original.getCurrentTime(), dx, dy, 0,
+                                0, 0, 0, i % 16);
+        }
+        writer.close();
+        (void)original.run(4000);
+
+        static BettiRDLKernel replayed;
+        for (int x = 0; x < 4; x++) {
+            for (int y = 0; y < 4; y++) {
+                (void)replayed.spawnProcess(x, y, 0);
+            }
+        }
+        (void)replayed.createEdge(0, 0, 0, 1, 0, 0, 1);
+        (void)replayed.createEdge(1, 0, 0, 2, 0, 0, 2);
+
+        rse_trace::EventTraceReader reader;
+        if (!reader.open(kTracePath)) {
+            std::printf("FAIL: replay open\n");
+            return 1;
+        }
+        const uint64_t fed = reader.replayInto(replayed, 0);
+        (void)replayed.run(4000);
+
+        if (fed != 500 ||
+            replayed.getEventsProcessed() != original.getEventsProcessed() ||
+            replayed.getCurrentTime() != original.getCurrentTime()) {
+            std::printf("FAIL: replay diverged (fed=%llu, events %llu vs %llu,"
+                        " time %llu vs %llu)\n",
+                        (unsigned long long)fed,
+                        (unsigned long long)replayed.getEventsProcessed(),
+                        (unsigned long long)original.getEventsProcessed(),
+                        (unsigned long long)replayed.getCurrentTime(),
+                        (unsigned long long)original.getCurrentTime());
+            return 1;
+        }
+        std::printf("  [OK] replay reproduces the original run\n");
+    }
+
+    std::remove(kTracePath);
+    std::printf("Event Trace Test PASSED\n");
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include "../ToroidalSpace.h"
 #include "../demos/BettiRDLKernel.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <iostream>
@@ -12,32 +13,97 @@ struct Process {
 };
 
 static void testToroidalSpaceVoxelCapacity() {
-  ToroidalSpace<32, 32, 32, 4> space;
+  // 4 in-cell slots plus a 2-entry shared overflow pool
+  ToroidalSpace<32, 32, 32, 4, DenseCells, RowMajorOrder, 2> space;
 
   [[maybe_unused]] Process p1{1};
   [[maybe_unused]] Process p2{2};
   [[maybe_unused]] Process p3{3};
   [[maybe_unused]] Process p4{4};
   [[maybe_unused]] Process p5{5};
+  [[maybe_unused]] Process p6{6};
+  [[maybe_unused]] Process p7{7};
 
   assert(space.addProcess(&p1, 0, 0, 0));
   assert(space.addProcess(&p2, 0, 0, 0));
   assert(space.addProcess(&p3, 0, 0, 0));
   assert(space.addProcess(&p4, 0, 0, 0));
 
-  // Capacity exceeded
-  assert(!space.addProcess(&p5, 0, 0, 0));
-  assert(space.getProcessCount() == 4);
+  // Crowded cell spills into the shared overflow pool instead of failing;
+  // wrap invariants hold for spilled adds too (32 wraps to 0)
+  assert(space.addProcess(&p5, 0, 0, 0));
+  assert(space.addProcess(&p6, 32, 0, 0));
+  assert(space.getProcessCount() == 6);
+  assert(space.getCellProcessCount(0, 0, 0) == 6);
+  assert(space.getCellProcess(0, 0, 0, 5) != nullptr);
+
+  // Overflow pool exhausted: bounded failure
+  assert(!space.addProcess(&p7, 0, 0, 0));
+  assert(space.getProcessCount() == 6);
 
-  // Removal frees capacity deterministically
+  // Removing an in-cell process promotes a spilled one back
   assert(space.removeProcess(&p2, 0, 0, 0));
-  assert(space.getProcessCount() == 3);
-  assert(space.addProcess(&p5, 0, 0, 0));
+  assert(space.getProcessCount() == 5);
+  assert(space.getCellProcessCount(0, 0, 0) == 5);
+
+  // Spilled processes are findable and removable
+  assert(space.removeProcess(&p6, 0, 0, 0));
   assert(space.getProcessCount() == 4);
+  assert(space.addProcess(&p7, 0, 0, 0));
+  assert(space.getProcessCount() == 5);
+}
 
-  // Wrap invariants (32 wraps to 0)
-  [[maybe_unused]] Process p6{6};
-  assert(!space.addProcess(&p6, 32, 0, 0));
+static void testToroidalSpaceSparseCells() {
+  // 128^3 lattice with sparse backing: memory scales with occupied cells.
+  ToroidalSpace<128, 128, 128, 4, SparseCells<8>> space;
+
+  [[maybe_unused]] Process p1{1};
+  [[maybe_unused]] Process p2{2};
+
+  assert(space.addProcess(&p1, 0, 0, 0));
+  assert(space.addProcess(&p2, 100, 50, 127));
+  assert(space.getProcessCount() == 2);
+  assert(space.getCellProcessCount(0, 0, 0) == 1);
+  assert(space.getCellProcessCount(100, 50, 127) == 1);
+
+  // Untouched cells read as empty without materializing
+  assert(space.getCellProcessCount(64, 64, 64) == 0);
+
+  // Wrap invariants hold through the sparse index
+  assert(space.getCellProcessCount(128, 0, 0) == 1);
+
+  assert(space.removeProcess(&p1, 0, 0, 0));
+  assert(space.getProcessCount() == 1);
+
+  // Occupied-cell capacity is bounded and deterministic
+  [[maybe_unused]] Process extras[16];
+  [[maybe_unused]] std::size_t created = 0;
+  for (int i = 0; i < 16; ++i) {
+    if (space.addProcess(&extras[i], i + 1, 0, 0)) {
+      ++created;
+    }
+  }
+  // 8 occupied-cell slots; (0,0,0) stays resident after removal and p2
+  // holds one, leaving 6 for new cells.
+  assert(created == 6);
+
+  space.clear();
+  assert(space.getProcessCount() == 0);
+  assert(space.addProcess(&p1, 5, 5, 5));
+}
+
+static void testToroidalWrapSpecializations() {
+  // Mask path (power-of-two) and table path (arbitrary extent) both
+  // agree with the arithmetic form, including negatives
+  using S32 = ToroidalSpace<32, 32, 32>;
+  for (int v = -100; v < 100; ++v) {
+    assert(S32::wrap<32>(v) == S32::wrap(v, 32));
+    assert(toroidal_detail::WrapDim<10>::wrap(v) == ((v % 10) + 10) % 10);
+  }
+  // Offsets beyond one period either side still wrap correctly
+  assert((toroidal_detail::WrapDim<10>::wrap(1000003)) == 3);
+  static_assert(S32::wrap<32>(-1) == 31);
+  static_assert(toroidal_detail::WrapDim<12>::wrap(25) == 1);
 }
 
 struct HeapEvent {
@@ -74,6 +140,96 @@ static void testFixedMinHeapCapacityAndOrder() {
   assert(heap.top().t == 2);
 }
 
+static void testFixedMinHeapBatchPush() {
+  FixedMinHeap<HeapEvent, 16> heap;
+
+  assert(heap.push({5, 0}));
+  assert(heap.push({9, 0}));
+
+  [[maybe_unused]] const HeapEvent batch[] = {{3, 0}, {1, 1}, {7, 0}, {1, 0}};
+  assert(heap.pushBatch(batch, 4));
+  assert(heap.size() == 6);
+
+  // Order is identical to individual pushes
+  assert(heap.top().t == 1 && heap.top().id == 0);
+  (void)heap.pop();
+  assert(heap.top().t == 1 && heap.top().id == 1);
+  (void)heap.pop();
+  assert(heap.top().t == 3);
+
+  // Batch exceeding remaining capacity is rejected atomically
+  FixedMinHeap<HeapEvent, 4> small;
+  assert(small.push({1, 0}));
+  [[maybe_unused]] const HeapEvent too_many[] = {{2, 0}, {3, 0}, {4, 0},
+                                                 {5, 0}};
+  assert(!small.pushBatch(too_many, 4));
+  assert(small.size() == 1);
+
+  // drainIf extracts matches in bulk and leaves a valid heap behind
+  FixedMinHeap<HeapEvent, 32> drain;
+  for (int i = 0; i < 12; ++i) {
+    bool pushed = drain.push({i, 0});
+    assert(pushed);
+    (void)pushed;
+  }
+  HeapEvent out[12];
+  std::size_t taken = drain.drainIf(
+      [](const HeapEvent &e) { return e.t < 5; }, out, 12);
+  assert(taken == 5);
+  assert(drain.size() == 7);
+  assert(drain.top().t == 5);
+  for (int i = 5; i < 12; ++i) {
+    assert(drain.top().t == i);
+    bool popped = drain.pop();
+    assert(popped);
+    (void)popped;
+  }
+
+  // max_out caps the extraction; leftovers survive in heap order
+  for (int i = 0; i < 8; ++i) {
+    bool pushed = drain.push({i, 0});
+    assert(pushed);
+    (void)pushed;
+  }
+  taken = drain.drainIf([](const HeapEvent &) { return true; }, out, 3);
+  assert(taken == 3);
+  assert(drain.size() == 5);
+  taken = drain.drainIf([](const HeapEvent &e) { return e.t > 99; }, out, 12);
+  assert(taken == 0);
+  assert(drain.size() == 5);
+  (void)taken;
+}
+
+static void testFixedQuadHeapOrder() {
+  FixedQuadHeap<HeapEvent, 32> heap;
+
+  // Enough elements for a three-level 4-ary tree
+  for (int i = 31; i >= 0; --i) {
+    assert(heap.push({i / 2, i % 2}));
+  }
+  assert(!heap.push({99, 0}));
+  assert(heap.size() == 32);
+
+  // Pop order matches the binary heap's canonical ordering
+  for (int i = 0; i < 32; ++i) {
+    assert(heap.top().t == i / 2 && heap.top().id == i % 2);
+    assert(heap.pop());
+  }
+  assert(heap.empty());
+
+  // Batch heapify preserves the same ordering
+  [[maybe_unused]] HeapEvent batch[16];
+  for (int i = 0; i < 16; ++i) {
+    batch[i] = {(15 - i) / 2, (15 - i) % 2};
+  }
+  assert(heap.pushBatch(batch, 16));
+  assert(heap.top().t == 0 && heap.top().id == 0);
+  (void)heap.pop();
+  assert(heap.top().t == 0 && heap.top().id == 1);
+  (void)heap.pop();
+  assert(heap.top().t == 1);
+}
+
 static void testFixedAdjacencyCapacity() {
   BettiRDLKernel kernel;
 
@@ -98,12 +254,477 @@ static void testFixedAdjacencyCapacity() {
   assert(!kernel.createEdge(0, 0, 0, 1, 0, 0, 1));
 }
 
+static void testEdgeFreeListAndCompaction() {
+  // Side effects stay outside assert() so the test behaves the same in
+  // NDEBUG builds
+  static BettiRDLKernel kernel;
+  bool ok;
+
+  // Interleaved adds across two source nodes fragment the chains
+  for (int i = 1; i <= 6; ++i) {
+    ok = kernel.createEdge(0, 0, 0, i, 0, 0, 1);
+    assert(ok);
+    ok = kernel.createEdge(1, 1, 1, 0, i, 0, 1);
+    assert(ok);
+  }
+  assert(kernel.getEdgeCount() == 12);
+
+  ok = kernel.removeEdge(0, 0, 0, 3, 0, 0);
+  assert(ok);
+  ok = kernel.removeEdge(0, 0, 0, 3, 0, 0);
+  assert(!ok);  // Already gone
+  assert(kernel.getEdgeCount() == 11);
+
+  // A freed slot is reused before the append frontier advances
+  ok = kernel.createEdge(2, 2, 2, 3, 3, 3, 5);
+  assert(ok);
+  assert(kernel.getEdgeCount() == 12);
+
+  // Churn, then compact; surviving edges stay reachable and mutable
+  for (int i = 1; i <= 6; ++i) {
+    ok = kernel.removeEdge(1, 1, 1, 0, i, 0);
+    assert(ok);
+  }
+  assert(kernel.getEdgeCount() == 6);
+  kernel.compactEdges();
+  assert(kernel.getEdgeCount() == 6);
+  ok = kernel.createEdge(0, 0, 0, 1, 0, 0, 9);  // Update-in-place
+  assert(ok);
+  assert(kernel.getEdgeCount() == 6);
+  ok = kernel.removeEdge(2, 2, 2, 3, 3, 3);
+  assert(ok);
+  ok = kernel.removeEdge(1, 1, 1, 0, 1, 0);
+  assert(!ok);
+  assert(kernel.getEdgeCount() == 5);
+
+  // Sustained add/remove churn never exhausts capacity
+  for (int r = 0; r < 20000; ++r) {
+    ok = kernel.createEdge(5, 5, 5, 6, 6, 6, 1);
+    assert(ok);
+    ok = kernel.removeEdge(5, 5, 5, 6, 6, 6);
+    assert(ok);
+  }
+  assert(kernel.getEdgeCount() == 5);
+  (void)ok;
+}
+
+static void testRunUntilHorizonEquivalence() {
+  // runUntil drains events below the horizon in one bulk pass; it must
+  // process exactly the events tick() would, in the same canonical order
+  static BettiRDLKernel horizon_k;
+  static BettiRDLKernel tick_k;
+  bool ok;
+
+  // Branching mesh so the fan-out adapts delays unevenly
+  for (BettiRDLKernel *k : {&horizon_k, &tick_k}) {
+    for (int x = 0; x < 12; ++x) {
+      ok = k->createEdge(x, 5, 5, x + 1, 5, 5, 1 + (x % 3));
+      assert(ok);
+      ok = k->createEdge(x, 5, 5, x, 6, 5, 2);
+      assert(ok);
+    }
+    ok = k->injectEvent(0, 5, 5, 0, 0, 0, 1);
+    assert(ok);
+    ok = k->injectEvent(3, 5, 5, 1, 1, 1, -2);
+    assert(ok);
+    ok = k->injectEvent(7, 5, 5, 2, 2, 2, 0);
+    assert(ok);
+  }
+
+  // Advance both in horizon slices; the reference spins per-event ticks
+  unsigned long long total = 0;
+  for (unsigned long long h : {4ULL, 10ULL, 25ULL, 200ULL}) {
+    total += horizon_k.runUntil(h);
+    while (tick_k.nextEventTime() < h) {
+      tick_k.tick();
+    }
+    assert(horizon_k.getEventsProcessed() == tick_k.getEventsProcessed());
+    assert(horizon_k.getCurrentTime() == tick_k.getCurrentTime());
+    assert(horizon_k.getPendingEventCount() == tick_k.getPendingEventCount());
+  }
+  assert(total == horizon_k.getEventsProcessed());
+  assert(total > 50);  // The mesh actually fanned out
+
+  // A horizon at or below the processed front is a no-op
+  const unsigned long long again = horizon_k.runUntil(1);
+  assert(again == 0);
+  (void)ok;
+  (void)total;
+  (void)again;
+}
+
+namespace {
+struct LinkNode {
+  int id = 0;
+  LinkNode *next = nullptr;
+  LinkNode *prev = nullptr;
+};
+}  // namespace
+
+static void testIntrusiveListUnlink() {
+  IntrusiveList<LinkNode, &LinkNode::next, &LinkNode::prev> list;
+  LinkNode nodes[4];
+  for (int i = 0; i < 4; ++i) {
+    nodes[i].id = i;
+    list.pushBack(&nodes[i]);
+  }
+  assert(list.front()->id == 0 && list.back()->id == 3);
+
+  // Middle unlink relinks neighbours; no element shifting
+  list.unlink(&nodes[2]);
+  assert(nodes[1].next == &nodes[3] && nodes[3].prev == &nodes[1]);
+  assert(nodes[2].next == nullptr && nodes[2].prev == nullptr);
+
+  // FIFO pop order skips the removed node
+  LinkNode *p = list.popFront();
+  assert(p == &nodes[0]);
+  p = list.popFront();
+  assert(p == &nodes[1]);
+  p = list.popFront();
+  assert(p == &nodes[3]);
+  assert(list.empty());
+  assert(list.popFront() == nullptr);
+  (void)p;
+}
+
+static void testFixedObjectPoolHandles() {
+  struct Obj {
+    int v;
+    explicit Obj(int x) : v(x) {}
+  };
+  FixedObjectPool<Obj, 16> pool;
+  using Handle = FixedObjectPool<Obj, 16>::Handle;
+
+  Handle null_handle;
+  assert(null_handle.isNull());
+  assert(pool.resolve(null_handle) == nullptr);
+
+  Obj *a = pool.create(7);
+  Handle ha = pool.handleFor(a);
+  Obj *ra = pool.resolve(ha);
+  assert(!ha.isNull());
+  assert(ra == a && ra->v == 7);
+
+  // destroy() bumps the slot generation: the old handle goes stale even
+  // after the slot is handed out again
+  pool.destroy(a);
+  assert(pool.resolve(ha) == nullptr);
+  Obj *b = pool.create(9);
+  Handle hb = pool.handleFor(b);
+  assert(pool.resolve(ha) == nullptr);
+  assert(pool.resolve(hb) == b);
+  assert(!(ha == hb));
+
+  // Churning one slot keeps advancing its generation; a handle from
+  // thousands of cycles ago must still miss
+  for (int i = 0; i < 5000; ++i) {
+    pool.destroy(b);
+    b = pool.create(i);
+  }
+  assert(pool.resolve(hb) == nullptr);
+
+  // clear() invalidates every outstanding handle at once
+  Handle hc = pool.handleFor(b);
+  pool.clear();
+  assert(pool.resolve(hc) == nullptr);
+  (void)null_handle;
+  (void)ra;
+  (void)ha;
+  (void)hb;
+  (void)hc;
+}
+
+static void testFixedBitsetScans() {
+  FixedBitset<130> bits;  // Odd size exercises the tail-word mask
+
+  assert(bits.none());
+  assert(bits.findFirstSet() == bits.npos);
+  assert(bits.findFirstZero() == 0);
+
+  bits.set(0);
+  bits.set(64);
+  bits.set(129);
+  assert(bits.test(64) && !bits.test(63));
+  assert(bits.count() == 3);
+  assert(bits.findFirstSet() == 0);
+  assert(bits.findFirstSet(1) == 64);
+  assert(bits.findFirstSet(65) == 129);
+  assert(bits.findFirstSet(130) == bits.npos);
+  assert(bits.findLastSet() == 129);
+  assert(bits.findFirstZero() == 1);
+
+  // Range ops split correctly across word boundaries
+  bits.setRange(60, 10);
+  assert(bits.count() == 3 + 10 - 1);  // bit 64 was already set
+  assert(bits.findFirstZero(60) == 70);
+  bits.clearRange(0, 130);
+  assert(bits.none());
+  assert(bits.findFirstZero(129) == 129);
+
+  // Fill: find-first-zero reports exhaustion, not a phantom tail bit
+  bits.setRange(0, 130);
+  assert(bits.count() == 130);
+  assert(bits.findFirstZero() == bits.npos);
+  assert(bits.findLastSet() == 129);
+
+  bits.reset();
+  assert(bits.none());
+
+  // Compile-time usability
+  constexpr auto first_free = [] {
+    FixedBitset<8> b;
+    b.setRange(0, 3);
+    return b.findFirstZero();
+  }();
+  static_assert(first_free == 3);
+}
+
+static void testFixedMPMCRingBounds() {
+  // Side effects stay outside assert() so the test behaves the same in
+  // NDEBUG builds
+  FixedMPMCRing<int, 8> ring;
+
+  assert(ring.empty());
+  bool ok = false;
+  for (int i = 0; i < 8; ++i) {
+    ok = ring.push(i);
+    assert(ok);
+  }
+  assert(ring.size() == 8);
+
+  // Full ring rejects deterministically
+  ok = ring.push(99);
+  assert(!ok);
+
+  // FIFO order through a full wrap of the sequence numbers
+  int out = -1;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 8; ++i) {
+      ok = ring.pop(out);
+      assert(ok);
+      assert(out == i);
+    }
+    ok = ring.pop(out);
+    assert(!ok);
+    for (int i = 0; i < 8; ++i) {
+      ok = ring.push(i);
+      assert(ok);
+    }
+  }
+
+  // Batch transfer stops at the boundary and reports the partial count.
+  // Side effects stay outside assert() so the test behaves the same in
+  // NDEBUG builds
+  int extra[4] = {8, 9, 10, 11};
+  int drained[12] = {};
+  std::size_t n = ring.pushMany(extra, 4);
+  assert(n == 0);
+  n = ring.popMany(drained, 12);
+  assert(n == 8);
+  assert(drained[0] == 0 && drained[7] == 7);
+  n = ring.pushMany(extra, 4);
+  assert(n == 4);
+  n = ring.popMany(drained, 2);
+  assert(n == 2);
+  assert(drained[0] == 8 && drained[1] == 9);
+  (void)ok;
+  (void)out;
+  (void)n;
+  (void)drained;
+}
+
+static void testFixedRadixSortCanonicalOrder() {
+  constexpr std::size_t N = 512;
+  static RDLEvent events[N];
+  static RDLEvent expected[N];
+  static FixedRadixSorter<RDLEvent, N> sorter;
+
+  // Deterministic pseudo-random batch with narrow ranges to force ties
+  // on every field
+  std::uint64_t state = 0x1234'5678'9ABC'DEF0ULL;
+  auto next = [&state]() {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state >> 33;
+  };
+  for (std::size_t i = 0; i < N; ++i) {
+    events[i].timestamp = next() % 16;
+    events[i].dst_node = static_cast<int>(next() % 8) - 4;
+    events[i].src_node = static_cast<int>(next() % 8) - 4;
+    events[i].payload = static_cast<int>(next() % 4) - 2;
+    expected[i] = events[i];
+  }
+  std::sort(expected, expected + N);
+
+  // Stable passes compose: least significant tiebreak first, then the
+  // primary timestamp key, yielding the canonical operator< order
+  sorter.sortByKey(events, N, [](const RDLEvent &e) {
+    return radixKeyFromSigned(e.payload);
+  });
+  sorter.sortByKey(events, N, [](const RDLEvent &e) {
+    return (radixKeyFromSigned(e.dst_node) << 32) |
+           radixKeyFromSigned(e.src_node);
+  });
+  sorter.sortByKey(events, N, [](const RDLEvent &e) {
+    return static_cast<std::uint64_t>(e.timestamp);
+  });
+
+  for (std::size_t i = 0; i < N; ++i) {
+    assert(events[i].timestamp == expected[i].timestamp);
+    assert(events[i].dst_node == expected[i].dst_node);
+    assert(events[i].src_node == expected[i].src_node);
+    assert(events[i].payload == expected[i].payload);
+  }
+
+  // Sorting an already-sorted batch (all passes skipped or not) is a
+  // fixed point
+  sorter.sortByKey(events, N, [](const RDLEvent &e) {
+    return static_cast<std::uint64_t>(e.timestamp);
+  });
+  for (std::size_t i = 0; i < N; ++i) {
+    assert(events[i].payload == expected[i].payload);
+  }
+}
+
+static void testFixedHashMapBasics() {
+  // Side effects stay outside assert() so the test behaves the same in
+  // NDEBUG builds
+  FixedHashMap<std::uint64_t, int, 8> map;
+
+  assert(map.empty());
+  bool ok = map.insert(42, 1);
+  assert(ok);
+  ok = map.insert(1042, 2);
+  assert(ok);
+  assert(map.contains(42));
+  assert(!map.contains(7));
+  assert(*map.find(1042) == 2);
+
+  // Insert on an existing key updates in place
+  ok = map.insert(42, 9);
+  assert(ok);
+  assert(map.size() == 2);
+  assert(*map.find(42) == 9);
+
+  // Erase leaves a tombstone that probing skips and insert reclaims
+  ok = map.erase(42);
+  assert(ok);
+  assert(!map.contains(42));
+  assert(map.size() == 1);
+  assert(*map.find(1042) == 2);
+  ok = map.insert(7, 3);
+  assert(ok);
+  assert(map.size() == 2);
+
+  // Fill to capacity; probing still finds earlier keys afterwards
+  for (std::uint64_t k = 100; map.size() < map.capacity(); ++k) {
+    ok = map.insert(k, static_cast<int>(k));
+    assert(ok);
+  }
+  assert(map.size() == map.capacity());
+  assert(*map.find(7) == 3);
+
+  map.clear();
+  assert(map.empty());
+  assert(!map.contains(1042));
+  (void)ok;
+}
+
+static void testFixedFlowProfiler() {
+  FixedFlowProfiler<4> prof;
+
+  assert(prof.empty());
+  bool ok = prof.record(10, 5);
+  assert(ok);
+  ok = prof.record(20, 1);
+  assert(ok);
+  ok = prof.record(10);
+  assert(ok);
+  ok = prof.record(30, 3);
+  assert(ok);
+  assert(prof.size() == 3);
+  assert(prof.count(10) == 6);
+  assert(prof.count(20) == 1);
+  assert(prof.count(99) == 0);
+
+  // topK returns descending counts; a window smaller than the key set
+  // keeps only the heaviest
+  std::uint64_t keys[4];
+  std::uint64_t counts[4];
+  std::size_t got = prof.topK(keys, counts, 2);
+  assert(got == 2);
+  (void)got;
+  assert(keys[0] == 10 && counts[0] == 6);
+  assert(keys[1] == 30 && counts[1] == 3);
+
+  // Saturated key set: resident keys keep accumulating, new keys drop
+  ok = prof.record(40);
+  assert(ok);
+  assert(prof.size() == prof.capacity());
+  ok = prof.record(50);
+  assert(!ok);
+  assert(prof.recordsDropped() == 1);
+  ok = prof.record(30, 2);
+  assert(ok);
+  assert(prof.count(30) == 5);
+
+  prof.clear();
+  assert(prof.empty());
+  assert(prof.count(10) == 0);
+  (void)ok;
+}
+
+static void testKernelFlowProfiling() {
+  // One heavy lane (0,0,0)->(1,0,0) driven hard enough that 1-in-16
+  // sampling must catch it, plus a light lane that may or may not appear
+  static BettiRDLKernel kernel;
+  bool ok = kernel.spawnProcess(0, 0, 0);
+  assert(ok);
+  ok = kernel.spawnProcess(1, 0, 0);
+  assert(ok);
+  ok = kernel.createEdge(0, 0, 0, 1, 0, 0, 1);
+  assert(ok);
+  kernel.setFlowProfiling(true);
+
+  for (int i = 0; i < 200; i++) {
+    ok = kernel.injectEvent(0, 0, 0, 0, 0, 0, 1);
+    assert(ok);
+  }
+  (void)kernel.run(400);
+
+  std::uint64_t keys[4];
+  std::uint64_t counts[4];
+  const std::size_t flows = kernel.topFlows(keys, counts, 4);
+  assert(flows >= 1);
+  (void)flows;
+  // Heaviest flow is the driven edge: node 0 -> node 1024
+  assert(keys[0] == ((0ULL << 32) | 1024ULL));
+  assert(counts[0] > 0);
+
+  kernel.clearFlowProfile();
+  assert(kernel.topFlows(keys, counts, 4) == 0);
+  (void)ok;
+}
+
 int main() {
   std::cout << "[FixedStructures Tests]" << std::endl;
 
   testToroidalSpaceVoxelCapacity();
+  testToroidalSpaceSparseCells();
+  testToroidalWrapSpecializations();
   testFixedMinHeapCapacityAndOrder();
+  testFixedMinHeapBatchPush();
+  testFixedQuadHeapOrder();
   testFixedAdjacencyCapacity();
+  testEdgeFreeListAndCompaction();
+  testRunUntilHorizonEquivalence();
+  testIntrusiveListUnlink();
+  testFixedObjectPoolHandles();
+  testFixedBitsetScans();
+  testFixedMPMCRingBounds();
+  testFixedRadixSortCanonicalOrder();
+  testFixedHashMapBasics();
+  testFixedFlowProfiler();
+  testKernelFlowProfiling();
 
   std::cout << "  ✓ all tests passed" << std::endl;
   return 0;
@@ -0,0 +1,102 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/PhysicalAllocator.h"
+#include "../os/TorusScheduler.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
+int main() {
+  std::cout << "[Fork COW Tests]" << std::endl;
+
+  alignas(os::PAGE_SIZE) static std::array<uint8_t, 1 << 20> phys{};
+  os::PhysicalAllocator phys_alloc(reinterpret_cast<uint64_t>(phys.data()), phys.size());
+  os::TorusScheduler scheduler(0);
+  os::SyscallDispatcher dispatcher;
+  os::TorusContext ctx;
+  ctx.scheduler = &scheduler;
+  ctx.dispatcher = &dispatcher;
+  ctx.phys_alloc = &phys_alloc;
+  ctx.next_pid = 2;
+  os::current_torus_context = &ctx;
+
+  os::OSProcess* parent = new os::OSProcess(1, 0, 0);
+  parent->initMemory(&phys_alloc);
+  uint64_t buf = parent->vmem->allocate(2 * os::PAGE_SIZE);
+  assert(buf != 0);
+
+  const char parent_data[] = "parent-data";
+  assert(parent->vmem->writeUser(buf, parent_data, sizeof(parent_data)));
+
+  scheduler.addProcess(parent);
+  scheduler.tick();
+
+  // Fork shares every frame; the only allocation is the child's info page
+  uint64_t free_before = phys_alloc.available();
+  int64_t child_pid = os::syscall(os::SYS_FORK, 0, 0, 0);
+  assert(child_pid > 1);
+  assert(free_before - phys_alloc.available() == 1);
+
+  os::OSProcess* child = scheduler.findProcess(static_cast<uint32_t>(child_pid));
+  assert(child != nullptr && child->vmem != nullptr);
+
+  uint64_t shared_phys = parent->memory.page_table->translate(buf);
+  assert(shared_phys != 0);
+  assert(child->memory.page_table->translate(buf) == shared_phys);
+  assert(phys_alloc.frameRefs(shared_phys) == 2);
+
+  char out[32] = {};
+  assert(child->vmem->readUser(out, buf, sizeof(parent_data)));
+  assert(std::strcmp(out, parent_data) == 0);
+
+  // First write in the child copies just that page; the parent keeps the
+  // original frame and contents
+  const char child_data[] = "child-data";
+  assert(child->vmem->writeUser(buf, child_data, sizeof(child_data)));
+  assert(child->memory.page_table->translate(buf) != shared_phys);
+  assert(parent->memory.page_table->translate(buf) == shared_phys);
+  assert(phys_alloc.frameRefs(shared_phys) == 1);
+
+  std::memset(out, 0, sizeof(out));
+  assert(parent->vmem->readUser(out, buf, sizeof(parent_data)));
+  assert(std::strcmp(out, parent_data) == 0);
+  std::memset(out, 0, sizeof(out));
+  assert(child->vmem->readUser(out, buf, sizeof(child_data)));
+  assert(std::strcmp(out, child_data) == 0);
+
+  // The untouched second page is still one shared frame
+  uint64_t page2 = buf + os::PAGE_SIZE;
+  assert(parent->memory.page_table->translate(page2) ==
+         child->memory.page_table->translate(page2));
+
+  // A parent-side write diverges the same way; the child still reads the
+  // deferred-zero contents
+  const char patch[] = "patched";
+  assert(parent->vmem->writeUser(page2, patch, sizeof(patch)));
+  assert(parent->memory.page_table->translate(page2) !=
+         child->memory.page_table->translate(page2));
+  std::memset(out, 0xFF, sizeof(out));
+  assert(child->vmem->readUser(out, page2, 8));
+  for (int i = 0; i < 8; i++) {
+    assert(out[i] == 0);
+  }
+
+  // The child now holds the last reference on its page2 frame (the parent
+  // dropped its own when it copied); unmapping actually frees it
+  uint64_t child_page2 = child->memory.page_table->translate(page2);
+  assert(phys_alloc.frameRefs(child_page2) == 1);
+  uint64_t free_mid = phys_alloc.available();
+  child->vmem->free(page2, os::PAGE_SIZE);
+  assert(phys_alloc.available() == free_mid + 1);
+  assert(phys_alloc.frameRefs(child_page2) == 0);
+
+  phys_alloc.printStats();
+  std::cout << "  ✓ all tests passed" << std::endl;
+  return 0;
+}
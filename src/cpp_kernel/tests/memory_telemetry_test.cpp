@@ -78,10 +78,40 @@ int main() {
     // If we free memory, RSS might drop, but we didn't free yet.
     
     // 4. Cleanup
-    // Generic pool doesn't support individual deallocation in this codebase (arena style), 
+    // Generic pool doesn't support individual deallocation in this codebase (arena style),
     // but let's try calling deallocate just to be correct with API, though it does nothing.
     BoundedArenaAllocator::getInstance().deallocateGeneric(ptr);
 
+    // 5. Generic pool fragmentation view
+    std::cout << "Checking fragmentation snapshot..." << std::endl;
+    auto& alloc = BoundedArenaAllocator::getInstance();
+    AllocationSnapshot before = alloc.snapshotGenericPool();
+    if (before.largest_free_run > before.free_bytes) {
+        std::cerr << "FAILURE: largest_free_run > free_bytes." << std::endl;
+        return 1;
+    }
+
+    // Freeing a class block banks it on its freelist: free_bytes must not
+    // shrink, and the banked 64-byte-class block is visible in the total.
+    void* small = alloc.allocateGeneric(48);
+    if (!small) {
+        std::cerr << "FAILURE: small allocation failed." << std::endl;
+        return 1;
+    }
+    alloc.deallocateGeneric(small);
+    AllocationSnapshot after = alloc.snapshotGenericPool();
+    if (after.free_bytes < before.free_bytes) {
+        std::cerr << "FAILURE: free_bytes shrank after alloc/free cycle." << std::endl;
+        return 1;
+    }
+    double frag = alloc.getGenericFragmentationPct();
+    std::cout << "Fragmentation: " << frag << "% (free " << after.free_bytes
+              << " bytes, largest run " << after.largest_free_run << ")" << std::endl;
+    if (frag < 0.0 || frag > 100.0) {
+        std::cerr << "FAILURE: fragmentation out of range." << std::endl;
+        return 1;
+    }
+
     std::cout << "Memory Telemetry Test PASSED" << std::endl;
     return 0;
 }
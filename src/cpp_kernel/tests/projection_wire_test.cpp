@@ -0,0 +1,217 @@
+#include "../braided/ProjectionWire.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Packed wire format: roundtrip fidelity per version, sparse-boundary
+// compactness, cross-version decode (old reader / new payload and the
+// reverse), and truncated-input rejection.
+
+namespace {
+
+// Deterministic fixture: sparse boundary (every 16th cell), full
+// constraint and process sections, non-trivial scalars everywhere
+void fillV3(braided::ProjectionV3& proj) {
+    proj = braided::ProjectionV3{};
+    proj.torus_id = 2;
+    proj.timestamp = 123456789ULL;
+    proj.total_events_processed = 987654321ULL;
+    proj.current_time = 555555;
+    proj.active_processes = 4096;
+    proj.pending_events = 77;
+    proj.edge_count = 8192;
+    for (size_t i = 0; i < braided::ProjectionV3::BOUNDARY_SIZE; i += 16) {
+        proj.boundary_states[i] = static_cast<uint32_t>(i * 3 + 1);
+    }
+    for (size_t i = 0; i < braided::ProjectionV3::CONSTRAINT_DIM; i++) {
+        proj.constraint_vector[i] = static_cast<int32_t>(i) - 8;
+    }
+    proj.initializeBoundaryConstraints(5);
+    proj.initializeGlobalConstraints();
+    proj.heartbeat_timestamp = 424242;
+    proj.health_status = braided::ProjectionV3::DEGRADED;
+    proj.num_processes = 3;
+    for (uint32_t i = 0; i < proj.num_processes; i++) {
+        proj.processes[i] = {i + 100, static_cast<int16_t>(i),
+                             static_cast<int16_t>(-static_cast<int>(i)),
+                             static_cast<int16_t>(31 - i), i * 7};
+    }
+    proj.is_delta = 1;
+    proj.boundary_generation = 9001;
+    proj.boundary_base_generation = 9000;
+    proj.num_boundary_deltas = 2;
+    proj.boundary_deltas[0] = {10, 111};
+    proj.boundary_deltas[1] = {500, 222};
+    proj.state_hash = proj.computeHash();
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Projection Wire Test...\n");
+
+    static uint8_t buf[braided::PROJECTION_WIRE_MAX_V3];
+
+    // 1. V3 roundtrip: every section survives encode/decode
+    {
+        static braided::ProjectionV3 src, dst;
+        fillV3(src);
+        const size_t n = braided::serializeWire(src, buf, sizeof(buf));
+        if (n == 0 || !braided::deserializeWire(buf, n, dst)) {
+            std::printf("FAIL: v3 encode/decode\n");
+            return 1;
+        }
+        if (dst.torus_id != src.torus_id || dst.timestamp != src.timestamp ||
+            dst.total_events_processed != src.total_events_processed ||
+            dst.boundary_states != src.boundary_states ||
+            dst.constraint_vector != src.constraint_vector ||
+            dst.bc_active_count != src.bc_active_count ||
+            dst.bc_cell_index != src.bc_cell_index ||
+            dst.bc_expected_state != src.bc_expected_state ||
+            dst.bc_tolerance != src.bc_tolerance ||
+            dst.heartbeat_timestamp != src.heartbeat_timestamp ||
+            dst.health_status != src.health_status ||
+            dst.num_processes != src.num_processes ||
+            dst.is_delta != src.is_delta ||
+            dst.boundary_generation != src.boundary_generation ||
+            dst.num_boundary_deltas != src.num_boundary_deltas ||
+            dst.state_hash != src.state_hash || !dst.verify()) {
+            std::printf("FAIL: v3 roundtrip mismatch\n");
+            return 1;
+        }
+        for (size_t i = 0; i < braided::ProjectionV3::NUM_GLOBAL_CONSTRAINTS;
+             i++) {
+            if (dst.global_constraints[i].type !=
+                    src.global_constraints[i].type ||
+                dst.global_constraints[i].expected_value !=
+                    src.global_constraints[i].expected_value) {
+                std::printf("FAIL: global constraint %zu mismatch\n", i);
+                return 1;
+            }
+        }
+        for (uint32_t i = 0; i < src.num_processes; i++) {
+            if (dst.processes[i].process_id != src.processes[i].process_id ||
+                dst.processes[i].x != src.processes[i].x ||
+                dst.processes[i].y != src.processes[i].y ||
+                dst.processes[i].z != src.processes[i].z ||
+                dst.processes[i].state != src.processes[i].state) {
+                std::printf("FAIL: process %u mismatch\n", i);
+                return 1;
+            }
+        }
+        std::printf("  [OK] v3 roundtrip (%zu bytes vs %zu raw)\n", n,
+                    sizeof(braided::ProjectionV3));
+        // 2. Compactness: a mostly-zero boundary must shrink the payload
+        // well below the in-memory struct
+        if (n >= sizeof(braided::ProjectionV3) / 4) {
+            std::printf("FAIL: packed payload not compact (%zu bytes)\n", n);
+            return 1;
+        }
+        std::printf("  [OK] sparse boundary compactness\n");
+    }
+
+    // 3. V1 roundtrip through its own encoder
+    {
+        static braided::ProjectionV3 ref;
+        static braided::Projection v1src, v1dst;
+        fillV3(ref);
+        std::memset(&v1src, 0, sizeof(v1src));
+        v1src.torus_id = ref.torus_id;
+        v1src.timestamp = ref.timestamp;
+        v1src.total_events_processed = ref.total_events_processed;
+        v1src.current_time = ref.current_time;
+        v1src.active_processes = ref.active_processes;
+        v1src.pending_events = ref.pending_events;
+        v1src.edge_count = ref.edge_count;
+        v1src.boundary_states = ref.boundary_states;
+        v1src.constraint_vector = ref.constraint_vector;
+        v1src.state_hash = v1src.computeHash();
+        const size_t n = braided::serializeWire(v1src, buf, sizeof(buf));
+        if (n == 0 || !braided::deserializeWire(buf, n, v1dst) ||
+            v1dst.boundary_states != v1src.boundary_states ||
+            v1dst.state_hash != v1src.state_hash || !v1dst.verify()) {
+            std::printf("FAIL: v1 roundtrip\n");
+            return 1;
+        }
+        std::printf("  [OK] v1 roundtrip\n");
+
+        // 4. Upgrade path: a V3 decoder fed the V1 payload fills the
+        // core and defaults the newer sections to inactive
+        static braided::ProjectionV3 up;
+        if (!braided::deserializeWire(buf, n, up) ||
+            up.boundary_states != v1src.boundary_states ||
+            up.bc_active_count != 0 ||
+            up.health_status != braided::ProjectionV3::HEALTHY ||
+            up.num_processes != 0 || up.is_delta != 0) {
+            std::printf("FAIL: v1 payload into v3 decoder\n");
+            return 1;
+        }
+        std::printf("  [OK] v1 payload -> v3 decoder\n");
+    }
+
+    // 5. Downgrade path: a V1 decoder fed a V3 payload reads the core
+    // section and ignores the tail
+    {
+        static braided::ProjectionV3 src;
+        static braided::Projection down;
+        fillV3(src);
+        const size_t n = braided::serializeWire(src, buf, sizeof(buf));
+        if (n == 0 || !braided::deserializeWire(buf, n, down) ||
+            down.torus_id != src.torus_id ||
+            down.boundary_states != src.boundary_states ||
+            down.constraint_vector != src.constraint_vector ||
+            down.state_hash != src.state_hash) {
+            std::printf("FAIL: v3 payload into v1 decoder\n");
+            return 1;
+        }
+        std::printf("  [OK] v3 payload -> v1 decoder\n");
+
+        // 6. V2 decoder on the same V3 payload recovers the constraint
+        // section through the delta-coded layout
+        static braided::ProjectionV2 mid;
+        if (!braided::deserializeWire(buf, n, mid) ||
+            mid.boundary_states != src.boundary_states ||
+            !mid.boundary_constraints[0].isActive() ||
+            mid.boundary_constraints[0].cell_index != src.bc_cell_index[0] ||
+            mid.boundary_constraints[0].expected_state !=
+                src.bc_expected_state[0] ||
+            mid.global_constraints[0].type !=
+                braided::ProjectionV2::GlobalConstraint::EVENT_CONSERVATION) {
+            std::printf("FAIL: v3 payload into v2 decoder\n");
+            return 1;
+        }
+        std::printf("  [OK] v3 payload -> v2 decoder\n");
+    }
+
+    // 7. Malformed input: truncation at any point and unknown versions
+    // are rejected, never read past the buffer
+    {
+        static braided::ProjectionV3 src, dst;
+        fillV3(src);
+        const size_t n = braided::serializeWire(src, buf, sizeof(buf));
+        for (size_t cut = 0; cut < n; cut += 17) {
+            if (braided::deserializeWire(buf, cut, dst)) {
+                std::printf("FAIL: accepted truncation at %zu\n", cut);
+                return 1;
+            }
+        }
+        const uint8_t saved = buf[0];
+        buf[0] = 0x7F;
+        if (braided::deserializeWire(buf, n, dst)) {
+            std::printf("FAIL: accepted unknown version\n");
+            return 1;
+        }
+        buf[0] = saved;
+
+        // Undersized encode buffer reports failure, not a partial write
+        if (braided::serializeWire(src, buf, 64) != 0) {
+            std::printf("FAIL: encode into undersized buffer\n");
+            return 1;
+        }
+        std::printf("  [OK] truncation and version rejection\n");
+    }
+
+    std::printf("All projection wire tests passed!\n");
+    return 0;
+}
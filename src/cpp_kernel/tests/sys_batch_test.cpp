@@ -0,0 +1,195 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/MemFS.h"
+#include "../os/VFS.h"
+#include "../os/FileDescriptor.h"
+#include "../os/PhysicalAllocator.h"
+#include "../os/TorusScheduler.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
+int main() {
+    std::cout << "[sys_batch Tests]" << std::endl;
+    auto require = [](bool ok, const char* msg) -> bool {
+        if (!ok) {
+            std::cerr << "  ✗ " << msg << std::endl;
+            return false;
+        }
+        return true;
+    };
+
+    alignas(os::PAGE_SIZE) std::array<uint8_t, 1 << 20> phys{};
+    os::PhysicalAllocator phys_alloc(reinterpret_cast<uint64_t>(phys.data()), phys.size());
+
+    os::MemFS memfs;
+    os::VFS vfs(&memfs);
+
+    os::TorusScheduler scheduler(0);
+    os::SyscallDispatcher dispatcher;
+    os::TorusContext ctx;
+    ctx.scheduler = &scheduler;
+    ctx.dispatcher = &dispatcher;
+    ctx.vfs = &vfs;
+    ctx.phys_alloc = &phys_alloc;
+    os::current_torus_context = &ctx;
+
+    os::OSProcess proc(1, 0, 0);
+    proc.initMemory(&phys_alloc);
+    scheduler.addProcess(&proc);
+    scheduler.tick();
+    assert(scheduler.getCurrentProcess() == &proc);
+
+    const char path[] = "batch.txt";
+    const char payload[] = "ring buffer payload";
+    uint64_t path_addr = proc.vmem->allocate(sizeof(path));
+    uint64_t data_addr = proc.vmem->allocate(4096);
+    if (!require(path_addr != 0 && data_addr != 0, "alloc user buffers")) {
+        return 1;
+    }
+    if (!require(proc.vmem->writeUser(path_addr, path, sizeof(path)), "write path")) {
+        return 1;
+    }
+    if (!require(proc.vmem->writeUser(data_addr, payload, sizeof(payload)), "write payload")) {
+        return 1;
+    }
+
+    // The file must exist before the batch reads it back
+    int64_t fd = os::syscall(os::SYS_OPEN, path_addr,
+                             os::O_CREAT | os::O_TRUNC | os::O_RDWR);
+    if (!require(fd >= 0, "open file")) {
+        return 1;
+    }
+
+    // Batch: write, rewind, read back, close — one submission pass
+    uint64_t read_addr = data_addr + 2048;
+    os::SyscallRecord records[4] = {};
+    records[0].number = os::SYS_WRITE;
+    records[0].args[0] = static_cast<uint64_t>(fd);
+    records[0].args[1] = data_addr;
+    records[0].args[2] = sizeof(payload);
+    records[0].user_data = 100;
+    records[1].number = os::SYS_LSEEK;
+    records[1].args[0] = static_cast<uint64_t>(fd);
+    records[1].args[1] = 0;
+    records[1].args[2] = SEEK_SET;
+    records[1].user_data = 101;
+    records[2].number = os::SYS_READ;
+    records[2].args[0] = static_cast<uint64_t>(fd);
+    records[2].args[1] = read_addr;
+    records[2].args[2] = sizeof(payload);
+    records[2].user_data = 102;
+    records[3].number = os::SYS_CLOSE;
+    records[3].args[0] = static_cast<uint64_t>(fd);
+    records[3].user_data = 103;
+
+    uint64_t records_addr = proc.vmem->allocate(sizeof(records));
+    uint64_t comps_addr = proc.vmem->allocate(4 * sizeof(os::SyscallCompletion));
+    if (!require(records_addr != 0 && comps_addr != 0, "alloc ring buffers")) {
+        return 1;
+    }
+    if (!require(proc.vmem->writeUser(records_addr, records, sizeof(records)),
+                 "write records")) {
+        return 1;
+    }
+
+    int64_t rc = os::syscall(os::SYS_BATCH, records_addr, 4, comps_addr);
+    if (!require(rc == 4, "batch completes all records")) {
+        return 1;
+    }
+
+    os::SyscallCompletion comps[4] = {};
+    if (!require(proc.vmem->readUser(comps, comps_addr, sizeof(comps)),
+                 "read completions")) {
+        return 1;
+    }
+    if (!require(comps[0].user_data == 100 &&
+                 comps[0].result == sizeof(payload), "write completion")) {
+        return 1;
+    }
+    if (!require(comps[1].user_data == 101 && comps[1].result == 0, "lseek completion")) {
+        return 1;
+    }
+    if (!require(comps[2].user_data == 102 &&
+                 comps[2].result == sizeof(payload), "read completion")) {
+        return 1;
+    }
+    if (!require(comps[3].user_data == 103 && comps[3].result == 0, "close completion")) {
+        return 1;
+    }
+
+    char roundtrip[sizeof(payload)] = {};
+    if (!require(proc.vmem->readUser(roundtrip, read_addr, sizeof(roundtrip)),
+                 "read roundtrip buffer")) {
+        return 1;
+    }
+    if (!require(std::memcmp(roundtrip, payload, sizeof(payload)) == 0,
+                 "payload survives batch roundtrip")) {
+        return 1;
+    }
+
+    // Process-control syscalls are rejected in a batch, not executed
+    os::SyscallRecord bad = {};
+    bad.number = os::SYS_EXIT;
+    bad.args[0] = 7;
+    bad.user_data = 200;
+    if (!require(proc.vmem->writeUser(records_addr, &bad, sizeof(bad)), "write exit record")) {
+        return 1;
+    }
+    rc = os::syscall(os::SYS_BATCH, records_addr, 1, comps_addr);
+    if (!require(rc == 1, "batch with rejected record still completes")) {
+        return 1;
+    }
+    os::SyscallCompletion bad_comp = {};
+    if (!require(proc.vmem->readUser(&bad_comp, comps_addr, sizeof(bad_comp)),
+                 "read rejection completion")) {
+        return 1;
+    }
+    if (!require(bad_comp.user_data == 200 && bad_comp.result == -EINVAL,
+                 "exit rejected with EINVAL")) {
+        return 1;
+    }
+    if (!require(!proc.isZombie(), "process not exited by rejected record")) {
+        return 1;
+    }
+
+    // Batches larger than the ring are processed in chunks
+    constexpr uint32_t kBig = os::SyscallDispatcher::BATCH_RING_ENTRIES + 8;
+    uint64_t big_records_addr = proc.vmem->allocate(kBig * sizeof(os::SyscallRecord));
+    uint64_t big_comps_addr = proc.vmem->allocate(kBig * sizeof(os::SyscallCompletion));
+    if (!require(big_records_addr != 0 && big_comps_addr != 0, "alloc big batch")) {
+        return 1;
+    }
+    for (uint32_t i = 0; i < kBig; ++i) {
+        os::SyscallRecord rec = {};
+        rec.number = os::SYS_GETPID;
+        rec.user_data = 1000 + i;
+        if (!proc.vmem->writeUser(big_records_addr + i * sizeof(rec), &rec, sizeof(rec))) {
+            return 1;
+        }
+    }
+    rc = os::syscall(os::SYS_BATCH, big_records_addr, kBig, big_comps_addr);
+    if (!require(rc == kBig, "oversized batch completes in chunks")) {
+        return 1;
+    }
+    os::SyscallCompletion last = {};
+    if (!require(proc.vmem->readUser(&last,
+                                     big_comps_addr + (kBig - 1) * sizeof(last),
+                                     sizeof(last)),
+                 "read last big completion")) {
+        return 1;
+    }
+    if (!require(last.user_data == 1000 + kBig - 1 && last.result == 1,
+                 "big batch ordering and results")) {
+        return 1;
+    }
+
+    std::cout << "  ✓ all tests passed" << std::endl;
+    return 0;
+}
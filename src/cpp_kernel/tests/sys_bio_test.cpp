@@ -0,0 +1,189 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/MemFS.h"
+#include "../os/VFS.h"
+#include "../os/FileDescriptor.h"
+#include "../os/PhysicalAllocator.h"
+#include "../os/TorusScheduler.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
+int main() {
+    std::cout << "[sys_bio Tests]" << std::endl;
+    auto require = [](bool ok, const char* msg) -> bool {
+        if (!ok) {
+            std::cerr << "  ✗ " << msg << std::endl;
+            return false;
+        }
+        return true;
+    };
+
+    alignas(os::PAGE_SIZE) std::array<uint8_t, 1 << 20> phys{};
+    os::PhysicalAllocator phys_alloc(reinterpret_cast<uint64_t>(phys.data()), phys.size());
+
+    os::rse_block_configure(512, 2048);
+    os::block_cache().reset(512);
+
+    os::MemFS memfs;
+    os::VFS vfs(&memfs);
+
+    os::TorusScheduler scheduler(0);
+    os::SyscallDispatcher dispatcher;
+    os::TorusContext ctx;
+    ctx.scheduler = &scheduler;
+    ctx.dispatcher = &dispatcher;
+    ctx.vfs = &vfs;
+    ctx.phys_alloc = &phys_alloc;
+    os::current_torus_context = &ctx;
+
+    os::OSProcess proc(1, 0, 0);
+    proc.initMemory(&phys_alloc);
+    scheduler.addProcess(&proc);
+    scheduler.tick();
+    assert(scheduler.getCurrentProcess() == &proc);
+
+    constexpr uint32_t kBlock = 512;
+    constexpr uint64_t kLba = 100;
+
+    // Submit an async write: the syscall returns an id immediately, the
+    // device is untouched until the completion path runs
+    uint8_t pattern[kBlock];
+    for (uint32_t i = 0; i < kBlock; ++i) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    uint64_t buf_addr = proc.vmem->allocate(kBlock);
+    if (!require(buf_addr != 0 &&
+                     proc.vmem->writeUser(buf_addr, pattern, kBlock),
+                 "stage write buffer")) {
+        return 1;
+    }
+    int64_t wid = os::syscall(os::SYS_BIO_SUBMIT, 1, kLba, buf_addr, kBlock);
+    if (!require(wid >= 1, "submit write")) {
+        return 1;
+    }
+    if (!require(os::block_io_queue().pending() == 1, "request pending")) {
+        return 1;
+    }
+
+    // Poll while in flight: the caller parks BLOCKED on the request's
+    // channel and the torus is free to run other work
+    int64_t rc = os::syscall(os::SYS_BIO_POLL, (uint64_t)wid, 0, 0);
+    if (!require(rc == -EAGAIN, "poll blocks while pending")) {
+        return 1;
+    }
+    if (!require(scheduler.getCurrentProcess() == nullptr,
+                 "submitter off the cpu")) {
+        return 1;
+    }
+
+    // Completion (idle-loop pump) executes the I/O and wakes the waiter
+    uint32_t completed = os::block_io_service();
+    if (!require(completed == 1, "service completes request")) {
+        return 1;
+    }
+    scheduler.tick();
+    if (!require(scheduler.getCurrentProcess() == &proc, "waiter rescheduled")) {
+        return 1;
+    }
+    rc = os::syscall(os::SYS_BIO_POLL, (uint64_t)wid, 0, 0);
+    if (!require(rc == 0, "write completion collected")) {
+        return 1;
+    }
+
+    // Async read brings the block back through the request's staging slot
+    uint64_t out_addr = proc.vmem->allocate(kBlock);
+    if (!require(out_addr != 0, "alloc read buffer")) {
+        return 1;
+    }
+    int64_t rid = os::syscall(os::SYS_BIO_SUBMIT, 0, kLba, 0, 0);
+    if (!require(rid >= 1 && rid != wid, "submit read")) {
+        return 1;
+    }
+    completed = os::block_io_service();
+    if (!require(completed == 1, "service read")) {
+        return 1;
+    }
+    rc = os::syscall(os::SYS_BIO_POLL, (uint64_t)rid, out_addr, kBlock);
+    if (!require(rc == (int64_t)kBlock, "read completion length")) {
+        return 1;
+    }
+    uint8_t out[kBlock];
+    if (!require(proc.vmem->readUser(out, out_addr, kBlock) &&
+                     std::memcmp(out, pattern, kBlock) == 0,
+                 "read data round-trips")) {
+        return 1;
+    }
+
+    // Partial-block write merges with the existing contents
+    const char tag[] = "merged-prefix";
+    uint64_t tag_addr = proc.vmem->allocate(sizeof(tag));
+    if (!require(tag_addr != 0 &&
+                     proc.vmem->writeUser(tag_addr, tag, sizeof(tag) - 1),
+                 "stage partial write")) {
+        return 1;
+    }
+    int64_t pid = os::syscall(os::SYS_BIO_SUBMIT, 1, kLba, tag_addr,
+                              sizeof(tag) - 1);
+    if (!require(pid >= 1, "submit partial write")) {
+        return 1;
+    }
+    (void)os::block_io_service();
+    rc = os::syscall(os::SYS_BIO_POLL, (uint64_t)pid, 0, 0);
+    if (!require(rc == 0, "partial write completes")) {
+        return 1;
+    }
+    rid = os::syscall(os::SYS_BIO_SUBMIT, 0, kLba, 0, 0);
+    (void)os::block_io_service();
+    rc = os::syscall(os::SYS_BIO_POLL, (uint64_t)rid, out_addr, kBlock);
+    if (!require(rc == (int64_t)kBlock &&
+                     proc.vmem->readUser(out, out_addr, kBlock) &&
+                     std::memcmp(out, tag, sizeof(tag) - 1) == 0 &&
+                     std::memcmp(out + sizeof(tag) - 1,
+                                 pattern + sizeof(tag) - 1,
+                                 kBlock - (sizeof(tag) - 1)) == 0,
+                 "partial write merged")) {
+        return 1;
+    }
+
+    // Error paths: bad op, unknown id, and a full request table
+    rc = os::syscall(os::SYS_BIO_SUBMIT, 7, kLba, buf_addr, kBlock);
+    if (!require(rc == -EINVAL, "bad op rejected")) {
+        return 1;
+    }
+    rc = os::syscall(os::SYS_BIO_POLL, 0x7FFFFFFF, 0, 0);
+    if (!require(rc == -EINVAL, "unknown id rejected")) {
+        return 1;
+    }
+    int64_t ids[os::BlockIOQueue::kMaxRequests];
+    for (uint32_t i = 0; i < os::BlockIOQueue::kMaxRequests; ++i) {
+        ids[i] = os::syscall(os::SYS_BIO_SUBMIT, 0, kLba + i, 0, 0);
+        if (!require(ids[i] >= 1, "fill request table")) {
+            return 1;
+        }
+    }
+    rc = os::syscall(os::SYS_BIO_SUBMIT, 0, kLba, 0, 0);
+    if (!require(rc == -EAGAIN, "full table backpressure")) {
+        return 1;
+    }
+    while (os::block_io_service() > 0) {
+    }
+    for (uint32_t i = 0; i < os::BlockIOQueue::kMaxRequests; ++i) {
+        rc = os::syscall(os::SYS_BIO_POLL, (uint64_t)ids[i], 0, 0);
+        if (!require(rc >= 0, "drain completions")) {
+            return 1;
+        }
+    }
+    if (!require(os::block_io_queue().pending() == 0, "table drained")) {
+        return 1;
+    }
+
+    std::cout << "  ✓ all tests passed" << std::endl;
+    return 0;
+}
@@ -1,10 +1,13 @@
 #include "../os/SyscallDispatcher.h"
+#include "../os/MemFS.h"
+#include "../os/VFS.h"
 #include "../os/PhysicalAllocator.h"
 #include "../os/TorusScheduler.h"
 
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
 namespace os {
@@ -55,6 +58,111 @@ int main() {
     rc = os::syscall(os::SYS_BRK, bad_brk);
     assert(rc == -os::ENOMEM);
 
+    // Anonymous mappings are demand paged: reserving 64 pages costs no
+    // frames, and the first touch materializes just the touched page
+    os::PhysicalAllocSnapshot before = phys_alloc.snapshot();
+    int64_t lazy_map = os::syscall(os::SYS_MMAP, 0, os::PAGE_SIZE * 64,
+                                   os::PROT_READ | os::PROT_WRITE);
+    assert(lazy_map > 0);
+    os::PhysicalAllocSnapshot reserved = phys_alloc.snapshot();
+    assert(reserved.free_frames == before.free_frames);
+
+    std::array<uint8_t, 64> pattern{};
+    for (uint32_t i = 0; i < pattern.size(); ++i) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+    uint64_t touch_addr = (uint64_t)lazy_map + os::PAGE_SIZE * 17;
+    bool touched = proc.vmem->writeUser(touch_addr, pattern.data(),
+                                        pattern.size());
+    assert(touched);
+    std::array<uint8_t, 64> readback{};
+    touched = proc.vmem->readUser(readback.data(), touch_addr,
+                                  readback.size());
+    assert(touched);
+    assert(readback == pattern);
+
+    // Protection changes apply to untouched demand pages too
+    rc = os::syscall(os::SYS_MPROTECT, (uint64_t)lazy_map, os::PAGE_SIZE,
+                     os::PROT_READ);
+    assert(rc == 0);
+    assert(!proc.vmem->validateUserRange((uint64_t)lazy_map, os::PAGE_SIZE,
+                                         /*write=*/true));
+
+    rc = os::syscall(os::SYS_MUNMAP, (uint64_t)lazy_map, os::PAGE_SIZE * 64);
+    assert(rc == 0);
+
+    // File-backed mapping over /persist with demand paging
+    os::rse_block_configure(512, 20000);
+    os::MemFS memfs;
+    os::VFS vfs(&memfs);
+    os::BlockFS bfs;
+    bool fs_ok = bfs.mount(512, os::rse_block_total_blocks());
+    assert(fs_ok);
+    vfs.setBlockFS(&bfs);
+    ctx.vfs = &vfs;
+
+    // Two pages of pattern plus a half page, so the mapping has an
+    // EOF tail that must read as zero
+    constexpr uint32_t kFileBytes = os::PAGE_SIZE * 2 + os::PAGE_SIZE / 2;
+    os::BlockFSEntry* entry = bfs.open("big.dat", true);
+    assert(entry != nullptr);
+    std::array<uint8_t, kFileBytes> file_data{};
+    for (uint32_t i = 0; i < kFileBytes; ++i) {
+        file_data[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+    int64_t put = bfs.write(entry, 0, file_data.data(), kFileBytes);
+    assert(put == (int64_t)kFileBytes);
+
+    const char path[] = "/persist/big.dat";
+    uint64_t path_addr = proc.vmem->allocate(sizeof(path));
+    bool staged = path_addr != 0 &&
+                  proc.vmem->writeUser(path_addr, path, sizeof(path));
+    assert(staged);
+    int64_t fd = os::syscall(os::SYS_OPEN, path_addr, os::O_RDONLY);
+    assert(fd >= 0);
+
+    int64_t file_map = os::syscall(os::SYS_MMAP, 0, os::PAGE_SIZE * 3,
+                                   os::PROT_READ, os::RSE_MAP_FILE,
+                                   (uint64_t)fd, 0);
+    assert(file_map > 0);
+
+    // Touching pages pulls the file through the block cache; untouched
+    // pages beyond EOF read as zero
+    std::array<uint8_t, os::PAGE_SIZE> page{};
+    bool read_ok = proc.vmem->readUser(page.data(), (uint64_t)file_map,
+                                       os::PAGE_SIZE);
+    assert(read_ok);
+    assert(std::memcmp(page.data(), file_data.data(), os::PAGE_SIZE) == 0);
+    read_ok = proc.vmem->readUser(page.data(),
+                                  (uint64_t)file_map + os::PAGE_SIZE * 2,
+                                  os::PAGE_SIZE);
+    assert(read_ok);
+    assert(std::memcmp(page.data(), file_data.data() + os::PAGE_SIZE * 2,
+                       os::PAGE_SIZE / 2) == 0);
+    for (uint32_t i = os::PAGE_SIZE / 2; i < os::PAGE_SIZE; ++i) {
+        assert(page[i] == 0);
+    }
+
+    // Offset mappings pick up mid-file, and a stale fd is rejected
+    int64_t off_map = os::syscall(os::SYS_MMAP, 0, os::PAGE_SIZE,
+                                  os::PROT_READ, os::RSE_MAP_FILE,
+                                  (uint64_t)fd, os::PAGE_SIZE);
+    assert(off_map > 0);
+    read_ok = proc.vmem->readUser(page.data(), (uint64_t)off_map,
+                                  os::PAGE_SIZE);
+    assert(read_ok);
+    assert(std::memcmp(page.data(), file_data.data() + os::PAGE_SIZE,
+                       os::PAGE_SIZE) == 0);
+    rc = os::syscall(os::SYS_MMAP, 0, os::PAGE_SIZE, os::PROT_READ,
+                     os::RSE_MAP_FILE, 99, 0);
+    assert(rc == -os::EBADF);
+
+    rc = os::syscall(os::SYS_MUNMAP, (uint64_t)file_map, os::PAGE_SIZE * 3);
+    assert(rc == 0);
+    rc = os::syscall(os::SYS_MUNMAP, (uint64_t)off_map, os::PAGE_SIZE);
+    assert(rc == 0);
+    (void)os::syscall(os::SYS_CLOSE, (uint64_t)fd);
+
     std::cout << "  ✓ all tests passed" << std::endl;
     return 0;
 }
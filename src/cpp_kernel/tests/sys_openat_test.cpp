@@ -0,0 +1,146 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/MemFS.h"
+#include "../os/VFS.h"
+#include "../os/FileDescriptor.h"
+#include "../os/FastPathDevice.h"
+#include "../os/PhysicalAllocator.h"
+#include "../os/TorusScheduler.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
+// The host's <errno.h> macros mangle os::-qualified error names (the
+// constants in os/Syscall.h are #ifndef-guarded mirrors of the same
+// values), so the expected codes are spelled locally
+constexpr int kErrNoEntry = 2;   // ENOENT
+constexpr int kErrNotDir = 20;   // ENOTDIR
+constexpr int kErrIsDir = 21;    // EISDIR
+
+int main() {
+    std::cout << "[sys_openat Tests]" << std::endl;
+    auto require = [](bool ok, const char* msg) -> bool {
+        if (!ok) {
+            std::cerr << "  ✗ " << msg << std::endl;
+            return false;
+        }
+        return true;
+    };
+
+    alignas(os::PAGE_SIZE) std::array<uint8_t, 1 << 20> phys{};
+    os::PhysicalAllocator phys_alloc(reinterpret_cast<uint64_t>(phys.data()), phys.size());
+
+    os::MemFS memfs;
+    os::VFS vfs(&memfs);
+    os::DeviceManager devices;
+    vfs.setDeviceManager(&devices);
+    os::Device* fastpath = os::create_fastpath_device("fastpath");
+    if (!require(fastpath && devices.registerDevice(fastpath), "register fastpath")) {
+        return 1;
+    }
+
+    os::TorusScheduler scheduler(0);
+    os::SyscallDispatcher dispatcher;
+    os::TorusContext ctx;
+    ctx.scheduler = &scheduler;
+    ctx.dispatcher = &dispatcher;
+    ctx.vfs = &vfs;
+    ctx.phys_alloc = &phys_alloc;
+    os::current_torus_context = &ctx;
+
+    os::OSProcess proc(1, 0, 0);
+    proc.initMemory(&phys_alloc);
+    scheduler.addProcess(&proc);
+    scheduler.tick();
+    assert(scheduler.getCurrentProcess() == &proc);
+
+    auto stage = [&](const char* str) -> uint64_t {
+        uint32_t len = (uint32_t)std::strlen(str) + 1;
+        uint64_t addr = proc.vmem->allocate(len);
+        if (!addr || !proc.vmem->writeUser(addr, str, len)) {
+            return 0;
+        }
+        return addr;
+    };
+
+    // A root directory descriptor anchors relative MemFS opens
+    uint64_t root_path = stage("/");
+    int64_t root_fd = os::syscall(os::SYS_OPEN, root_path, os::O_RDONLY);
+    if (!require(root_path && root_fd >= 0, "open root directory")) {
+        return 1;
+    }
+    uint64_t name_addr = stage("relat.txt");
+    int64_t fd = os::syscall(os::SYS_OPENAT, (uint64_t)root_fd, name_addr,
+                             os::O_CREAT | os::O_RDWR);
+    if (!require(name_addr && fd >= 0, "openat creates MemFS file")) {
+        return 1;
+    }
+    const char payload[] = "via-openat";
+    constexpr uint64_t kPayload = sizeof(payload) - 1;
+    uint64_t payload_addr = stage(payload);
+    int64_t wrote = os::syscall(os::SYS_WRITE, (uint64_t)fd, payload_addr, kPayload);
+    if (!require(wrote == (int64_t)kPayload, "write through relative fd")) {
+        return 1;
+    }
+    // The same file resolves through an absolute open
+    uint64_t abs_path = stage("relat.txt");
+    int64_t abs_fd = os::syscall(os::SYS_OPEN, abs_path, os::O_RDONLY);
+    uint64_t out_addr = proc.vmem->allocate(32);
+    char out[32] = {};
+    int64_t got = os::syscall(os::SYS_READ, (uint64_t)abs_fd, out_addr, kPayload);
+    if (!require(abs_fd >= 0 && got == (int64_t)kPayload &&
+                     proc.vmem->readUser(out, out_addr, kPayload) &&
+                     std::memcmp(out, payload, kPayload) == 0,
+                 "absolute open sees openat contents")) {
+        return 1;
+    }
+
+    // A /dev directory descriptor reaches device nodes by bare name
+    uint64_t dev_dir_path = stage("/dev");
+    int64_t dev_dir_fd = os::syscall(os::SYS_OPEN, dev_dir_path, os::O_RDONLY);
+    uint64_t dev_name = stage("fastpath");
+    int64_t dev_fd = os::syscall(os::SYS_OPENAT, (uint64_t)dev_dir_fd, dev_name,
+                                 os::O_RDWR);
+    if (!require(dev_dir_fd >= 0 && dev_fd >= 0, "openat device by name")) {
+        return 1;
+    }
+    wrote = os::syscall(os::SYS_WRITE, (uint64_t)dev_fd, payload_addr, kPayload);
+    got = os::syscall(os::SYS_READ, (uint64_t)dev_fd, out_addr, kPayload);
+    if (!require(wrote == (int64_t)kPayload && got == (int64_t)kPayload,
+                 "device roundtrip through relative fd")) {
+        return 1;
+    }
+
+    // An absolute name ignores the directory descriptor
+    uint64_t abs_dev = stage("/dev/fastpath");
+    int64_t rc = os::syscall(os::SYS_OPENAT, (uint64_t)root_fd, abs_dev,
+                             os::O_RDWR);
+    if (!require(rc >= 0, "absolute name bypasses dirfd")) {
+        return 1;
+    }
+
+    // Misuse: relative open on a non-directory, missing name, I/O on a
+    // directory descriptor
+    rc = os::syscall(os::SYS_OPENAT, (uint64_t)fd, dev_name, os::O_RDWR);
+    if (!require(rc == -kErrNotDir, "file fd rejected as dirfd")) {
+        return 1;
+    }
+    uint64_t missing = stage("no-such-device");
+    rc = os::syscall(os::SYS_OPENAT, (uint64_t)dev_dir_fd, missing, os::O_RDWR);
+    if (!require(rc == -kErrNoEntry, "missing name reports ENOENT")) {
+        return 1;
+    }
+    rc = os::syscall(os::SYS_READ, (uint64_t)root_fd, out_addr, 8);
+    if (!require(rc == -kErrIsDir, "read on directory rejected")) {
+        return 1;
+    }
+
+    std::cout << "  ✓ all tests passed" << std::endl;
+    return 0;
+}
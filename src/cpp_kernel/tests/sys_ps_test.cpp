@@ -57,6 +57,45 @@ int main() {
     int64_t bad_rc = os::syscall(os::SYS_PS, bad_addr, 64);
     assert(bad_rc == -EFAULT);
 
+#if RSE_SYSCALL_STATS_ENABLED
+    // The dispatcher accounts each call per process; ps names the top
+    // consumers with their counts
+    (void)os::syscall(os::SYS_GETPID);
+    (void)os::syscall(os::SYS_GETPID);
+    wrote = os::syscall(os::SYS_PS, buf_addr, 512);
+    assert(wrote > 0);
+    read_len = (wrote < (int64_t)(sizeof(out) - 1))
+        ? (size_t)wrote
+        : (sizeof(out) - 1);
+    ok = proc1.vmem->readUser(out, buf_addr, read_len);
+    assert(ok);
+    out[read_len] = '\0';
+    assert(std::strstr(out, "top=") != nullptr);
+    assert(std::strstr(out, "getpid:2") != nullptr);
+#endif
+
+    // vDSO fast path: same answers as the dispatcher, via plain loads
+    os::OSProcess* current = scheduler.getCurrentProcess();
+    assert(current != nullptr);
+    const os::VdsoInfoPage* info = os::vdso_info();
+    assert(info != nullptr);
+    assert(info->pid == current->pid);
+    assert(os::fast_getpid() == os::syscall(os::SYS_GETPID));
+    assert(os::fast_getppid() == os::syscall(os::SYS_GETPPID));
+    assert(info->process_count == scheduler.getProcessCount());
+
+    // The kernel refreshes the page every tick
+    uint32_t version_before = info->version;
+    scheduler.tick();
+    assert(os::vdso_info()->version > version_before);
+
+    // Userspace sees the page read-only but readable
+    assert(!current->vmem->validateUserRange(os::VDSO_BASE, sizeof(os::VdsoInfoPage), true));
+    assert(current->vmem->validateUserRange(os::VDSO_BASE, sizeof(os::VdsoInfoPage), false));
+    os::VdsoInfoPage copy = {};
+    assert(current->vmem->readUser(&copy, os::VDSO_BASE, sizeof(copy)));
+    assert(copy.pid == current->pid);
+
     std::cout << "  ✓ all tests passed" << std::endl;
     return 0;
 }
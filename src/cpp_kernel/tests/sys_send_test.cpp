@@ -0,0 +1,118 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/PhysicalAllocator.h"
+#include "../os/TorusScheduler.h"
+#include "../os/TorusChannel.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
+// The mesh is large (per-pair rings); keep it off the stack.
+static os::TorusMesh g_mesh;
+
+int main() {
+    std::cout << "[sys_send/sys_recv Tests]" << std::endl;
+
+    alignas(os::PAGE_SIZE) std::array<uint8_t, 1 << 20> phys{};
+    // One shared physical pool, as migration requires
+    os::PhysicalAllocator phys_alloc(reinterpret_cast<uint64_t>(phys.data()), phys.size());
+
+    os::TorusScheduler scheduler0(0);
+    os::TorusScheduler scheduler2(2);
+    os::SyscallDispatcher dispatcher0;
+    os::SyscallDispatcher dispatcher2;
+
+    os::TorusContext ctx0;
+    ctx0.scheduler = &scheduler0;
+    ctx0.dispatcher = &dispatcher0;
+    ctx0.phys_alloc = &phys_alloc;
+    ctx0.mesh = &g_mesh;
+    ctx0.torus_id = 0;
+
+    os::TorusContext ctx2;
+    ctx2.scheduler = &scheduler2;
+    ctx2.dispatcher = &dispatcher2;
+    ctx2.phys_alloc = &phys_alloc;
+    ctx2.mesh = &g_mesh;
+    ctx2.torus_id = 2;
+    ctx2.next_pid = 100;
+
+    os::OSProcess proc1(1, 0, 0);
+    os::OSProcess proc2(2, 0, 2);
+    proc1.initMemory(&phys_alloc);
+    proc2.initMemory(&phys_alloc);
+
+    os::current_torus_context = &ctx0;
+    scheduler0.addProcess(&proc1);
+    scheduler0.tick();
+    assert(scheduler0.getCurrentProcess() == &proc1);
+
+    os::current_torus_context = &ctx2;
+    scheduler2.addProcess(&proc2);
+    scheduler2.tick();
+    assert(scheduler2.getCurrentProcess() == &proc2);
+
+    // Send from torus 0 / pid 1 to torus 2 / pid 2
+    os::current_torus_context = &ctx0;
+    const char payload[] = "across the braid";
+    uint64_t send_buf = proc1.vmem->allocate(256);
+    assert(send_buf != 0);
+    assert(proc1.vmem->writeUser(send_buf, payload, sizeof(payload)));
+    int64_t sent = os::syscall(os::SYS_SEND, 2, 2, send_buf, sizeof(payload));
+    assert(sent == (int64_t)sizeof(payload));
+
+    // Oversized payloads and bogus tori are rejected up front
+    assert(os::syscall(os::SYS_SEND, 2, 2, send_buf, os::TORUS_MSG_MAX + 1) == -EINVAL);
+    assert(os::syscall(os::SYS_SEND, os::MAX_TORI, 2, send_buf, 4) == -EINVAL);
+
+    // Receive on torus 2
+    os::current_torus_context = &ctx2;
+    uint64_t recv_buf = proc2.vmem->allocate(256);
+    uint64_t src_pid_addr = proc2.vmem->allocate(sizeof(uint32_t));
+    assert(recv_buf != 0 && src_pid_addr != 0);
+    int64_t got = os::syscall(os::SYS_RECV, recv_buf, 256, src_pid_addr);
+    assert(got == (int64_t)sizeof(payload));
+
+    char out[64] = {};
+    assert(proc2.vmem->readUser(out, recv_buf, sizeof(payload)));
+    assert(std::strcmp(out, payload) == 0);
+    uint32_t src_pid = 0;
+    assert(proc2.vmem->readUser(&src_pid, src_pid_addr, sizeof(src_pid)));
+    assert(src_pid == 1);
+
+    // Mailbox drained: the next receive has nothing to deliver
+    assert(os::syscall(os::SYS_RECV, recv_buf, 256, 0) == -EAGAIN);
+
+    // dst_pid 0 delivers to whichever process is current on the target
+    os::current_torus_context = &ctx0;
+    assert(os::syscall(os::SYS_SEND, 2, 0, send_buf, 8) == 8);
+    os::current_torus_context = &ctx2;
+    assert(os::syscall(os::SYS_RECV, recv_buf, 256, 0) == 8);
+
+    // Migrate a ready process from torus 0 to torus 2
+    os::OSProcess proc3(3, 1, 0);
+    proc3.initMemory(&phys_alloc);
+    os::current_torus_context = &ctx0;
+    scheduler0.addProcess(&proc3);
+    assert(os::migrate_process(3, 2) == 0);
+    assert(scheduler0.findProcess(3) == nullptr);
+
+    os::current_torus_context = &ctx2;
+    os::drain_torus_mesh();
+    os::OSProcess* migrated = scheduler2.findProcess(3);
+    assert(migrated == &proc3);
+    assert(migrated->torus_id == 2);
+
+    // Migrating an unknown pid reports -ESRCH
+    os::current_torus_context = &ctx0;
+    assert(os::migrate_process(99, 2) == -ESRCH);
+
+    std::cout << "  ✓ all tests passed" << std::endl;
+    return 0;
+}
@@ -1,3 +1,13 @@
+#include "../os/SyscallDispatcher.h"
+#include "../os/VFS.h"
+#include "../os/MemFS.h"
+#include "../os/FileDescriptor.h"
+#include "../os/TorusScheduler.h"
+#include "../os/ConsoleDevice.h"
+#include "../os/LoopbackDevice.h"
+
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -7,6 +17,10 @@
 #include <sys/utsname.h>
 #include <sys/stat.h>
 
+namespace os {
+TorusContext* current_torus_context = nullptr;
+}
+
 // ANSI color codes for cyberpunk aesthetic
 #define RESET   "\033[0m"
 #define BOLD    "\033[1m"
@@ -95,6 +109,12 @@ void printHelp() {
     std::cout << MAGENTA << "│ " << CYAN << BOLD << "torus" << RESET << "     - Display torus status\n";
     std::cout << MAGENTA << "│ " << CYAN << BOLD << "perf" << RESET << "      - Show performance metrics\n";
     std::cout << MAGENTA << "│ " << CYAN << BOLD << "stat" << RESET << "      - Show file metadata\n";
+    std::cout << MAGENTA << "│ " << CYAN << BOLD << "echo" << RESET << "      - Print arguments\n";
+    std::cout << MAGENTA << "│ " << CYAN << BOLD << "jobs" << RESET << "      - List background jobs\n";
+    std::cout << MAGENTA << "│" << RESET << "\n";
+    std::cout << MAGENTA << "│ " << PURPLE << "Pipelines: " << RESET << "cmd1 | cmd2 | ...  with " << CYAN << "cat grep upper count" << RESET << "\n";
+    std::cout << MAGENTA << "│ " << PURPLE << "Background:" << RESET << " append " << CYAN << "&" << RESET << " to run across the tori while you type\n";
+    std::cout << MAGENTA << "│" << RESET << "\n";
     std::cout << MAGENTA << "│ " << CYAN << BOLD << "matrix" << RESET << "    - Enter the matrix (animation)\n";
     std::cout << MAGENTA << "│ " << CYAN << BOLD << "help" << RESET << "      - Show this help\n";
     std::cout << MAGENTA << "│ " << CYAN << BOLD << "clear" << RESET << "     - Clear screen\n";
@@ -174,12 +194,439 @@ void printMatrix() {
     std::cout << RESET;
 }
 
+// ─────────────────────────────────────────────────────────────────────
+// Pipeline engine
+//
+// Pipeline stages run as OSProcesses spread round-robin across three
+// torus schedulers, connected by the kernel's loopback pipe devices and
+// moved along through the syscall dispatcher (SYS_READ / SYS_WRITE /
+// SYS_SPLICE). A scheduler tick grants whichever stage it scheduled one
+// bounded I/O quantum, so stages genuinely interleave under the
+// schedulers' preemption instead of running to completion in sequence —
+// the shell exercises the process and IPC layers rather than driving
+// them serially. Trailing '&' detaches the pipeline as a background
+// job; jobs advance whenever the shell pumps the schedulers (each
+// prompt and the 'jobs' command).
+// ─────────────────────────────────────────────────────────────────────
+
+static constexpr int kNumTori = 3;
+static constexpr size_t kChunk = 256;
+
+static os::TorusScheduler* g_sched[kNumTori] = {nullptr, nullptr, nullptr};
+static os::SyscallDispatcher* g_dispatcher = nullptr;
+static os::TorusContext g_torus_ctx{};
+static os::MemFS* g_memfs = nullptr;
+static os::VFS* g_vfs = nullptr;
+static os::DeviceManager* g_dev_mgr = nullptr;
+static os::Device* g_console = nullptr;
+
+struct Stage {
+    os::OSProcess* proc = nullptr;
+    int torus = 0;
+    int in_fd = -1;
+    int out_fd = -1;
+    Stage* upstream = nullptr;
+    bool last = false;      // Final stage writes to the shell's stdout
+    bool done = false;
+
+    enum Kind { SOURCE, CAT, GREP, UPPER, COUNT } kind = SOURCE;
+    std::string arg;
+
+    std::string source_text;   // SOURCE: text still to emit
+    size_t source_off = 0;
+    std::string pending_out;   // Filters: output awaiting pipe space
+    std::string line_buf;      // Filters: partial input line
+    size_t line_count = 0;     // COUNT
+    bool eof_handled = false;
+};
+
+struct Job {
+    int id = 0;
+    std::string cmdline;
+    std::vector<Stage*> stages;
+    bool background = false;
+};
+
+static std::vector<Job> g_jobs;
+static int g_next_job_id = 1;
+
+// Boot the embedded torus world the pipelines run on: VFS + console
+// device shared by all stages, one scheduler per torus, one dispatcher
+void bootTorusWorld() {
+    g_memfs = new os::MemFS();
+    g_vfs = new os::VFS(g_memfs);
+    g_dev_mgr = new os::DeviceManager();
+    g_console = os::create_console_device();
+    g_dev_mgr->registerDevice(g_console);
+    g_vfs->setDeviceManager(g_dev_mgr);
+    for (int t = 0; t < kNumTori; t++) {
+        g_sched[t] = new os::TorusScheduler(static_cast<uint32_t>(t));
+    }
+    g_dispatcher = new os::SyscallDispatcher();
+    g_torus_ctx.scheduler = g_sched[0];
+    g_torus_ctx.dispatcher = g_dispatcher;
+    g_torus_ctx.vfs = g_vfs;
+    os::current_torus_context = &g_torus_ctx;
+}
+
+// Run a producing builtin with std::cout captured, so its output can be
+// fed into a pipe instead of the terminal
+std::string captureBuiltin(const std::string& cmd, const std::string& arg) {
+    std::ostringstream captured;
+    std::streambuf* saved = std::cout.rdbuf(captured.rdbuf());
+    if (cmd == "info") {
+        printSystemInfo();
+    } else if (cmd == "torus") {
+        printTorusStatus();
+    } else if (cmd == "perf" || cmd == "performance") {
+        printPerformance();
+    } else if (cmd == "help") {
+        printHelp();
+    } else if (cmd == "stat") {
+        printStat(arg);
+    } else if (cmd == "echo") {
+        std::cout << arg << "\n";
+    }
+    std::cout.rdbuf(saved);
+    return captured.str();
+}
+
+// Build one stage from its tokenized command; nullptr on unknown command
+Stage* makeStage(const std::vector<std::string>& tokens) {
+    if (tokens.empty()) {
+        return nullptr;
+    }
+    const std::string& cmd = tokens[0];
+    std::string arg;
+    for (size_t i = 1; i < tokens.size(); i++) {
+        if (!arg.empty()) {
+            arg += " ";
+        }
+        arg += tokens[i];
+    }
+
+    Stage* stage = new Stage();
+    if (cmd == "cat") {
+        stage->kind = Stage::CAT;
+    } else if (cmd == "grep") {
+        stage->kind = Stage::GREP;
+        stage->arg = arg;
+    } else if (cmd == "upper") {
+        stage->kind = Stage::UPPER;
+    } else if (cmd == "count") {
+        stage->kind = Stage::COUNT;
+    } else if (cmd == "info" || cmd == "torus" || cmd == "perf" ||
+               cmd == "performance" || cmd == "help" || cmd == "stat" ||
+               cmd == "echo") {
+        stage->kind = Stage::SOURCE;
+        stage->source_text = captureBuiltin(cmd, arg);
+    } else {
+        delete stage;
+        return nullptr;
+    }
+    return stage;
+}
+
+// Emit transformed output: the last stage goes straight to the shell's
+// terminal, inner stages queue for their downstream pipe
+void stageEmit(Stage& s, const std::string& text) {
+    if (s.last) {
+        std::cout << text;
+    } else {
+        s.pending_out += text;
+    }
+}
+
+void stageConsumeLine(Stage& s, const std::string& line) {
+    switch (s.kind) {
+        case Stage::GREP:
+            if (line.find(s.arg) != std::string::npos) {
+                stageEmit(s, line + "\n");
+            }
+            break;
+        case Stage::UPPER: {
+            std::string up = line;
+            std::transform(up.begin(), up.end(), up.begin(), [](unsigned char c) {
+                return static_cast<char>(std::toupper(c));
+            });
+            stageEmit(s, up + "\n");
+            break;
+        }
+        case Stage::COUNT:
+            s.line_count++;
+            break;
+        default:
+            break;
+    }
+}
+
+void finishStage(Stage& s) {
+    s.done = true;
+    g_sched[s.torus]->removeProcess(s.proc->pid);
+}
+
+// One bounded I/O quantum for the stage the scheduler just ran. The
+// stage's process is current on g_torus_ctx.scheduler, so the syscalls
+// below resolve against its descriptor table.
+void stageQuantum(Stage& s) {
+    switch (s.kind) {
+        case Stage::SOURCE: {
+            if (s.source_off < s.source_text.size()) {
+                const size_t n =
+                    std::min(kChunk, s.source_text.size() - s.source_off);
+                if (s.last) {
+                    std::cout.write(s.source_text.data() + s.source_off,
+                                    static_cast<std::streamsize>(n));
+                    s.source_off += n;
+                } else {
+                    const int64_t w = os::write(
+                        s.out_fd, s.source_text.data() + s.source_off, n);
+                    if (w > 0) {
+                        s.source_off += static_cast<size_t>(w);
+                    }
+                }
+            }
+            if (s.source_off >= s.source_text.size()) {
+                finishStage(s);
+            }
+            break;
+        }
+        case Stage::CAT: {
+            if (s.last) {
+                char buf[kChunk];
+                const int64_t r = os::read(s.in_fd, buf, sizeof(buf));
+                if (r > 0) {
+                    std::cout.write(buf, static_cast<std::streamsize>(r));
+                } else if (s.upstream && s.upstream->done) {
+                    finishStage(s);
+                }
+            } else {
+                // Kernel-side copy: bytes hop pipes without touching a
+                // stage buffer
+                const int64_t moved = os::splice(s.in_fd, s.out_fd, kChunk);
+                if (moved <= 0 && s.upstream && s.upstream->done) {
+                    finishStage(s);
+                }
+            }
+            break;
+        }
+        case Stage::GREP:
+        case Stage::UPPER:
+        case Stage::COUNT: {
+            // Backpressure first: drain queued output before reading more
+            if (!s.pending_out.empty()) {
+                const size_t n = std::min(kChunk, s.pending_out.size());
+                const int64_t w = os::write(s.out_fd, s.pending_out.data(), n);
+                if (w > 0) {
+                    s.pending_out.erase(0, static_cast<size_t>(w));
+                }
+                break;
+            }
+            if (s.eof_handled) {
+                finishStage(s);
+                break;
+            }
+            char buf[kChunk];
+            const int64_t r = os::read(s.in_fd, buf, sizeof(buf));
+            if (r > 0) {
+                for (int64_t i = 0; i < r; i++) {
+                    if (buf[i] == '\n') {
+                        stageConsumeLine(s, s.line_buf);
+                        s.line_buf.clear();
+                    } else {
+                        s.line_buf += buf[i];
+                    }
+                }
+            } else if (s.upstream && s.upstream->done) {
+                if (!s.line_buf.empty()) {
+                    stageConsumeLine(s, s.line_buf);
+                    s.line_buf.clear();
+                }
+                if (s.kind == Stage::COUNT) {
+                    stageEmit(s, std::to_string(s.line_count) + "\n");
+                }
+                s.eof_handled = true;
+                if (s.pending_out.empty()) {
+                    finishStage(s);
+                }
+            }
+            break;
+        }
+    }
+}
+
+bool jobFinished(const Job& job) {
+    for (const Stage* s : job.stages) {
+        if (!s->done) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// One tick per torus scheduler; whichever stage each scheduler elected
+// gets its quantum. Returns true while any job still has live stages.
+bool pumpSchedulers() {
+    bool live = false;
+    for (int t = 0; t < kNumTori; t++) {
+        g_torus_ctx.scheduler = g_sched[t];
+        g_sched[t]->tick();
+        os::OSProcess* current = g_sched[t]->getCurrentProcess();
+        if (!current) {
+            continue;
+        }
+        for (Job& job : g_jobs) {
+            for (Stage* s : job.stages) {
+                if (!s->done && s->proc == current) {
+                    stageQuantum(*s);
+                }
+            }
+        }
+    }
+    for (const Job& job : g_jobs) {
+        if (!jobFinished(job)) {
+            live = true;
+        }
+    }
+    return live;
+}
+
+// Retire finished jobs, announcing completed background ones
+void reapJobs() {
+    for (size_t i = 0; i < g_jobs.size();) {
+        if (!jobFinished(g_jobs[i])) {
+            i++;
+            continue;
+        }
+        if (g_jobs[i].background) {
+            std::cout << GREEN << "  [" << g_jobs[i].id << "] done: " << RESET
+                      << g_jobs[i].cmdline << "\n";
+        }
+        for (Stage* s : g_jobs[i].stages) {
+            delete s->proc;
+            delete s;
+        }
+        g_jobs.erase(g_jobs.begin() + static_cast<long>(i));
+    }
+}
+
+void printJobs() {
+    if (g_jobs.empty()) {
+        std::cout << DIM << "  No active jobs." << RESET << "\n\n";
+        return;
+    }
+    for (const Job& job : g_jobs) {
+        size_t running = 0;
+        for (const Stage* s : job.stages) {
+            if (!s->done) {
+                running++;
+            }
+        }
+        std::cout << CYAN << "  [" << job.id << "] " << RESET << job.cmdline
+                  << DIM << "  (" << running << "/" << job.stages.size()
+                  << " stages running)" << RESET << "\n";
+    }
+    std::cout << "\n";
+}
+
+// Parse and launch "cmd1 | cmd2 | ... [&]". Foreground pipelines pump
+// the schedulers to completion; background ones return to the prompt
+// immediately and advance on later pumps.
+void runPipeline(std::string line) {
+    bool background = false;
+    if (!line.empty() && line.back() == '&') {
+        background = true;
+        line.pop_back();
+    }
+
+    // Split stages on '|', tokenize each on whitespace
+    std::vector<Stage*> stages;
+    std::stringstream pipe_split(line);
+    std::string stage_text;
+    bool parse_ok = true;
+    while (std::getline(pipe_split, stage_text, '|')) {
+        std::stringstream tok(stage_text);
+        std::vector<std::string> tokens;
+        std::string word;
+        while (tok >> word) {
+            tokens.push_back(word);
+        }
+        Stage* stage = makeStage(tokens);
+        if (!stage) {
+            std::cout << RED << "  ✗ Unknown pipeline stage: " << RESET << BOLD
+                      << (tokens.empty() ? "(empty)" : tokens[0]) << RESET
+                      << "\n\n";
+            parse_ok = false;
+            break;
+        }
+        stages.push_back(stage);
+    }
+    if (!parse_ok || stages.empty()) {
+        for (Stage* s : stages) {
+            delete s;
+        }
+        return;
+    }
+
+    // One OSProcess per stage, spread across the torus schedulers
+    for (size_t i = 0; i < stages.size(); i++) {
+        Stage* s = stages[i];
+        s->torus = static_cast<int>(i) % kNumTori;
+        s->proc = new os::OSProcess(os::allocate_pid(), 0,
+                                    static_cast<uint32_t>(s->torus));
+        s->proc->fd_table.bindStandardDevices(g_console);
+        s->last = (i + 1 == stages.size());
+        if (i > 0) {
+            s->upstream = stages[i - 1];
+        }
+        g_sched[s->torus]->addProcess(s->proc);
+    }
+
+    // Adjacent stages share a loopback pipe device: writer end in the
+    // producer's descriptor table, reader end in the consumer's (the
+    // same device SYS_PIPE hands one process, split across two)
+    for (size_t i = 0; i + 1 < stages.size(); i++) {
+        os::Device* pipe_dev = os::create_loopback_device("pipe");
+        if (!pipe_dev) {
+            continue;
+        }
+        if (pipe_dev->open) {
+            pipe_dev->open(pipe_dev);
+        }
+        stages[i]->out_fd =
+            stages[i]->proc->fd_table.allocateDevice(pipe_dev, os::O_WRONLY);
+        stages[i + 1]->in_fd =
+            stages[i + 1]->proc->fd_table.allocateDevice(pipe_dev, os::O_RDONLY);
+    }
+
+    Job job;
+    job.id = g_next_job_id++;
+    job.cmdline = line;
+    job.stages = stages;
+    job.background = background;
+    g_jobs.push_back(job);
+
+    if (background) {
+        std::cout << CYAN << "  [" << job.id << "] started: " << RESET << line
+                  << "\n\n";
+        return;
+    }
+
+    // Foreground: pump every scheduler until the pipeline quiesces
+    const int kMaxRounds = 1000000;
+    for (int round = 0; round < kMaxRounds && pumpSchedulers(); round++) {
+    }
+    reapJobs();
+    std::cout << "\n";
+}
+
 void printPrompt() {
     std::cout << CYAN << "┌─[" << RESET << MAGENTA << BOLD << "braid" << RESET << CYAN << "@" << RESET << GREEN << BOLD << "future" << RESET << CYAN << "]" << RESET << "\n";
     std::cout << CYAN << "└─" << PURPLE << "▶" << RESET << " ";
 }
 
 int main() {
+    bootTorusWorld();
     clearScreen();
     printBanner();
     
@@ -189,6 +636,14 @@ int main() {
     std::string line;
     
     while (true) {
+        // Advance background jobs a bounded number of scheduler rounds per
+        // prompt so they make progress without delaying the shell
+        if (!g_jobs.empty()) {
+            for (int round = 0; round < 64 && pumpSchedulers(); round++) {
+            }
+            reapJobs();
+        }
+
         printPrompt();
         
         if (!std::getline(std::cin, line)) {
@@ -205,7 +660,10 @@ int main() {
         
         std::cout << "\n";
         
-        if (line == "exit" || line == "quit") {
+        if (line.find('|') != std::string::npos || line.back() == '&') {
+            runPipeline(line);
+        }
+        else if (line == "exit" || line == "quit") {
             std::cout << MAGENTA << "  Exiting BraidShell..." << RESET << "\n";
             std::cout << CYAN << "  Stay degen. Stay future. 🚀" << RESET << "\n\n";
             break;
@@ -228,6 +686,12 @@ int main() {
             path.erase(path.find_last_not_of(" \t") + 1);
             printStat(path);
         }
+        else if (line == "jobs") {
+            printJobs();
+        }
+        else if (line.rfind("echo ", 0) == 0) {
+            std::cout << "  " << line.substr(5) << "\n\n";
+        }
         else if (line == "clear") {
             clearScreen();
             printBanner();